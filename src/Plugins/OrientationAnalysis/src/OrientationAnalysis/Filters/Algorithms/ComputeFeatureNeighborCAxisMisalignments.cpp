@@ -60,7 +60,7 @@ Result<> ComputeFeatureNeighborCAxisMisalignments::operator()()
                 "skipped and a NAN value will be used instead."});
   }
 
-  auto& neighborList = m_DataStructure.getDataRefAs<NeighborList<int32>>(m_InputValues->NeighborListArrayPath);
+  const auto& neighborList = m_DataStructure.getDataRefAs<NeighborList<int32>>(m_InputValues->NeighborListArrayPath);
   const auto& featurePhases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeaturePhasesArrayPath);
   const auto& avgQuats = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->AvgQuatsArrayPath);
 
@@ -70,8 +70,13 @@ Result<> ComputeFeatureNeighborCAxisMisalignments::operator()()
   const usize totalFeatures = featurePhases.getNumberOfTuples();
   const usize numQuatComps = avgQuats.getNumberOfComponents();
 
-  std::vector<std::vector<float>> misalignmentLists;
-  misalignmentLists.resize(totalFeatures);
+  // Every misalignment list is as long as the neighbor list of its feature, so the lists are allocated once and written in place
+  std::vector<usize> listSizes(totalFeatures, 0);
+  for(usize i = 1; i < totalFeatures; i++)
+  {
+    listSizes[i] = neighborList.at(i).size();
+  }
+  cAxisMisalignmentList.allocateLists(listSizes);
 
   const Eigen::Vector3d cAxis{0.0, 0.0, 1.0};
   usize hexNeighborListSize = 0;
@@ -91,12 +96,12 @@ Result<> ComputeFeatureNeighborCAxisMisalignments::operator()()
     // normalize so that the dot product can be taken below without
     // dividing by the magnitudes (they would be 1)
     c1.normalize();
-    misalignmentLists[i].resize(neighborList[i].size(), -1.0f);
-    for(usize j = 0; j < neighborList[i].size(); j++)
+    const nonstd::span<float32> misalignments = cAxisMisalignmentList.getListSpan(i);
+    for(usize j = 0; j < neighborList.at(i).size(); j++)
     {
-      nName = neighborList[i][j];
+      nName = neighborList.at(i)[j];
       phase2 = crystalStructures[featurePhases[nName]];
-      hexNeighborListSize = neighborList[i].size();
+      hexNeighborListSize = neighborList.at(i).size();
       if(phase1 == phase2 && (phase1 == EbsdLib::CrystalStructure::Hexagonal_High || phase1 == EbsdLib::CrystalStructure::Hexagonal_Low))
       {
         const usize quatTupleIndex2 = nName * numQuatComps;
@@ -118,10 +123,10 @@ Result<> ComputeFeatureNeighborCAxisMisalignments::operator()()
           w = Constants::k_PiD - w;
         }
 
-        misalignmentLists[i][j] = static_cast<float32>(w * Constants::k_180OverPiD);
+        misalignments[j] = static_cast<float32>(w * Constants::k_180OverPiD);
         if(m_InputValues->FindAvgMisals)
         {
-          avgCAxisMisalignment[i] += misalignmentLists[i][j];
+          avgCAxisMisalignment[i] += misalignments[j];
         }
       }
       else
@@ -130,7 +135,7 @@ Result<> ComputeFeatureNeighborCAxisMisalignments::operator()()
         {
           hexNeighborListSize--;
         }
-        misalignmentLists[i][j] = NAN;
+        misalignments[j] = NAN;
       }
     }
     if(m_InputValues->FindAvgMisals)
@@ -147,13 +152,5 @@ Result<> ComputeFeatureNeighborCAxisMisalignments::operator()()
     }
   }
 
-  for(size_t i = 1; i < totalFeatures; i++)
-  {
-    // Set the vector for each list into the NeighborList Object
-    NeighborList<float>::SharedVectorType misaL(new std::vector<float>);
-    misaL->assign(misalignmentLists[i].begin(), misalignmentLists[i].end());
-    cAxisMisalignmentList.setList(static_cast<int32_t>(i), misaL);
-  }
-
   return result;
 }
@@ -48,7 +48,16 @@ Result<> ComputeMisorientations::operator()()
 
   size_t totalFeatures = inFeaturePhases.getNumberOfTuples();
 
-  std::vector<std::vector<float>> tempMisorientationLists(totalFeatures);
+  // Output Variables
+  // Every misorientation list is as long as the neighbor list of its feature, so the lists are allocated once and written in place
+  auto& outMisorientationList = m_DataStructure.getDataRefAs<NeighborList<float32>>(m_InputValues->MisorientationListArrayName);
+  std::vector<usize> listSizes(totalFeatures, 0);
+  for(size_t i = 1; i < totalFeatures; i++)
+  {
+    listSizes[i] = inNeighborList.at(i).size();
+  }
+  outMisorientationList.allocateLists(listSizes);
+
   usize quatIndex = 0;
   for(size_t i = 1; i < totalFeatures; i++)
   {
@@ -57,9 +66,8 @@ Result<> ComputeMisorientations::operator()()
     QuatF q1(inAvgQuats[quatIndex], inAvgQuats[quatIndex + 1], inAvgQuats[quatIndex + 2], inAvgQuats[quatIndex + 3]);
     uint32_t xtalType1 = inXtalStruct[inFeaturePhases[i]];
 
-    const NeighborList<int32_t>::VectorType& featureNeighborList = inNeighborList.getListReference(static_cast<int32_t>(i));
-
-    tempMisorientationLists[i].assign(featureNeighborList.size(), -1.0);
+    const nonstd::span<const int32> featureNeighborList = inNeighborList.at(static_cast<int32_t>(i));
+    const nonstd::span<float32> misorientations = outMisorientationList.getListSpan(i);
 
     for(size_t j = 0; j < featureNeighborList.size(); j++)
     {
@@ -72,10 +80,10 @@ Result<> ComputeMisorientations::operator()()
       {
         OrientationD axisAngle = orientationOps[xtalType1]->calculateMisorientation(q1, q2);
 
-        tempMisorientationLists[i][j] = static_cast<float>(axisAngle[3] * nx::core::Constants::k_180OverPiF);
+        misorientations[j] = static_cast<float>(axisAngle[3] * nx::core::Constants::k_180OverPiF);
         if(m_InputValues->ComputeAvgMisors)
         {
-          (*avgMisorientations)[i] += tempMisorientationLists[i][j];
+          (*avgMisorientations)[i] += misorientations[j];
         }
       }
       else
@@ -84,7 +92,7 @@ Result<> ComputeMisorientations::operator()()
         {
           tempMisoList--;
         }
-        tempMisorientationLists[i][j] = NAN;
+        misorientations[j] = NAN;
       }
     }
     if(m_InputValues->ComputeAvgMisors)
@@ -101,15 +109,5 @@ Result<> ComputeMisorientations::operator()()
     }
   }
 
-  // Output Variables
-  auto& outMisorientationList = m_DataStructure.getDataRefAs<NeighborList<float32>>(m_InputValues->MisorientationListArrayName);
-  // Set the vector for each list into the NeighborList Object
-  for(size_t i = 1; i < totalFeatures; i++)
-  {
-    // Construct a shared vector<float> through the std::vector<> copy constructor.
-    NeighborList<float>::SharedVectorType sharedMisorientationList(new std::vector<float>(tempMisorientationLists[i]));
-    outMisorientationList.setList(static_cast<int32_t>(i), sharedMisorientationList);
-  }
-
   return {};
 }
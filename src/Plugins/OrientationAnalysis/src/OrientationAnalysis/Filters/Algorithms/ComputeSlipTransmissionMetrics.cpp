@@ -39,12 +39,23 @@ Result<> ComputeSlipTransmissionMetrics::operator()()
 
   usize totalFeatures = featurePhases.getNumberOfTuples();
 
-  auto& neighborList = m_DataStructure.getDataRefAs<Int32NeighborList>(m_InputValues->NeighborListArrayPath);
+  const auto& neighborList = m_DataStructure.getDataRefAs<Int32NeighborList>(m_InputValues->NeighborListArrayPath);
 
-  std::vector<std::vector<float32>> F1Lists(totalFeatures);
-  std::vector<std::vector<float32>> F1sPtLists(totalFeatures);
-  std::vector<std::vector<float32>> F7Lists(totalFeatures);
-  std::vector<std::vector<float32>> mPrimeLists(totalFeatures);
+  auto& F1L = m_DataStructure.getDataRefAs<Float32NeighborList>(m_InputValues->F1ListArrayName);
+  auto& F1sptL = m_DataStructure.getDataRefAs<Float32NeighborList>(m_InputValues->F1sptListArrayName);
+  auto& F7L = m_DataStructure.getDataRefAs<Float32NeighborList>(m_InputValues->F7ListArrayName);
+  auto& mPrimeL = m_DataStructure.getDataRefAs<Float32NeighborList>(m_InputValues->mPrimeListArrayName);
+
+  // Every output list is as long as the neighbor list of its feature, so the lists are allocated once and written in place
+  std::vector<usize> listSizes(totalFeatures, 0);
+  for(usize i = 1; i < totalFeatures; i++)
+  {
+    listSizes[i] = neighborList.at(i).size();
+  }
+  F1L.allocateLists(listSizes);
+  F1sptL.allocateLists(listSizes);
+  F7L.allocateLists(listSizes);
+  mPrimeL.allocateLists(listSizes);
 
   float64 LD[3] = {0.0, 0.0, 1.0};
 
@@ -55,14 +66,14 @@ Result<> ComputeSlipTransmissionMetrics::operator()()
 
   for(usize i = 1; i < totalFeatures; i++)
   {
-    usize listLength = neighborList[i].size();
-    F1Lists[i].assign(listLength, 0.0f);
-    F1sPtLists[i].assign(listLength, 0.0f);
-    F7Lists[i].assign(listLength, 0.0f);
-    mPrimeLists[i].assign(listLength, 0.0f);
+    usize listLength = neighborList.at(i).size();
+    const nonstd::span<float32> F1List = F1L.getListSpan(i);
+    const nonstd::span<float32> F1sPtList = F1sptL.getListSpan(i);
+    const nonstd::span<float32> F7List = F7L.getListSpan(i);
+    const nonstd::span<float32> mPrimeList = mPrimeL.getListSpan(i);
     for(usize j = 0; j < listLength; j++)
     {
-      nName = neighborList[i][j];
+      nName = neighborList.at(i)[j];
       QuatD q1(avgQuats[i * 4], avgQuats[i * 4 + 1], avgQuats[i * 4 + 2], avgQuats[i * 4 + 3]);
       QuatD q2(avgQuats[nName * 4], avgQuats[nName * 4 + 1], avgQuats[nName * 4 + 2], avgQuats[nName * 4 + 3]);
 
@@ -88,33 +99,13 @@ Result<> ComputeSlipTransmissionMetrics::operator()()
         F1sPt = 0.0f;
         F7 = 0.0f;
       }
-      mPrimeLists[i][j] = mPrime;
-      F1Lists[i][j] = F1;
-      F1sPtLists[i][j] = F1sPt;
-      F7Lists[i][j] = F7;
+      mPrimeList[j] = mPrime;
+      F1List[j] = F1;
+      F1sPtList[j] = F1sPt;
+      F7List[j] = F7;
     }
   }
 
-  auto& F1L = m_DataStructure.getDataRefAs<Float32NeighborList>(m_InputValues->F1ListArrayName);
-  auto& F1sptL = m_DataStructure.getDataRefAs<Float32NeighborList>(m_InputValues->F1sptListArrayName);
-  auto& F7L = m_DataStructure.getDataRefAs<Float32NeighborList>(m_InputValues->F7ListArrayName);
-  auto& mPrimeL = m_DataStructure.getDataRefAs<Float32NeighborList>(m_InputValues->mPrimeListArrayName);
-
-  for(usize i = 1; i < totalFeatures; i++)
-  {
-    Float32NeighborList::SharedVectorType f1L(new std::vector<float32>(F1Lists[i]));
-    F1L.setList(static_cast<int32>(i), f1L);
-
-    Float32NeighborList::SharedVectorType f1sptL(new std::vector<float32>(F1sPtLists[i]));
-    F1sptL.setList(static_cast<int32>(i), f1sptL);
-
-    Float32NeighborList::SharedVectorType f7L(new std::vector<float32>(F7Lists[i]));
-    F7L.setList(static_cast<int32>(i), f7L);
-
-    Float32NeighborList::SharedVectorType primeL(new std::vector<float32>(mPrimeLists[i]));
-    mPrimeL.setList(static_cast<int32>(i), primeL);
-  }
-
   if(emitLaueClassWarning)
   {
     return MakeWarningVoidResult(-94739, fmt::format("A phase other then Cubic m-3m is being analyzed. This filter only works on Cubic m-3m Laue classes. Those phases have a result of 0.0."));
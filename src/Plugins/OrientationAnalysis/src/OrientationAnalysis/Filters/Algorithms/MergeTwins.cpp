@@ -4,106 +4,128 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
 #include "EbsdLib/Core/EbsdLibConstants.h"
 #include "EbsdLib/Core/Orientation.hpp"
 #include "EbsdLib/Core/Quaternion.hpp"
 
+#include <atomic>
 #include <random>
 
 using namespace nx::core;
 
-// -----------------------------------------------------------------------------
-MergeTwins::MergeTwins(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, MergeTwinsInputValues* inputValues)
-: m_DataStructure(dataStructure)
-, m_InputValues(inputValues)
-, m_ShouldCancel(shouldCancel)
-, m_MessageHandler(mesgHandler)
+namespace
 {
-  m_OrientationOps = LaueOps::GetAllOrientationOps();
-}
-
-// -----------------------------------------------------------------------------
-MergeTwins::~MergeTwins() noexcept = default;
-
-// -----------------------------------------------------------------------------
-int MergeTwins::getSeed(int32 newFid) const
+/**
+ * @brief The AssignCellParentIdsImpl class copies the parent id of each cell's feature into the
+ * cell parent ids while tracking the largest parent id that is referenced by any cell and which
+ * features own at least one cell.
+ */
+class AssignCellParentIdsImpl
 {
-  auto& phases = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeaturePhasesArrayPath)->getDataStoreRef();
-  auto& featureParentIds = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureParentIdsArrayPath)->getDataStoreRef();
-  auto& cellFeaturesAttMatrix = m_DataStructure.getDataRefAs<AttributeMatrix>(m_InputValues->NewCellFeatureAttributeMatrixPath);
-
-  auto numFeatures = static_cast<int32>(phases.getNumberOfTuples());
-
-  int32 seed = -1;
-
-  // Precalculate some constants
-  int32 totalFMinus1 = numFeatures - 1;
+public:
+  AssignCellParentIdsImpl(const Int32AbstractDataStore& featureIds, const Int32AbstractDataStore& featureParentIds, Int32AbstractDataStore& cellParentIds, std::atomic<int32>& maxParentId,
+                          std::vector<std::atomic<uint8>>& featureHasCells)
+  : m_FeatureIds(featureIds)
+  , m_FeatureParentIds(featureParentIds)
+  , m_CellParentIds(cellParentIds)
+  , m_MaxParentId(maxParentId)
+  , m_FeatureHasCells(featureHasCells)
+  {
+  }
 
-  usize counter = 0;
-  std::mt19937_64 generator(m_InputValues->Seed); // Standard mersenne_twister_engine seeded
-  std::uniform_real_distribution<float32> distribution(0, 1);
-  auto randFeature = static_cast<int32>(distribution(generator) * static_cast<float32>(totalFMinus1));
-  while(seed == -1 && counter < numFeatures)
+  void operator()(const Range& range) const
   {
-    if(randFeature > totalFMinus1)
+    int32 maxParentId = 0;
+    for(usize k = range.min(); k < range.max(); k++)
     {
-      randFeature = randFeature - numFeatures;
+      int32 featureId = m_FeatureIds[k];
+      int32 parentId = m_FeatureParentIds[featureId];
+      m_CellParentIds[k] = parentId;
+      m_FeatureHasCells[featureId].store(1, std::memory_order_relaxed);
+      maxParentId = std::max(maxParentId, parentId);
     }
-    if(featureParentIds[randFeature] == -1)
+    int32 currentMax = m_MaxParentId.load();
+    while(currentMax < maxParentId && !m_MaxParentId.compare_exchange_weak(currentMax, maxParentId))
     {
-      seed = randFeature;
     }
-    randFeature++;
-    counter++;
   }
-  if(seed >= 0)
+
+private:
+  const Int32AbstractDataStore& m_FeatureIds;
+  const Int32AbstractDataStore& m_FeatureParentIds;
+  Int32AbstractDataStore& m_CellParentIds;
+  std::atomic<int32>& m_MaxParentId;
+  std::vector<std::atomic<uint8>>& m_FeatureHasCells;
+};
+
+/**
+ * @brief The RemapCellParentIdsImpl class applies the shuffled parent id map to the cells
+ */
+class RemapCellParentIdsImpl
+{
+public:
+  RemapCellParentIdsImpl(const std::vector<int32>& parentIds, Int32AbstractDataStore& cellParentIds)
+  : m_ParentIds(parentIds)
+  , m_CellParentIds(cellParentIds)
   {
-    featureParentIds[seed] = newFid;
-    std::vector<usize> tDims(1, newFid + 1);
-    cellFeaturesAttMatrix.resizeTuples(tDims); // this will resize the active array as well
   }
-  return seed;
-}
+
+  void operator()(const Range& range) const
+  {
+    for(usize k = range.min(); k < range.max(); k++)
+    {
+      m_CellParentIds[k] = m_ParentIds[m_CellParentIds[k]];
+    }
+  }
+
+private:
+  const std::vector<int32>& m_ParentIds;
+  Int32AbstractDataStore& m_CellParentIds;
+};
+} // namespace
 
 // -----------------------------------------------------------------------------
-bool MergeTwins::determineGrouping(int32 referenceFeature, int32 neighborFeature, int32 newFid)
+MergeTwins::MergeTwins(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, MergeTwinsInputValues* inputValues)
+: GroupFeatures(shouldCancel, mesgHandler)
+, m_DataStructure(dataStructure)
+, m_InputValues(inputValues)
+, m_FeaturePhases(dataStructure.getDataRefAs<Int32Array>(inputValues->FeaturePhasesArrayPath).getDataStoreRef())
+, m_CrystalStructures(dataStructure.getDataRefAs<UInt32Array>(inputValues->CrystalStructuresArrayPath).getDataStoreRef())
+, m_AvgQuats(dataStructure.getDataRefAs<Float32Array>(inputValues->AvgQuatsArrayPath).getDataStoreRef())
+, m_AxisToleranceRad(inputValues->AxisTolerance * numbers::pi_v<float32> / 180.0f)
 {
-  auto& phases = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeaturePhasesArrayPath)->getDataStoreRef();
-  auto& featureParentIds = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureParentIdsArrayPath)->getDataStoreRef();
-  auto& crystalStructures = m_DataStructure.getDataAs<UInt32Array>(m_InputValues->CrystalStructuresArrayPath)->getDataStoreRef();
-  auto& avgQuats = m_DataStructure.getDataAs<Float32Array>(m_InputValues->AvgQuatsArrayPath)->getDataStoreRef();
-  auto axisToleranceRad = m_InputValues->AxisTolerance * numbers::pi_v<float32> / 180.0f;
+  m_OrientationOps = LaueOps::GetAllOrientationOps();
+}
 
-  bool twin = false;
+// -----------------------------------------------------------------------------
+MergeTwins::~MergeTwins() noexcept = default;
 
-  if(featureParentIds[neighborFeature] == -1 && phases[referenceFeature] > 0 && phases[neighborFeature] > 0)
+// -----------------------------------------------------------------------------
+bool MergeTwins::determineGrouping(int32 referenceFeature, int32 neighborFeature) const
+{
+  if(m_FeaturePhases[referenceFeature] <= 0 || m_FeaturePhases[neighborFeature] <= 0)
   {
-    uint32 phase1 = crystalStructures[phases[referenceFeature]];
-
-    QuatF q1(avgQuats[referenceFeature * 4], avgQuats[referenceFeature * 4 + 1], avgQuats[referenceFeature * 4 + 2], avgQuats[referenceFeature * 4 + 3]);
-    QuatF q2(avgQuats[neighborFeature * 4], avgQuats[neighborFeature * 4 + 1], avgQuats[neighborFeature * 4 + 2], avgQuats[neighborFeature * 4 + 3]);
+    return false;
+  }
 
-    uint32 phase2 = crystalStructures[phases[neighborFeature]];
-    if(phase1 == phase2 && (phase1 == EbsdLib::CrystalStructure::Cubic_High))
-    {
-      OrientationD axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
-      double w = axisAngle[3];
-      w *= (180.0f / numbers::pi);
-      double axisDiff111 = std::acos(std::fabs(axisAngle[0]) * 0.57735f + std::fabs(axisAngle[1]) * 0.57735f + fabs(axisAngle[2]) * 0.57735f);
-      double angDiff60 = std::fabs(w - 60.0f);
-      if(axisDiff111 < axisToleranceRad && angDiff60 < m_InputValues->AngleTolerance)
-      {
-        twin = true;
-      }
-      if(twin)
-      {
-        featureParentIds[neighborFeature] = newFid;
-        return true;
-      }
-    }
+  uint32 phase1 = m_CrystalStructures[m_FeaturePhases[referenceFeature]];
+  uint32 phase2 = m_CrystalStructures[m_FeaturePhases[neighborFeature]];
+  if(phase1 != phase2 || phase1 != EbsdLib::CrystalStructure::Cubic_High)
+  {
+    return false;
   }
-  return false;
+
+  QuatF q1(m_AvgQuats[referenceFeature * 4], m_AvgQuats[referenceFeature * 4 + 1], m_AvgQuats[referenceFeature * 4 + 2], m_AvgQuats[referenceFeature * 4 + 3]);
+  QuatF q2(m_AvgQuats[neighborFeature * 4], m_AvgQuats[neighborFeature * 4 + 1], m_AvgQuats[neighborFeature * 4 + 2], m_AvgQuats[neighborFeature * 4 + 3]);
+
+  OrientationD axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
+  double w = axisAngle[3];
+  w *= (180.0f / numbers::pi);
+  double axisDiff111 = std::acos(std::fabs(axisAngle[0]) * 0.57735f + std::fabs(axisAngle[1]) * 0.57735f + fabs(axisAngle[2]) * 0.57735f);
+  double angDiff60 = std::fabs(w - 60.0f);
+  return axisDiff111 < m_AxisToleranceRad && angDiff60 < m_InputValues->AngleTolerance;
 }
 
 // -----------------------------------------------------------------------------
@@ -131,38 +153,26 @@ Result<> MergeTwins::operator()()
     }
   }
 
-  featureParentIds[0] = 0; // set feature 0 to be parent 0
-
-  { // This code used to be in GroupFeatures Superclass
-    auto& contNeighborList = m_DataStructure.getDataRefAs<NeighborList<int32>>(m_InputValues->ContiguousNeighborListArrayPath);
+  auto& cellFeaturesAttMatrix = m_DataStructure.getDataRefAs<AttributeMatrix>(m_InputValues->NewCellFeatureAttributeMatrixPath);
+  auto& contNeighborList = m_DataStructure.getDataRefAs<NeighborList<int32>>(m_InputValues->ContiguousNeighborListArrayPath);
 
-    int32 parentCount = 1;
-    int32 seed = getSeed(parentCount);
-    int32 neigh;
-    while(seed >= 0)
-    {
-      std::vector<int32> groupList = {seed};
-      for(std::vector<int32>::size_type j = 0; j < groupList.size(); j++)
-      {
-        int32 firstFeature = groupList[j];
-        auto list1size = static_cast<int32>(contNeighborList[firstFeature].size());
-        for(int32 l = 0; l < list1size; l++)
-        {
-          neigh = contNeighborList[firstFeature][l];
-          if(neigh != firstFeature)
-          {
-            if(determineGrouping(firstFeature, neigh, parentCount))
-            {
-              groupList.push_back(neigh);
-            }
-          }
-        }
-      }
+  // Parents are numbered starting from a seeded random feature so the numbering matches the
+  // classic seed based region growing.
+  auto numFeatures = static_cast<int32>(featureParentIds.getNumberOfTuples());
+  std::mt19937_64 generator(m_InputValues->Seed); // Standard mersenne_twister_engine seeded
+  std::uniform_real_distribution<float32> distribution(0, 1);
+  auto seedStart = static_cast<usize>(distribution(generator) * static_cast<float32>(numFeatures - 1));
 
-      parentCount++;
-      seed = getSeed(parentCount);
-    }
+  Result<int32> groupResult = GroupFeatures::execute(contNeighborList, seedStart, featureParentIds);
+  if(groupResult.invalid())
+  {
+    return MergeResults(result, ConvertResult(std::move(groupResult)));
+  }
+  if(m_ShouldCancel)
+  {
+    return result;
   }
+  cellFeaturesAttMatrix.resizeTuples({static_cast<usize>(groupResult.value())}); // this will resize the active array as well
 
   usize totalFeatures = active.getNumberOfTuples();
   if(totalFeatures < 2)
@@ -171,18 +181,16 @@ Result<> MergeTwins::operator()()
         result, ConvertResult(MakeErrorResult<OutputActions>(-23501, "The number of grouped Features was 0 or 1 which means no grouped Features were detected. A grouping value may be set too high")));
   }
 
-  int32 numParents = 0;
   usize totalPoints = featureIds.getNumberOfTuples();
-  for(usize k = 0; k < totalPoints; k++)
+  std::atomic<int32> maxParentId(0);
+  std::vector<std::atomic<uint8>> featureHasCells(featureParentIds.getNumberOfTuples());
   {
-    int32 featureName = featureIds[k];
-    cellParentIds[k] = featureParentIds[featureName];
-    if(featureParentIds[featureName] > numParents)
-    {
-      numParents = featureParentIds[featureName];
-    }
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, totalPoints);
+    dataAlg.requireStoresInMemory({&featureIds, &featureParentIds, &cellParentIds});
+    dataAlg.execute(AssignCellParentIdsImpl(featureIds, featureParentIds, cellParentIds, maxParentId, featureHasCells));
   }
-  numParents += 1;
+  int32 numParents = maxParentId.load() + 1;
 
   // Randomize the feature Ids for purely visual clarify. Having random Feature Ids
   // allows users visualizing the data to better discern each grain otherwise the coloring
@@ -210,10 +218,19 @@ Result<> MergeTwins::operator()()
 
     m_MessageHandler({IFilter::Message::Type::Info, "Adjusting Feature Ids Array...."});
     // Now adjust all the Feature ID values for each Voxel
-    for(usize i = 0; i < totalPoints; ++i)
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, totalPoints);
+    dataAlg.requireStoresInMemory({&cellParentIds});
+    dataAlg.execute(RemapCellParentIdsImpl(parentIds, cellParentIds));
+
+    // Keep the feature level parent ids consistent with the cells. Features without any cells
+    // keep their unshuffled parent id, as they always have.
+    for(usize i = 0; i < featureParentIds.getNumberOfTuples(); ++i)
     {
-      cellParentIds[i] = parentIds[cellParentIds[i]];
-      featureParentIds[featureIds[i]] = cellParentIds[i];
+      if(featureHasCells[i].load(std::memory_order_relaxed) != 0)
+      {
+        featureParentIds[i] = parentIds[featureParentIds[i]];
+      }
     }
   }
 
@@ -3,9 +3,11 @@
 #include "OrientationAnalysis/OrientationAnalysis_export.hpp"
 
 #include "EbsdLib/LaueOps/LaueOps.h"
+#include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataPath.hpp"
 #include "simplnx/DataStructure/DataStructure.hpp"
 #include "simplnx/Filter/IFilter.hpp"
+#include "simplnx/Utilities/GroupFeatures.hpp"
 
 namespace nx::core
 {
@@ -28,11 +30,11 @@ struct ORIENTATIONANALYSIS_EXPORT MergeTwinsInputValues
 /**
  * @class
  */
-class ORIENTATIONANALYSIS_EXPORT MergeTwins
+class ORIENTATIONANALYSIS_EXPORT MergeTwins : public GroupFeatures
 {
 public:
   MergeTwins(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, MergeTwinsInputValues* inputValues);
-  ~MergeTwins() noexcept;
+  ~MergeTwins() noexcept override;
 
   MergeTwins(const MergeTwins&) = delete;
   MergeTwins(MergeTwins&&) noexcept = delete;
@@ -43,16 +45,17 @@ public:
 
   const std::atomic_bool& getCancel();
 
-  int getSeed(int32 newFid) const;
-  bool determineGrouping(int32 referenceFeature, int32 neighborFeature, int32 newFid);
+  bool determineGrouping(int32 referenceFeature, int32 neighborFeature) const override;
 
 private:
   DataStructure& m_DataStructure;
   const MergeTwinsInputValues* m_InputValues = nullptr;
-  const std::atomic_bool& m_ShouldCancel;
-  const IFilter::MessageHandler& m_MessageHandler;
 
   std::vector<LaueOps::Pointer> m_OrientationOps;
+  const Int32AbstractDataStore& m_FeaturePhases;
+  const UInt32AbstractDataStore& m_CrystalStructures;
+  const Float32AbstractDataStore& m_AvgQuats;
+  float32 m_AxisToleranceRad = 0.0f;
 };
 
 } // namespace nx::core
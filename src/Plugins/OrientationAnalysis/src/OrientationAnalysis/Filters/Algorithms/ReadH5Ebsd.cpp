@@ -11,6 +11,8 @@
 #include "simplnx/Filter/IFilter.hpp"
 #include "simplnx/Parameters/ChoicesParameter.hpp"
 #include "simplnx/Parameters/VectorParameter.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/Parsing/HDF5/Readers/FileReader.hpp"
 
 #include "EbsdLib/Core/EbsdLibConstants.h"
 #include "EbsdLib/Core/EbsdMacros.h"
@@ -20,6 +22,8 @@
 #include "EbsdLib/IO/TSL/AngFields.h"
 #include "EbsdLib/IO/TSL/H5AngVolumeReader.h"
 
+#include <future>
+
 namespace
 {
 // Parameter Keys
@@ -125,12 +129,272 @@ void CopyData(nx::core::DataStructure& dataStructure, H5EbsdReaderType* ebsdRead
   }
 }
 
+/**
+ * @brief Returns true if every selected dataset of every slice in the requested range holds
+ * exactly one full XY plane of the volume. Slices that are smaller than the volume need to be
+ * centered into the volume which only the EbsdLib volume reader knows how to do.
+ */
+bool CanAssembleBySlice(const nx::core::HDF5::FileReader& fileReader, const nx::core::ReadH5EbsdInputValues* mInputValues, const std::vector<std::string>& datasetNames, size_t sliceSize)
+{
+  if(!fileReader.isValid())
+  {
+    return false;
+  }
+  for(int32_t slice = mInputValues->startSlice; slice <= mInputValues->endSlice; slice++)
+  {
+    nx::core::HDF5::GroupReader dataGroup = fileReader.openGroup(std::to_string(slice)).openGroup(EbsdLib::H5Ebsd::Data);
+    if(!dataGroup.isValid())
+    {
+      return false;
+    }
+    for(const auto& datasetName : datasetNames)
+    {
+      nx::core::HDF5::DatasetReader datasetReader = dataGroup.openDataset(datasetName);
+      if(!datasetReader.isValid() || datasetReader.getNumElements() != sliceSize)
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Reads one slice dataset into the XY plane at 'zIndex' of the destination array. In-memory
+ * stores are read directly into their buffer at the plane offset; any other store is read through
+ * the reusable 'scratch' buffer.
+ */
+template <typename T>
+nx::core::Result<> ReadSliceIntoArray(const nx::core::HDF5::GroupReader& dataGroup, const std::string& datasetName, nx::core::DataArray<T>& destination, size_t zIndex, size_t sliceSize,
+                                      std::vector<T>& scratch)
+{
+  nx::core::HDF5::DatasetReader datasetReader = dataGroup.openDataset(datasetName);
+  auto& destinationStore = destination.getDataStoreRef();
+  auto* inMemoryStore = dynamic_cast<nx::core::DataStore<T>*>(&destinationStore);
+  if(inMemoryStore != nullptr)
+  {
+    return datasetReader.readIntoSpan(nonstd::span<T>(inMemoryStore->data() + zIndex * sliceSize, sliceSize));
+  }
+
+  scratch.resize(sliceSize);
+  nx::core::Result<> result = datasetReader.readIntoSpan(nonstd::span<T>(scratch));
+  if(result.invalid())
+  {
+    return result;
+  }
+  std::copy(scratch.begin(), scratch.end(), destinationStore.begin() + zIndex * sliceSize);
+  return {};
+}
+
+/**
+ * @brief The three Euler angle planes of a single slice as they are stored in the file
+ */
+struct EulerSliceBuffer
+{
+  std::vector<float> euler0;
+  std::vector<float> euler1;
+  std::vector<float> euler2;
+};
+
+/**
+ * @brief The ConvertEulerSliceImpl class interleaves the Euler angle planes of one slice into the
+ * destination array while applying the degree to radian conversion and the Oxford hexagonal
+ * reference frame correction.
+ */
+class ConvertEulerSliceImpl
+{
+public:
+  ConvertEulerSliceImpl(const EulerSliceBuffer& buffer, nx::core::Float32Array& eulerData, const nx::core::Int32Array* phaseData, const nx::core::UInt32Array& xtalData, size_t sliceOffset,
+                        float degToRad, bool applyHexCorrection)
+  : m_Buffer(buffer)
+  , m_EulerData(eulerData)
+  , m_PhaseData(phaseData)
+  , m_XtalData(xtalData)
+  , m_SliceOffset(sliceOffset)
+  , m_DegToRad(degToRad)
+  , m_ApplyHexCorrection(applyHexCorrection)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    for(size_t planeIndex = start; planeIndex < end; planeIndex++)
+    {
+      const size_t elementIndex = m_SliceOffset + planeIndex;
+      float euler2 = m_Buffer.euler2[planeIndex] * m_DegToRad;
+      // THIS IS ONLY TO BRING OXFORD DATA INTO THE SAME HEX REFERENCE AS EDAX HEX REFERENCE
+      if(m_ApplyHexCorrection && m_XtalData[(*m_PhaseData)[elementIndex]] == EbsdLib::CrystalStructure::Hexagonal_High)
+      {
+        euler2 = euler2 + (30.0F * m_DegToRad);
+      }
+      m_EulerData[3 * elementIndex] = m_Buffer.euler0[planeIndex] * m_DegToRad;
+      m_EulerData[3 * elementIndex + 1] = m_Buffer.euler1[planeIndex] * m_DegToRad;
+      m_EulerData[3 * elementIndex + 2] = euler2;
+    }
+  }
+
+  void operator()(const nx::core::Range& range) const
+  {
+    convert(range.min(), range.max());
+  }
+
+private:
+  const EulerSliceBuffer& m_Buffer;
+  nx::core::Float32Array& m_EulerData;
+  const nx::core::Int32Array* m_PhaseData = nullptr;
+  const nx::core::UInt32Array& m_XtalData;
+  size_t m_SliceOffset = 0;
+  float m_DegToRad = 1.0F;
+  bool m_ApplyHexCorrection = false;
+};
+
+/**
+ * @brief AssembleVolumeBySlice reads the selected arrays slice by slice straight from the H5Ebsd
+ * file into their final location in the DataStructure, bypassing the intermediate volume buffers
+ * of the EbsdLib volume reader. The Euler angle conversion of slice k runs in the background while
+ * slice k+1 is being read so that the import is bound by the HDF5 I/O.
+ * @return Result<> holding the errors of the HDF5 read that failed, if any. An empty Result is
+ * returned as soon as the filter is cancelled.
+ */
+nx::core::Result<> AssembleVolumeBySlice(const nx::core::HDF5::FileReader& fileReader, const nx::core::ReadH5EbsdInputValues* mInputValues, nx::core::DataStructure& dataStructure,
+                                         const std::vector<std::string>& eulerNames, const std::set<std::string>& selectedArrayNames, const std::array<size_t, 3>& dcDims,
+                                         const std::vector<std::string>& floatArrayNames, const std::vector<std::string>& intArrayNames, const std::string& manufacturer, uint32_t refFrameZDir,
+                                         const nx::core::IFilter::MessageHandler& mMessageHandler, const std::atomic_bool& shouldCancel)
+{
+  const nx::core::DataPath& cellAttributeMatrixPath = mInputValues->cellAttributeMatrixPath;
+  const size_t sliceSize = dcDims[0] * dcDims[1];
+  const size_t numSlices = dcDims[2];
+
+  nx::core::DataPath xtalDataPath = mInputValues->cellEnsembleMatrixPath.createChildPath(EbsdLib::EnsembleData::CrystalStructures);
+  const auto& xtalData = dataStructure.getDataRefAs<nx::core::UInt32Array>(xtalDataPath);
+
+  nx::core::Int32Array* phaseDataArrayPtr = nullptr;
+  if(selectedArrayNames.find(eulerNames[3]) != selectedArrayNames.end())
+  {
+    phaseDataArrayPtr = dataStructure.getDataAs<nx::core::Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::H5Ebsd::Phases));
+  }
+
+  nx::core::Float32Array* eulerDataPtr = nullptr;
+  if(selectedArrayNames.find(EbsdLib::CellData::EulerAngles) != selectedArrayNames.end())
+  {
+    eulerDataPtr = dataStructure.getDataAs<nx::core::Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::CellData::EulerAngles));
+  }
+
+  float degToRad = 1.0f;
+  if(mInputValues->eulerRepresentation != EbsdLib::AngleRepresentation::Radians && mInputValues->useRecommendedTransform)
+  {
+    degToRad = nx::core::numbers::pi_v<float> / 180.0F;
+  }
+  const bool applyHexCorrection = manufacturer == EbsdLib::Ctf::Manufacturer && phaseDataArrayPtr != nullptr;
+
+  std::vector<float> floatScratch;
+  std::vector<int32_t> intScratch;
+  // Two Euler buffers are used in a ping-pong fashion: one is being filled from the file while the
+  // other one is being converted into the destination array.
+  std::array<EulerSliceBuffer, 2> eulerBuffers;
+  std::future<void> pendingConversion;
+
+  nx::core::Result<> result;
+  for(size_t slice = 0; slice < numSlices; slice++)
+  {
+    if(shouldCancel)
+    {
+      if(pendingConversion.valid())
+      {
+        pendingConversion.get();
+      }
+      return {};
+    }
+    mMessageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, fmt::format("Reading slice {}/{}", slice + 1, numSlices)});
+
+    const size_t zIndex = refFrameZDir == EbsdLib::RefFrameZDir::LowtoHigh ? slice : (numSlices - 1) - slice;
+    nx::core::HDF5::GroupReader dataGroup = fileReader.openGroup(std::to_string(slice + mInputValues->startSlice)).openGroup(EbsdLib::H5Ebsd::Data);
+
+    if(phaseDataArrayPtr != nullptr)
+    {
+      result = ReadSliceIntoArray<int32_t>(dataGroup, eulerNames[3], *phaseDataArrayPtr, zIndex, sliceSize, intScratch);
+      if(result.invalid())
+      {
+        break;
+      }
+    }
+    for(const auto& arrayName : floatArrayNames)
+    {
+      if(selectedArrayNames.find(arrayName) != selectedArrayNames.end())
+      {
+        auto& destination = dataStructure.getDataRefAs<nx::core::Float32Array>(cellAttributeMatrixPath.createChildPath(arrayName));
+        result = ReadSliceIntoArray<float>(dataGroup, arrayName, destination, zIndex, sliceSize, floatScratch);
+        if(result.invalid())
+        {
+          break;
+        }
+      }
+    }
+    for(const auto& arrayName : intArrayNames)
+    {
+      if(selectedArrayNames.find(arrayName) != selectedArrayNames.end() && result.valid())
+      {
+        auto& destination = dataStructure.getDataRefAs<nx::core::Int32Array>(cellAttributeMatrixPath.createChildPath(arrayName));
+        result = ReadSliceIntoArray<int32_t>(dataGroup, arrayName, destination, zIndex, sliceSize, intScratch);
+      }
+    }
+    if(result.invalid())
+    {
+      break;
+    }
+
+    if(eulerDataPtr != nullptr)
+    {
+      EulerSliceBuffer& eulerBuffer = eulerBuffers[slice % 2];
+      eulerBuffer.euler0.resize(sliceSize);
+      eulerBuffer.euler1.resize(sliceSize);
+      eulerBuffer.euler2.resize(sliceSize);
+      for(const auto& [eulerName, eulerPlane] : {std::make_pair(eulerNames[0], &eulerBuffer.euler0), std::make_pair(eulerNames[1], &eulerBuffer.euler1),
+                                                 std::make_pair(eulerNames[2], &eulerBuffer.euler2)})
+      {
+        result = dataGroup.openDataset(eulerName).readIntoSpan(nonstd::span<float>(*eulerPlane));
+        if(result.invalid())
+        {
+          break;
+        }
+      }
+      if(result.invalid())
+      {
+        break;
+      }
+
+      // The previous conversion owns the other buffer, it has to finish before that buffer is refilled
+      if(pendingConversion.valid())
+      {
+        pendingConversion.get();
+      }
+      pendingConversion = std::async(std::launch::async, [&eulerBuffer, eulerDataPtr, phaseDataArrayPtr, &xtalData, zIndex, sliceSize, degToRad, applyHexCorrection]() {
+        nx::core::ParallelDataAlgorithm dataAlg;
+        dataAlg.setRange(0, sliceSize);
+        dataAlg.requireArraysInMemory({eulerDataPtr, phaseDataArrayPtr});
+        dataAlg.execute(ConvertEulerSliceImpl(eulerBuffer, *eulerDataPtr, phaseDataArrayPtr, xtalData, zIndex * sliceSize, degToRad, applyHexCorrection));
+      });
+    }
+  }
+
+  if(pendingConversion.valid())
+  {
+    pendingConversion.get();
+  }
+  if(result.invalid())
+  {
+    return nx::core::MergeResults(std::move(result), nx::core::MakeErrorResult(-50004, fmt::format("Error reading slice data from H5Ebsd file '{}'.", mInputValues->inputFilePath)));
+  }
+  return {};
+}
+
 /**
  * @brief LoadEbsdData
  * @param mInputValues
  * @param dataStructure
  * @param eulerNames
  * @param mMessageHandler
+ * @param shouldCancel
  * @param selectedArrayNames
  * @param dcDims
  * @param floatArrays
@@ -139,7 +403,8 @@ void CopyData(nx::core::DataStructure& dataStructure, H5EbsdReaderType* ebsdRead
  */
 template <typename H5EbsdReaderType, typename PhaseType>
 nx::core::Result<> LoadEbsdData(const nx::core::ReadH5EbsdInputValues* mInputValues, nx::core::DataStructure& dataStructure, const std::vector<std::string>& eulerNames,
-                                const nx::core::IFilter::MessageHandler& mMessageHandler, std::set<std::string> selectedArrayNames, const std::array<size_t, 3>& dcDims,
+                                const nx::core::IFilter::MessageHandler& mMessageHandler, const std::atomic_bool& shouldCancel, std::set<std::string> selectedArrayNames,
+                                const std::array<size_t, 3>& dcDims,
                                 const std::vector<std::string>& floatArrayNames, const std::vector<std::string>& intArrayNames)
 {
   int32_t err = 0;
@@ -172,6 +437,26 @@ nx::core::Result<> LoadEbsdData(const nx::core::ReadH5EbsdInputValues* mInputVal
   mMessageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, fmt::format("Reading EBSD Data from file {}", mInputValues->inputFilePath)});
   uint32_t mRefFrameZDir = ebsdReader->getStackingOrder();
 
+  // Prefer reading each slice directly into the DataStructure. This avoids holding a second copy
+  // of the whole volume in the EbsdLib reader.
+  {
+    std::vector<std::string> datasetNames;
+    for(const auto& arrayName : selectedArrayNames)
+    {
+      if(std::find(eulerNames.begin(), eulerNames.end(), arrayName) != eulerNames.end() || std::find(floatArrayNames.begin(), floatArrayNames.end(), arrayName) != floatArrayNames.end() ||
+         std::find(intArrayNames.begin(), intArrayNames.end(), arrayName) != intArrayNames.end())
+      {
+        datasetNames.push_back(arrayName);
+      }
+    }
+    nx::core::HDF5::FileReader fileReader(mInputValues->inputFilePath);
+    if(CanAssembleBySlice(fileReader, mInputValues, datasetNames, dcDims[0] * dcDims[1]))
+    {
+      return AssembleVolumeBySlice(fileReader, mInputValues, dataStructure, eulerNames, selectedArrayNames, dcDims, floatArrayNames, intArrayNames, manufacturer, mRefFrameZDir, mMessageHandler,
+                                   shouldCancel);
+    }
+  }
+
   ebsdReader->setSliceStart(mInputValues->startSlice);
   ebsdReader->setSliceEnd(mInputValues->endSlice);
   ebsdReader->readAllArrays(false);
@@ -305,22 +590,32 @@ Result<> ReadH5Ebsd::operator()()
     std::vector<std::string> eulerPhaseArrays = {EbsdLib::Ang::Phi1, EbsdLib::Ang::Phi, EbsdLib::Ang::Phi2, EbsdLib::Ang::PhaseData};
     std::vector<std::string> floatArrays = {EbsdLib::Ang::ImageQuality, EbsdLib::Ang::ConfidenceIndex, EbsdLib::Ang::SEMSignal, EbsdLib::Ang::Fit, EbsdLib::Ang::XPosition, EbsdLib::Ang::YPosition};
     std::vector<std::string> intArrays = {};
-    Result<> result = LoadEbsdData<H5AngVolumeReader, AngPhase>(m_InputValues, m_DataStructure, eulerPhaseArrays, m_MessageHandler, mSelectedArrayNames, dcDims, floatArrays, intArrays);
+    Result<> result =
+        LoadEbsdData<H5AngVolumeReader, AngPhase>(m_InputValues, m_DataStructure, eulerPhaseArrays, m_MessageHandler, m_ShouldCancel, mSelectedArrayNames, dcDims, floatArrays, intArrays);
     if(result.invalid())
     {
       return result;
     }
+    if(m_ShouldCancel)
+    {
+      return {};
+    }
   }
   else if(manufacturer == EbsdLib::Ctf::Manufacturer)
   {
     std::vector<std::string> eulerPhaseArrays = {EbsdLib::Ctf::Euler1, EbsdLib::Ctf::Euler2, EbsdLib::Ctf::Euler3, EbsdLib::Ctf::Phase};
     std::vector<std::string> floatArrays = {EbsdLib::Ctf::MAD, EbsdLib::Ctf::X, EbsdLib::Ctf::Y};
     std::vector<std::string> intArrays = {EbsdLib::Ctf::Bands, EbsdLib::Ctf::Error, EbsdLib::Ctf::BC, EbsdLib::Ctf::BS};
-    Result<> result = LoadEbsdData<H5CtfVolumeReader, CtfPhase>(m_InputValues, m_DataStructure, eulerPhaseArrays, m_MessageHandler, mSelectedArrayNames, dcDims, floatArrays, intArrays);
+    Result<> result =
+        LoadEbsdData<H5CtfVolumeReader, CtfPhase>(m_InputValues, m_DataStructure, eulerPhaseArrays, m_MessageHandler, m_ShouldCancel, mSelectedArrayNames, dcDims, floatArrays, intArrays);
     if(result.invalid())
     {
       return result;
     }
+    if(m_ShouldCancel)
+    {
+      return {};
+    }
   }
   else
   {
@@ -168,6 +168,12 @@ std::any OEMEbsdScanSelectionParameter::defaultValue() const
   return m_DefaultValue;
 }
 
+//-----------------------------------------------------------------------------
+std::vector<std::filesystem::path> OEMEbsdScanSelectionParameter::inputPaths(const std::any& valueRef) const
+{
+  return {GetAnyRef<ValueType>(valueRef).inputFilePath};
+}
+
 //-----------------------------------------------------------------------------
 Result<> OEMEbsdScanSelectionParameter::validate(const std::any& valueRef) const
 {
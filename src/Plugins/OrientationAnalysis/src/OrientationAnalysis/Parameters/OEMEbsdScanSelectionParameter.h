@@ -105,6 +105,13 @@ public:
    */
   Result<> validate(const std::any& value) const override;
 
+  /**
+   * @brief Returns the EBSD file that the scans are read from.
+   * @param value
+   * @return std::vector<std::filesystem::path>
+   */
+  std::vector<std::filesystem::path> inputPaths(const std::any& value) const override;
+
   /**
    * @brief Returns all of the valid extension types that can be used.
    * @return
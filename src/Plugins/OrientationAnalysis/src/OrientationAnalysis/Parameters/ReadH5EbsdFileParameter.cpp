@@ -195,6 +195,12 @@ std::any ReadH5EbsdFileParameter::defaultValue() const
   return m_DefaultValue;
 }
 
+//-----------------------------------------------------------------------------
+std::vector<std::filesystem::path> ReadH5EbsdFileParameter::inputPaths(const std::any& valueRef) const
+{
+  return {GetAnyRef<ValueType>(valueRef).inputFilePath};
+}
+
 //-----------------------------------------------------------------------------
 Result<> ReadH5EbsdFileParameter::validate(const std::any& valueRef) const
 {
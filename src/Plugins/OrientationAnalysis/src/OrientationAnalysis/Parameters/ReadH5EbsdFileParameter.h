@@ -85,6 +85,13 @@ public:
    */
   Result<> validate(const std::any& value) const override;
 
+  /**
+   * @brief Returns the .h5ebsd file that is read.
+   * @param value
+   * @return std::vector<std::filesystem::path>
+   */
+  std::vector<std::filesystem::path> inputPaths(const std::any& value) const override;
+
 protected:
   /**
    * @brief
@@ -7,10 +7,15 @@
 #include "OrientationAnalysisTestUtils.hpp"
 
 #include "simplnx/Core/Application.hpp"
+#include "simplnx/DataStructure/AttributeMatrix.hpp"
+#include "simplnx/DataStructure/NeighborList.hpp"
 #include "simplnx/Parameters/ArrayCreationParameter.hpp"
 #include "simplnx/Parameters/Dream3dImportParameter.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
 
+#include "EbsdLib/Core/EbsdLibConstants.h"
+
+#include <cmath>
 #include <filesystem>
 
 namespace fs = std::filesystem;
@@ -249,3 +254,87 @@ TEST_CASE("Reconstruction::MergeTwinsFilter: Valid Execution", "[Reconstruction]
     REQUIRE(activeNumComps == 1);
   }
 }
+
+TEST_CASE("OrientationAnalysis::MergeTwinsFilter: Small Fixture", "[OrientationAnalysis][MergeTwinsFilter]")
+{
+  // Feature 1 and its Sigma 3 twin (feature 2) touch feature 3, which is misoriented 30 degrees about [001].
+  // Feature 4 has no cells and no neighbors.
+  const DataPath cellDataPath({"Cell Data"});
+  const DataPath featureDataPath({"CellFeatureData"});
+  const DataPath ensembleDataPath({"CellEnsembleData"});
+  const DataPath featureIdsPath = cellDataPath.createChildPath(k_FeatureIds);
+  const DataPath phasesPath = featureDataPath.createChildPath(k_Phases);
+  const DataPath avgQuatsPath = featureDataPath.createChildPath("AvgQuats");
+  const DataPath neighborListPath = featureDataPath.createChildPath("NeighborList");
+  const DataPath crystalStructuresPath = ensembleDataPath.createChildPath(k_CrystalStructures);
+
+  DataStructure dataStructure;
+  auto* cellData = AttributeMatrix::Create(dataStructure, cellDataPath.getTargetName(), {6});
+  auto* featureData = AttributeMatrix::Create(dataStructure, featureDataPath.getTargetName(), {5});
+  auto* ensembleData = AttributeMatrix::Create(dataStructure, ensembleDataPath.getTargetName(), {2});
+
+  auto& featureIds = UnitTest::CreateTestDataArray<int32>(dataStructure, k_FeatureIds, {6}, {1}, cellData->getId())->getDataStoreRef();
+  const std::vector<int32> cellFeatures = {1, 1, 2, 2, 3, 3};
+  std::copy(cellFeatures.begin(), cellFeatures.end(), featureIds.begin());
+
+  auto& phases = UnitTest::CreateTestDataArray<int32>(dataStructure, k_Phases, {5}, {1}, featureData->getId())->getDataStoreRef();
+  phases.fill(1);
+  phases[0] = 0;
+
+  const float32 twinComp = 0.5f / std::sqrt(3.0f);
+  const std::vector<float32> quats = {0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, twinComp, twinComp, twinComp, 0.8660254f, 0.0f, 0.0f, 0.2588190f, 0.9659258f, 0.0f, 0.0f, 0.0f, 1.0f};
+  auto& avgQuats = UnitTest::CreateTestDataArray<float32>(dataStructure, "AvgQuats", {5}, {4}, featureData->getId())->getDataStoreRef();
+  std::copy(quats.begin(), quats.end(), avgQuats.begin());
+
+  auto* neighborList = NeighborList<int32>::Create(dataStructure, "NeighborList", 5, featureData->getId());
+  const std::vector<std::pair<int32, int32>> neighborPairs = {{1, 2}, {1, 3}, {2, 3}};
+  for(const auto& [first, second] : neighborPairs)
+  {
+    neighborList->addEntry(first, second);
+    neighborList->addEntry(second, first);
+  }
+  neighborList->resizeTuples(5);
+
+  auto& crystalStructures = UnitTest::CreateTestDataArray<uint32>(dataStructure, k_CrystalStructures, {2}, {1}, ensembleData->getId())->getDataStoreRef();
+  crystalStructures[0] = EbsdLib::CrystalStructure::UnknownCrystalStructure;
+  crystalStructures[1] = EbsdLib::CrystalStructure::Cubic_High;
+
+  MergeTwinsFilter filter;
+  Arguments args;
+  args.insertOrAssign(MergeTwinsFilter::k_UseSeed_Key, std::make_any<bool>(true));
+  args.insertOrAssign(MergeTwinsFilter::k_SeedValue_Key, std::make_any<uint64>(5489));
+  args.insertOrAssign(MergeTwinsFilter::k_SeedArrayName_Key, std::make_any<std::string>("MergeTwins SeedValue"));
+  args.insertOrAssign(MergeTwinsFilter::k_ContiguousNeighborListArrayPath_Key, std::make_any<DataPath>(neighborListPath));
+  args.insertOrAssign(MergeTwinsFilter::k_AxisTolerance_Key, std::make_any<float32>(3.0f));
+  args.insertOrAssign(MergeTwinsFilter::k_AngleTolerance_Key, std::make_any<float32>(2.0f));
+  args.insertOrAssign(MergeTwinsFilter::k_FeaturePhasesArrayPath_Key, std::make_any<DataPath>(phasesPath));
+  args.insertOrAssign(MergeTwinsFilter::k_AvgQuatsArrayPath_Key, std::make_any<DataPath>(avgQuatsPath));
+  args.insertOrAssign(MergeTwinsFilter::k_CellFeatureIdsArrayPath_Key, std::make_any<DataPath>(featureIdsPath));
+  args.insertOrAssign(MergeTwinsFilter::k_CrystalStructuresArrayPath_Key, std::make_any<DataPath>(crystalStructuresPath));
+  args.insertOrAssign(MergeTwinsFilter::k_CellParentIdsArrayName_Key, std::make_any<std::string>("ParentIds"));
+  args.insertOrAssign(MergeTwinsFilter::k_CreatedFeatureAttributeMatrixName_Key, std::make_any<std::string>("NewGrain Data"));
+  args.insertOrAssign(MergeTwinsFilter::k_FeatureParentIdsArrayName_Key, std::make_any<std::string>("ParentIds"));
+  args.insertOrAssign(MergeTwinsFilter::k_ActiveArrayName_Key, std::make_any<std::string>("Active"));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+
+  // Parent 0 plus the twin pair, feature 3 and feature 4
+  const auto& active = dataStructure.getDataRefAs<BoolArray>(DataPath({"NewGrain Data", "Active"}));
+  REQUIRE(active.getNumberOfTuples() == 4);
+
+  const auto& cellParentIds = dataStructure.getDataRefAs<Int32Array>(cellDataPath.createChildPath("ParentIds"));
+  const auto& featureParentIds = dataStructure.getDataRefAs<Int32Array>(featureDataPath.createChildPath("ParentIds"));
+  REQUIRE(cellParentIds[0] == cellParentIds[2]);
+  REQUIRE(cellParentIds[0] != cellParentIds[4]);
+  for(usize i = 0; i < cellFeatures.size(); i++)
+  {
+    REQUIRE(cellParentIds[i] == featureParentIds[cellFeatures[i]]);
+  }
+  // A feature without cells keeps the parent id the grouping assigned it
+  REQUIRE(featureParentIds[4] >= 1);
+  REQUIRE(featureParentIds[4] < 4);
+}
@@ -7,6 +7,10 @@
 #include "simplnx/Parameters/Dream3dImportParameter.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
 
+#include "EbsdLib/IO/H5EbsdVolumeInfo.h"
+#include "EbsdLib/IO/TSL/AngFields.h"
+#include "EbsdLib/IO/TSL/H5AngVolumeReader.h"
+
 #include <catch2/catch.hpp>
 
 using namespace nx::core;
@@ -149,3 +153,83 @@ TEST_CASE("OrientationAnalysis::ReadH5Ebsd: Valid filter execution", "[Orientati
     }
   }
 }
+
+TEST_CASE("OrientationAnalysis::ReadH5Ebsd: Slice assembly matches EbsdLib volume reader", "[OrientationAnalysis][ReadH5Ebsd]")
+{
+  const nx::core::UnitTest::TestFileSentinel testDataSentinel(nx::core::unit_test::k_CMakeExecutable, nx::core::unit_test::k_TestFilesDir, "Small_IN100_h5ebsd.tar.gz", "Small_IN100.h5ebsd");
+
+  Application::GetOrCreateInstance()->loadPlugins(unit_test::k_BuildDir.view(), true);
+
+  const std::string inputFilePath = fmt::format("{}/Small_IN100.h5ebsd", unit_test::k_TestFilesDir);
+  // A sub range of slices in degrees without the recommended transformations so the arrays can be
+  // compared value for value against the EbsdLib volume reader
+  const int32 startSlice = 10;
+  const int32 endSlice = 30;
+
+  DataStructure dataStructure;
+  {
+    ReadH5EbsdFilter filter;
+    Arguments args;
+
+    ReadH5EbsdFileParameter::ValueType h5ebsdParamVal;
+    h5ebsdParamVal.inputFilePath = inputFilePath;
+    h5ebsdParamVal.startSlice = startSlice;
+    h5ebsdParamVal.endSlice = endSlice;
+    h5ebsdParamVal.eulerRepresentation = EbsdLib::AngleRepresentation::Degrees;
+    h5ebsdParamVal.selectedArrayNames = {EbsdLib::Ang::ConfidenceIndex, EbsdLib::CellData::EulerAngles, EbsdLib::Ang::ImageQuality, EbsdLib::H5Ebsd::Phases};
+    h5ebsdParamVal.useRecommendedTransform = false;
+
+    args.insertOrAssign(ReadH5EbsdFilter::k_ReadH5EbsdParameter_Key, std::make_any<ReadH5EbsdFileParameter::ValueType>(h5ebsdParamVal));
+    args.insertOrAssign(ReadH5EbsdFilter::k_CreatedImageGeometryPath_Key, std::make_any<DataPath>(Constants::k_DataContainerPath));
+    args.insertOrAssign(ReadH5EbsdFilter::k_CellAttributeMatrixName_Key, std::make_any<std::string>(Constants::k_CellData));
+    args.insertOrAssign(ReadH5EbsdFilter::k_CellEnsembleAttributeMatrixName_Key, std::make_any<std::string>(Constants::k_EnsembleAttributeMatrix));
+
+    auto preflightResult = filter.preflight(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+  }
+
+  H5EbsdVolumeInfo::Pointer volumeInfoReader = H5EbsdVolumeInfo::New();
+  volumeInfoReader->setFileName(inputFilePath);
+  REQUIRE(volumeInfoReader->readVolumeInfo() >= 0);
+  std::array<int64_t, 3> dims = {0, 0, 0};
+  std::array<float, 3> res = {0.0f, 0.0f, 0.0f};
+  volumeInfoReader->getDimsAndResolution(dims[0], dims[1], dims[2], res[0], res[1], res[2]);
+  dims[2] = endSlice - startSlice + 1;
+  const usize totalPoints = static_cast<usize>(dims[0] * dims[1] * dims[2]);
+
+  auto volumeReader = std::dynamic_pointer_cast<H5AngVolumeReader>(H5AngVolumeReader::New());
+  REQUIRE(volumeReader != nullptr);
+  volumeReader->setFileName(inputFilePath);
+  volumeReader->setSliceStart(startSlice);
+  volumeReader->setSliceEnd(endSlice);
+  volumeReader->readAllArrays(false);
+  volumeReader->setArraysToRead({EbsdLib::Ang::ConfidenceIndex, EbsdLib::Ang::ImageQuality, EbsdLib::Ang::PhaseData, EbsdLib::Ang::Phi1, EbsdLib::Ang::Phi, EbsdLib::Ang::Phi2});
+  REQUIRE(volumeReader->loadData(dims[0], dims[1], dims[2], volumeReader->getStackingOrder()) >= 0);
+
+  const auto* confidenceIndex = reinterpret_cast<float*>(volumeReader->getPointerByName(EbsdLib::Ang::ConfidenceIndex));
+  const auto* imageQuality = reinterpret_cast<float*>(volumeReader->getPointerByName(EbsdLib::Ang::ImageQuality));
+  const auto* phases = reinterpret_cast<int32*>(volumeReader->getPointerByName(EbsdLib::Ang::PhaseData));
+  const std::array<const float*, 3> eulers = {reinterpret_cast<float*>(volumeReader->getPointerByName(EbsdLib::Ang::Phi1)),
+                                              reinterpret_cast<float*>(volumeReader->getPointerByName(EbsdLib::Ang::Phi)),
+                                              reinterpret_cast<float*>(volumeReader->getPointerByName(EbsdLib::Ang::Phi2))};
+
+  const auto& confidenceIndexArray = dataStructure.getDataRefAs<Float32Array>(Constants::k_CellAttributeMatrix.createChildPath(EbsdLib::Ang::ConfidenceIndex));
+  const auto& imageQualityArray = dataStructure.getDataRefAs<Float32Array>(Constants::k_CellAttributeMatrix.createChildPath(EbsdLib::Ang::ImageQuality));
+  const auto& phasesArray = dataStructure.getDataRefAs<Int32Array>(Constants::k_CellAttributeMatrix.createChildPath(EbsdLib::H5Ebsd::Phases));
+  const auto& eulersArray = dataStructure.getDataRefAs<Float32Array>(Constants::k_CellAttributeMatrix.createChildPath(EbsdLib::CellData::EulerAngles));
+  REQUIRE(phasesArray.getNumberOfTuples() == totalPoints);
+
+  for(usize index = 0; index < totalPoints; index++)
+  {
+    REQUIRE(confidenceIndexArray[index] == confidenceIndex[index]);
+    REQUIRE(imageQualityArray[index] == imageQuality[index]);
+    REQUIRE(phasesArray[index] == phases[index]);
+    for(usize comp = 0; comp < 3; comp++)
+    {
+      REQUIRE(eulersArray[index * 3 + comp] == eulers[comp][index]);
+    }
+  }
+}
@@ -3,6 +3,7 @@
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/DataStructure/IArray.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
+#include "simplnx/Utilities/GridRemap.hpp"
 #include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
 
 using namespace nx::core;
@@ -57,6 +58,38 @@ Result<> AppendImageGeometry::operator()()
     destCellData->resizeTuples(newDims);
   }
 
+  // When saving as a new geometry, every source geometry is placed into the new grid with a GridRemap
+  // and the DataArrays are copied as contiguous blocks, in parallel across arrays and z slabs.
+  std::vector<DataPath> sourceCellDataPaths;
+  std::vector<GridRemap> sourceRemaps;
+  std::vector<std::vector<GridRemap::ArrayPair>> sourceArrayPairs;
+  if(m_InputValues->SaveAsNewGeometry)
+  {
+    const auto& newGeometry = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->NewGeometryPath);
+    const SizeVec3 newGeomDims = newGeometry.getDimensions();
+    const auto dim = to_underlying(m_InputValues->Direction);
+    std::array<bool, 3> mirror = {false, false, false};
+    mirror[dim] = m_InputValues->MirrorGeometry;
+
+    std::vector<DataPath> sourceGeometryPaths = {m_InputValues->DestinationGeometryPath};
+    sourceGeometryPaths.insert(sourceGeometryPaths.end(), m_InputValues->InputGeometriesPaths.begin(), m_InputValues->InputGeometriesPaths.end());
+    SizeVec3 offset = {0, 0, 0};
+    for(const auto& sourceGeometryPath : sourceGeometryPaths)
+    {
+      const auto& sourceGeometry = m_DataStructure.getDataRefAs<ImageGeom>(sourceGeometryPath);
+      const SizeVec3 sourceGeomDims = sourceGeometry.getDimensions();
+      auto remapResult = GridRemap::Place(sourceGeomDims, newGeomDims, offset, mirror);
+      if(remapResult.invalid())
+      {
+        return ConvertResult(std::move(remapResult));
+      }
+      sourceCellDataPaths.push_back(sourceGeometryPath.createChildPath(sourceGeometry.getCellData()->getName()));
+      sourceRemaps.push_back(std::move(remapResult.value()));
+      offset[dim] += sourceGeomDims[dim];
+    }
+    sourceArrayPairs.resize(sourceRemaps.size());
+  }
+
   ParallelTaskAlgorithm taskRunner;
   for(const auto& [dataId, dataObject] : *newCellData)
   {
@@ -74,6 +107,27 @@ Result<> AppendImageGeometry::operator()()
       continue;
     }
 
+    if(m_InputValues->SaveAsNewGeometry && newDataArray->getArrayType() == IArray::ArrayType::DataArray)
+    {
+      m_MessageHandler(fmt::format("Combining data into array {}", newCellDataPath.createChildPath(name).toString()));
+      auto* newIDataArray = dynamic_cast<IDataArray*>(newDataArray);
+      for(usize sourceIndex = 0; sourceIndex < sourceCellDataPaths.size(); sourceIndex++)
+      {
+        const auto* sourceDataArray = m_DataStructure.getDataAs<IDataArray>(sourceCellDataPaths[sourceIndex].createChildPath(name));
+        if(sourceDataArray == nullptr)
+        {
+          results = MergeResults(
+              results,
+              MakeWarningVoidResult(
+                  -8213, fmt::format("Data object {} does not exist in the input geometry cell data attribute matrix. Cannot append data so the resulting data object will likely contain invalid data!",
+                                     name)));
+          continue;
+        }
+        sourceArrayPairs[sourceIndex].emplace_back(sourceDataArray, newIDataArray);
+      }
+      continue;
+    }
+
     std::vector<const IArray*> inputDataArrays;
     std::vector<std::vector<usize>> inputTupleShapes;
     if(m_InputValues->SaveAsNewGeometry)
@@ -133,5 +187,14 @@ Result<> AppendImageGeometry::operator()()
   }
   taskRunner.wait(); // This will spill over if the number of DataArrays to process does not divide evenly by the number of threads.
 
+  for(usize sourceIndex = 0; sourceIndex < sourceRemaps.size(); sourceIndex++)
+  {
+    Result<> copyResult = sourceRemaps[sourceIndex].copyArrays(sourceArrayPairs[sourceIndex], m_ShouldCancel);
+    if(copyResult.invalid())
+    {
+      return MergeResults(results, copyResult);
+    }
+  }
+
   return results;
 }
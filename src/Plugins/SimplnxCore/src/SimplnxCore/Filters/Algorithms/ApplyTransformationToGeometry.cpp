@@ -3,9 +3,7 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/INodeGeometry0D.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
-#include "simplnx/Utilities/ParallelAlgorithmUtilities.hpp"
 #include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
-#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
 
 using namespace nx::core;
 
@@ -62,11 +60,6 @@ Result<> ApplyTransformationToGeometry::applyImageGeometryTransformation()
 
   ImageRotationUtilities::FilterProgressCallback filterProgressCallback(m_MessageHandler, m_ShouldCancel);
 
-  // The actual rotating of the dataStructure arrays is done in parallel where parallel here
-  // refers to the cropping of each DataArray being done on a separate thread.
-  ParallelTaskAlgorithm taskRunner;
-  taskRunner.setParallelizationEnabled(true);
-
   const DataPath srcCelLDataAMPath = srcImageGeom.getCellDataPath();
   const auto& srcCellDataAM = srcImageGeom.getCellDataRef();
 
@@ -90,38 +83,25 @@ Result<> ApplyTransformationToGeometry::applyImageGeometryTransformation()
     destCellDataAM.resizeTuples(dataArrayShape);
   }
 
+  std::vector<std::pair<const IDataArray*, IDataArray*>> arrays;
   for(const auto& [dataId, srcDataObject] : srcCellDataAM)
   {
-    if(m_ShouldCancel)
-    {
-      return {};
-    }
-
     const auto* srcDataArrayPtr = m_DataStructure.getDataAs<IDataArray>(srcCelLDataAMPath.createChildPath(srcDataObject->getName()));
     auto* destDataArrayPtr = m_DataStructure.getDataAs<IDataArray>(destCellDataAMPath.createChildPath(srcDataObject->getName()));
-
-    if(m_InputValues->InterpolationSelection == detail::k_NearestNeighborInterpolationIdx)
-    {
-      m_MessageHandler(fmt::format("Applying Transform || Nearest Neighbor Interpolation {}", srcDataObject->getName()));
-
-      ExecuteParallelFunction<ImageRotationUtilities::RotateImageGeometryWithNearestNeighbor>(srcDataArrayPtr->getDataType(), taskRunner, srcDataArrayPtr, destDataArrayPtr, rotateArgs,
-                                                                                              m_TransformationMatrix, false, &filterProgressCallback);
-    }
-    else if(m_InputValues->InterpolationSelection == detail::k_LinearInterpolationIdx)
-    {
-      m_MessageHandler(fmt::format("Applying Transform || Trilinear Interpolation {}", srcDataObject->getName()));
-
-      ExecuteParallelFunction<ImageRotationUtilities::RotateImageGeometryWithTrilinearInterpolation, NoBooleanType>(srcDataArrayPtr->getDataType(), taskRunner, srcDataArrayPtr, destDataArrayPtr,
-                                                                                                                    rotateArgs, m_TransformationMatrix, &filterProgressCallback);
-    }
-
-    if(getCancel())
-    {
-      break;
-    }
+    arrays.emplace_back(srcDataArrayPtr, destDataArrayPtr);
   }
 
-  taskRunner.wait(); // This will spill over if the number of DataArrays to process does not divide evenly by the number of threads.
+  // The mapping from transformed voxels back to the source voxels is computed once per slab and shared by all arrays
+  if(m_InputValues->InterpolationSelection == detail::k_NearestNeighborInterpolationIdx)
+  {
+    m_MessageHandler("Applying Transform || Nearest Neighbor Interpolation");
+    ImageRotationUtilities::TransformImageArrays(rotateArgs, m_TransformationMatrix, ImageRotationUtilities::InterpolationType::NearestNeighbor, false, arrays, filterProgressCallback);
+  }
+  else if(m_InputValues->InterpolationSelection == detail::k_LinearInterpolationIdx)
+  {
+    m_MessageHandler("Applying Transform || Trilinear Interpolation");
+    ImageRotationUtilities::TransformImageArrays(rotateArgs, m_TransformationMatrix, ImageRotationUtilities::InterpolationType::Trilinear, false, arrays, filterProgressCallback);
+  }
 
   return {};
 }
@@ -139,6 +119,7 @@ Result<> ApplyTransformationToGeometry::applyNodeGeometryTransformation()
   ParallelDataAlgorithm dataAlg;
   dataAlg.setRange(0, vertexList.getNumberOfTuples());
   dataAlg.execute(ImageRotationUtilities::ApplyTransformationToNodeGeometry(vertexList, m_TransformationMatrix, &filterProgressCallback));
+  nodeGeometry0D.markModified();
 
   return {};
 }
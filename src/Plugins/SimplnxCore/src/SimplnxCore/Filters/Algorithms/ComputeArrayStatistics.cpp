@@ -290,10 +290,10 @@ public:
             }
             else
             {
-              auto modeList = m_ModeArray->getList(j);
-              for(int i = 0; i < modeList->size(); i++)
+              const auto modeList = m_ModeArray->at(j);
+              for(int i = 0; i < modeList.size(); i++)
               {
-                const T mode = modeList->at(i);
+                const T mode = modeList[i];
                 const auto modalBin = HistogramUtilities::serial::CalculateBin(mode, histMin, increment);
                 if((modalBin >= 0) && (modalBin < m_NumBins)) // make certain bin is in range
                 {
@@ -751,6 +751,16 @@ void FindStatistics(const DataArray<T>& source, const Int32Array* featureIds, co
     }
 #endif
 
+    // The modes and modal bin ranges were appended feature by feature
+    if(modeArrayPtr != nullptr)
+    {
+      modeArrayPtr->compact();
+    }
+    if(modalBinsArrayPtr != nullptr)
+    {
+      modalBinsArrayPtr->compact();
+    }
+
     if(inputValues->FindMedian || inputValues->FindNumUniqueValues)
     {
       filter->sendThreadSafeInfoMessage("Starting Median Calculation..");
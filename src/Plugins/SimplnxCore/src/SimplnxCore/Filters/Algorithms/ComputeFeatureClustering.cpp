@@ -304,12 +304,16 @@ Result<> ComputeFeatureClustering::operator()()
     rdfStore[(m_InputValues->NumberOfBins * m_InputValues->PhaseNumber) + i] = oldCount[i] / randomRDF[i + 1];
   }
 
+  // Pack the lists into the Clustering Object in one allocation
+  std::vector<usize> listSizes(totalFeatures, 0);
   for(usize i = 1; i < totalFeatures; i++)
   {
-    // Set the vector for each list into the Clustering Object
-    NeighborList<float32>::SharedVectorType sharedClusterLst(new std::vector<float32>);
-    sharedClusterLst->assign(clusters[i].begin(), clusters[i].end());
-    clusteringList.setList(static_cast<int>(i), sharedClusterLst);
+    listSizes[i] = clusters[i].size();
+  }
+  clusteringList.allocateLists(listSizes);
+  for(usize i = 1; i < totalFeatures; i++)
+  {
+    std::copy(clusters[i].begin(), clusters[i].end(), clusteringList.getListSpan(i).begin());
   }
   return {};
 }
@@ -15,15 +15,18 @@ template <typename T>
 class ComputeKMeansTemplate
 {
 public:
-  ComputeKMeansTemplate(ComputeKMeans* filter, const IDataArray* inputIDataArray, IDataArray* meansIDataArray, const std::unique_ptr<MaskCompare>& maskDataArray, usize numClusters,
-                        Int32AbstractDataStore& fIds, ClusterUtilities::DistanceMetric distMetric, std::mt19937_64::result_type seed)
+  ComputeKMeansTemplate(ComputeKMeans* filter, const IDataArray* inputIDataArray, IDataArray* meansIDataArray, const std::unique_ptr<MaskCompare>& maskDataArray, const IDataStore* maskStore,
+                        usize numClusters, Int32AbstractDataStore& fIds, ClusterUtilities::DistanceMetric distMetric, ClusterUtilities::InitializationMethod initMethod,
+                        std::mt19937_64::result_type seed)
   : m_Filter(filter)
   , m_InputArray(inputIDataArray->template getIDataStoreRefAs<AbstractDataStoreT>())
   , m_Means(meansIDataArray->template getIDataStoreRefAs<AbstractDataStoreT>())
   , m_Mask(maskDataArray)
+  , m_MaskStore(maskStore)
   , m_NumClusters(numClusters)
   , m_FeatureIds(fIds)
   , m_DistMetric(distMetric)
+  , m_InitMethod(initMethod)
   , m_Seed(seed)
   {
   }
@@ -36,67 +39,86 @@ public:
   void operator()()
   {
     usize numTuples = m_InputArray.getNumberOfTuples();
-    int32 numCompDims = m_InputArray.getNumberOfComponents();
+    usize numCompDims = m_InputArray.getNumberOfComponents();
 
-    const usize rangeMax = numTuples - 1;
+    const ClusterUtilities::ClusterData clusterData = ClusterUtilities::CreateClusterData(m_InputArray, *m_Mask, m_MaskStore, m_DistMetric);
 
-    std::mt19937_64 gen(m_Seed);
-    std::uniform_real_distribution<float64> dist(0.0, 1.0);
+    std::vector<usize> clusterIdxs;
+    if(m_InitMethod == ClusterUtilities::KMeansPlusPlus)
+    {
+      clusterIdxs = ClusterUtilities::KMeansPlusPlusSeeds(clusterData, m_NumClusters, m_Seed, m_Filter->getCancel());
+      if(clusterIdxs.size() != m_NumClusters)
+      {
+        return;
+      }
+    }
+    else
+    {
+      const usize rangeMax = numTuples - 1;
 
-    std::vector<usize> clusterIdxs(m_NumClusters);
+      std::mt19937_64 gen(m_Seed);
+      std::uniform_real_distribution<float64> dist(0.0, 1.0);
 
-    usize clusterChoices = 0;
-    while(clusterChoices < m_NumClusters)
-    {
-      usize index = std::floor(dist(gen) * static_cast<float64>(rangeMax));
-      if(m_Mask->isTrue(index))
+      clusterIdxs.resize(m_NumClusters);
+      usize clusterChoices = 0;
+      while(clusterChoices < m_NumClusters)
       {
-        clusterIdxs[clusterChoices] = index;
-        clusterChoices++;
+        usize index = std::floor(dist(gen) * static_cast<float64>(rangeMax));
+        if(m_Mask->isTrue(index))
+        {
+          clusterIdxs[clusterChoices] = index;
+          clusterChoices++;
+        }
       }
     }
 
+    // Row 0 of the means belongs to the unclustered tuples and stays zero
+    std::vector<float64> means((m_NumClusters + 1) * numCompDims, 0.0);
     for(usize i = 0; i < m_NumClusters; i++)
     {
-      for(int32 j = 0; j < numCompDims; j++)
+      for(usize j = 0; j < numCompDims; j++)
       {
-        m_Means[numCompDims * (i + 1) + j] = m_InputArray[numCompDims * clusterIdxs[i] + j];
+        means[numCompDims * (i + 1) + j] = static_cast<float64>(m_InputArray[numCompDims * clusterIdxs[i] + j]);
       }
     }
 
-    std::vector<float64> oldMeans(m_NumClusters);
-    std::vector<float64> differences(m_NumClusters);
+    // Lloyd's algorithm has converged once an assignment pass leaves every cluster id unchanged
+    std::vector<float64> clusterSums;
+    std::vector<usize> clusterCounts;
     usize iteration = 1;
-    usize updateCheck = 0;
-    while(updateCheck != m_NumClusters)
+    usize numChanges = 1;
+    while(numChanges != 0)
     {
       if(m_Filter->getCancel())
       {
         return;
       }
-      findClusters(numTuples, numCompDims);
+      numChanges = ClusterUtilities::AssignClusters(clusterData, means, m_NumClusters, m_FeatureIds, &clusterSums, &clusterCounts);
 
-      for(usize i = 0; i < m_NumClusters; i++)
+      float64 meanShift = 0.0;
+      for(usize i = 1; i <= m_NumClusters; i++)
       {
-        oldMeans[i] = m_Means[i + 1];
-      }
-
-      findMeans(numTuples, numCompDims);
-
-      updateCheck = 0;
-      for(usize i = 0; i < m_NumClusters; i++)
-      {
-        differences[i] = oldMeans[i] - m_Means[i + 1];
-        if(closeEnough<float64>(differences[i], 0.0))
+        // An empty cluster keeps its previous mean
+        if(clusterCounts[i] == 0)
+        {
+          continue;
+        }
+        for(usize j = 0; j < numCompDims; j++)
         {
-          updateCheck++;
+          const float64 newMean = clusterSums[numCompDims * i + j] / static_cast<float64>(clusterCounts[i]);
+          meanShift += std::fabs(newMean - means[numCompDims * i + j]);
+          means[numCompDims * i + j] = newMean;
         }
       }
 
-      float64 sum = std::accumulate(std::begin(differences), std::end(differences), 0.0);
-      m_Filter->updateProgress(fmt::format("Clustering Data || Iteration {} || Total Mean Shift: {}", iteration, sum));
+      m_Filter->updateProgress(fmt::format("Clustering Data || Iteration {} || Changed Assignments: {} || Total Mean Shift: {}", iteration, numChanges, meanShift));
       iteration++;
     }
+
+    for(usize i = 0; i < means.size(); i++)
+    {
+      m_Means[i] = static_cast<T>(means[i]);
+    }
   }
 
 private:
@@ -105,78 +127,12 @@ private:
   const AbstractDataStoreT& m_InputArray;
   AbstractDataStoreT& m_Means;
   const std::unique_ptr<MaskCompare>& m_Mask;
+  const IDataStore* m_MaskStore;
   usize m_NumClusters;
   Int32AbstractDataStore& m_FeatureIds;
   ClusterUtilities::DistanceMetric m_DistMetric;
+  ClusterUtilities::InitializationMethod m_InitMethod;
   std::mt19937_64::result_type m_Seed;
-
-  // -----------------------------------------------------------------------------
-  template <typename K>
-  bool closeEnough(const K& a, const K& b, const K& epsilon = std::numeric_limits<K>::epsilon())
-  {
-    return (epsilon > fabs(a - b));
-  }
-
-  // -----------------------------------------------------------------------------
-  void findClusters(usize tuples, int32 dims)
-  {
-    for(usize i = 0; i < tuples; i++)
-    {
-      if(m_Filter->getCancel())
-      {
-        return;
-      }
-      if(m_Mask->isTrue(i))
-      {
-        float64 minDist = std::numeric_limits<float64>::max();
-        for(int32 j = 0; j < m_NumClusters; j++)
-        {
-          float64 dist = ClusterUtilities::GetDistance(m_InputArray, (dims * i), m_Means, (dims * (j + 1)), dims, m_DistMetric);
-          if(dist < minDist)
-          {
-            minDist = dist;
-            m_FeatureIds[i] = j + 1;
-          }
-        }
-      }
-    }
-  }
-
-  // -----------------------------------------------------------------------------
-  void findMeans(usize tuples, int32 dims)
-  {
-    std::vector<usize> counts(m_NumClusters + 1, 0);
-
-    for(usize i = 0; i <= m_NumClusters; i++)
-    {
-      for(usize j = 0; j < dims; j++)
-      {
-        m_Means[dims * i + j] = 0.0;
-      }
-    }
-
-    for(usize i = 0; i < dims; i++)
-    {
-      for(usize j = 0; j < tuples; j++)
-      {
-        int32 feature = m_FeatureIds[j];
-        m_Means[dims * feature + i] += static_cast<float64>(m_InputArray[dims * j + i]);
-        counts[feature] += 1;
-      }
-      for(usize j = 0; j <= m_NumClusters; j++)
-      {
-        if(counts[j] == 0)
-        {
-          m_Means[dims * j + i] = 0.0;
-        }
-        else
-        {
-          m_Means[dims * j + i] /= static_cast<float64>(counts[j]);
-        }
-      }
-      std::fill(std::begin(counts), std::end(counts), 0);
-    }
-  }
 };
 } // namespace
 
@@ -220,10 +176,16 @@ Result<> ComputeKMeans::operator()()
     std::string message = fmt::format("Mask Array DataPath does not exist or is not of the correct type (Bool | UInt8) {}", m_InputValues->MaskArrayPath.toString());
     return MakeErrorResult(-54060, message);
   }
+  if(maskCompare->countTrueValues() == 0)
+  {
+    return MakeErrorResult(-54061, fmt::format("The mask array {} does not select any tuples to cluster", m_InputValues->MaskArrayPath.toString()));
+  }
+  const IDataStore* maskStore = m_DataStructure.getDataRefAs<IDataArray>(m_InputValues->MaskArrayPath).getIDataStore();
 
   RunTemplateClass<ComputeKMeansTemplate, types::NoBooleanType>(clusteringArray->getDataType(), this, clusteringArray, m_DataStructure.getDataAs<IDataArray>(m_InputValues->MeansArrayPath),
-                                                                maskCompare, m_InputValues->InitClusters, m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)->getDataStoreRef(),
-                                                                m_InputValues->DistanceMetric, m_InputValues->Seed);
+                                                                maskCompare, maskStore, m_InputValues->InitClusters,
+                                                                m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)->getDataStoreRef(), m_InputValues->DistanceMetric,
+                                                                m_InputValues->InitMethod, m_InputValues->Seed);
 
   return {};
 }
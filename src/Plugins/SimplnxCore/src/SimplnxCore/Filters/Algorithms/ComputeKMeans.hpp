@@ -18,6 +18,7 @@ struct SIMPLNXCORE_EXPORT ComputeKMeansInputValues
 {
   uint64 InitClusters;
   ClusterUtilities::DistanceMetric DistanceMetric;
+  ClusterUtilities::InitializationMethod InitMethod = ClusterUtilities::Random;
   DataPath ClusteringArrayPath;
   DataPath MaskArrayPath;
   DataPath FeatureIdsArrayPath;
@@ -15,15 +15,18 @@ template <typename T>
 class KMedoidsTemplate
 {
 public:
-  KMedoidsTemplate(ComputeKMedoids* filter, const IDataArray* inputIDataArray, IDataArray* medoidsIDataArray, const std::unique_ptr<MaskCompare>& maskDataArray, usize numClusters,
-                   Int32AbstractDataStore& fIds, ClusterUtilities::DistanceMetric distMetric, std::mt19937_64::result_type seed)
+  KMedoidsTemplate(ComputeKMedoids* filter, const IDataArray* inputIDataArray, IDataArray* medoidsIDataArray, const std::unique_ptr<MaskCompare>& maskDataArray, const IDataStore* maskStore,
+                   usize numClusters, Int32AbstractDataStore& fIds, ClusterUtilities::DistanceMetric distMetric, ClusterUtilities::InitializationMethod initMethod,
+                   std::mt19937_64::result_type seed)
   : m_Filter(filter)
   , m_InputArray(inputIDataArray->template getIDataStoreRefAs<AbstractDataStore<T>>())
   , m_Medoids(medoidsIDataArray->template getIDataStoreRefAs<AbstractDataStore<T>>())
   , m_Mask(maskDataArray)
+  , m_MaskStore(maskStore)
   , m_NumClusters(numClusters)
   , m_FeatureIds(fIds)
   , m_DistMetric(distMetric)
+  , m_InitMethod(initMethod)
   , m_Seed(seed)
   {
   }
@@ -36,48 +39,62 @@ public:
   void operator()()
   {
     usize numTuples = m_InputArray.getNumberOfTuples();
-    int32 numCompDims = m_InputArray.getNumberOfComponents();
+    usize numCompDims = m_InputArray.getNumberOfComponents();
 
-    std::mt19937_64 gen(m_Seed);
-    std::uniform_int_distribution<usize> dist(0, numTuples - 1);
+    const ClusterUtilities::ClusterData clusterData = ClusterUtilities::CreateClusterData(m_InputArray, *m_Mask, m_MaskStore, m_DistMetric);
 
-    std::vector<usize> clusterIdxs(m_NumClusters);
-
-    usize clusterChoices = 0;
-    while(clusterChoices < m_NumClusters)
+    std::vector<usize> clusterIdxs;
+    if(m_InitMethod == ClusterUtilities::KMeansPlusPlus)
     {
-      usize index = dist(gen);
-      if(m_Mask->isTrue(index))
+      clusterIdxs = ClusterUtilities::KMeansPlusPlusSeeds(clusterData, m_NumClusters, m_Seed, m_Filter->getCancel());
+      if(clusterIdxs.size() != m_NumClusters)
       {
-        clusterIdxs[clusterChoices] = index;
-        clusterChoices++;
+        return;
       }
     }
-
-    for(usize i = 0; i < m_NumClusters; i++)
+    else
     {
-      for(int32 j = 0; j < numCompDims; j++)
+      std::mt19937_64 gen(m_Seed);
+      std::uniform_int_distribution<usize> dist(0, numTuples - 1);
+
+      clusterIdxs.resize(m_NumClusters);
+      usize clusterChoices = 0;
+      while(clusterChoices < m_NumClusters)
       {
-        m_Medoids[numCompDims * (i + 1) + j] = m_InputArray[numCompDims * clusterIdxs[i] + j];
+        usize index = dist(gen);
+        if(m_Mask->isTrue(index))
+        {
+          clusterIdxs[clusterChoices] = index;
+          clusterChoices++;
+        }
       }
     }
 
-    findClusters(numTuples, numCompDims);
+    std::vector<float64> medoids((m_NumClusters + 1) * numCompDims, 0.0);
+    updateMedoids(clusterIdxs, numCompDims, medoids);
+
+    ClusterUtilities::AssignClusters(clusterData, medoids, m_NumClusters, m_FeatureIds, nullptr, nullptr);
 
     std::vector<usize> optClusterIdxs(clusterIdxs);
 
-    std::vector<float64> costs = optimizeClusters(numTuples, numCompDims, clusterIdxs);
+    std::vector<float64> costs = ClusterUtilities::FindMedoids(clusterData, m_FeatureIds, m_NumClusters, clusterIdxs, m_Filter->getCancel());
+    updateMedoids(clusterIdxs, numCompDims, medoids);
 
     bool update = optClusterIdxs == clusterIdxs ? false : true;
     usize iteration = 1;
 
     while(update)
     {
-      findClusters(numTuples, numCompDims);
+      if(m_Filter->getCancel())
+      {
+        return;
+      }
+      ClusterUtilities::AssignClusters(clusterData, medoids, m_NumClusters, m_FeatureIds, nullptr, nullptr);
 
       optClusterIdxs = clusterIdxs;
 
-      costs = optimizeClusters(numTuples, numCompDims, clusterIdxs);
+      costs = ClusterUtilities::FindMedoids(clusterData, m_FeatureIds, m_NumClusters, clusterIdxs, m_Filter->getCancel());
+      updateMedoids(clusterIdxs, numCompDims, medoids);
 
       update = optClusterIdxs == clusterIdxs ? false : true;
 
@@ -94,89 +111,24 @@ private:
   const AbstractDataStoreT& m_InputArray;
   AbstractDataStoreT& m_Medoids;
   const std::unique_ptr<MaskCompare>& m_Mask;
+  const IDataStore* m_MaskStore;
   usize m_NumClusters;
   Int32AbstractDataStore& m_FeatureIds;
   ClusterUtilities::DistanceMetric m_DistMetric;
+  ClusterUtilities::InitializationMethod m_InitMethod;
   std::mt19937_64::result_type m_Seed;
 
   // -----------------------------------------------------------------------------
-  void findClusters(usize tuples, int32 dims)
-  {
-    for(usize i = 0; i < tuples; i++)
-    {
-      if(m_Filter->getCancel())
-      {
-        return;
-      }
-      if(m_Mask->isTrue(i))
-      {
-        float64 minDist = std::numeric_limits<float64>::max();
-        for(int32 j = 0; j < m_NumClusters; j++)
-        {
-          float64 dist = ClusterUtilities::GetDistance(m_InputArray, (dims * i), m_Medoids, (dims * (j + 1)), dims, m_DistMetric);
-          if(dist < minDist)
-          {
-            minDist = dist;
-            m_FeatureIds[i] = j + 1;
-          }
-        }
-      }
-    }
-  }
-
-  // -----------------------------------------------------------------------------
-  std::vector<float64> optimizeClusters(usize tuples, int32 dims, std::vector<usize>& clusterIdxs)
+  void updateMedoids(const std::vector<usize>& clusterIdxs, usize dims, std::vector<float64>& medoids)
   {
-    std::vector<float64> minCosts(m_NumClusters, std::numeric_limits<float64>::max());
-
-    for(usize i = 0; i < m_NumClusters; i++)
-    {
-      if(m_Filter->getCancel())
-      {
-        return {};
-      }
-      for(usize j = 0; j < tuples; j++)
-      {
-        if(m_Filter->getCancel())
-        {
-          return {};
-        }
-        if(m_Mask->isTrue(j))
-        {
-          if(m_FeatureIds[j] == i + 1)
-          {
-            float64 cost = 0.0;
-            for(usize k = 0; k < tuples; k++)
-            {
-              if(m_Filter->getCancel())
-              {
-                return {};
-              }
-              if(m_FeatureIds[k] == i + 1 && m_Mask->isTrue(k))
-              {
-                cost += ClusterUtilities::GetDistance(m_InputArray, (dims * k), m_InputArray, (dims * j), dims, m_DistMetric);
-              }
-            }
-
-            if(cost < minCosts[i])
-            {
-              minCosts[i] = cost;
-              clusterIdxs[i] = j;
-            }
-          }
-        }
-      }
-    }
-
     for(usize i = 0; i < m_NumClusters; i++)
     {
-      for(int32 j = 0; j < dims; j++)
+      for(usize j = 0; j < dims; j++)
       {
         m_Medoids[dims * (i + 1) + j] = m_InputArray[dims * clusterIdxs[i] + j];
+        medoids[dims * (i + 1) + j] = static_cast<float64>(m_InputArray[dims * clusterIdxs[i] + j]);
       }
     }
-
-    return minCosts;
   }
 };
 } // namespace
@@ -220,9 +172,15 @@ Result<> ComputeKMedoids::operator()()
     std::string message = fmt::format("Mask Array DataPath does not exist or is not of the correct type (Bool | UInt8) {}", m_InputValues->MaskArrayPath.toString());
     return MakeErrorResult(-54070, message);
   }
+  if(maskCompare->countTrueValues() == 0)
+  {
+    return MakeErrorResult(-54071, fmt::format("The mask array {} does not select any tuples to cluster", m_InputValues->MaskArrayPath.toString()));
+  }
+  const IDataStore* maskStore = m_DataStructure.getDataRefAs<IDataArray>(m_InputValues->MaskArrayPath).getIDataStore();
+
   RunTemplateClass<KMedoidsTemplate, types::NoBooleanType>(clusteringArray->getDataType(), this, clusteringArray, m_DataStructure.getDataAs<IDataArray>(m_InputValues->MedoidsArrayPath), maskCompare,
-                                                           m_InputValues->InitClusters, m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)->getDataStoreRef(),
-                                                           m_InputValues->DistanceMetric, m_InputValues->Seed);
+                                                           maskStore, m_InputValues->InitClusters, m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)->getDataStoreRef(),
+                                                           m_InputValues->DistanceMetric, m_InputValues->InitMethod, m_InputValues->Seed);
 
   return {};
 }
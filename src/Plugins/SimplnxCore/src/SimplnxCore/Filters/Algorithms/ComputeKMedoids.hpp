@@ -14,6 +14,7 @@ struct SIMPLNXCORE_EXPORT KMedoidsInputValues
 {
   uint64 InitClusters;
   ClusterUtilities::DistanceMetric DistanceMetric;
+  ClusterUtilities::InitializationMethod InitMethod = ClusterUtilities::Random;
   DataPath ClusteringArrayPath;
   DataPath MaskArrayPath;
   DataPath FeatureIdsArrayPath;
@@ -194,12 +194,16 @@ Result<> ComputeNeighborhoods::operator()()
 
   // Output Variables
   auto& outputNeighborList = m_DataStructure.getDataRefAs<NeighborList<int32>>(m_InputValues->NeighborhoodListArrayName);
-  // Set the vector for each list into the NeighborList Object
+  // Pack the lists into the NeighborList Object in one allocation
+  std::vector<usize> listSizes(totalFeatures, 0);
   for(usize i = 1; i < totalFeatures; i++)
   {
-    // Construct a shared vector<int32> through the std::vector<> copy constructor.
-    NeighborList<int32>::SharedVectorType sharedMisOrientationList(new std::vector<int32>(m_LocalNeighborhoodList[i]));
-    outputNeighborList.setList(static_cast<int32>(i), sharedMisOrientationList);
+    listSizes[i] = m_LocalNeighborhoodList[i].size();
+  }
+  outputNeighborList.allocateLists(listSizes);
+  for(usize i = 1; i < totalFeatures; i++)
+  {
+    std::copy(m_LocalNeighborhoodList[i].begin(), m_LocalNeighborhoodList[i].end(), outputNeighborList.getListSpan(i).begin());
   }
 
   m_LocalNeighborhoodList.clear();
@@ -5,14 +5,12 @@
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
 #include "simplnx/DataStructure/Geometry/VertexGeom.hpp"
 #include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
-#include "simplnx/Utilities/RTree.hpp"
+#include "simplnx/Utilities/TriangleBVH.hpp"
 
 using namespace nx::core;
 
 namespace
 {
-using RTreeType = RTree<size_t, float, 3, float>;
-using SharedTriListT = AbstractDataStore<IGeometry::SharedTriList::value_type>;
 using SharedVertexListT = AbstractDataStore<IGeometry::SharedVertexList::value_type>;
 
 /**
@@ -214,85 +212,19 @@ Vec3fa operator*(const Vec3fa& rhs, const float scalar)
 }
 
 /**
- * @brief Take from https://github.com/embree/embree/blob/master/tutorials/common/math/closest_point.h
- * Which has an apache license.
- * @param p
- * @param a
- * @param b
- * @param c
- * @return
+ * @brief Returns the squared distance between the point and its closest point on a triangle. The
+ * value is negative if the point lies behind the triangle with respect to its normal.
  */
-Vec3fa closestPointTriangle(const Vec3fa& p, const Vec3fa& a, const Vec3fa& b, const Vec3fa& c)
+float32 SignedSquaredDistance(const Vec3fa& point, const TriangleBVH::ClosestPoint& closest, const Float64AbstractDataStore& normals)
 {
-  const Vec3fa ab = b - a;
-  const Vec3fa ac = c - a;
-  const Vec3fa ap = p - a;
-
-  const float d1 = ab.dot(ap); // dot(ab, ap);
-  const float d2 = ac.dot(ap); // dot(ac, ap);
-  if(d1 <= 0.f && d2 <= 0.f)
-  {
-    return a;
-  }
-
-  const Vec3fa bp = p - b;
-  const float d3 = ab.dot(bp); // dot(ab, bp);
-  const float d4 = ac.dot(bp); // dot(ac, bp);
-  if(d3 >= 0.f && d4 <= d3)
-  {
-    return b;
-  }
-
-  const Vec3fa cp = p - c;
-  const float d5 = ab.dot(cp); // dot(ab, cp);
-  const float d6 = ac.dot(cp); // dot(ac, cp);
-  if(d6 >= 0.f && d5 <= d6)
-  {
-    return c;
-  }
-
-  const float vc = d1 * d4 - d3 * d2;
-  if(vc <= 0.f && d1 >= 0.f && d3 <= 0.f)
-  {
-    const float v = d1 / (d1 - d3);
-    return a + v * ab;
-  }
-
-  const float vb = d5 * d2 - d1 * d6;
-  if(vb <= 0.f && d2 >= 0.f && d6 <= 0.f)
-  {
-    const float v = d2 / (d2 - d6);
-    return a + v * ac;
-  }
-
-  const float va = d3 * d6 - d5 * d4;
-  if(va <= 0.f && (d4 - d3) >= 0.f && (d5 - d6) >= 0.f)
-  {
-    const float v = (d4 - d3) / ((d4 - d3) + (d5 - d6));
-    return b + v * (c - b);
-  }
-
-  const float denominator = 1.f / (va + vb + vc);
-  const float v = vb * denominator;
-  const float w = vc * denominator;
-  const Vec3fa pointInTriangle = a + v * ab + w * ac;
-
-  return pointInTriangle;
-}
-
-float32 PointTriangleDistance(const Vec3fa& point, const Vec3fa& vert0, const Vec3fa& vert1, const Vec3fa& vert2, const int64 triangle, const Float64AbstractDataStore& normals)
-{
-
-  Vec3fa closestPointInTriangle = closestPointTriangle(point, vert0, vert1, vert2);
-
+  const Vec3fa closestPointInTriangle(closest.point[0], closest.point[1], closest.point[2]);
   auto diffPoint = point - closestPointInTriangle; // Gives a vector pointing from the closest point in triangle to point
-  // Only do the dot-product of the vector with itself, so we don't incur the penalty of a square root that we might not need
-  float dist = diffPoint.dot(diffPoint);
 
+  const usize triangle = closest.triangleId;
   Vec3fa normal = {static_cast<float32>(normals[3 * triangle + 0]), static_cast<float32>(normals[3 * triangle + 1]), static_cast<float32>(normals[3 * triangle + 2])};
 
+  float32 dist = closest.squaredDistance;
   float32 cosTheta = normal.cosThetaBetweenVectors(diffPoint);
-
   if(cosTheta < 0.0f)
   {
     dist *= -1.0f;
@@ -304,16 +236,14 @@ float32 PointTriangleDistance(const Vec3fa& point, const Vec3fa& vert0, const Ve
 class ComputeVertexToTriangleDistancesImpl
 {
 public:
-  ComputeVertexToTriangleDistancesImpl(ComputeVertexToTriangleDistances* filter, const SharedTriListT& triangles, const SharedVertexListT& vertices, SharedVertexListT& sourcePoints,
-                                       Float32AbstractDataStore& distances, Int64AbstractDataStore& closestTri, const Float64AbstractDataStore& normals, const RTreeType rtree)
+  ComputeVertexToTriangleDistancesImpl(ComputeVertexToTriangleDistances* filter, const TriangleBVH& bvh, SharedVertexListT& sourcePoints, Float32AbstractDataStore& distances,
+                                       Int64AbstractDataStore& closestTri, const Float64AbstractDataStore& normals)
   : m_Filter(filter)
-  , m_SharedTriangleList(triangles)
-  , m_TriangleVertices(vertices)
+  , m_BVH(bvh)
   , m_SourcePoints(sourcePoints)
   , m_Distances(distances)
   , m_ClosestTri(closestTri)
   , m_Normals(normals)
-  , m_RTree(rtree)
   {
   }
   virtual ~ComputeVertexToTriangleDistancesImpl() = default;
@@ -328,68 +258,24 @@ public:
     int64 counter = 0;
     auto progIncrement = static_cast<int64>((end - start) / 100);
 
-    size_t numTuples = m_SharedTriangleList.getNumberOfTuples(); // allocate vector of all possible indexes
     for(usize v = start; v < end; v++)
     {
-      Vec3fa sourcePoint(m_SourcePoints[3 * v], m_SourcePoints[3 * v + 1], m_SourcePoints[3 * v + 2]);
-
-      std::vector<size_t> hitTriangleIds;
-      std::function<bool(size_t)> func = [&](size_t triangleIndex) {
-        hitTriangleIds.push_back(triangleIndex);
-        return true; // keep going
-      };
-
-      int32 nhits = m_RTree.Search(sourcePoint.data(), sourcePoint.data(), func);
-      if(nhits > 0) // Point is within the RTree bounding box so just loop over those triangles that are in the RTree
+      if(m_Filter->getCancel())
       {
-        for(const auto t : hitTriangleIds)
-        {
-          if(m_Filter->getCancel())
-          {
-            return;
-          }
-
-          auto p = static_cast<int64>(m_SharedTriangleList[t * 3 + 0]);
-          auto q = static_cast<int64>(m_SharedTriangleList[t * 3 + 1]);
-          auto r = static_cast<int64>(m_SharedTriangleList[t * 3 + 2]);
-          const Vec3fa point = {m_SourcePoints[3 * v + 0], m_SourcePoints[3 * v + 1], m_SourcePoints[3 * v + 2]};
-          const Vec3fa v0(m_TriangleVertices[p * 3 + 0], m_TriangleVertices[p * 3 + 1], m_TriangleVertices[p * 3 + 2]);
-          const Vec3fa v1(m_TriangleVertices[q * 3 + 0], m_TriangleVertices[q * 3 + 1], m_TriangleVertices[q * 3 + 2]);
-          const Vec3fa v2(m_TriangleVertices[r * 3 + 0], m_TriangleVertices[r * 3 + 1], m_TriangleVertices[r * 3 + 2]);
-
-          float32 d = PointTriangleDistance(point, v0, v1, v2, static_cast<int64>(t), m_Normals);
-
-          if(std::abs(d) < std::abs(m_Distances[v]))
-          {
-            m_Distances[v] = d;
-            m_ClosestTri[v] = static_cast<int64>(t);
-          }
-        }
+        return;
       }
-      else // Point was not in the RTree, so we need to search against every triangle
+
+      const Vec3fa point = {m_SourcePoints[3 * v + 0], m_SourcePoints[3 * v + 1], m_SourcePoints[3 * v + 2]};
+
+      // The hierarchy returns the lowest triangle id among equally close triangles, the same triangle a scan over all triangles would pick
+      const TriangleBVH::ClosestPoint closest = m_BVH.findClosestPoint({point[0], point[1], point[2]});
+      if(closest.triangleId != TriangleBVH::k_InvalidTriangle)
       {
-        for(size_t t = 0; t < numTuples; t++)
+        float32 d = SignedSquaredDistance(point, closest, m_Normals);
+        if(std::abs(d) < std::abs(m_Distances[v]))
         {
-          if(m_Filter->getCancel())
-          {
-            return;
-          }
-
-          auto p = static_cast<int64>(m_SharedTriangleList[t * 3 + 0]);
-          auto q = static_cast<int64>(m_SharedTriangleList[t * 3 + 1]);
-          auto r = static_cast<int64>(m_SharedTriangleList[t * 3 + 2]);
-          const Vec3fa point = {m_SourcePoints[3 * v + 0], m_SourcePoints[3 * v + 1], m_SourcePoints[3 * v + 2]};
-          const Vec3fa v0(m_TriangleVertices[p * 3 + 0], m_TriangleVertices[p * 3 + 1], m_TriangleVertices[p * 3 + 2]);
-          const Vec3fa v1(m_TriangleVertices[q * 3 + 0], m_TriangleVertices[q * 3 + 1], m_TriangleVertices[q * 3 + 2]);
-          const Vec3fa v2(m_TriangleVertices[r * 3 + 0], m_TriangleVertices[r * 3 + 1], m_TriangleVertices[r * 3 + 2]);
-
-          float32 d = PointTriangleDistance(point, v0, v1, v2, static_cast<int64>(t), m_Normals);
-
-          if(std::abs(d) < std::abs(m_Distances[v]))
-          {
-            m_Distances[v] = d;
-            m_ClosestTri[v] = static_cast<int64>(t);
-          }
+          m_Distances[v] = d;
+          m_ClosestTri[v] = static_cast<int64>(closest.triangleId);
         }
       }
 
@@ -416,31 +302,12 @@ public:
 
 private:
   ComputeVertexToTriangleDistances* m_Filter;
-  const SharedTriListT& m_SharedTriangleList;
-  const SharedVertexListT& m_TriangleVertices;
+  const TriangleBVH& m_BVH;
   SharedVertexListT& m_SourcePoints;
   Float32AbstractDataStore& m_Distances;
   Int64AbstractDataStore& m_ClosestTri;
   const Float64AbstractDataStore& m_Normals;
-  const RTreeType m_RTree;
 };
-
-void GetBoundingBoxAtTri(const SharedTriListT& triList, const SharedVertexListT& vertList, size_t triId, nonstd::span<float> bounds)
-{
-  size_t v0Index = triList[triId * 3 + 0] * 3;
-  size_t v1Index = triList[triId * 3 + 1] * 3;
-  size_t v2Index = triList[triId * 3 + 2] * 3;
-
-  auto xMinMax = std::minmax({vertList[v0Index + 0], vertList[v1Index + 0], vertList[v2Index + 0]});
-  auto yMinMax = std::minmax({vertList[v0Index + 1], vertList[v1Index + 1], vertList[v2Index + 1]});
-  auto zMinMax = std::minmax({vertList[v0Index + 2], vertList[v1Index + 2], vertList[v2Index + 2]});
-  bounds[0] = xMinMax.first;
-  bounds[1] = yMinMax.first;
-  bounds[2] = zMinMax.first;
-  bounds[3] = xMinMax.second;
-  bounds[4] = yMinMax.second;
-  bounds[5] = zMinMax.second;
-}
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -486,19 +353,9 @@ Result<> ComputeVertexToTriangleDistances::operator()()
   SharedVertexListT& sourceVertices = vertexGeom.getVertices()->getDataStoreRef();
   m_TotalElements = vertexGeom.getNumberOfVertices();
 
-  auto& triangleGeom = m_DataStructure.getDataRefAs<TriangleGeom>(m_InputValues->TriangleDataContainer);
-  auto numTris = static_cast<usize>(triangleGeom.getNumberOfFaces());
-  const SharedTriListT& triangles = triangleGeom.getFaces()->getDataStoreRef();
-  const SharedVertexListT& vertices = triangleGeom.getVertices()->getDataStoreRef();
-
-  RTreeType m_RTree;
-  // Populate the RTree
-  std::vector<float> triBoundsArray(numTris * 6, 0.0F);
-  for(size_t triIndex = 0; triIndex < numTris; triIndex++)
-  {
-    GetBoundingBoxAtTri(triangles, vertices, triIndex, {triBoundsArray.data() + (6 * triIndex), 6});
-    m_RTree.Insert(triBoundsArray.data() + (6 * triIndex), triBoundsArray.data() + (6 * triIndex) + 3, triIndex); // Note, all values including zero are fine in this version
-  }
+  const auto& triangleGeom = m_DataStructure.getDataRefAs<TriangleGeom>(m_InputValues->TriangleDataContainer);
+  m_MessageHandler(IFilter::Message::Type::Info, "Building triangle search hierarchy...");
+  const std::shared_ptr<const TriangleBVH> bvh = triangleGeom.getBVH();
 
   const auto& normalsArray = m_DataStructure.getDataAs<Float64Array>(m_InputValues->TriangleNormalsArrayPath)->getDataStoreRef();
   auto& distancesArray = m_DataStructure.getDataAs<Float32Array>(m_InputValues->DistancesArrayPath)->getDataStoreRef();
@@ -510,7 +367,7 @@ Result<> ComputeVertexToTriangleDistances::operator()()
   ParallelDataAlgorithm dataAlg;
   dataAlg.setParallelizationEnabled(true);
   dataAlg.setRange(0, m_TotalElements);
-  dataAlg.execute(ComputeVertexToTriangleDistancesImpl(this, triangles, vertices, sourceVertices, distancesArray, closestTriangleIdsArray, normalsArray, m_RTree));
+  dataAlg.execute(ComputeVertexToTriangleDistancesImpl(this, *bvh, sourceVertices, distancesArray, closestTriangleIdsArray, normalsArray));
 
   return {};
 }
@@ -5,6 +5,7 @@
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/GridNeighborhood.hpp"
 
 using namespace nx::core;
 
@@ -86,12 +87,6 @@ Result<> FillBadData::operator()()
     cellPhasesPtr = m_DataStructure.getDataAs<Int32Array>(m_InputValues->cellPhasesArrayPath);
   }
 
-  std::array<int64_t, 3> dims = {
-      static_cast<int64_t>(udims[0]),
-      static_cast<int64_t>(udims[1]),
-      static_cast<int64_t>(udims[2]),
-  };
-
   size_t count = 1;
   // int32_t good = 1;
   // int64_t neighbor = 0;
@@ -128,7 +123,7 @@ Result<> FillBadData::operator()()
     }
   }
 
-  std::array<int64_t, 6> neighborPoints = {-dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
+  const GridNeighborhood<GridConnectivity::Face> neighborhood(udims);
   std::vector<int64_t> currentVisitedList;
 
   for(size_t iter = 0; iter < totalPoints; iter++)
@@ -149,42 +144,13 @@ Result<> FillBadData::operator()()
       while(count < currentVisitedList.size())
       {
         int64_t index = currentVisitedList[count];
-        int64 column = index % dims[0];
-        int64 row = (index / dims[0]) % dims[1];
-        int64 plane = index / (dims[0] * dims[1]);
-        for(int32_t j = 0; j < 6; j++)
-        {
-          int64_t neighbor = index + neighborPoints[j];
-          if(j == 0 && plane == 0)
-          {
-            continue;
-          }
-          if(j == 5 && plane == (dims[2] - 1))
-          {
-            continue;
-          }
-          if(j == 1 && row == 0)
-          {
-            continue;
-          }
-          if(j == 4 && row == (dims[1] - 1))
-          {
-            continue;
-          }
-          if(j == 2 && column == 0)
-          {
-            continue;
-          }
-          if(j == 3 && column == (dims[0] - 1))
-          {
-            continue;
-          }
+        neighborhood.forEachNeighbor(static_cast<usize>(index), [&](usize neighbor, usize) {
           if(featureIdsStore[neighbor] == 0 && !alreadyChecked[neighbor])
           {
-            currentVisitedList.push_back(neighbor);
+            currentVisitedList.push_back(static_cast<int64_t>(neighbor));
             alreadyChecked[neighbor] = true;
           }
-        }
+        });
         count++;
       }
       if((int32_t)currentVisitedList.size() >= m_InputValues->minAllowedDefectSizeValue)
@@ -222,37 +188,8 @@ Result<> FillBadData::operator()()
         count++;
         // int32 current = 0;
         int32 most = 0;
-        auto xIndex = static_cast<float32>(i % dims[0]);
-        auto yIndex = static_cast<float32>((i / dims[0]) % dims[1]);
-        auto zIndex = static_cast<float32>(i / (dims[0] * dims[1]));
-        for(int32_t j = 0; j < 6; j++)
-        {
-          auto neighborPoint = static_cast<int64_t>(i + neighborPoints[j]);
-          if(j == 0 && zIndex == 0)
-          {
-            continue;
-          }
-          if(j == 5 && zIndex == static_cast<float32>(dims[2] - 1))
-          {
-            continue;
-          }
-          if(j == 1 && yIndex == 0)
-          {
-            continue;
-          }
-          if(j == 4 && yIndex == static_cast<float32>(dims[1] - 1))
-          {
-            continue;
-          }
-          if(j == 2 && xIndex == 0)
-          {
-            continue;
-          }
-          if(j == 3 && xIndex == static_cast<float32>(dims[0] - 1))
-          {
-            continue;
-          }
-
+        const auto position = neighborhood.getPosition(i);
+        neighborhood.forEachNeighbor(i, position[0], position[1], position[2], [&](usize neighborPoint, usize) {
           int32 feature = featureIdsStore[neighborPoint];
           if(feature > 0)
           {
@@ -264,41 +201,14 @@ Result<> FillBadData::operator()()
               neighbors[i] = static_cast<int32>(neighborPoint);
             }
           }
-        }
-        for(int32_t j = 0; j < 6; j++)
-        {
-          int64 neighborPoint = static_cast<int64>(i) + neighborPoints[j];
-          if(j == 0 && zIndex == 0)
-          {
-            continue;
-          }
-          if(j == 5 && zIndex == static_cast<float32>(dims[2] - 1))
-          {
-            continue;
-          }
-          if(j == 1 && yIndex == 0)
-          {
-            continue;
-          }
-          if(j == 4 && yIndex == static_cast<float32>(dims[1] - 1))
-          {
-            continue;
-          }
-          if(j == 2 && xIndex == 0)
-          {
-            continue;
-          }
-          if(j == 3 && xIndex == static_cast<float32>(dims[0] - 1))
-          {
-            continue;
-          }
-
+        });
+        neighborhood.forEachNeighbor(i, position[0], position[1], position[2], [&](usize neighborPoint, usize) {
           int32 feature = featureIdsStore[neighborPoint];
           if(feature > 0)
           {
             featureNumber[feature] = 0;
           }
-        }
+        });
       }
     }
 
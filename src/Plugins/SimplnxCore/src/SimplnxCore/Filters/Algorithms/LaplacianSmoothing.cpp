@@ -31,6 +31,8 @@ Result<> LaplacianSmoothing::edgeBasedSmoothing()
   auto& surfaceMesh = m_DataStructure.getDataRefAs<TriangleGeom>(m_InputValues->pTriangleGeometryDataPath);
 
   Float32AbstractDataStore& verts = surfaceMesh.getVertices()->getDataStoreRef();
+  // The vertices are smoothed in place below
+  surfaceMesh.markModified();
 
   IGeometry::MeshIndexType nvert = surfaceMesh.getNumberOfVertices();
 
@@ -8,15 +8,75 @@
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/GeometryUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <utility>
 
 using namespace nx::core;
 
 namespace
 {
+using SharedTriList = AbstractDataStore<IGeometry::MeshIndexArrayType::value_type>;
+using SharedVertList = AbstractDataStore<IGeometry::SharedVertexList::value_type>;
+
+// Each binary STL record holds the normal and 3 vertices (12 float32) followed by the uint16 attribute byte count
+constexpr usize k_StlElementCount = 12;
+constexpr usize k_StlTriangleSize = k_StlElementCount * sizeof(float32);
+constexpr usize k_StlRecordSize = k_StlTriangleSize + sizeof(uint16);
+constexpr usize k_BlockSize = k_StlRecordSize * 262144; // 12.5 MB
+
+/**
+ * @brief Decodes the records located in a block of the STL file into the geometry
+ */
+class DecodeTrianglesImpl
+{
+public:
+  DecodeTrianglesImpl(const std::vector<char>& blockBuffer, const std::vector<usize>& recordOffsets, usize firstTriangle, SharedTriList& triangles, SharedVertList& nodes,
+                      AbstractDataStore<float64>& faceNormals)
+  : m_BlockBuffer(blockBuffer)
+  , m_RecordOffsets(recordOffsets)
+  , m_FirstTriangle(firstTriangle)
+  , m_Triangles(triangles)
+  , m_Nodes(nodes)
+  , m_FaceNormals(faceNormals)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    std::array<float32, k_StlElementCount> fileVert = {0.0F};
+    for(usize index = range.min(); index < range.max(); index++)
+    {
+      // The records are not aligned in the file so copy them out before interpreting them
+      std::memcpy(fileVert.data(), m_BlockBuffer.data() + m_RecordOffsets[index], k_StlTriangleSize);
+
+      const usize t = m_FirstTriangle + index;
+      m_FaceNormals.setValue(3 * t + 0, static_cast<float64>(fileVert[0]));
+      m_FaceNormals.setValue(3 * t + 1, static_cast<float64>(fileVert[1]));
+      m_FaceNormals.setValue(3 * t + 2, static_cast<float64>(fileVert[2]));
+      for(usize v = 0; v < 9; v++)
+      {
+        m_Nodes.setValue(9 * t + v, fileVert[3 + v]);
+      }
+      m_Triangles.setValue(t * 3 + 0, 3 * t + 0);
+      m_Triangles.setValue(t * 3 + 1, 3 * t + 1);
+      m_Triangles.setValue(t * 3 + 2, 3 * t + 2);
+    }
+  }
+
+private:
+  const std::vector<char>& m_BlockBuffer;
+  const std::vector<usize>& m_RecordOffsets;
+  const usize m_FirstTriangle;
+  SharedTriList& m_Triangles;
+  SharedVertList& m_Nodes;
+  AbstractDataStore<float64>& m_FaceNormals;
+};
+
 class StlFileSentinel
 {
 public:
@@ -66,7 +126,7 @@ bool IsVxElementsFile(const std::string& stlHeader)
 } // End anonymous namespace
 
 ReadStlFile::ReadStlFile(DataStructure& dataStructure, fs::path stlFilePath, const DataPath& geometryPath, const DataPath& faceGroupPath, const DataPath& faceNormalsDataPath, bool scaleOutput,
-                         float32 scaleFactor, const std::atomic_bool& shouldCancel, const IFilter::MessageHandler& mesgHandler)
+                         float32 scaleFactor, float32 weldingTolerance, const std::atomic_bool& shouldCancel, const IFilter::MessageHandler& mesgHandler)
 : m_DataStructure(dataStructure)
 , m_FilePath(std::move(stlFilePath))
 , m_GeometryDataPath(geometryPath)
@@ -74,6 +134,7 @@ ReadStlFile::ReadStlFile(DataStructure& dataStructure, fs::path stlFilePath, con
 , m_FaceNormalsDataPath(faceNormalsDataPath)
 , m_ScaleOutput(scaleOutput)
 , m_ScaleFactor(scaleFactor)
+, m_WeldingTolerance(weldingTolerance)
 , m_ShouldCancel(shouldCancel)
 , m_MessageHandler(mesgHandler)
 {
@@ -123,99 +184,117 @@ Result<> ReadStlFile::operator()()
   triangleGeom.resizeFaceList(triCount);
   triangleGeom.resizeVertexList(triCount * 3);
 
-  using SharedTriList = AbstractDataStore<IGeometry::MeshIndexArrayType::value_type>;
-  using SharedVertList = AbstractDataStore<IGeometry::SharedVertexList::value_type>;
-
   SharedTriList& triangles = triangleGeom.getFaces()->getDataStoreRef();
   SharedVertList& nodes = triangleGeom.getVertices()->getDataStoreRef();
 
   auto& faceNormalsStore = m_DataStructure.getDataAs<Float64Array>(m_FaceNormalsDataPath)->getDataStoreRef();
 
-  // Read the triangles
-  constexpr size_t k_StlElementCount = 12;
-  std::array<float, k_StlElementCount> fileVert = {0.0F};
-  uint16_t attr = 0;
-  std::vector<uint8_t> triangleAttributeBuffer(std::numeric_limits<uint16_t>::max()); // Just allocate a buffer of max UINT16 elements
+  // Read the triangles. The file is read in large blocks and the records of each block are located serially
+  // (the attribute byte count makes the record size variable) and then decoded in parallel.
+  std::vector<char> blockBuffer(static_cast<usize>(std::clamp<uint64>(stlFileSize, k_StlRecordSize, k_BlockSize)));
+  std::vector<usize> recordOffsets;
+  recordOffsets.reserve(blockBuffer.size() / k_StlRecordSize);
+  usize bufferPos = 0;
+  usize bufferEnd = 0;
+  uint64 bufferFileOffset = nx::core::StlConstants::k_STL_HEADER_LENGTH + sizeof(int32_t);
+  uint64 pendingSkip = 0;
+  usize t = 0;
+  const usize numTriangles = static_cast<usize>(triCount);
 
-  fpos_t pos;
-  auto start = std::chrono::steady_clock::now();
-  int32_t progInt = 0;
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.requireArraysInMemory({triangleGeom.getFaces(), triangleGeom.getVertices(), m_DataStructure.getDataAs<Float64Array>(m_FaceNormalsDataPath)});
 
-  for(int32_t t = 0; t < triCount; ++t)
+  auto start = std::chrono::steady_clock::now();
+  while(t < numTriangles)
   {
-    progInt = static_cast<float>(t) / static_cast<float>(triCount) * 100.0f;
-
+    if(m_ShouldCancel)
+    {
+      return {};
+    }
     auto now = std::chrono::steady_clock::now();
     // Only send updates every 1 second
     if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
     {
+      auto progInt = static_cast<int32>(static_cast<float>(t) / static_cast<float>(numTriangles) * 100.0f);
       std::string message = fmt::format("Reading {}% Complete", progInt);
       m_MessageHandler(nx::core::IFilter::ProgressMessage{nx::core::IFilter::Message::Type::Info, message, progInt});
       start = std::chrono::steady_clock::now();
     }
-    if(m_ShouldCancel)
-    {
-      return {};
-    }
-    // Get the current File Position
-    fgetpos(f, &pos);
-#if defined(__APPLE__) || defined(_WIN32)
-    if(pos >= stlFileSize)
-#else
-    if(pos.__pos >= stlFileSize)
-#endif
-    {
-      std::string msg = fmt::format(
-          "Trying to read at file position {} >= file size {}.\n  File Header: '{}'\n  Header Triangle Count: {}  Current Triangle: {}\n  The STL File does not conform to the STL file specification.",
-#if defined(__APPLE__) || defined(_WIN32)
-          pos,
-#else
-          pos.__pos,
-#endif
-          stlFileSize, stlHeaderStr, triCount, t);
-      return MakeErrorResult(nx::core::StlConstants::k_StlFileLengthError, msg);
-    }
 
-    // Read the Vertices and Normal (12 total float32 = 48 Bytes)
-    size_t objsRead = std::fread(fileVert.data(), sizeof(float), k_StlElementCount, f); // Read the Triangle
-    if(k_StlElementCount != objsRead)
-    {
-      std::string msg = fmt::format("Error reading Triangle '{}'. Object Count was {} and should have been {}", t, objsRead, k_StlElementCount);
-      return MakeErrorResult(nx::core::StlConstants::k_TriangleParseError, msg);
-    }
-    // Read the Uint16 value that is supposed to represent the number of bytes following that are file/vendor specific metadata
-    // Lots of writers/vendors do NOT set this properly which can cause problems.
-    objsRead = std::fread(&attr, sizeof(uint16_t), 1, f); // Read the Triangle Attribute Data length
-    if(objsRead != 1)
+    // Keep the partial record at the end of the previous block and fill the rest of the buffer
+    std::copy(blockBuffer.begin() + bufferPos, blockBuffer.begin() + bufferEnd, blockBuffer.begin());
+    bufferFileOffset += bufferPos;
+    bufferEnd -= bufferPos;
+    bufferPos = 0;
+    if(pendingSkip > 0)
     {
-      std::string msg = fmt::format("Error reading Number of attributes for triangle '{}'. uint16 count was {} and should have been 1", t, objsRead);
-      return MakeErrorResult(nx::core::StlConstants::k_AttributeParseError, msg);
+      // Skip the remainder of the attribute data of the last record in the previous block
+      std::ignore = std::fseek(f, static_cast<long>(pendingSkip), SEEK_CUR);
+      bufferFileOffset += pendingSkip;
+      pendingSkip = 0;
     }
-    // If we are trying to follow along the STL Spec, skip the stated bytes unless
-    // we detected known Vendors that do not write proper STL Files.
-    if(attr > 0 && !ignoreMetaSizeValue)
+    const usize bytesRequested = blockBuffer.size() - bufferEnd;
+    const usize bytesRead = std::fread(blockBuffer.data() + bufferEnd, 1, bytesRequested, f);
+    bufferEnd += bytesRead;
+    const bool endOfFile = bytesRead < bytesRequested;
+
+    // Locate the records in this block
+    const usize blockFirstTriangle = t;
+    recordOffsets.clear();
+    while(t < numTriangles)
     {
-      std::ignore = std::fseek(f, static_cast<size_t>(attr), SEEK_CUR); // Skip past the Triangle Attribute data since we don't know how to read it anyway
+      const usize bytesAvailable = bufferEnd - bufferPos;
+      if(bytesAvailable < k_StlRecordSize)
+      {
+        if(!endOfFile)
+        {
+          break;
+        }
+        const uint64 recordFileOffset = bufferFileOffset + bufferPos;
+        if(recordFileOffset >= stlFileSize)
+        {
+          std::string msg = fmt::format(
+              "Trying to read at file position {} >= file size {}.\n  File Header: '{}'\n  Header Triangle Count: {}  Current Triangle: {}\n  The STL File does not conform to the STL file specification.",
+              recordFileOffset, stlFileSize, stlHeaderStr, triCount, t);
+          return MakeErrorResult(nx::core::StlConstants::k_StlFileLengthError, msg);
+        }
+        if(bytesAvailable < k_StlTriangleSize)
+        {
+          std::string msg = fmt::format("Error reading Triangle '{}'. Object Count was {} and should have been {}", t, bytesAvailable / sizeof(float32), k_StlElementCount);
+          return MakeErrorResult(nx::core::StlConstants::k_TriangleParseError, msg);
+        }
+        std::string msg = fmt::format("Error reading Number of attributes for triangle '{}'. uint16 count was 0 and should have been 1", t);
+        return MakeErrorResult(nx::core::StlConstants::k_AttributeParseError, msg);
+      }
+
+      recordOffsets.push_back(bufferPos);
+      // Read the Uint16 value that is supposed to represent the number of bytes following that are file/vendor specific metadata
+      // Lots of writers/vendors do NOT set this properly which can cause problems.
+      uint16 attr = 0;
+      std::memcpy(&attr, blockBuffer.data() + bufferPos + k_StlTriangleSize, sizeof(uint16));
+      bufferPos += k_StlRecordSize;
+      t++;
+
+      // If we are trying to follow along the STL Spec, skip the stated bytes unless
+      // we detected known Vendors that do not write proper STL Files.
+      if(attr > 0 && !ignoreMetaSizeValue)
+      {
+        const usize remaining = bufferEnd - bufferPos;
+        if(attr > remaining)
+        {
+          pendingSkip = attr - remaining;
+          bufferPos = bufferEnd;
+          break;
+        }
+        bufferPos += attr;
+      }
     }
 
     // Write the data into the actual geometry
-    faceNormalsStore[3 * t + 0] = static_cast<double>(fileVert[0]);
-    faceNormalsStore[3 * t + 1] = static_cast<double>(fileVert[1]);
-    faceNormalsStore[3 * t + 2] = static_cast<double>(fileVert[2]);
-    nodes[3 * (3 * t + 0) + 0] = fileVert[3];
-    nodes[3 * (3 * t + 0) + 1] = fileVert[4];
-    nodes[3 * (3 * t + 0) + 2] = fileVert[5];
-    nodes[3 * (3 * t + 1) + 0] = fileVert[6];
-    nodes[3 * (3 * t + 1) + 1] = fileVert[7];
-    nodes[3 * (3 * t + 1) + 2] = fileVert[8];
-    nodes[3 * (3 * t + 2) + 0] = fileVert[9];
-    nodes[3 * (3 * t + 2) + 1] = fileVert[10];
-    nodes[3 * (3 * t + 2) + 2] = fileVert[11];
-    triangles[t * 3] = 3 * t + 0;
-    triangles[t * 3 + 1] = 3 * t + 1;
-    triangles[t * 3 + 2] = 3 * t + 2;
+    dataAlg.setRange(0ULL, recordOffsets.size());
+    dataAlg.execute(DecodeTrianglesImpl(blockBuffer, recordOffsets, blockFirstTriangle, triangles, nodes, faceNormalsStore));
   }
 
-  return GeometryUtilities::EliminateDuplicateNodes(triangleGeom, m_ScaleOutput ? std::optional<float32>(m_ScaleFactor) : std::nullopt);
   // The fileSentinel will ensure the FILE* is closed.
+  return GeometryUtilities::EliminateDuplicateNodes(triangleGeom, m_ScaleOutput ? std::optional<float32>(m_ScaleFactor) : std::nullopt, m_WeldingTolerance);
 }
@@ -5,63 +5,10 @@
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
-#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/StreamCompaction.hpp"
 
 using namespace nx::core;
 
-namespace
-{
-/**
- * @brief The PopulateReducedGeometryTrianglesImpl pulls the vertices associated with a triangle then locates the indices in
- * the new VertexList then assigns that "new" triangle to Reduced Geometry
- */
-class PopulateReducedGeometryTrianglesImpl
-{
-public:
-  PopulateReducedGeometryTrianglesImpl(const TriangleGeom& originalTriangle, TriangleGeom& reducedTriangle, const std::vector<usize>& newTrianglesIndex, const std::vector<usize>& newVerticesIndex)
-  : m_OriginalTriangle(originalTriangle)
-  , m_ReducedTriangle(reducedTriangle)
-  , m_NewTrianglesIndex(newTrianglesIndex)
-  , m_NewVerticesIndex(newVerticesIndex)
-  {
-  }
-  ~PopulateReducedGeometryTrianglesImpl() = default;
-
-  void generate(usize start, usize end) const
-  {
-    for(usize index = start; index < end; index++)
-    {
-      // pull old vertices
-      usize oldVertexIndices[3] = {0, 0, 0};
-      m_OriginalTriangle.getFacePointIds(m_NewTrianglesIndex[index], oldVertexIndices);
-
-      // locate new vertex index for each vertex index
-      usize newVertexIndices[3] = {0, 0, 0};
-      for(usize vertIndex = 0; vertIndex < 3; vertIndex++)
-      {
-        const auto& itr = lower_bound(m_NewVerticesIndex.cbegin(), m_NewVerticesIndex.cend(), oldVertexIndices[vertIndex]); // find first instance of value as iterator
-        usize indexOfTarget = std::distance(m_NewVerticesIndex.cbegin(), itr);
-        newVertexIndices[vertIndex] = indexOfTarget;
-      }
-
-      // set the triangle in reduced
-      m_ReducedTriangle.setFacePointIds(index, newVertexIndices);
-    }
-  }
-
-  void operator()(const Range& range) const
-  {
-    generate(range.min(), range.max());
-  }
-
-private:
-  const TriangleGeom& m_OriginalTriangle;
-  TriangleGeom& m_ReducedTriangle;
-  const std::vector<usize>& m_NewTrianglesIndex;
-  const std::vector<usize>& m_NewVerticesIndex;
-};
-} // namespace
-
 // -----------------------------------------------------------------------------
 RemoveFlaggedTriangles::RemoveFlaggedTriangles(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
                                                RemoveFlaggedTrianglesInputValues* inputValues)
@@ -96,66 +43,42 @@ Result<> RemoveFlaggedTriangles::operator()()
   }
   auto& reducedTriangleGeom = m_DataStructure.getDataRefAs<TriangleGeom>(m_InputValues->ReducedTriangleGeometry);
 
-  // Set up allocated masks
-  usize size = originalTriangle.getNumberOfFaces();
-  std::vector<usize> newTrianglesIndexList;
-  newTrianglesIndexList.reserve(size);
-
-  // parse mask Triangles list and load a list of indices for triangles to keep
-  for(usize index = 0; index < size; index++)
-  {
-    if(!maskCompare->isTrue(index))
-    {
-      newTrianglesIndexList.push_back(index);
-    }
-  }
-  newTrianglesIndexList.shrink_to_fit();
-
+  // Compact the list of triangles down to the triangles that are not flagged
+  const IDataStore* maskStore = m_DataStructure.getDataRefAs<IDataArray>(m_InputValues->MaskArrayPath).getIDataStore();
+  const StreamCompaction triangleCompaction = StreamCompaction::Create(originalTriangle.getNumberOfFaces(), [&maskCompare](usize index) { return !maskCompare->isTrue(index); }, {maskStore}, m_ShouldCancel);
   if(getCancel())
   {
     return {};
   }
-  if(newTrianglesIndexList.empty())
+  if(triangleCompaction.getNumberOfKept() == 0)
   {
     return MakeErrorResult(-67880, "Re-evaluate mask conditions - with current configuration all triangles will be stripped!");
   }
 
-  // flatten a list of the indices of vertices used by the triangles
-  std::vector<usize> vertexListIndices; // also used as a pseudo look up table in PopulateReducedGeometryTrianglesImpl
-  for(usize& index : newTrianglesIndexList)
+  // Compact the list of vertices down to the vertices used by the remaining triangles
+  auto vertexCompactionResult = StreamCompaction::CreateFromConnectivity(originalTriangle.getFacesRef().getDataStoreRef(), triangleCompaction, originalTriangle.getNumberOfVertices(), m_ShouldCancel);
+  if(vertexCompactionResult.invalid())
   {
-    usize vertIDs[3] = {0, 0, 0};
-    originalTriangle.getFacePointIds(index, vertIDs);
-    vertexListIndices.push_back(vertIDs[0]);
-    vertexListIndices.push_back(vertIDs[1]);
-    vertexListIndices.push_back(vertIDs[2]);
+    return ConvertResult(std::move(vertexCompactionResult));
   }
+  const StreamCompaction& vertexCompaction = vertexCompactionResult.value();
   if(getCancel())
   {
     return {};
   }
-
-  if(vertexListIndices.empty())
+  if(vertexCompaction.getNumberOfKept() == 0)
   {
     return MakeErrorResult(-67881, "Re-evaluate mask conditions - with current configuration all vertices will be dumped!");
   }
 
-  // clear duplicate values out of vector
-  std::sort(vertexListIndices.begin(), vertexListIndices.end()); // orders ascending !!!!! Basis for later search !!!!!
-  auto dupes = std::unique(vertexListIndices.begin(), vertexListIndices.end());
-  vertexListIndices.erase(dupes, vertexListIndices.end());
-
-  // define new sizing
-  size = vertexListIndices.size();
+  // load reduced Geometry Vertex list according to used vertices
+  usize size = vertexCompaction.getNumberOfKept();
   reducedTriangleGeom.resizeVertexList(size); // resize accordingly
   reducedTriangleGeom.getVertexAttributeMatrix()->resizeTuples({size});
-
-  // load reduced Geometry Vertex list according to used vertices
-  Point3Df coords = {0.0f, 0.0f, 0.0f};
-  for(usize i = 0; i < size; i++)
+  Result<> copyResult = vertexCompaction.copyArrays({{originalTriangle.getVertices(), reducedTriangleGeom.getVertices()}}, m_ShouldCancel);
+  if(copyResult.invalid())
   {
-    coords = originalTriangle.getVertexCoordinate(vertexListIndices[i]);
-    reducedTriangleGeom.setVertexCoordinate(i, coords);
+    return copyResult;
   }
 
   if(getCancel())
@@ -163,21 +86,21 @@ Result<> RemoveFlaggedTriangles::operator()()
     return {};
   }
 
-  // Set up preprocessing conditions (allocation for parallelization)
-  size = newTrianglesIndexList.size();
+  // Copy the remaining triangles and reassign their indexes to match the new vertex list
+  size = triangleCompaction.getNumberOfKept();
   reducedTriangleGeom.resizeFaceList(size); // resize accordingly
   reducedTriangleGeom.getFaceAttributeMatrix()->resizeTuples({size});
-
-  // parse triangles and reassign indexes to match new vertex list
-  ParallelDataAlgorithm dataAlg;
-  dataAlg.setRange(0, size);
-  dataAlg.execute(PopulateReducedGeometryTrianglesImpl(originalTriangle, reducedTriangleGeom, newTrianglesIndexList, vertexListIndices));
+  copyResult = triangleCompaction.copyConnectivity(originalTriangle.getFacesRef().getDataStoreRef(), reducedTriangleGeom.getFacesRef().getDataStoreRef(), vertexCompaction, m_ShouldCancel);
+  if(copyResult.invalid())
+  {
+    return copyResult;
+  }
 
   /** This section will copy any user defined Triangle Data Arrays from the old to the reduced Triangle geometry **/
   if(m_InputValues->TriangleDataHandling == detail::k_CopySelectedTriangleArraysIdx)
   {
-    TransferGeometryElementData::transferElementData(m_DataStructure, reducedTriangleGeom.getFaceAttributeMatrixRef(), m_InputValues->SelectedTriangleData, newTrianglesIndexList, m_ShouldCancel,
-                                                     m_MessageHandler);
+    copyResult = TransferGeometryElementData::transferElementData(m_DataStructure, reducedTriangleGeom.getFaceAttributeMatrixRef(), m_InputValues->SelectedTriangleData, triangleCompaction,
+                                                                  m_ShouldCancel, m_MessageHandler);
   }
   else if(m_InputValues->TriangleDataHandling == detail::k_CopyAllTriangleArraysIdx)
   {
@@ -185,16 +108,20 @@ Result<> RemoveFlaggedTriangles::operator()()
     auto getChildrenResult = GetAllChildArrayDataPaths(m_DataStructure, m_InputValues->TriangleAttributeMatrixPath, ignorePaths);
     if(getChildrenResult.has_value())
     {
-      TransferGeometryElementData::transferElementData(m_DataStructure, reducedTriangleGeom.getFaceAttributeMatrixRef(), getChildrenResult.value(), newTrianglesIndexList, m_ShouldCancel,
-                                                       m_MessageHandler);
+      copyResult = TransferGeometryElementData::transferElementData(m_DataStructure, reducedTriangleGeom.getFaceAttributeMatrixRef(), getChildrenResult.value(), triangleCompaction, m_ShouldCancel,
+                                                                    m_MessageHandler);
     }
   }
+  if(copyResult.invalid())
+  {
+    return copyResult;
+  }
 
   /** This section will copy any user defined Vertex Data Arrays from the old to the reduced Vertex geometry **/
   if(m_InputValues->VertexDataHandling == detail::k_CopySelectedVertexArraysIdx)
   {
-    TransferGeometryElementData::transferElementData(m_DataStructure, reducedTriangleGeom.getVertexAttributeMatrixRef(), m_InputValues->SelectedVertexData, vertexListIndices, m_ShouldCancel,
-                                                     m_MessageHandler);
+    copyResult = TransferGeometryElementData::transferElementData(m_DataStructure, reducedTriangleGeom.getVertexAttributeMatrixRef(), m_InputValues->SelectedVertexData, vertexCompaction,
+                                                                  m_ShouldCancel, m_MessageHandler);
   }
   else if(m_InputValues->VertexDataHandling == detail::k_CopyAllVertexArraysIdx)
   {
@@ -202,10 +129,10 @@ Result<> RemoveFlaggedTriangles::operator()()
     auto getChildrenResult = GetAllChildArrayDataPaths(m_DataStructure, m_InputValues->VertexAttributeMatrixPath, ignorePaths);
     if(getChildrenResult.has_value())
     {
-      TransferGeometryElementData::transferElementData(m_DataStructure, reducedTriangleGeom.getVertexAttributeMatrixRef(), getChildrenResult.value(), vertexListIndices, m_ShouldCancel,
-                                                       m_MessageHandler);
+      copyResult = TransferGeometryElementData::transferElementData(m_DataStructure, reducedTriangleGeom.getVertexAttributeMatrixRef(), getChildrenResult.value(), vertexCompaction, m_ShouldCancel,
+                                                                    m_MessageHandler);
     }
   }
 
-  return {};
+  return copyResult;
 }
@@ -4,73 +4,11 @@
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/DataStructure/StringArray.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
-#include "simplnx/Utilities/ParallelAlgorithmUtilities.hpp"
-#include "simplnx/Utilities/ParallelData3DAlgorithm.hpp"
-#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
-#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
+#include "simplnx/Utilities/GridRemap.hpp"
 #include "simplnx/Utilities/SamplingUtils.hpp"
 
 using namespace nx::core;
 
-namespace
-{
-// -----------------------------------------------------------------------------
-class ResampleImageGeomImpl
-{
-public:
-  ResampleImageGeomImpl(std::vector<int64>& newIndices, std::vector<float> spacing, FloatVec3 sourceSpacing, SizeVec3 sourceDims, SizeVec3 destDims, const std::atomic_bool& shouldCancel)
-  : m_NewIndices(newIndices)
-  , m_Spacing(std::move(spacing))
-  , m_OrigSpacing(std::move(sourceSpacing))
-  , m_OrigDims(std::move(sourceDims))
-  , m_CopyDims(std::move(destDims))
-  , m_ShouldCancel(shouldCancel)
-  {
-  }
-
-  // -----------------------------------------------------------------------------
-  void compute(size_t xStart, size_t xEnd, size_t yStart, size_t yEnd, size_t zStart, size_t zEnd) const
-  {
-    for(size_t i = zStart; i < zEnd; i++)
-    {
-      for(size_t j = yStart; j < yEnd; j++)
-      {
-        if(m_ShouldCancel)
-        {
-          return;
-        }
-
-        for(size_t k = xStart; k < xEnd; k++)
-        {
-          float32 x = (static_cast<float32>(k) * m_Spacing[0]);
-          float32 y = (static_cast<float32>(j) * m_Spacing[1]);
-          float32 z = (static_cast<float32>(i) * m_Spacing[2]);
-          auto col = static_cast<int64>(x / m_OrigSpacing[0]);
-          auto row = static_cast<int64>(y / m_OrigSpacing[1]);
-          auto plane = static_cast<int64>(z / m_OrigSpacing[2]);
-          int64 indexOld = static_cast<int64>(plane * m_OrigDims[1] * m_OrigDims[0]) + static_cast<int64>(row * m_OrigDims[0]) + col;
-          auto index = static_cast<size_t>((i * m_CopyDims[0] * m_CopyDims[1]) + (j * m_CopyDims[0]) + k);
-          m_NewIndices[index] = indexOld;
-        }
-      }
-    }
-  }
-
-  void operator()(const Range3D& r) const
-  {
-    compute(r[0], r[1], r[2], r[3], r[4], r[5]);
-  }
-
-private:
-  std::vector<int64>& m_NewIndices;
-  std::vector<float> m_Spacing;
-  FloatVec3 m_OrigSpacing;
-  SizeVec3 m_OrigDims;
-  SizeVec3 m_CopyDims;
-  const std::atomic_bool& m_ShouldCancel;
-};
-} // namespace
-
 // -----------------------------------------------------------------------------
 ResampleImageGeom::ResampleImageGeom(DataStructure& dataStructure, const IFilter::MessageHandler& msgHandler, const std::atomic_bool& shouldCancel, ResampleImageGeomInputValues* inputValues)
 : m_DataStructure(dataStructure)
@@ -101,45 +39,30 @@ Result<> ResampleImageGeom::operator()()
   auto& destImageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->CreatedImageGeometryPath);
   SizeVec3 destDims = destImageGeom.getDimensions();
 
-  std::vector<int64> newIndices(destDims[2] * destDims[1] * destDims[0]);
-  ParallelData3DAlgorithm dataAlg;
-  dataAlg.setRange(destDims[0], destDims[1], destDims[2]);
-  dataAlg.execute(ResampleImageGeomImpl(newIndices, m_InputValues->Spacing, origSpacing, sourceDims, destDims, m_ShouldCancel));
-
-  auto cellDataGroupPath = m_InputValues->CellDataGroupPath;
-  auto& cellDataGroup = m_DataStructure.getDataRefAs<AttributeMatrix>(cellDataGroupPath);
-  std::vector<DataPath> selectedCellArrays;
-
-  // Create the vector of selected cell DataPaths
-  for(const auto& child : cellDataGroup)
+  auto remapResult = GridRemap::Resample(sourceDims, origSpacing, destDims, FloatVec3(m_InputValues->Spacing));
+  if(remapResult.invalid())
   {
-    selectedCellArrays.push_back(m_InputValues->CellDataGroupPath.createChildPath(child.second->getName()));
+    return ConvertResult(std::move(remapResult));
   }
 
-  // The actual cropping of the dataStructure arrays is done in parallel where parallel here
-  // refers to the cropping of each DataArray being done on a separate thread.
-  ParallelTaskAlgorithm taskRunner;
+  // copy over/resample the cell data. All of the arrays are resampled together, split into z slabs that are copied in parallel
   const auto& srcCellDataAM = selectedImageGeom.getCellDataRef();
   auto& destCellDataAM = destImageGeom.getCellDataRef();
-
-  // copy over/resample the cell data
+  std::vector<GridRemap::ArrayPair> cellArrays;
   for(const auto& [dataId, oldDataObject] : srcCellDataAM)
   {
-    if(m_ShouldCancel)
-    {
-      return {};
-    }
-
     const auto& oldDataArray = dynamic_cast<const IDataArray&>(*oldDataObject);
-    const std::string srcName = oldDataArray.getName();
-
-    auto& newDataArray = dynamic_cast<IDataArray&>(destCellDataAM.at(srcName));
-    m_MessageHandler(fmt::format("Resample Volume || Copying Data Array {}", srcName));
+    auto& newDataArray = dynamic_cast<IDataArray&>(destCellDataAM.at(oldDataArray.getName()));
+    cellArrays.emplace_back(&oldDataArray, &newDataArray);
+  }
 
-    ExecuteParallelFunction<CopyTupleUsingIndexList>(oldDataArray.getDataType(), taskRunner, oldDataArray, newDataArray, newIndices);
+  m_MessageHandler(fmt::format("Resample Volume || Copying {} Data Arrays", cellArrays.size()));
+  Result<> copyResult = remapResult.value().copyArrays(cellArrays, m_ShouldCancel);
+  if(copyResult.invalid())
+  {
+    return copyResult;
   }
 
-  taskRunner.wait(); // This will spill over if the number of DataArrays to process does not divide evenly by the number of threads.
   if(m_ShouldCancel)
   {
     return {};
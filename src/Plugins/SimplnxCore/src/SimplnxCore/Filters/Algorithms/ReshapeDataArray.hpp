@@ -58,7 +58,7 @@ Result<> ReshapeNeighborListImpl(DataStructure& dataStructure, const DataPath& i
   {
     if(listIdx < inputNeighborList.getNumberOfTuples())
     {
-      outputNeighborList.setList(listIdx, inputNeighborList.getList(listIdx));
+      outputNeighborList.setList(listIdx, inputNeighborList.at(listIdx));
     }
     else
     {
@@ -19,6 +19,8 @@ struct SIMPLNXCORE_EXPORT SilhouetteInputValues
   DataPath MaskArrayPath;
   DataPath FeatureIdsArrayPath;
   DataPath SilhouetteArrayPath;
+  uint64 SamplesPerCluster = 0; // 0 computes the exact silhouette
+  uint64 Seed = 0;
 };
 
 /**
@@ -3,6 +3,7 @@
 #include "simplnx/Common/Bit.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
+#include "simplnx/Utilities/BufferedBinaryWriter.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
 
 using namespace nx::core;
@@ -84,12 +85,18 @@ Result<> WriteAvizoRectilinearCoordinate::writeData(FILE* outputFile) const
 
   fprintf(outputFile, "@1 # FeatureIds in z, y, x with X moving fastest, then Y, then Z\n");
 
-  const auto& featureIds = m_DataStructure.getDataAs<IDataArray>(m_InputValues->FeatureIdsArrayPath)->template getIDataStoreRefAs<DataStore<int32>>();
+  const auto& featureIds = m_DataStructure.getDataAs<IDataArray>(m_InputValues->FeatureIdsArrayPath)->template getIDataStoreRefAs<AbstractDataStore<int32>>();
   const usize totalPoints = featureIds.getNumberOfTuples();
 
   if(m_InputValues->WriteBinaryFile)
   {
-    fwrite(featureIds.data(), sizeof(int32_t), totalPoints, outputFile);
+    // The header declares the native byte order, so the values are written as they are
+    BufferedBinaryWriter writer(outputFile);
+    Result<> writeResult = MergeResults(writer.writeValues(featureIds, endian::native, m_ShouldCancel), writer.flush());
+    if(writeResult.invalid())
+    {
+      return writeResult;
+    }
   }
   else
   {
@@ -116,15 +123,25 @@ Result<> WriteAvizoRectilinearCoordinate::writeData(FILE* outputFile) const
 
   if(m_InputValues->WriteBinaryFile)
   {
-    for(int d = 0; d < 3; ++d)
+    BufferedBinaryWriter writer(outputFile);
+    Result<> writeResult;
+    for(int d = 0; d < 3 && writeResult.valid(); ++d)
     {
       std::vector<float> coords(dims[d]);
       for(size_t i = 0; i < dims[d]; ++i)
       {
         coords[i] = origin[d] + (res[d] * i);
       }
-      fwrite(reinterpret_cast<char*>(coords.data()), sizeof(char), sizeof(char) * sizeof(float) * dims[d], outputFile);
-      fprintf(outputFile, "\n");
+      writeResult = writer.writeValues(nonstd::span<const float>(coords), endian::native);
+      if(writeResult.valid())
+      {
+        writeResult = writer.write("\n");
+      }
+    }
+    writeResult = MergeResults(std::move(writeResult), writer.flush());
+    if(writeResult.invalid())
+    {
+      return writeResult;
     }
   }
   else
@@ -2,6 +2,7 @@
 
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
+#include "simplnx/Utilities/BufferedBinaryWriter.hpp"
 
 #include <chrono>
 #include <ctime>
@@ -87,12 +88,18 @@ Result<> WriteAvizoUniformCoordinate::writeData(FILE* outputFile) const
 {
   fprintf(outputFile, "@1\n");
 
-  const auto& featureIds = m_DataStructure.getDataAs<IDataArray>(m_InputValues->FeatureIdsArrayPath)->template getIDataStoreRefAs<DataStore<int32>>();
+  const auto& featureIds = m_DataStructure.getDataAs<IDataArray>(m_InputValues->FeatureIdsArrayPath)->template getIDataStoreRefAs<AbstractDataStore<int32>>();
   const usize totalPoints = featureIds.getNumberOfTuples();
 
   if(m_InputValues->WriteBinaryFile)
   {
-    fwrite(featureIds.data(), sizeof(int32), totalPoints, outputFile);
+    // The header declares the native byte order, so the values are written as they are
+    BufferedBinaryWriter writer(outputFile);
+    Result<> writeResult = MergeResults(writer.writeValues(featureIds, endian::native, m_ShouldCancel), writer.flush());
+    if(writeResult.invalid())
+    {
+      return writeResult;
+    }
   }
   else
   {
@@ -2,6 +2,7 @@
 
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
+#include "simplnx/Utilities/BufferedBinaryWriter.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 
@@ -69,8 +70,13 @@ Result<> WriteVtkRectilinearGrid::operator()()
 
   for(const DataPath& arrayPath : m_InputValues->SelectedDataArrayPaths)
   {
-    ExecuteDataFunction(WriteVtkDataArrayFunctor{}, m_DataStructure.getDataAs<IDataArray>(arrayPath)->getDataType(), outputFile, m_InputValues->WriteBinaryFile, m_DataStructure, arrayPath,
-                        m_MessageHandler);
+    Result<> writeArrayResult = ExecuteDataFunction(WriteVtkDataArrayFunctor{}, m_DataStructure.getDataAs<IDataArray>(arrayPath)->getDataType(), outputFile, m_InputValues->WriteBinaryFile,
+                                                    m_DataStructure, arrayPath, m_MessageHandler, m_ShouldCancel);
+    if(writeArrayResult.invalid())
+    {
+      fclose(outputFile);
+      return MergeResults(writeArrayResult, MakeErrorResult(-2078, fmt::format("Error writing array '{}' to vtk file '{}'", arrayPath.toString(), m_InputValues->OutputFile.string())));
+    }
   }
 
   fclose(outputFile);
@@ -109,22 +115,21 @@ Result<> WriteVtkRectilinearGrid::writeCoords(FILE* outputFile, const std::strin
   if(m_InputValues->WriteBinaryFile)
   {
     std::vector<T> data(nPoints);
-    T d;
     for(int idx = 0; idx < nPoints; ++idx)
     {
-      d = idx * step + min;
-      if constexpr(endian::little == endian::native)
-      {
-        d = nx::core::byteswap(d);
-      }
-      data[idx] = d;
+      data[idx] = idx * step + min;
+    }
+    BufferedBinaryWriter writer(outputFile);
+    Result<> writeResult = writer.writeValues(nonstd::span<const T>(data), endian::big);
+    if(writeResult.valid())
+    {
+      writeResult = writer.write("\n"); // Write a newline character at the end of the coordinates
     }
-    const usize totalWritten = fwrite(static_cast<void*>(data.data()), sizeof(T), static_cast<usize>(nPoints), outputFile);
-    fprintf(outputFile, "\n"); // Write a newline character at the end of the coordinates
-    if(totalWritten != static_cast<usize>(nPoints))
+    writeResult = MergeResults(std::move(writeResult), writer.flush());
+    if(writeResult.invalid())
     {
       fclose(outputFile);
-      return MakeErrorResult(-2074, fmt::format("Error Writing Binary VTK Data into file"));
+      return MergeResults(writeResult, MakeErrorResult(-2074, fmt::format("Error Writing Binary VTK Data into file")));
     }
   }
   else
@@ -345,6 +345,7 @@ void translateGeometry(IGeometry& geometry, const FloatVec3& translation)
       vertices[3 * i + 1] += translation[1];
       vertices[3 * i + 2] += translation[2];
     }
+    geometry2d.markModified();
     return;
   }
     // 3D Geometries
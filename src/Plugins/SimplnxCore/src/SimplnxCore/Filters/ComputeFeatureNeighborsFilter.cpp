@@ -407,15 +407,20 @@ Result<> ComputeFeatureNeighborsFilter::executeImpl(DataStructure& dataStructure
       neighborsurfacearealist[i].push_back(area);
     }
     numNeighbors[i] = static_cast<int32>(neighborlist[i].size());
+  }
 
-    // Set the vector for each list into the NeighborList Object
-    NeighborList<int32>::SharedVectorType sharedNeiLst(new std::vector<int32>);
-    sharedNeiLst->assign(neighborlist[i].begin(), neighborlist[i].end());
-    neighborList.setList(static_cast<int32>(i), sharedNeiLst);
-
-    NeighborList<float32>::SharedVectorType sharedSAL(new std::vector<float32>);
-    sharedSAL->assign(neighborsurfacearealist[i].begin(), neighborsurfacearealist[i].end());
-    sharedSurfaceAreaList.setList(static_cast<int32>(i), sharedSAL);
+  // Pack the lists into the NeighborList Objects in one allocation each
+  std::vector<usize> listSizes(totalFeatures, 0);
+  for(usize i = 1; i < totalFeatures; i++)
+  {
+    listSizes[i] = neighborlist[i].size();
+  }
+  neighborList.allocateLists(listSizes);
+  sharedSurfaceAreaList.allocateLists(listSizes);
+  for(usize i = 1; i < totalFeatures; i++)
+  {
+    std::copy(neighborlist[i].begin(), neighborlist[i].end(), neighborList.getListSpan(i).begin());
+    std::copy(neighborsurfacearealist[i].begin(), neighborsurfacearealist[i].end(), sharedSurfaceAreaList.getListSpan(i).begin());
   }
 
   return {};
@@ -11,6 +11,7 @@
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
+#include "simplnx/Utilities/FeatureReductionUtilities.hpp"
 
 using namespace nx::core;
 
@@ -132,30 +133,50 @@ Result<> ComputeFeaturePhasesFilter::executeImpl(DataStructure& dataStructure, c
     return validateResults;
   }
 
-  usize totalPoints = featureIds.getNumberOfTuples();
-  std::map<int32, int32> featureMap;
-  std::map<int32, int32> warningMap;
+  namespace fru = FeatureReductionUtilities;
+  const usize numFeatures = featurePhases.getNumberOfTuples();
 
-  for(usize i = 0; i < totalPoints; i++)
+  // Each feature takes the phase of its last element
+  auto firstPhasesResult = fru::FeatureReduce(featureIds, cellPhases, numFeatures, fru::First<int32>{}, shouldCancel);
+  if(firstPhasesResult.invalid())
   {
-    if(shouldCancel)
-    {
-      return {};
-    }
+    return ConvertResult(std::move(firstPhasesResult));
+  }
+  auto lastPhasesResult = fru::FeatureReduce(featureIds, cellPhases, numFeatures, fru::Last<int32>{}, shouldCancel);
+  if(lastPhasesResult.invalid())
+  {
+    return ConvertResult(std::move(lastPhasesResult));
+  }
+  if(shouldCancel)
+  {
+    return {};
+  }
+  const auto& firstPhases = firstPhasesResult.value();
+  const auto& lastPhases = lastPhasesResult.value();
 
-    int32 gnum = featureIds[i];
-    featureMap.insert({gnum, cellPhases[i]});
+  // Count the elements whose phase differs from the first element of their feature
+  auto phaseMismatch = [&](usize i, usize comp) { return cellPhases[i] != firstPhases[featureIds[i]].value ? 1 : 0; };
+  auto mismatchCountsResult = fru::FeatureReduce(featureIds, numFeatures, 1, phaseMismatch, fru::Sum<int32>{}, shouldCancel);
+  if(mismatchCountsResult.invalid())
+  {
+    return ConvertResult(std::move(mismatchCountsResult));
+  }
+  if(shouldCancel)
+  {
+    return {};
+  }
 
-    int32 curPhaseVal = featureMap[gnum];
-    if(curPhaseVal != cellPhases[i])
+  std::map<int32, int32> warningMap;
+  for(usize featureId = 0; featureId < numFeatures; featureId++)
+  {
+    if(lastPhases[featureId].elementIndex != fru::k_NoElement)
+    {
+      featurePhases[featureId] = lastPhases[featureId].value;
+    }
+    if(mismatchCountsResult.value()[featureId] > 0)
     {
-      auto [iter, insertSuccess] = warningMap.insert({gnum, 1});
-      if(!insertSuccess)
-      {
-        iter->second += 1;
-      }
+      warningMap[static_cast<int32>(featureId)] = mismatchCountsResult.value()[featureId];
     }
-    featurePhases[gnum] = cellPhases[i];
   }
 
   Result<> result;
@@ -2,6 +2,7 @@
 
 #include "simplnx/Common/Numbers.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/Geometry/IGridGeometry.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Filter/Actions/CreateArrayAction.hpp"
 #include "simplnx/Parameters/ArraySelectionParameter.hpp"
@@ -10,6 +11,7 @@
 #include "simplnx/Parameters/DataGroupSelectionParameter.hpp"
 #include "simplnx/Parameters/DataObjectNameParameter.hpp"
 #include "simplnx/Parameters/GeometrySelectionParameter.hpp"
+#include "simplnx/Utilities/FeatureReductionUtilities.hpp"
 
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
@@ -148,8 +150,6 @@ Result<> ComputeFeatureSizesFilter::executeImpl(DataStructure& dataStructure, co
 
   const auto& featureIds = dataStructure.getDataRefAs<Int32Array>(args.value<DataPath>(k_CellFeatureIdsArrayPath_Key)).getDataStoreRef();
 
-  usize totalPoints = featureIds.getNumberOfTuples();
-
   auto geomPath = args.value<DataPath>(k_GeometryPath_Key);
   auto* geom = dataStructure.getDataAs<IGeometry>(geomPath);
 
@@ -167,14 +167,16 @@ Result<> ComputeFeatureSizesFilter::executeImpl(DataStructure& dataStructure, co
     usize maxValue = featureIds[featureIdsMaxIdx];
     usize numFeatures = maxValue + 1;
 
-    std::vector<uint64> featureCounts(numFeatures, 0);
-
-    for(size_t j = 0; j < totalPoints; j++)
+    auto featureCountsResult = FeatureReductionUtilities::FeatureCount(featureIds, numFeatures, shouldCancel);
+    if(featureCountsResult.invalid())
+    {
+      return ConvertResult(std::move(featureCountsResult));
+    }
+    if(shouldCancel)
     {
-      int32_t gnum = featureIds[j];
-      auto temp = featureCounts[gnum] + 1;
-      featureCounts[gnum] = temp;
+      return {};
     }
+    const std::vector<uint64>& featureCounts = featureCountsResult.value();
 
     FloatVec3 spacing = imageGeom->getSpacing();
 
@@ -211,7 +213,7 @@ Result<> ComputeFeatureSizesFilter::executeImpl(DataStructure& dataStructure, co
     }
     else
     {
-      float32 res_scalar = spacing[0] * spacing[1] * spacing[2];
+      float32 res_scalar = imageGeom->getElementSize(0);
       float vol_term = (4.0f / 3.0f) * k_PI;
       for(usize i = 1; i < numFeatures; i++)
       {
@@ -248,29 +250,54 @@ Result<> ComputeFeatureSizesFilter::executeImpl(DataStructure& dataStructure, co
 
     usize numFeatures = volumes.getNumberOfTuples();
 
-    int32_t err = geom->findElementSizes(false);
-    if(err < 0)
+    // Grid geometries compute their element sizes on the fly, so the array is only built when it is kept
+    const auto* gridGeom = dynamic_cast<const IGridGeometry*>(geom);
+    if(gridGeom == nullptr || saveElementSizes)
     {
-      std::string ss = fmt::format("Error computing Element sizes for Geometry type {}", geom->getTypeName());
-      return {nonstd::make_unexpected(std::vector<Error>{Error{err, ss}})};
+      int32_t err = geom->findElementSizes(false);
+      if(err < 0)
+      {
+        std::string ss = fmt::format("Error computing Element sizes for Geometry type {}", geom->getTypeName());
+        return {nonstd::make_unexpected(std::vector<Error>{Error{err, ss}})};
+      }
     }
 
-    const Float32Array* elemSizes = geom->getElementSizes();
-
-    std::vector<float> featureCounts(numFeatures, 1);
-
-    for(size_t j = 0; j < totalPoints; j++)
+    auto featureCountsResult = FeatureReductionUtilities::FeatureCount(featureIds, numFeatures, shouldCancel);
+    if(featureCountsResult.invalid())
+    {
+      return ConvertResult(std::move(featureCountsResult));
+    }
+    Result<std::vector<float64>> featureVolumesResult;
+    if(gridGeom != nullptr)
+    {
+      auto elementSize = [gridGeom](usize elementIndex, usize /*comp*/) { return gridGeom->getElementSize(elementIndex); };
+      featureVolumesResult = FeatureReductionUtilities::FeatureReduce(featureIds, numFeatures, 1, elementSize, FeatureReductionUtilities::Sum<float32, float64>{}, shouldCancel);
+    }
+    else
+    {
+      featureVolumesResult =
+          FeatureReductionUtilities::FeatureReduce(featureIds, geom->getElementSizes()->getDataStoreRef(), numFeatures, FeatureReductionUtilities::Sum<float32, float64>{}, shouldCancel);
+    }
+    if(featureVolumesResult.invalid())
     {
-      int32 gnum = featureIds[j];
-      auto temp = featureCounts[gnum] + 1;
-      featureCounts[gnum] = temp;
-      auto temp2 = volumes[gnum];
-      volumes[gnum] = temp2 + (*elemSizes)[j];
+      return ConvertResult(std::move(featureVolumesResult));
     }
+    if(shouldCancel)
+    {
+      return {};
+    }
+    const std::vector<uint64>& featureCounts = featureCountsResult.value();
+    const std::vector<float64>& featureVolumes = featureVolumesResult.value();
+
     float vol_term = (4.0f / 3.0f) * k_PI;
+    for(size_t i = 0; i < numFeatures; i++)
+    {
+      volumes[i] = volumes[i] + static_cast<float32>(featureVolumes[i]);
+    }
     for(size_t i = 1; i < numFeatures; i++)
     {
-      numElements[i] = static_cast<int32>(featureCounts[i]);
+      // The counts have always started at one for non-image geometries
+      numElements[i] = static_cast<int32>(featureCounts[i] + 1);
       float rad = volumes[i] / vol_term;
       float diameter = 2.0f * powf(rad, 0.3333333333f);
       equivalentDiameters[i] = diameter;
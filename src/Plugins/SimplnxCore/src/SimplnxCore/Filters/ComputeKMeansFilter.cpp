@@ -78,6 +78,10 @@ Parameters ComputeKMeansFilter::parameters() const
   params.insert(
       std::make_unique<ChoicesParameter>(k_DistanceMetric_Key, "Distance Metric", "Distance Metric type to be used for calculations", to_underlying(ClusterUtilities::DistanceMetric::Euclidean),
                                          ChoicesParameter::Choices{"Euclidean", "Squared Euclidean", "Manhattan", "Cosine", "Pearson", "Squared Pearson"})); // sequence dependent DO NOT REORDER
+  params.insert(std::make_unique<ChoicesParameter>(k_InitializationMethod_Key, "Initialization Method",
+                                                   "How the initial clusters are chosen. K-Means++ spreads the initial clusters apart and usually converges in fewer iterations",
+                                                   to_underlying(ClusterUtilities::InitializationMethod::Random),
+                                                   ChoicesParameter::Choices{"Random", "K-Means++"})); // sequence dependent DO NOT REORDER
 
   params.insertSeparator(Parameters::Separator{"Optional Data Mask"});
   params.insertLinkableParameter(std::make_unique<BoolParameter>(k_UseMask_Key, "Use Mask Array", "Specifies whether or not to use a mask array", false));
@@ -195,6 +199,7 @@ Result<> ComputeKMeansFilter::executeImpl(DataStructure& dataStructure, const Ar
 
   inputValues.InitClusters = filterArgs.value<uint64>(k_InitClusters_Key);
   inputValues.DistanceMetric = static_cast<ClusterUtilities::DistanceMetric>(filterArgs.value<ChoicesParameter::ValueType>(k_DistanceMetric_Key));
+  inputValues.InitMethod = static_cast<ClusterUtilities::InitializationMethod>(filterArgs.value<ChoicesParameter::ValueType>(k_InitializationMethod_Key));
   inputValues.MaskArrayPath = maskPath;
   inputValues.MeansArrayPath = filterArgs.value<DataPath>(k_FeatureAMPath_Key).createChildPath(filterArgs.value<std::string>(k_MeansArrayName_Key));
   inputValues.Seed = seed;
@@ -26,6 +26,7 @@ public:
   // Parameter Keys
   static inline constexpr StringLiteral k_InitClusters_Key = "init_clusters";
   static inline constexpr StringLiteral k_DistanceMetric_Key = "distance_metric_index";
+  static inline constexpr StringLiteral k_InitializationMethod_Key = "initialization_method_index";
   static inline constexpr StringLiteral k_UseMask_Key = "use_mask";
   static inline constexpr StringLiteral k_SelectedArrayPath_Key = "selected_array_path";
   static inline constexpr StringLiteral k_MaskArrayPath_Key = "mask_array_path";
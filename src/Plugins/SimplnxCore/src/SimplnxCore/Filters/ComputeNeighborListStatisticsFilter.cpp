@@ -93,11 +93,14 @@ public:
       throw std::invalid_argument("ComputeNeighborListStatisticsFilter::compute() could not dynamic_cast 'Summation' array to needed type. Check input array selection.");
     }
 
-    auto& sourceList = dynamic_cast<NeighborListType&>(m_Source);
+    const auto& sourceList = dynamic_cast<const NeighborListType&>(m_Source);
 
+    // The statistics calculations need a container, reuse one buffer for all lists
+    std::vector<T> tmpList;
     for(usize i = start; i < end; i++)
     {
-      const std::vector<T>& tmpList = sourceList[i];
+      const nonstd::span<const T> sourceValues = sourceList.at(i);
+      tmpList.assign(sourceValues.begin(), sourceValues.end());
 
       if(m_Length)
       {
@@ -9,54 +9,24 @@
 #include "simplnx/Parameters/MultiPathSelectionParameter.hpp"
 #include "simplnx/Parameters/StringParameter.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
-#include "simplnx/Utilities/ParallelAlgorithmUtilities.hpp"
+#include "simplnx/Utilities/FeatureReductionUtilities.hpp"
+#include "simplnx/Utilities/FilterUtilities.hpp"
 
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
-#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
-
 using namespace nx::core;
 
 namespace
 {
-template <typename T>
-class CopyFeatureArrayToElementArrayImpl
+struct CopyFeatureArrayToElementArrayFunctor
 {
-public:
-  using StoreType = AbstractDataStore<T>;
-
-  CopyFeatureArrayToElementArrayImpl(const IDataArray* selectedFeatureArray, const Int32AbstractDataStore& featureIdsStore, IDataArray* createdArray, const std::atomic_bool& shouldCancel)
-  : m_SelectedFeature(selectedFeatureArray->template getIDataStoreRefAs<StoreType>())
-  , m_FeatureIdsStore(featureIdsStore)
-  , m_CreatedStore(createdArray->template getIDataStoreRefAs<StoreType>())
-  , m_ShouldCancel(shouldCancel)
+  template <typename T>
+  Result<> operator()(const IDataArray* selectedFeatureArray, const Int32AbstractDataStore& featureIdsStore, IDataArray* createdArray, const std::atomic_bool& shouldCancel)
   {
+    const auto& selectedFeatureStore = selectedFeatureArray->template getIDataStoreRefAs<AbstractDataStore<T>>();
+    auto& createdStore = createdArray->template getIDataStoreRefAs<AbstractDataStore<T>>();
+    return FeatureReductionUtilities::FeatureBroadcast<T>(featureIdsStore, selectedFeatureStore, createdStore, shouldCancel);
   }
-
-  void operator()(const Range& range) const
-  {
-    const usize totalFeatureArrayComponents = m_SelectedFeature.getNumberOfComponents();
-
-    for(usize i = range.min(); i < range.max(); ++i)
-    {
-      if(m_ShouldCancel)
-      {
-        return;
-      }
-
-      for(usize faComp = 0; faComp < totalFeatureArrayComponents; faComp++)
-      {
-        // Get the feature identifier (or what ever the user has selected as their "Feature" identifier
-        m_CreatedStore[totalFeatureArrayComponents * i + faComp] = m_SelectedFeature[totalFeatureArrayComponents * m_FeatureIdsStore[i] + faComp];
-      }
-    }
-  }
-
-private:
-  const StoreType& m_SelectedFeature;
-  const Int32AbstractDataStore& m_FeatureIdsStore;
-  StoreType& m_CreatedStore;
-  const std::atomic_bool& m_ShouldCancel;
 };
 } // namespace
 
@@ -185,10 +155,12 @@ Result<> CopyFeatureArrayToElementArrayFilter::executeImpl(DataStructure& dataSt
     }
 
     messageHandler(IFilter::ProgressMessage{IFilter::ProgressMessage::Type::Info, fmt::format("Copying data into target array '{}'...", createdArrayPath.toString())});
-    ParallelDataAlgorithm dataAlg;
-    dataAlg.setRange(0, featureIds.getNumberOfTuples());
-    ExecuteParallelFunction<::CopyFeatureArrayToElementArrayImpl>(selectedFeatureArray->getDataType(), dataAlg, selectedFeatureArray, featureIds.getDataStoreRef(),
-                                                                  dataStructure.getDataAs<IDataArray>(createdArrayPath), shouldCancel);
+    results = ExecuteDataFunction(CopyFeatureArrayToElementArrayFunctor{}, selectedFeatureArray->getDataType(), selectedFeatureArray, featureIds.getDataStoreRef(),
+                                  dataStructure.getDataAs<IDataArray>(createdArrayPath), shouldCancel);
+    if(results.invalid())
+    {
+      return results;
+    }
   }
 
   return {};
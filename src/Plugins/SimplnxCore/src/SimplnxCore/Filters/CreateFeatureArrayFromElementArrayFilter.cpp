@@ -9,13 +9,47 @@
 #include "simplnx/Parameters/DataGroupSelectionParameter.hpp"
 #include "simplnx/Parameters/DataObjectNameParameter.hpp"
 #include "simplnx/Utilities/DataObjectUtilities.hpp"
+#include "simplnx/Utilities/FeatureReductionUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
+#include <numeric>
+
 using namespace nx::core;
 
 namespace
 {
+namespace fru = FeatureReductionUtilities;
+
+/**
+ * @brief Finds the first element of each feature that is not set. Elements that are set pass their own index as value.
+ */
+struct FirstSetElementOp
+{
+  using AccumulatorType = usize;
+
+  AccumulatorType identity() const
+  {
+    return fru::k_NoElement;
+  }
+
+  void accumulate(AccumulatorType& accumulator, usize value, usize elementIndex) const
+  {
+    if(accumulator == fru::k_NoElement)
+    {
+      accumulator = value;
+    }
+  }
+
+  void merge(AccumulatorType& accumulator, const AccumulatorType& later) const
+  {
+    if(accumulator == fru::k_NoElement)
+    {
+      accumulator = later;
+    }
+  }
+};
+
 struct CopyCellDataFunctor
 {
   template <typename T>
@@ -27,45 +61,75 @@ struct CopyCellDataFunctor
     // Initialize the output array with a default value
     createdDataStore.fill(0);
 
-    usize totalCellArrayComponents = selectedCellStore.getNumberOfComponents();
-
-    std::map<int32, usize> featureMap;
-    Result<> result;
+    const usize totalCellArrayComponents = selectedCellStore.getNumberOfComponents();
+    const usize numFeatures = createdDataStore.getNumberOfTuples();
 
-    usize totalCellArrayTuples = selectedCellStore.getNumberOfTuples();
-    for(usize cellTupleIdx = 0; cellTupleIdx < totalCellArrayTuples; cellTupleIdx++)
+    // Find the first and the last tuple of each feature
+    auto cellTupleIndex = [](usize cellTupleIdx, usize comp) { return cellTupleIdx; };
+    auto firstResult = fru::FeatureReduce(featureIds, numFeatures, 1, cellTupleIndex, fru::First<usize>{}, shouldCancel);
+    if(firstResult.invalid())
+    {
+      return ConvertResult(std::move(firstResult));
+    }
+    auto lastResult = fru::FeatureReduce(featureIds, numFeatures, 1, cellTupleIndex, fru::Last<usize>{}, shouldCancel);
+    if(lastResult.invalid())
     {
-      if(shouldCancel)
+      return ConvertResult(std::move(lastResult));
+    }
+    if(shouldCancel)
+    {
+      return {};
+    }
+    const auto& firstTuples = firstResult.value();
+    const auto& lastTuples = lastResult.value();
+
+    // Find the first tuple of each feature whose values differ from the first tuple of that feature
+    auto mismatchedTuple = [&](usize cellTupleIdx, usize comp) {
+      const usize firstInstanceCellTupleIdx = firstTuples[featureIds[cellTupleIdx]].value;
+      for(usize cellCompIdx = 0; cellCompIdx < totalCellArrayComponents; cellCompIdx++)
       {
-        return {};
+        if(selectedCellStore[totalCellArrayComponents * cellTupleIdx + cellCompIdx] != selectedCellStore[totalCellArrayComponents * firstInstanceCellTupleIdx + cellCompIdx])
+        {
+          return cellTupleIdx;
+        }
       }
+      return fru::k_NoElement;
+    };
+    auto mismatchResult = fru::FeatureReduce(featureIds, numFeatures, 1, mismatchedTuple, FirstSetElementOp{}, shouldCancel);
+    if(mismatchResult.invalid())
+    {
+      return ConvertResult(std::move(mismatchResult));
+    }
+    if(shouldCancel)
+    {
+      return {};
+    }
 
-      // Get the feature identifier (or what ever the user has selected as their "Feature" identifier
-      int32 featureIdx = featureIds[cellTupleIdx];
-
-      // Store the index of the first tuple with this feature identifier in the map
-      if(featureMap.find(featureIdx) == featureMap.end())
+    // Copy the values of the last tuple of each feature
+    for(usize featureIdx = 0; featureIdx < numFeatures; featureIdx++)
+    {
+      const usize lastCellTupleIdx = lastTuples[featureIdx].value;
+      if(lastTuples[featureIdx].elementIndex == fru::k_NoElement)
       {
-        featureMap[featureIdx] = totalCellArrayComponents * cellTupleIdx;
+        continue;
       }
-
-      // Check that the values at the current index match the value at the first index
-      usize firstInstanceCellTupleIdx = featureMap[featureIdx];
       for(usize cellCompIdx = 0; cellCompIdx < totalCellArrayComponents; cellCompIdx++)
       {
-        T firstInstanceCellVal = selectedCellStore[firstInstanceCellTupleIdx + cellCompIdx];
-        T currentCellVal = selectedCellStore[totalCellArrayComponents * cellTupleIdx + cellCompIdx];
-        if(currentCellVal != firstInstanceCellVal && result.warnings().empty())
-        {
-          // The values are inconsistent with the first values for this feature identifier, so throw a warning
-          result.warnings().push_back(
-              Warning{-1000, fmt::format("Elements from Feature {} do not all have the same value. The last value copied into Feature {} will be used", featureIdx, featureIdx)});
-        }
-
-        createdDataStore[totalCellArrayComponents * featureIdx + cellCompIdx] = selectedCellStore[totalCellArrayComponents * cellTupleIdx + cellCompIdx];
+        createdDataStore[totalCellArrayComponents * featureIdx + cellCompIdx] = selectedCellStore[totalCellArrayComponents * lastCellTupleIdx + cellCompIdx];
       }
     }
 
+    Result<> result;
+    const auto& mismatchedTuples = mismatchResult.value();
+    const usize firstMismatchedTupleIdx = std::accumulate(mismatchedTuples.cbegin(), mismatchedTuples.cend(), fru::k_NoElement, [](usize a, usize b) { return std::min(a, b); });
+    if(firstMismatchedTupleIdx != fru::k_NoElement)
+    {
+      // The values are inconsistent with the first values for this feature identifier, so throw a warning
+      const int32 featureIdx = featureIds[firstMismatchedTupleIdx];
+      result.warnings().push_back(
+          Warning{-1000, fmt::format("Elements from Feature {} do not all have the same value. The last value copied into Feature {} will be used", featureIdx, featureIdx)});
+    }
+
     return result;
   }
 };
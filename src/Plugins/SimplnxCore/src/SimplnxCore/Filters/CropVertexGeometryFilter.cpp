@@ -12,34 +12,10 @@
 #include "simplnx/Parameters/VectorParameter.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
 #include "simplnx/Utilities/SIMPLConversion.hpp"
+#include "simplnx/Utilities/StreamCompaction.hpp"
 
 namespace nx::core
 {
-namespace
-{
-struct CopyDataToCroppedGeometryFunctor
-{
-  template <typename T>
-  void operator()(const IDataArray* inDataRef, IDataArray* outDataRef, const std::vector<int64>& croppedPoints)
-  {
-    const auto& inputData = inDataRef->template getIDataStoreRefAs<AbstractDataStore<T>>();
-    auto& croppedData = outDataRef->template getIDataStoreRefAs<AbstractDataStore<T>>();
-
-    usize nComps = inDataRef->getNumberOfComponents();
-
-    for(std::vector<int64>::size_type i = 0; i < croppedPoints.size(); i++)
-    {
-      for(usize d = 0; d < nComps; d++)
-      {
-        usize tmpIndex = nComps * i + d;
-        usize ptrIndex = nComps * croppedPoints[i] + d;
-        croppedData[tmpIndex] = inputData[ptrIndex];
-      }
-    }
-  }
-};
-} // namespace
-
 //------------------------------------------------------------------------------
 std::string CropVertexGeometryFilter::name() const
 {
@@ -217,28 +193,21 @@ Result<> CropVertexGeometryFilter::executeImpl(DataStructure& dataStructure, con
   auto zMax = posMax[2];
 
   auto& vertices = dataStructure.getDataRefAs<VertexGeom>(vertexGeomPath);
-  auto numVerts = static_cast<int64>(vertices.getNumberOfVertices());
   auto* verticesPtr = vertices.getVertices();
-  auto& allVerts = verticesPtr->getDataStoreRef();
-  std::vector<int64> croppedPoints;
-  croppedPoints.reserve(numVerts);
-
-  for(int64 i = 0; i < numVerts; i++)
+  const auto& allVerts = verticesPtr->getDataStoreRef();
+  const StreamCompaction croppedPoints = StreamCompaction::Create(
+      vertices.getNumberOfVertices(),
+      [&](usize i) {
+        return allVerts[3 * i + 0] >= xMin && allVerts[3 * i + 0] <= xMax && allVerts[3 * i + 1] >= yMin && allVerts[3 * i + 1] <= yMax && allVerts[3 * i + 2] >= zMin && allVerts[3 * i + 2] <= zMax;
+      },
+      {&allVerts}, shouldCancel);
+  if(shouldCancel)
   {
-    if(shouldCancel)
-    {
-      return {};
-    }
-    if(allVerts[3 * i + 0] >= xMin && allVerts[3 * i + 0] <= xMax && allVerts[3 * i + 1] >= yMin && allVerts[3 * i + 1] <= yMax && allVerts[3 * i + 2] >= zMin && allVerts[3 * i + 2] <= zMax)
-    {
-      croppedPoints.push_back(i);
-    }
+    return {};
   }
 
-  croppedPoints.shrink_to_fit();
-
   auto& crop = dataStructure.getDataRefAs<VertexGeom>(croppedGeomPath);
-  usize numTuples = croppedPoints.size();
+  usize numTuples = croppedPoints.getNumberOfKept();
   crop.resizeVertexList(numTuples);
   std::vector<usize> tDims = {numTuples};
 
@@ -246,27 +215,17 @@ Result<> CropVertexGeometryFilter::executeImpl(DataStructure& dataStructure, con
   auto& vertedDataAttMatrix = dataStructure.getDataRefAs<AttributeMatrix>(croppedVertexDataPath);
   vertedDataAttMatrix.resizeTuples(tDims);
 
-  for(usize i = 0; i < numTuples; i++)
-  {
-    if(shouldCancel)
-    {
-      return {};
-    }
-    auto coords = vertices.getVertexCoordinate(croppedPoints[i]);
-    crop.setVertexCoordinate(i, coords);
-  }
-
+  std::vector<StreamCompaction::ArrayPair> arrays = {{verticesPtr, crop.getVertices()}};
   for(auto&& targetArrayPath : targetArrays)
   {
     DataPath destArrayPath(croppedVertexDataPath.createChildPath(targetArrayPath.getTargetName()));
 
     const auto* srcArray = dataStructure.getDataAs<IDataArray>(targetArrayPath);
     auto* destArray = dataStructure.getDataAs<IDataArray>(destArrayPath);
-
-    ExecuteDataFunction(CopyDataToCroppedGeometryFunctor{}, srcArray->getDataType(), srcArray, destArray, croppedPoints);
+    arrays.emplace_back(srcArray, destArray);
   }
 
-  return {};
+  return croppedPoints.copyArrays(arrays, shouldCancel);
 }
 
 namespace
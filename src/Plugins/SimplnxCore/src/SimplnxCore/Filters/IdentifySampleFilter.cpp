@@ -7,6 +7,7 @@
 #include "simplnx/Parameters/DataGroupSelectionParameter.hpp"
 #include "simplnx/Parameters/GeometrySelectionParameter.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/GridNeighborhood.hpp"
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
 namespace nx::core
@@ -23,33 +24,13 @@ struct IdentifySampleFunctor
 
     const auto totalPoints = static_cast<int64>(goodVoxelsPtr->getNumberOfTuples());
 
-    SizeVec3 uDims = imageGeom->getDimensions();
+    const GridNeighborhood<GridConnectivity::Face> neighborhood(imageGeom->getDimensions());
 
-    const int64 dims[3] = {
-        static_cast<int64>(uDims[0]),
-        static_cast<int64>(uDims[1]),
-        static_cast<int64>(uDims[2]),
-    };
-
-    int64 neighborPoints[6] = {0, 0, 0, 0, 0, 0};
-    const int64 xp = dims[0];
-    const int64 yp = dims[1];
-    const int64 zp = dims[2];
-
-    neighborPoints[0] = -(xp * yp);
-    neighborPoints[1] = -xp;
-    neighborPoints[2] = -1;
-    neighborPoints[3] = 1;
-    neighborPoints[4] = xp;
-    neighborPoints[5] = (xp * yp);
     std::vector<int64> currentVList;
     std::vector<bool> checked(totalPoints, false);
     std::vector<bool> sample(totalPoints, false);
     int64 biggestBlock = 0;
     usize count = 0;
-    int32 good = 0;
-    int64 neighbor = 0;
-    int64 column = 0, row = 0, plane = 0;
     int64 index = 0;
 
     // In this loop over the data we are finding the biggest contiguous set of GoodVoxels and calling that the 'sample'  All GoodVoxels that do not touch the 'sample'
@@ -74,43 +55,13 @@ struct IdentifySampleFunctor
         while(count < currentVList.size())
         {
           index = currentVList[count];
-          column = index % xp;
-          row = (index / xp) % yp;
-          plane = index / (xp * yp);
-          for(int32 j = 0; j < 6; j++)
-          {
-            good = 1;
-            neighbor = index + neighborPoints[j];
-            if(j == 0 && plane == 0)
-            {
-              good = 0;
-            }
-            if(j == 5 && plane == (zp - 1))
-            {
-              good = 0;
-            }
-            if(j == 1 && row == 0)
-            {
-              good = 0;
-            }
-            if(j == 4 && row == (yp - 1))
-            {
-              good = 0;
-            }
-            if(j == 2 && column == 0)
-            {
-              good = 0;
-            }
-            if(j == 3 && column == (xp - 1))
-            {
-              good = 0;
-            }
-            if(good == 1 && !checked[neighbor] && goodVoxels.getValue(neighbor))
+          neighborhood.forEachNeighbor(static_cast<usize>(index), [&](usize neighbor, usize) {
+            if(!checked[neighbor] && goodVoxels.getValue(neighbor))
             {
-              currentVList.push_back(neighbor);
+              currentVList.push_back(static_cast<int64>(neighbor));
               checked[neighbor] = true;
             }
-          }
+          });
           count++;
         }
         if(static_cast<int64>(currentVList.size()) >= biggestBlock)
@@ -161,47 +112,18 @@ struct IdentifySampleFunctor
           while(count < currentVList.size())
           {
             index = currentVList[count];
-            column = index % xp;
-            row = (index / xp) % yp;
-            plane = index / (xp * yp);
-            if(column == 0 || column == (xp - 1) || row == 0 || row == (yp - 1) || plane == 0 || plane == (zp - 1))
+            const auto position = neighborhood.getPosition(static_cast<usize>(index));
+            if(!neighborhood.isInterior(position[0], position[1], position[2]))
             {
               touchesBoundary = true;
             }
-            for(int32 j = 0; j < 6; j++)
-            {
-              good = 1;
-              neighbor = index + neighborPoints[j];
-              if(j == 0 && plane == 0)
-              {
-                good = 0;
-              }
-              if(j == 5 && plane == (zp - 1))
-              {
-                good = 0;
-              }
-              if(j == 1 && row == 0)
-              {
-                good = 0;
-              }
-              if(j == 4 && row == (yp - 1))
+            neighborhood.forEachNeighbor(static_cast<usize>(index), position[0], position[1], position[2], [&](usize neighbor, usize) {
+              if(!checked[neighbor] && !goodVoxels.getValue(neighbor))
               {
-                good = 0;
-              }
-              if(j == 2 && column == 0)
-              {
-                good = 0;
-              }
-              if(j == 3 && column == (xp - 1))
-              {
-                good = 0;
-              }
-              if(good == 1 && !checked[neighbor] && !goodVoxels.getValue(neighbor))
-              {
-                currentVList.push_back(neighbor);
+                currentVList.push_back(static_cast<int64>(neighbor));
                 checked[neighbor] = true;
               }
-            }
+            });
             count++;
           }
           if(!touchesBoundary)
@@ -18,10 +18,14 @@
 #include "simplnx/Parameters/VectorParameter.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
 #include <cmath>
+#include <limits>
+#include <memory>
+#include <optional>
 
 namespace nx::core
 {
@@ -67,6 +71,15 @@ struct MapPointCloudDataByKernelFunctor
   }
 };
 
+struct CompactNeighborListFunctor
+{
+  template <typename T>
+  void operator()(INeighborList* list)
+  {
+    dynamic_cast<NeighborList<T>*>(list)->compact();
+  }
+};
+
 void determineKernel(uint64 interpolationTechnique, const FloatVec3& sigmas, std::vector<float32>& kernel, const int64 kernelNumVoxels[3])
 {
   usize counter = 0;
@@ -142,6 +155,467 @@ void mapKernelDistances(NeighborList<float32>* kernelDistances, std::vector<floa
     }
   }
 }
+
+// The binned interpolation works on chunks of points while sorting them into voxels
+constexpr usize k_MinPointChunkSize = 65536;
+constexpr usize k_MaxPointChunks = 256;
+
+/**
+ * @brief Voxel offset of a kernel entry. A point in voxel v + offset contributes to voxel v with the given weight.
+ */
+struct KernelOffset
+{
+  int64 x = 0;
+  int64 y = 0;
+  int64 z = 0;
+  float32 weight = 0.0f;
+  float32 distance = 0.0f;
+};
+
+/**
+ * @brief A single point contributing to an output voxel through one of the kernel offsets
+ */
+struct KernelContribution
+{
+  usize pointId = 0;
+  usize offsetId = 0;
+};
+
+/**
+ * @brief Creates the gather offsets of the kernel. The kernel is centered on the point, so the point in voxel
+ * v + d reaches voxel v through the kernel entry of -d. The offsets are ordered so that the source voxels of an
+ * output voxel are visited in ascending index order. Entries with a zero weight are dropped.
+ */
+std::vector<KernelOffset> createGatherOffsets(const std::vector<float32>& kernel, const std::vector<float32>& kernelValDistances, const int64 kernelNumVoxels[3])
+{
+  std::vector<KernelOffset> offsets;
+  offsets.reserve(kernel.size());
+  const usize lastIndex = kernel.size() - 1;
+  usize counter = 0;
+  for(int64 z = -kernelNumVoxels[2]; z <= kernelNumVoxels[2]; z++)
+  {
+    for(int64 y = -kernelNumVoxels[1]; y <= kernelNumVoxels[1]; y++)
+    {
+      for(int64 x = -kernelNumVoxels[0]; x <= kernelNumVoxels[0]; x++)
+      {
+        // Reversing all three offsets reverses the linear kernel index
+        const usize kernelIndex = lastIndex - counter;
+        counter++;
+        if(kernel[kernelIndex] == 0.0f)
+        {
+          continue;
+        }
+        const float32 distance = kernelValDistances.empty() ? 0.0f : kernelValDistances[kernelIndex];
+        offsets.push_back({x, y, z, kernel[kernelIndex], distance});
+      }
+    }
+  }
+  return offsets;
+}
+
+/**
+ * @brief The points sorted by the voxel that contains them. The points of voxel v are stored in
+ * sortedPoints[binStarts[v]] up to sortedPoints[binStarts[v + 1]] in ascending order.
+ */
+struct VoxelBins
+{
+  std::vector<usize> binStarts;
+  std::vector<usize> sortedPoints;
+};
+
+/**
+ * @brief Counts the usable points of each chunk per z slice of the image geometry and records the first
+ * voxel index of each chunk that falls outside the image.
+ */
+class CountSlicePointsImpl
+{
+public:
+  CountSlicePointsImpl(const AbstractDataStore<uint64>& voxelIndices, const AbstractDataStore<bool>* mask, usize chunkSize, usize numPoints, usize sliceSize, usize numSlices,
+                       std::vector<usize>& sliceCounts, std::vector<uint64>& invalidIndices)
+  : m_VoxelIndices(voxelIndices)
+  , m_Mask(mask)
+  , m_ChunkSize(chunkSize)
+  , m_NumPoints(numPoints)
+  , m_SliceSize(sliceSize)
+  , m_NumSlices(numSlices)
+  , m_SliceCounts(sliceCounts)
+  , m_InvalidIndices(invalidIndices)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize maxImageIndex = m_SliceSize * m_NumSlices;
+    for(usize chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      usize* counts = m_SliceCounts.data() + chunk * m_NumSlices;
+      const usize end = std::min(m_NumPoints, (chunk + 1) * m_ChunkSize);
+      for(usize i = chunk * m_ChunkSize; i < end; i++)
+      {
+        if(m_Mask != nullptr && !m_Mask->getValue(i))
+        {
+          continue;
+        }
+        const uint64 index = m_VoxelIndices[i];
+        if(index >= maxImageIndex)
+        {
+          m_InvalidIndices[chunk] = index;
+          break;
+        }
+        counts[index / m_SliceSize]++;
+      }
+    }
+  }
+
+private:
+  const AbstractDataStore<uint64>& m_VoxelIndices;
+  const AbstractDataStore<bool>* m_Mask;
+  usize m_ChunkSize;
+  usize m_NumPoints;
+  usize m_SliceSize;
+  usize m_NumSlices;
+  std::vector<usize>& m_SliceCounts;
+  std::vector<uint64>& m_InvalidIndices;
+};
+
+/**
+ * @brief Writes the ids of the usable points of each chunk to the z slice they belong to. The slice
+ * offsets hold the first output position of every (chunk, slice) pair, so the points stay in ascending order.
+ */
+class ScatterSlicePointsImpl
+{
+public:
+  ScatterSlicePointsImpl(const AbstractDataStore<uint64>& voxelIndices, const AbstractDataStore<bool>* mask, usize chunkSize, usize numPoints, usize sliceSize, usize numSlices,
+                         std::vector<usize>& sliceOffsets, std::vector<usize>& slicePoints)
+  : m_VoxelIndices(voxelIndices)
+  , m_Mask(mask)
+  , m_ChunkSize(chunkSize)
+  , m_NumPoints(numPoints)
+  , m_SliceSize(sliceSize)
+  , m_NumSlices(numSlices)
+  , m_SliceOffsets(sliceOffsets)
+  , m_SlicePoints(slicePoints)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      usize* offsets = m_SliceOffsets.data() + chunk * m_NumSlices;
+      const usize end = std::min(m_NumPoints, (chunk + 1) * m_ChunkSize);
+      for(usize i = chunk * m_ChunkSize; i < end; i++)
+      {
+        if(m_Mask != nullptr && !m_Mask->getValue(i))
+        {
+          continue;
+        }
+        m_SlicePoints[offsets[m_VoxelIndices[i] / m_SliceSize]++] = i;
+      }
+    }
+  }
+
+private:
+  const AbstractDataStore<uint64>& m_VoxelIndices;
+  const AbstractDataStore<bool>* m_Mask;
+  usize m_ChunkSize;
+  usize m_NumPoints;
+  usize m_SliceSize;
+  usize m_NumSlices;
+  std::vector<usize>& m_SliceOffsets;
+  std::vector<usize>& m_SlicePoints;
+};
+
+/**
+ * @brief Sorts the points of each z slice by voxel with a counting sort and fills in the bin starts of the slice's voxels.
+ */
+class SortSliceBinsImpl
+{
+public:
+  SortSliceBinsImpl(const AbstractDataStore<uint64>& voxelIndices, usize sliceSize, const std::vector<usize>& sliceStarts, VoxelBins& bins)
+  : m_VoxelIndices(voxelIndices)
+  , m_SliceSize(sliceSize)
+  , m_SliceStarts(sliceStarts)
+  , m_Bins(bins)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    std::vector<usize> slicePoints;
+    for(usize z = range.min(); z < range.max(); z++)
+    {
+      const usize sliceStart = m_SliceStarts[z];
+      const usize sliceEnd = m_SliceStarts[z + 1];
+      usize* binStarts = m_Bins.binStarts.data() + z * m_SliceSize;
+      slicePoints.assign(m_Bins.sortedPoints.begin() + static_cast<std::ptrdiff_t>(sliceStart), m_Bins.sortedPoints.begin() + static_cast<std::ptrdiff_t>(sliceEnd));
+
+      std::fill(binStarts, binStarts + m_SliceSize, 0);
+      for(usize pointId : slicePoints)
+      {
+        binStarts[m_VoxelIndices[pointId] % m_SliceSize]++;
+      }
+      usize position = sliceStart;
+      for(usize voxel = 0; voxel < m_SliceSize; voxel++)
+      {
+        const usize count = binStarts[voxel];
+        binStarts[voxel] = position;
+        position += count;
+      }
+
+      // The bin starts double as write cursors and are shifted back afterwards
+      for(usize pointId : slicePoints)
+      {
+        m_Bins.sortedPoints[binStarts[m_VoxelIndices[pointId] % m_SliceSize]++] = pointId;
+      }
+      for(usize voxel = m_SliceSize; voxel > 0; voxel--)
+      {
+        binStarts[voxel - 1] = voxel > 1 ? binStarts[voxel - 2] : sliceStart;
+      }
+    }
+  }
+
+private:
+  const AbstractDataStore<uint64>& m_VoxelIndices;
+  usize m_SliceSize;
+  const std::vector<usize>& m_SliceStarts;
+  VoxelBins& m_Bins;
+};
+
+/**
+ * @brief Sorts the usable points by the voxel that contains them. The points are first distributed to the
+ * z slices from per chunk histograms and then sorted within each slice, so no step needs atomics.
+ * @return The first voxel index outside of the image, if any
+ */
+std::optional<uint64> binPointsByVoxel(const AbstractDataStore<uint64>& voxelIndices, const AbstractDataStore<bool>* mask, const SizeVec3& dims, VoxelBins& bins)
+{
+  const usize numPoints = voxelIndices.getNumberOfTuples();
+  const usize sliceSize = dims[0] * dims[1];
+  const usize numSlices = dims[2];
+  const usize chunkSize = std::max(k_MinPointChunkSize, (numPoints + k_MaxPointChunks - 1) / k_MaxPointChunks);
+  const usize numChunks = (numPoints + chunkSize - 1) / chunkSize;
+
+  std::vector<usize> sliceOffsets(numChunks * numSlices, 0);
+  std::vector<uint64> invalidIndices(numChunks, std::numeric_limits<uint64>::max());
+  ParallelDataAlgorithm countAlg;
+  countAlg.setRange(0, numChunks);
+  countAlg.requireStoresInMemory({&voxelIndices, mask});
+  countAlg.execute(CountSlicePointsImpl(voxelIndices, mask, chunkSize, numPoints, sliceSize, numSlices, sliceOffsets, invalidIndices));
+  for(uint64 invalidIndex : invalidIndices)
+  {
+    if(invalidIndex != std::numeric_limits<uint64>::max())
+    {
+      return invalidIndex;
+    }
+  }
+
+  // Turn the counts into output positions ordered by slice first and chunk second
+  std::vector<usize> sliceStarts(numSlices + 1, 0);
+  usize position = 0;
+  for(usize z = 0; z < numSlices; z++)
+  {
+    sliceStarts[z] = position;
+    for(usize chunk = 0; chunk < numChunks; chunk++)
+    {
+      const usize count = sliceOffsets[chunk * numSlices + z];
+      sliceOffsets[chunk * numSlices + z] = position;
+      position += count;
+    }
+  }
+  sliceStarts[numSlices] = position;
+
+  bins.sortedPoints.resize(position);
+  ParallelDataAlgorithm scatterAlg;
+  scatterAlg.setRange(0, numChunks);
+  scatterAlg.requireStoresInMemory({&voxelIndices, mask});
+  scatterAlg.execute(ScatterSlicePointsImpl(voxelIndices, mask, chunkSize, numPoints, sliceSize, numSlices, sliceOffsets, bins.sortedPoints));
+
+  bins.binStarts.resize(sliceSize * numSlices + 1);
+  bins.binStarts.back() = position;
+  ParallelDataAlgorithm sortAlg;
+  sortAlg.setRange(0, numSlices);
+  sortAlg.requireStoresInMemory({&voxelIndices});
+  sortAlg.execute(SortSliceBinsImpl(voxelIndices, sliceSize, sliceStarts, bins));
+
+  return {};
+}
+
+/**
+ * @brief Writes the kernel contributions gathered for one voxel into an output NeighborList.
+ */
+class IKernelListWriter
+{
+public:
+  virtual ~IKernelListWriter() = default;
+
+  virtual void write(usize voxel, const std::vector<KernelContribution>& contributions) const = 0;
+
+  /**
+   * @brief Packs the written lists into one buffer once all voxels are written.
+   */
+  virtual void compact() const = 0;
+};
+
+/**
+ * @brief Writes the source values of the contributing points, optionally multiplied by their kernel weights.
+ */
+template <typename T>
+class KernelValueListWriter : public IKernelListWriter
+{
+public:
+  KernelValueListWriter(const AbstractDataStore<T>& source, NeighborList<T>& destination, const std::vector<KernelOffset>& offsets, bool applyWeights)
+  : m_Source(source)
+  , m_Destination(destination)
+  , m_Offsets(offsets)
+  , m_ApplyWeights(applyWeights)
+  {
+  }
+
+  void write(usize voxel, const std::vector<KernelContribution>& contributions) const override
+  {
+    auto list = std::make_shared<typename NeighborList<T>::VectorType>();
+    list->reserve(contributions.size());
+    for(const auto& contribution : contributions)
+    {
+      if(m_ApplyWeights)
+      {
+        list->push_back(static_cast<T>(m_Offsets[contribution.offsetId].weight * m_Source[contribution.pointId]));
+      }
+      else
+      {
+        list->push_back(m_Source[contribution.pointId]);
+      }
+    }
+    m_Destination.setList(static_cast<int32>(voxel), list);
+  }
+
+  void compact() const override
+  {
+    m_Destination.compact();
+  }
+
+private:
+  const AbstractDataStore<T>& m_Source;
+  NeighborList<T>& m_Destination;
+  const std::vector<KernelOffset>& m_Offsets;
+  bool m_ApplyWeights;
+};
+
+/**
+ * @brief Writes the distances between the voxel and the contributing points.
+ */
+class KernelDistanceListWriter : public IKernelListWriter
+{
+public:
+  KernelDistanceListWriter(NeighborList<float32>& destination, const std::vector<KernelOffset>& offsets)
+  : m_Destination(destination)
+  , m_Offsets(offsets)
+  {
+  }
+
+  void write(usize voxel, const std::vector<KernelContribution>& contributions) const override
+  {
+    auto list = std::make_shared<NeighborList<float32>::VectorType>();
+    list->reserve(contributions.size());
+    for(const auto& contribution : contributions)
+    {
+      list->push_back(m_Offsets[contribution.offsetId].distance);
+    }
+    m_Destination.setList(static_cast<int32>(voxel), list);
+  }
+
+  void compact() const override
+  {
+    m_Destination.compact();
+  }
+
+private:
+  NeighborList<float32>& m_Destination;
+  const std::vector<KernelOffset>& m_Offsets;
+};
+
+struct CreateKernelValueListWriterFunctor
+{
+  template <typename T>
+  std::unique_ptr<IKernelListWriter> operator()(const IDataArray* source, INeighborList* destination, const std::vector<KernelOffset>& offsets, bool applyWeights)
+  {
+    const auto& sourceStore = source->template getIDataStoreRefAs<AbstractDataStore<T>>();
+    auto& destinationList = dynamic_cast<NeighborList<T>&>(*destination);
+    return std::make_unique<KernelValueListWriter<T>>(sourceStore, destinationList, offsets, applyWeights);
+  }
+};
+
+/**
+ * @brief Gathers the kernel contributions of every voxel in a range of z slices. Each task owns whole slices
+ * of the output, so the lists are written without synchronization.
+ */
+class GatherKernelContributionsImpl
+{
+public:
+  GatherKernelContributionsImpl(const VoxelBins& bins, const std::vector<KernelOffset>& offsets, const SizeVec3& dims, const std::vector<std::unique_ptr<IKernelListWriter>>& writers,
+                                const std::atomic_bool& shouldCancel)
+  : m_Bins(bins)
+  , m_Offsets(offsets)
+  , m_Dims(dims)
+  , m_Writers(writers)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const auto dimX = static_cast<int64>(m_Dims[0]);
+    const auto dimY = static_cast<int64>(m_Dims[1]);
+    const auto dimZ = static_cast<int64>(m_Dims[2]);
+    std::vector<KernelContribution> contributions;
+    for(usize z = range.min(); z < range.max(); z++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      for(int64 y = 0; y < dimY; y++)
+      {
+        for(int64 x = 0; x < dimX; x++)
+        {
+          contributions.clear();
+          for(usize offsetId = 0; offsetId < m_Offsets.size(); offsetId++)
+          {
+            const KernelOffset& offset = m_Offsets[offsetId];
+            const int64 sourceX = x + offset.x;
+            const int64 sourceY = y + offset.y;
+            const int64 sourceZ = static_cast<int64>(z) + offset.z;
+            if(sourceX < 0 || sourceX >= dimX || sourceY < 0 || sourceY >= dimY || sourceZ < 0 || sourceZ >= dimZ)
+            {
+              continue;
+            }
+            const auto sourceVoxel = static_cast<usize>((sourceZ * dimY + sourceY) * dimX + sourceX);
+            for(usize slot = m_Bins.binStarts[sourceVoxel]; slot < m_Bins.binStarts[sourceVoxel + 1]; slot++)
+            {
+              contributions.push_back({m_Bins.sortedPoints[slot], offsetId});
+            }
+          }
+          if(contributions.empty())
+          {
+            continue;
+          }
+          const auto voxel = static_cast<usize>((static_cast<int64>(z) * dimY + y) * dimX + x);
+          for(const auto& writer : m_Writers)
+          {
+            writer->write(voxel, contributions);
+          }
+        }
+      }
+    }
+  }
+
+private:
+  const VoxelBins& m_Bins;
+  const std::vector<KernelOffset>& m_Offsets;
+  const SizeVec3& m_Dims;
+  const std::vector<std::unique_ptr<IKernelListWriter>>& m_Writers;
+  const std::atomic_bool& m_ShouldCancel;
+};
 } // namespace
 
 //------------------------------------------------------------------------------
@@ -184,6 +658,9 @@ Parameters InterpolatePointCloudToRegularGridFilter::parameters() const
   params.insertLinkableParameter(std::make_unique<BoolParameter>(k_StoreKernelDistances_Key, "Store Kernel Distances", "Specifies whether or not to store kernel distances", false));
   params.insertLinkableParameter(
       std::make_unique<ChoicesParameter>(k_InterpolationTechnique_Key, "Interpolation Technique", "Selected Interpolation Technique", 0, std::vector<std::string>{"Uniform", "Gaussian"}));
+  params.insert(std::make_unique<BoolParameter>(k_UseBinnedInterpolation_Key, "Use Binned Interpolation",
+                                                "Sorts the points into voxels and gathers the kernel of every voxel in parallel. Unlike the default mode, the kernel is applied over its full z "
+                                                "extent, so results differ when the kernel spans more than one z slice. Recommended for large point clouds.", false));
   params.insert(
       std::make_unique<VectorFloat32Parameter>(k_KernelSize_Key, "Kernel Size", "Specifies the kernel size", std::vector<float32>{1.0f, 1.0f, 1.0f}, std::vector<std::string>{"x", "y", "z"}));
   params.insert(std::make_unique<VectorFloat32Parameter>(k_GaussianSigmas_Key, "Gaussian Sigmas", "Specifies the Gaussian sigmas", std::vector<float32>{1.0f, 1.0f, 1.0f},
@@ -433,6 +910,69 @@ Result<> InterpolatePointCloudToRegularGridFilter::executeImpl(DataStructure& da
     determineKernelDistances(kernelValDistances, kernelNumVoxels, res);
   }
 
+  if(args.value<bool>(k_UseBinnedInterpolation_Key))
+  {
+    messageHandler("Sorting points into voxels...");
+    VoxelBins bins;
+    std::optional<uint64> invalidIndex = binPointsByVoxel(voxelIndices.getDataStoreRef(), mask, dims, bins);
+    if(invalidIndex.has_value())
+    {
+      return MakeErrorResult(-11004,
+                             fmt::format("Index present in the selected Voxel Indices array that falls outside the selected Image Geometry for interpolation.\n Index = {}\n Max Image Index = {}\n",
+                                         *invalidIndex, maxImageIndex));
+    }
+    if(shouldCancel)
+    {
+      return {};
+    }
+
+    const std::vector<KernelOffset> offsets = createGatherOffsets(kernel, kernelValDistances, kernelNumVoxels);
+
+    std::vector<std::unique_ptr<IKernelListWriter>> writers;
+    IParallelAlgorithm::AlgorithmArrays sourceArrays;
+    for(const auto& interpolatedDataPath : interpolatedDataPaths)
+    {
+      const auto* sourceArray = dataStructure.getDataAs<IDataArray>(interpolatedDataPath);
+      if(sourceArray->getDataType() == DataType::boolean)
+      {
+        continue;
+      }
+      auto* destination = dataStructure.getDataAs<INeighborList>(interpolatedGroupPath.createChildPath(interpolatedDataPath.getTargetName()));
+      writers.push_back(ExecuteNeighborFunction(CreateKernelValueListWriterFunctor{}, sourceArray->getDataType(), sourceArray, destination, offsets, true));
+      sourceArrays.push_back(sourceArray);
+    }
+    for(const auto& copyDataPath : copyDataPaths)
+    {
+      const auto* sourceArray = dataStructure.getDataAs<IDataArray>(copyDataPath);
+      if(sourceArray->getDataType() == DataType::boolean)
+      {
+        continue;
+      }
+      auto* destination = dataStructure.getDataAs<INeighborList>(interpolatedGroupPath.createChildPath(copyDataPath.getTargetName()));
+      writers.push_back(ExecuteNeighborFunction(CreateKernelValueListWriterFunctor{}, sourceArray->getDataType(), sourceArray, destination, offsets, false));
+      sourceArrays.push_back(sourceArray);
+    }
+    if(storeKernelDistances)
+    {
+      const DataPath kernelDistPath = interpolatedGroupPath.createChildPath(args.value<std::string>(k_KernelDistancesArrayName_Key));
+      InitializeNeighborList(dataStructure, kernelDistPath);
+      writers.push_back(std::make_unique<KernelDistanceListWriter>(dataStructure.getDataRefAs<Float32NeighborList>(kernelDistPath), offsets));
+    }
+
+    messageHandler("Interpolating Point Cloud...");
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, dims[2]);
+    dataAlg.requireArraysInMemory(sourceArrays);
+    dataAlg.execute(GatherKernelContributionsImpl(bins, offsets, dims, writers, shouldCancel));
+
+    for(const auto& writer : writers)
+    {
+      writer->compact();
+    }
+
+    return {};
+  }
+
   usize progIncrement = numVerts / 100;
   usize prog = 1;
   usize progressInt = 0;
@@ -505,6 +1045,29 @@ Result<> InterpolatePointCloudToRegularGridFilter::executeImpl(DataStructure& da
     }
   }
 
+  // Pack the lists that were appended to voxel by voxel
+  std::vector<DataPath> interpolatedListPaths;
+  for(const auto& dataPath : interpolatedDataPaths)
+  {
+    interpolatedListPaths.push_back(interpolatedGroupPath.createChildPath(dataPath.getTargetName()));
+  }
+  for(const auto& dataPath : copyDataPaths)
+  {
+    interpolatedListPaths.push_back(interpolatedGroupPath.createChildPath(dataPath.getTargetName()));
+  }
+  if(storeKernelDistances)
+  {
+    interpolatedListPaths.push_back(interpolatedGroupPath.createChildPath(args.value<std::string>(k_KernelDistancesArrayName_Key)));
+  }
+  for(const auto& listPath : interpolatedListPaths)
+  {
+    auto* interpolatedList = dataStructure.getDataAs<INeighborList>(listPath);
+    if(interpolatedList != nullptr && interpolatedList->getDataType() != DataType::boolean)
+    {
+      ExecuteNeighborFunction(CompactNeighborListFunctor{}, interpolatedList->getDataType(), interpolatedList);
+    }
+  }
+
   return {};
 }
 
@@ -28,6 +28,7 @@ public:
   static inline constexpr StringLiteral k_UseMask_Key = "use_mask";
   static inline constexpr StringLiteral k_StoreKernelDistances_Key = "store_kernel_distances";
   static inline constexpr StringLiteral k_InterpolationTechnique_Key = "interpolation_index";
+  static inline constexpr StringLiteral k_UseBinnedInterpolation_Key = "use_binned_interpolation";
   static inline constexpr StringLiteral k_KernelSize_Key = "kernel_size";
   static inline constexpr StringLiteral k_GaussianSigmas_Key = "gaussian_sigmas";
   static inline constexpr StringLiteral k_SelectedVertexGeometryPath_Key = "input_vertex_geometry_path";
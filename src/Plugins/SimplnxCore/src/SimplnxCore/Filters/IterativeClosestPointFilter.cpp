@@ -11,9 +11,13 @@
 #include "simplnx/Parameters/DataGroupSelectionParameter.hpp"
 #include "simplnx/Parameters/DataPathSelectionParameter.hpp"
 #include "simplnx/Parameters/NumberParameter.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
 #include <Eigen/Geometry>
+#include <Eigen/SVD>
+
+#include <algorithm>
 
 namespace nx::core
 {
@@ -24,6 +28,12 @@ constexpr int32 k_MissingTargetVertex = -4501;
 constexpr int32 k_BadNumIterations = -4502;
 constexpr int32 k_MissingVertices = -4503;
 constexpr int32 k_EmptyVertices = -4505;
+constexpr int32 k_BadSamplingStride = -4506;
+constexpr int32 k_BadConvergenceTolerance = -4507;
+
+// Number of sampled points reduced into one partial sum. The partial sums are combined in a fixed
+// order so the result does not depend on the number of threads.
+constexpr usize k_ReductionChunkSize = 4096;
 
 template <typename Derived>
 struct VertexGeomAdaptor
@@ -64,6 +74,203 @@ struct VertexGeomAdaptor
     return false;
   }
 };
+
+using KDtree = nanoflann::KDTreeSingleIndexAdaptor<nanoflann::L2_Adaptor<float32, VertexGeomAdaptor<VertexGeom*>>, VertexGeomAdaptor<VertexGeom*>, 3>;
+
+/**
+ * @brief Selects every 'stride'-th moving point starting at 'offset'
+ */
+struct PointSampling
+{
+  usize offset = 0;
+  usize stride = 1;
+  usize count = 0;
+
+  usize pointIndex(usize sample) const
+  {
+    return offset + sample * stride;
+  }
+};
+
+/**
+ * @brief Finds the closest target point of each sampled moving point and sums the sampled moving
+ * and target points of every chunk
+ */
+class FindCorrespondencesImpl
+{
+public:
+  FindCorrespondencesImpl(const KDtree& index, const Float32AbstractDataStore& targetStore, const float32* movingPoints, const PointSampling& sampling, float32* correspondences,
+                          std::vector<Eigen::Vector3d>& movingSums, std::vector<Eigen::Vector3d>& targetSums)
+  : m_Index(index)
+  , m_TargetStore(targetStore)
+  , m_MovingPoints(movingPoints)
+  , m_Sampling(sampling)
+  , m_Correspondences(correspondences)
+  , m_MovingSums(movingSums)
+  , m_TargetSums(targetSums)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      Eigen::Vector3d movingSum = Eigen::Vector3d::Zero();
+      Eigen::Vector3d targetSum = Eigen::Vector3d::Zero();
+      const usize end = std::min((chunk + 1) * k_ReductionChunkSize, m_Sampling.count);
+      for(usize sample = chunk * k_ReductionChunkSize; sample < end; sample++)
+      {
+        const float32* movingPoint = m_MovingPoints + 3 * m_Sampling.pointIndex(sample);
+        usize identifier = 0;
+        float32 dist = 0.0F;
+        nanoflann::KNNResultSet<float32> results(1);
+        results.init(&identifier, &dist);
+        m_Index.findNeighbors(results, movingPoint, nanoflann::SearchParams());
+        for(usize k = 0; k < 3; k++)
+        {
+          const float32 targetValue = m_TargetStore.getValue(3 * identifier + k);
+          m_Correspondences[3 * sample + k] = targetValue;
+          movingSum[k] += movingPoint[k];
+          targetSum[k] += targetValue;
+        }
+      }
+      m_MovingSums[chunk] = movingSum;
+      m_TargetSums[chunk] = targetSum;
+    }
+  }
+
+private:
+  const KDtree& m_Index;
+  const Float32AbstractDataStore& m_TargetStore;
+  const float32* m_MovingPoints;
+  const PointSampling& m_Sampling;
+  float32* m_Correspondences;
+  std::vector<Eigen::Vector3d>& m_MovingSums;
+  std::vector<Eigen::Vector3d>& m_TargetSums;
+};
+
+/**
+ * @brief Sums the cross-covariance of the centered correspondences of every chunk
+ */
+class AccumulateCovarianceImpl
+{
+public:
+  AccumulateCovarianceImpl(const float32* movingPoints, const PointSampling& sampling, const float32* correspondences, const Eigen::Vector3d& movingMean, const Eigen::Vector3d& targetMean,
+                           std::vector<Eigen::Matrix3d>& covarianceSums)
+  : m_MovingPoints(movingPoints)
+  , m_Sampling(sampling)
+  , m_Correspondences(correspondences)
+  , m_MovingMean(movingMean)
+  , m_TargetMean(targetMean)
+  , m_CovarianceSums(covarianceSums)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      Eigen::Matrix3d covarianceSum = Eigen::Matrix3d::Zero();
+      const usize end = std::min((chunk + 1) * k_ReductionChunkSize, m_Sampling.count);
+      for(usize sample = chunk * k_ReductionChunkSize; sample < end; sample++)
+      {
+        const float32* movingPoint = m_MovingPoints + 3 * m_Sampling.pointIndex(sample);
+        const float32* targetPoint = m_Correspondences + 3 * sample;
+        const Eigen::Vector3d moving(movingPoint[0] - m_MovingMean[0], movingPoint[1] - m_MovingMean[1], movingPoint[2] - m_MovingMean[2]);
+        const Eigen::Vector3d target(targetPoint[0] - m_TargetMean[0], targetPoint[1] - m_TargetMean[1], targetPoint[2] - m_TargetMean[2]);
+        covarianceSum.noalias() += target * moving.transpose();
+      }
+      m_CovarianceSums[chunk] = covarianceSum;
+    }
+  }
+
+private:
+  const float32* m_MovingPoints;
+  const PointSampling& m_Sampling;
+  const float32* m_Correspondences;
+  const Eigen::Vector3d& m_MovingMean;
+  const Eigen::Vector3d& m_TargetMean;
+  std::vector<Eigen::Matrix3d>& m_CovarianceSums;
+};
+
+/**
+ * @brief Applies a rigid transform to an interleaved xyz point buffer
+ */
+class ApplyTransformImpl
+{
+public:
+  ApplyTransformImpl(float32* points, const Eigen::Matrix4f& transform)
+  : m_Points(points)
+  , m_Transform(transform)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize j = range.min(); j < range.max(); j++)
+    {
+      Eigen::Vector4f position(m_Points[3 * j + 0], m_Points[3 * j + 1], m_Points[3 * j + 2], 1);
+      Eigen::Vector4f transformedPosition = m_Transform * position;
+      std::memcpy(m_Points + (3 * j), transformedPosition.data(), sizeof(float32) * 3);
+    }
+  }
+
+private:
+  float32* m_Points;
+  const Eigen::Matrix4f& m_Transform;
+};
+
+/**
+ * @brief Computes the least squares rigid transform (Umeyama without scaling) that maps the sampled
+ * moving points onto their correspondences.
+ */
+Eigen::Matrix4f ComputeRigidTransform(const KDtree& index, const Float32AbstractDataStore& targetStore, const float32* movingPoints, const PointSampling& sampling, float32* correspondences)
+{
+  const usize numChunks = (sampling.count + k_ReductionChunkSize - 1) / k_ReductionChunkSize;
+  const float64 oneOverCount = 1.0 / static_cast<float64>(sampling.count);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0ULL, numChunks);
+  dataAlg.requireStoresInMemory({&targetStore});
+
+  std::vector<Eigen::Vector3d> movingSums(numChunks);
+  std::vector<Eigen::Vector3d> targetSums(numChunks);
+  dataAlg.execute(FindCorrespondencesImpl(index, targetStore, movingPoints, sampling, correspondences, movingSums, targetSums));
+
+  Eigen::Vector3d movingMean = Eigen::Vector3d::Zero();
+  Eigen::Vector3d targetMean = Eigen::Vector3d::Zero();
+  for(usize chunk = 0; chunk < numChunks; chunk++)
+  {
+    movingMean += movingSums[chunk];
+    targetMean += targetSums[chunk];
+  }
+  movingMean *= oneOverCount;
+  targetMean *= oneOverCount;
+
+  std::vector<Eigen::Matrix3d> covarianceSums(numChunks);
+  dataAlg.execute(AccumulateCovarianceImpl(movingPoints, sampling, correspondences, movingMean, targetMean, covarianceSums));
+
+  Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
+  for(usize chunk = 0; chunk < numChunks; chunk++)
+  {
+    covariance += covarianceSums[chunk];
+  }
+  covariance *= oneOverCount;
+
+  Eigen::JacobiSVD<Eigen::Matrix3d> svd(covariance, Eigen::ComputeFullU | Eigen::ComputeFullV);
+  Eigen::Vector3d reflection = Eigen::Vector3d::Ones();
+  if(svd.matrixU().determinant() * svd.matrixV().determinant() < 0.0)
+  {
+    reflection[2] = -1.0;
+  }
+  const Eigen::Matrix3d rotation = svd.matrixU() * reflection.asDiagonal() * svd.matrixV().transpose();
+  const Eigen::Vector3d translation = targetMean - rotation * movingMean;
+
+  Eigen::Matrix4d transform = Eigen::Matrix4d::Identity();
+  transform.block<3, 3>(0, 0) = rotation;
+  transform.block<3, 1>(0, 3) = translation;
+  return transform.cast<float32>();
+}
 } // namespace
 
 //------------------------------------------------------------------------------
@@ -103,6 +310,11 @@ Parameters IterativeClosestPointFilter::parameters() const
 
   params.insertSeparator(Parameters::Separator{"Input Parameter(s)"});
   params.insert(std::make_unique<UInt64Parameter>(k_NumIterations_Key, "Number of Iterations", "The number of times to run the algorithm [more increases accuracy]", 1));
+  params.insert(std::make_unique<UInt64Parameter>(k_SamplingStride_Key, "Moving Point Sampling Stride",
+                                                  "Only every n-th moving point is matched in each iteration. The sampled points are rotated between iterations. [1 uses all points]", 1));
+  params.insert(std::make_unique<Float32Parameter>(k_ConvergenceTolerance_Key, "Convergence Tolerance",
+                                                   "Iterations stop early once no element of an iteration's transform differs from the identity by more than this value. [0 always runs all iterations]",
+                                                   0.0F));
   params.insert(std::make_unique<BoolParameter>(k_ApplyTransformation_Key, "Apply Transformation to Moving Geometry", "If checked, geometry will be updated implicitly", false));
 
   params.insertSeparator(Parameters::Separator{"Input Data Objects"});
@@ -133,6 +345,8 @@ IFilter::PreflightResult IterativeClosestPointFilter::preflightImpl(const DataSt
   auto movingVertexPath = args.value<DataPath>(k_MovingVertexPath_Key);
   auto targetVertexPath = args.value<DataPath>(k_TargetVertexPath_Key);
   auto numIterations = args.value<uint64>(k_NumIterations_Key);
+  auto samplingStride = args.value<uint64>(k_SamplingStride_Key);
+  auto convergenceTolerance = args.value<float32>(k_ConvergenceTolerance_Key);
   auto transformArrayPath = args.value<DataPath>(k_TransformArrayPath_Key);
 
   if(dataStructure.getDataAs<VertexGeom>(movingVertexPath) == nullptr)
@@ -152,6 +366,15 @@ IFilter::PreflightResult IterativeClosestPointFilter::preflightImpl(const DataSt
     return {nonstd::make_unexpected(std::vector<Error>{Error{k_BadNumIterations, ss}})};
   }
 
+  if(samplingStride < 1)
+  {
+    return MakePreflightErrorResult(k_BadSamplingStride, "The moving point sampling stride must be at least 1");
+  }
+  if(convergenceTolerance < 0.0F)
+  {
+    return MakePreflightErrorResult(k_BadConvergenceTolerance, fmt::format("The convergence tolerance must be 0 or greater. Value given was {}", convergenceTolerance));
+  }
+
   usize numTuples = 1;
   auto action = std::make_unique<CreateArrayAction>(DataType::float32, std::vector<usize>{numTuples}, std::vector<usize>{16}, transformArrayPath);
 
@@ -170,6 +393,8 @@ Result<> IterativeClosestPointFilter::executeImpl(DataStructure& dataStructure,
   auto numIterations = args.value<uint64>(k_NumIterations_Key);
   auto applyTransformation = args.value<bool>(k_ApplyTransformation_Key);
   auto transformArrayPath = args.value<DataPath>(k_TransformArrayPath_Key);
+  auto samplingStride = args.value<uint64>(k_SamplingStride_Key);
+  auto convergenceTolerance = args.value<float32>(k_ConvergenceTolerance_Key);
 
   auto movingVertexGeom = dataStructure.getDataAs<VertexGeom>(movingVertexPath);
   auto targetVertexGeom = dataStructure.getDataAs<VertexGeom>(targetVertexPath);
@@ -205,68 +430,54 @@ Result<> IterativeClosestPointFilter::executeImpl(DataStructure& dataStructure,
 
   std::vector<float32> movingVector(movingStore.begin(), movingStore.end());
   float32* movingCopyPtr = movingVector.data();
-  DataStructure tmp;
 
   usize numMovingVerts = movingVertexGeom->getNumberOfVertices();
-  std::vector<float32> dynTarget(numMovingVerts * 3, 0.0F);
-  float* dynTargetPtr = dynTarget.data();
+  const usize stride = std::min(static_cast<usize>(samplingStride), numMovingVerts);
+  std::vector<float32> dynTarget(((numMovingVerts + stride - 1) / stride) * 3, 0.0F);
 
   using Adaptor = VertexGeomAdaptor<VertexGeom*>;
   const Adaptor adaptor(targetVertexGeom);
 
   messageHandler("Building kd-tree index...");
 
-  using KDtree = nanoflann::KDTreeSingleIndexAdaptor<nanoflann::L2_Adaptor<float32, Adaptor>, Adaptor, 3>;
   KDtree index(3, adaptor, nanoflann::KDTreeSingleIndexAdaptorParams(30));
   index.buildIndex();
 
-  usize iters = numIterations;
-  const usize nn = 1;
+  Eigen::Matrix4f globalTransform = Eigen::Matrix4f::Identity();
 
-  typedef Eigen::Matrix<float, 3, Eigen::Dynamic, Eigen::ColMajor> PointCloud;
-  typedef Eigen::Matrix<float, 4, 4, Eigen::ColMajor> UmeyamaTransform;
-
-  UmeyamaTransform globalTransform;
-  globalTransform << 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1;
+  ParallelDataAlgorithm transformAlg;
+  transformAlg.setRange(0ULL, numMovingVerts);
 
   auto start = std::chrono::steady_clock::now();
-  for(usize i = 0; i < iters; i++)
+  for(usize i = 0; i < numIterations; i++)
   {
     if(shouldCancel)
     {
       return {};
     }
 
-    for(usize j = 0; j < numMovingVerts; j++)
-    {
-      usize identifier;
-      float dist;
-      nanoflann::KNNResultSet<float> results(nn);
-      results.init(&identifier, &dist);
-      index.findNeighbors(results, movingCopyPtr + (3 * j), nanoflann::SearchParams());
-      dynTargetPtr[3 * j + 0] = targetStore[3 * identifier + 0];
-      dynTargetPtr[3 * j + 1] = targetStore[3 * identifier + 1];
-      dynTargetPtr[3 * j + 2] = targetStore[3 * identifier + 2];
-    }
+    // Rotate the sampled subset so every moving point contributes over consecutive iterations
+    PointSampling sampling;
+    sampling.offset = i % stride;
+    sampling.stride = stride;
+    sampling.count = (numMovingVerts - sampling.offset + stride - 1) / stride;
 
-    Eigen::Map<PointCloud> moving_(movingCopyPtr, 3, numMovingVerts);
-    Eigen::Map<PointCloud> target_(dynTargetPtr, 3, numMovingVerts);
+    Eigen::Matrix4f transform = ComputeRigidTransform(index, targetStore, movingCopyPtr, sampling, dynTarget.data());
 
-    UmeyamaTransform transform = Eigen::umeyama(moving_, target_, false);
+    transformAlg.execute(ApplyTransformImpl(movingCopyPtr, transform));
+    // Update the global transform
+    globalTransform = transform * globalTransform;
 
-    for(usize j = 0; j < numMovingVerts; j++)
+    if(convergenceTolerance > 0.0F && (transform - Eigen::Matrix4f::Identity()).cwiseAbs().maxCoeff() <= convergenceTolerance)
     {
-      Eigen::Vector4f position(movingCopyPtr[3 * j + 0], movingCopyPtr[3 * j + 1], movingCopyPtr[3 * j + 2], 1);
-      Eigen::Vector4f transformedPosition = transform * position;
-      std::memcpy(movingCopyPtr + (3 * j), transformedPosition.data(), sizeof(float) * 3);
+      messageHandler(fmt::format("Registration converged after {} iterations", i + 1));
+      break;
     }
-    // Update the global transform
-    globalTransform = transform * globalTransform;
 
     auto now = std::chrono::steady_clock::now();
     if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
     {
-      messageHandler(fmt::format("Performing Registration Iterations || {}% Completed", static_cast<int64>((static_cast<float>(i) / iters) * 100.0f)));
+      messageHandler(fmt::format("Performing Registration Iterations || {}% Completed", static_cast<int64>((static_cast<float>(i) / numIterations) * 100.0f)));
       start = now;
     }
   }
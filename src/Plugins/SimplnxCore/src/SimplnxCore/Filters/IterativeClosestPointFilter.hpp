@@ -24,6 +24,8 @@ public:
   static inline constexpr StringLiteral k_MovingVertexPath_Key = "input_moving_vertex_geometry_path";
   static inline constexpr StringLiteral k_TargetVertexPath_Key = "input_target_vertex_geometry_path";
   static inline constexpr StringLiteral k_NumIterations_Key = "num_iterations";
+  static inline constexpr StringLiteral k_SamplingStride_Key = "sampling_stride";
+  static inline constexpr StringLiteral k_ConvergenceTolerance_Key = "convergence_tolerance";
   static inline constexpr StringLiteral k_ApplyTransformation_Key = "apply_transformation";
   static inline constexpr StringLiteral k_TransformArrayPath_Key = "transform_array_path";
 
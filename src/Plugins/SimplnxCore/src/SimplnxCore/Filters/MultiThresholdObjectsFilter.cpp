@@ -10,285 +10,21 @@
 #include "simplnx/Parameters/NumberParameter.hpp"
 #include "simplnx/Parameters/NumericTypeParameter.hpp"
 #include "simplnx/Utilities/ArrayThreshold.hpp"
+#include "simplnx/Utilities/ArrayThresholdEvaluator.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
-#include <algorithm>
-
 namespace nx::core
 {
 namespace
 {
-template <typename U>
-class ThresholdFilterHelper
-{
-public:
-  ThresholdFilterHelper(nx::core::ArrayThreshold::ComparisonType compType, nx::core::ArrayThreshold::ComparisonValue compValue, std::vector<U>& output)
-  : m_ComparisonOperator(compType)
-  , m_ComparisonValue(compValue)
-  , m_Output(output)
-  {
-  }
-
-  ~ThresholdFilterHelper() = default;
-
-  /**
-   * @brief
-   */
-  template <typename T>
-  void filterDataLessThan(const AbstractDataStore<T>& m_Input, T trueValue, T falseValue)
-  {
-    size_t m_NumValues = m_Input.getNumberOfTuples();
-    T value = static_cast<T>(m_ComparisonValue);
-    for(size_t i = 0; i < m_NumValues; ++i)
-    {
-      m_Output[i] = (m_Input[i] < value) ? trueValue : falseValue;
-    }
-  }
-
-  /**
-   * @brief
-   */
-  template <typename T>
-  void filterDataGreaterThan(const AbstractDataStore<T>& m_Input, T trueValue, T falseValue)
-  {
-    size_t m_NumValues = m_Input.getNumberOfTuples();
-    T value = static_cast<T>(m_ComparisonValue);
-    for(size_t i = 0; i < m_NumValues; ++i)
-    {
-      m_Output[i] = (m_Input[i] > value) ? trueValue : falseValue;
-    }
-  }
-
-  /**
-   * @brief
-   */
-  template <typename T>
-  void filterDataEqualTo(const AbstractDataStore<T>& m_Input, T trueValue, T falseValue)
-  {
-    size_t m_NumValues = m_Input.getNumberOfTuples();
-    T value = static_cast<T>(m_ComparisonValue);
-    for(size_t i = 0; i < m_NumValues; ++i)
-    {
-      m_Output[i] = (m_Input[i] == value) ? trueValue : falseValue;
-    }
-  }
-
-  /**
-   * @brief
-   */
-  template <typename T>
-  void filterDataNotEqualTo(const AbstractDataStore<T>& m_Input, T trueValue, T falseValue)
-  {
-    size_t m_NumValues = m_Input.getNumberOfTuples();
-    T value = static_cast<T>(m_ComparisonValue);
-    for(size_t i = 0; i < m_NumValues; ++i)
-    {
-      m_Output[i] = (m_Input[i] != value) ? trueValue : falseValue;
-    }
-  }
-
-  template <typename Type>
-  void filterData(const AbstractDataStore<Type>& input, Type trueValue, Type falseValue)
-  {
-    if(m_ComparisonOperator == ArrayThreshold::ComparisonType::LessThan)
-    {
-      filterDataLessThan<Type>(input, trueValue, falseValue);
-    }
-    else if(m_ComparisonOperator == ArrayThreshold::ComparisonType::GreaterThan)
-    {
-      filterDataGreaterThan<Type>(input, trueValue, falseValue);
-    }
-    else if(m_ComparisonOperator == ArrayThreshold::ComparisonType::Operator_Equal)
-    {
-      filterDataEqualTo<Type>(input, trueValue, falseValue);
-    }
-    else if(m_ComparisonOperator == ArrayThreshold::ComparisonType::Operator_NotEqual)
-    {
-      filterDataNotEqualTo<Type>(input, trueValue, falseValue);
-    }
-    else
-    {
-      std::string errorMessage = fmt::format("MultiThresholdObjects Comparison Operator not understood: '{}'", static_cast<int>(m_ComparisonOperator));
-      throw std::runtime_error(errorMessage);
-    }
-  }
-
-private:
-  nx::core::ArrayThreshold::ComparisonType m_ComparisonOperator;
-  nx::core::ArrayThreshold::ComparisonValue m_ComparisonValue;
-  std::vector<U>& m_Output;
-
-public:
-  ThresholdFilterHelper(const ThresholdFilterHelper&) = delete;            // Copy Constructor Not Implemented
-  ThresholdFilterHelper(ThresholdFilterHelper&&) = delete;                 // Move Constructor Not Implemented
-  ThresholdFilterHelper& operator=(const ThresholdFilterHelper&) = delete; // Copy Assignment Not Implemented
-  ThresholdFilterHelper& operator=(ThresholdFilterHelper&&) = delete;      // Move Assignment Not Implemented
-};
-
-struct ExecuteThresholdHelper
-{
-  template <typename Type, typename MaskType>
-  void operator()(ThresholdFilterHelper<MaskType>& helper, const IDataArray* iDataArray, Type trueValue, Type falseValue)
-  {
-    const auto& dataStore = iDataArray->template getIDataStoreRefAs<AbstractDataStore<Type>>();
-    helper.template filterData<Type>(dataStore, trueValue, falseValue);
-  }
-};
-
-/**
- * @brief InsertThreshold
- * @param numItems
- * @param currentArrayPtr
- * @param unionOperator
- * @param newArrayPtr
- * @param inverse
- */
-template <typename T>
-void InsertThreshold(usize numItems, AbstractDataStore<T>& currentStore, nx::core::IArrayThreshold::UnionOperator unionOperator, std::vector<T>& newArrayPtr, bool inverse, T trueValue, T falseValue)
-{
-  for(usize i = 0; i < numItems; i++)
-  {
-    // invert the current comparison if necessary
-    if(inverse)
-    {
-      newArrayPtr[i] = (newArrayPtr[i] == trueValue) ? falseValue : trueValue;
-    }
-
-    if(nx::core::IArrayThreshold::UnionOperator::Or == unionOperator)
-    {
-      currentStore[i] = (currentStore[i] == trueValue || newArrayPtr[i] == trueValue) ? trueValue : falseValue;
-    }
-    else if(currentStore[i] == falseValue || newArrayPtr[i] == falseValue)
-    {
-      currentStore[i] = falseValue;
-    }
-  }
-}
-
-template <typename T>
-void ThresholdValue(std::shared_ptr<ArrayThreshold>& comparisonValue, const DataStructure& dataStructure, AbstractDataStore<T>& outputResultStore, int32_t& err, bool replaceInput, bool inverse,
-                    T trueValue, T falseValue)
-{
-  if(nullptr == comparisonValue)
-  {
-    err = -1;
-    return;
-  }
-
-  // Get the total number of tuples, create and initialize an array with FALSE to use for these results
-  size_t totalTuples = outputResultStore.getNumberOfTuples();
-  std::vector<T> tempResultVector(totalTuples, falseValue);
-
-  nx::core::ArrayThreshold::ComparisonType compOperator = comparisonValue->getComparisonType();
-  nx::core::ArrayThreshold::ComparisonValue compValue = comparisonValue->getComparisonValue();
-  nx::core::IArrayThreshold::UnionOperator unionOperator = comparisonValue->getUnionOperator();
-
-  DataPath inputDataArrayPath = comparisonValue->getArrayPath();
-
-  ThresholdFilterHelper<T> helper(compOperator, compValue, tempResultVector);
-
-  const auto* iDataArray = dataStructure.getDataAs<IDataArray>(inputDataArrayPath);
-
-  ExecuteDataFunction(ExecuteThresholdHelper{}, iDataArray->getDataType(), helper, iDataArray, trueValue, falseValue);
-
-  if(replaceInput)
-  {
-    if(inverse)
-    {
-      std::reverse(tempResultVector.begin(), tempResultVector.end());
-    }
-    // copy the temp uint8 vector to the final uint8 result array
-    for(size_t i = 0; i < totalTuples; i++)
-    {
-      outputResultStore[i] = tempResultVector[i];
-    }
-  }
-  else
-  {
-    // insert into current threshold
-    InsertThreshold<T>(totalTuples, outputResultStore, unionOperator, tempResultVector, inverse, trueValue, falseValue);
-  }
-}
-
-struct ThresholdValueFunctor
+struct FillMaskFunctor
 {
   template <typename T>
-  void operator()(std::shared_ptr<ArrayThreshold>& comparisonValue, const DataStructure& dataStructure, IDataArray* outputResultArray, int32_t& err, bool replaceInput, bool inverse, T trueValue,
-                  T falseValue)
+  Result<> operator()(const ArrayThresholdEvaluator& evaluator, IDataArray& maskArray, float64 trueValue, float64 falseValue, const std::atomic_bool& shouldCancel)
   {
-    // Traditionally we would do a check to ensure we get a valid pointer, I'm forgoing that check because it
-    // was essentially done in the preflight part.
-    ThresholdValue(comparisonValue, dataStructure, outputResultArray->template getIDataStoreRefAs<AbstractDataStore<T>>(), err, replaceInput, inverse, trueValue, falseValue);
-  }
-};
-
-template <typename T>
-void ThresholdSet(std::shared_ptr<ArrayThresholdSet>& inputComparisonSet, const DataStructure& dataStructure, AbstractDataStore<T>& outputResultStore, int32_t& err, bool replaceInput, bool inverse,
-                  T trueValue, T falseValue)
-{
-  if(nullptr == inputComparisonSet)
-  {
-    return;
-  }
-
-  // Get the total number of tuples, create and initialize an array with FALSE to use for these results
-  size_t totalTuples = outputResultStore.getNumberOfTuples();
-  std::vector<T> tempResultVector(totalTuples, falseValue);
-
-  T firstValueFound = 0;
-
-  ArrayThresholdSet::CollectionType thresholds = inputComparisonSet->getArrayThresholds();
-  for(const std::shared_ptr<IArrayThreshold>& threshold : thresholds)
-  {
-    if(std::dynamic_pointer_cast<ArrayThresholdSet>(threshold))
-    {
-      std::shared_ptr<ArrayThresholdSet> comparisonSet = std::dynamic_pointer_cast<ArrayThresholdSet>(threshold);
-      ThresholdSet<T>(comparisonSet, dataStructure, outputResultStore, err, !firstValueFound, false, trueValue, falseValue);
-      firstValueFound = true;
-    }
-    else if(std::dynamic_pointer_cast<ArrayThreshold>(threshold))
-    {
-      std::shared_ptr<ArrayThreshold> comparisonValue = std::dynamic_pointer_cast<ArrayThreshold>(threshold);
-
-      ThresholdValue<T>(comparisonValue, dataStructure, outputResultStore, err, !firstValueFound, false, trueValue, falseValue);
-      firstValueFound = true;
-    }
-  }
-
-  if(replaceInput)
-  {
-    if(inverse)
-    {
-      std::reverse(tempResultVector.begin(), tempResultVector.end());
-    }
-    // copy the temp uint8 vector to the final uint8 result array
-    for(size_t i = 0; i < totalTuples; i++)
-    {
-      outputResultStore[i] = tempResultVector[i];
-    }
-  }
-  else
-  {
-    // insert into current threshold
-    InsertThreshold<T>(totalTuples, outputResultStore, inputComparisonSet->getUnionOperator(), tempResultVector, inverse, trueValue, falseValue);
-  }
-}
-
-struct ThresholdSetFunctor
-{
-  template <typename T>
-  void operator()(std::shared_ptr<ArrayThresholdSet>& inputComparisonSet, const DataStructure& dataStructure, IDataArray* outputResultArray, int32_t& err, bool replaceInput, bool inverse, T trueValue,
-                  T falseValue)
-  {
-    if(outputResultArray == nullptr)
-    {
-      return;
-    }
-
-    // Traditionally we would do a check to ensure we get a valid pointer, I'm forgoing that check because it
-    // was essentially done in the preflight part.
-    ThresholdSet<T>(inputComparisonSet, dataStructure, outputResultArray->template getIDataStoreRefAs<AbstractDataStore<T>>(), err, replaceInput, inverse, trueValue, falseValue);
+    auto& maskStore = maskArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
+    return evaluator.fillMask<T>(maskStore, static_cast<T>(trueValue), static_cast<T>(falseValue), shouldCancel);
   }
 };
 
@@ -498,29 +234,16 @@ Result<> MultiThresholdObjectsFilter::executeImpl(DataStructure& dataStructure,
   float64 trueValue = useCustomTrueValue ? customTrueValue : 1.0;
   float64 falseValue = useCustomFalseValue ? customFalseValue : 0.0;
 
-  bool firstValueFound = false;
-  DataPath maskArrayPath = (*thresholdsObject.getRequiredPaths().begin()).replaceName(maskArrayName);
-  int32_t err = 0;
-  ArrayThresholdSet::CollectionType thresholdSet = thresholdsObject.getArrayThresholds();
-  for(const std::shared_ptr<IArrayThreshold>& threshold : thresholdSet)
+  auto evaluatorResult = ArrayThresholdEvaluator::Create(thresholdsObject, dataStructure);
+  if(evaluatorResult.invalid())
   {
-    if(std::dynamic_pointer_cast<ArrayThresholdSet>(threshold))
-    {
-      std::shared_ptr<ArrayThresholdSet> comparisonSet = std::dynamic_pointer_cast<ArrayThresholdSet>(threshold);
-      ExecuteDataFunction(ThresholdSetFunctor{}, maskArrayType, comparisonSet, dataStructure, dataStructure.getDataAs<IDataArray>(maskArrayPath), err, !firstValueFound, thresholdsObject.isInverted(),
-                          trueValue, falseValue);
-      firstValueFound = true;
-    }
-    else if(std::dynamic_pointer_cast<ArrayThreshold>(threshold))
-    {
-      std::shared_ptr<ArrayThreshold> comparisonValue = std::dynamic_pointer_cast<ArrayThreshold>(threshold);
-      ExecuteDataFunction(ThresholdValueFunctor{}, maskArrayType, comparisonValue, dataStructure, dataStructure.getDataAs<IDataArray>(maskArrayPath), err, !firstValueFound,
-                          thresholdsObject.isInverted(), trueValue, falseValue);
-      firstValueFound = true;
-    }
+    return ConvertResult(std::move(evaluatorResult));
   }
 
-  return {};
+  DataPath maskArrayPath = (*thresholdsObject.getRequiredPaths().begin()).replaceName(maskArrayName);
+  auto& maskArray = dataStructure.getDataRefAs<IDataArray>(maskArrayPath);
+
+  return ExecuteDataFunction(FillMaskFunctor{}, maskArrayType, evaluatorResult.value(), maskArray, trueValue, falseValue, shouldCancel);
 }
 
 namespace
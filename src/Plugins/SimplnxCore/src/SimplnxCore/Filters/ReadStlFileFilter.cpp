@@ -65,6 +65,8 @@ Parameters ReadStlFileFilter::parameters() const
 
   params.insert(std::make_unique<FileSystemPathParameter>(k_StlFilePath_Key, "STL File", "Input STL File", fs::path(""), FileSystemPathParameter::ExtensionsType{".stl"},
                                                           FileSystemPathParameter::PathType::InputFile));
+  params.insert(std::make_unique<Float32Parameter>(k_WeldingTolerance_Key, "Vertex Welding Tolerance",
+                                                   "Vertices closer than this distance are merged into a single vertex. A value of 0 only merges identical vertices.", 0.0F));
 
   params.insertSeparator(Parameters::Separator{"Output Triangle Geometry"});
   params.insert(
@@ -103,9 +105,15 @@ IFilter::PreflightResult ReadStlFileFilter::preflightImpl(const DataStructure& d
   auto vertexMatrixName = filterArgs.value<std::string>(k_VertexAttributeMatrixName_Key);
   auto faceMatrixName = filterArgs.value<std::string>(k_FaceAttributeMatrixName_Key);
   auto faceNormalsName = filterArgs.value<std::string>(k_FaceNormalsName_Key);
+  auto weldingTolerance = filterArgs.value<float32>(k_WeldingTolerance_Key);
 
   nx::core::Result<OutputActions> resultOutputActions;
 
+  if(weldingTolerance < 0.0F)
+  {
+    return MakePreflightErrorResult(StlConstants::k_NegativeWeldingTolerance, fmt::format("The vertex welding tolerance must be 0 or greater. Value given was {}", weldingTolerance));
+  }
+
   // Validate that the STL File is binary and readable.
   StlConstants::StlFileType stlFileType = StlUtilities::DetermineStlFileType(pStlFilePathValue);
   if(stlFileType == StlConstants::StlFileType::ASCI)
@@ -174,9 +182,10 @@ Result<> ReadStlFileFilter::executeImpl(DataStructure& dataStructure, const Argu
 
   auto scaleOutput = filterArgs.value<bool>(k_ScaleOutput);
   auto scaleFactor = filterArgs.value<float32>(k_ScaleFactor);
+  auto weldingTolerance = filterArgs.value<float32>(k_WeldingTolerance_Key);
 
   // The actual STL File Reading is placed in a separate class `ReadStlFile`
-  Result<> result = ReadStlFile(dataStructure, pStlFilePathValue, pTriangleGeometryPath, pFaceDataGroupPath, pFaceNormalsPath, scaleOutput, scaleFactor, shouldCancel, messageHandler)();
+  Result<> result = ReadStlFile(dataStructure, pStlFilePathValue, pTriangleGeometryPath, pFaceDataGroupPath, pFaceNormalsPath, scaleOutput, scaleFactor, weldingTolerance, shouldCancel, messageHandler)();
   return result;
 }
 
@@ -28,6 +28,7 @@ public:
   // Parameter Keys
   static inline constexpr StringLiteral k_ScaleOutput = "scale_output";
   static inline constexpr StringLiteral k_ScaleFactor = "scale_factor";
+  static inline constexpr StringLiteral k_WeldingTolerance_Key = "welding_tolerance";
   static inline constexpr StringLiteral k_StlFilePath_Key = "stl_file_path";
 
   static inline constexpr StringLiteral k_CreatedTriangleGeometryPath_Key = "output_triangle_geometry_path";
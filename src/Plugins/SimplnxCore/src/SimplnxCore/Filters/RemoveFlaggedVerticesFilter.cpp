@@ -13,6 +13,7 @@
 #include "simplnx/Parameters/GeometrySelectionParameter.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/StreamCompaction.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 
 #include <fmt/format.h>
@@ -26,35 +27,6 @@ using namespace nx::core;
 namespace
 {
 constexpr int32 k_VertexGeomNotFound = -277;
-
-struct RemoveFlaggedVerticesFunctor
-{
-  // copy data to masked geometry
-  template <class T>
-  void operator()(const IDataArray& sourceIDataArray, IDataArray& destIDataArray, const std::unique_ptr<MaskCompare>& maskCompare, size_t numVerticesToKeep) const
-  {
-    const auto& sourceDataStore = sourceIDataArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
-    auto& destinationDataStore = destIDataArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
-    destinationDataStore.resizeTuples({numVerticesToKeep});
-
-    const usize numInputTuples = sourceDataStore.getNumberOfTuples();
-    const usize nComps = sourceDataStore.getNumberOfComponents();
-    usize destTupleIndex = 0;
-    for(usize inputIndex = 0; inputIndex < numInputTuples; inputIndex++)
-    {
-      if(!maskCompare->isTrue(inputIndex))
-      {
-        for(usize compIdx = 0; compIdx < nComps; compIdx++)
-        {
-          const usize sourceIndex = (nComps * inputIndex) + compIdx;
-          const usize destinationIndex = (nComps * destTupleIndex) + compIdx;
-          destinationDataStore[destinationIndex] = sourceDataStore[sourceIndex];
-        }
-        destTupleIndex++;
-      }
-    }
-  }
-};
 } // namespace
 
 namespace nx::core
@@ -234,8 +206,14 @@ Result<> RemoveFlaggedVerticesFilter::executeImpl(DataStructure& dataStructure,
     return MakeErrorResult(-54070, message);
   }
 
-  const size_t numVerticesToKeep = maskCompare->getNumberOfTuples() - maskCompare->countTrueValues(); // We don't need component size since it must be 1
-  const size_t numberOfVertices = vertexGeom.getNumberOfVertices();
+  // Compact the list of vertices down to the vertices that are *NOT* flagged for removal
+  const IDataStore* maskStore = dataStructure.getDataRefAs<IDataArray>(maskArrayPath).getIDataStore();
+  const StreamCompaction vertexCompaction = StreamCompaction::Create(vertexGeom.getNumberOfVertices(), [&maskCompare](usize index) { return !maskCompare->isTrue(index); }, {maskStore}, shouldCancel);
+  if(shouldCancel)
+  {
+    return {};
+  }
+  const usize numVerticesToKeep = vertexCompaction.getNumberOfKept();
 
   const std::vector<usize> tDims = {numVerticesToKeep};
 
@@ -244,25 +222,10 @@ Result<> RemoveFlaggedVerticesFilter::executeImpl(DataStructure& dataStructure,
   reducedVertexGeom.resizeVertexList(numVerticesToKeep);
   reducedVertexGeom.getVertexAttributeMatrix()->resizeTuples(tDims);
 
-  messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, fmt::format("Copying vertices to reduced geometry")});
-
-  size_t keepIndex = 0;
-  // Loop over each vertex and only copy the vertices that were *NOT* flagged for removal
-  for(size_t inputVertexIndex = 0; inputVertexIndex < numberOfVertices; inputVertexIndex++)
-  {
-    // If the mask value == FALSE we are keeping that vertex.
-    if(!maskCompare->isTrue(inputVertexIndex))
-    {
-      reducedVertexGeom.setVertexCoordinate(keepIndex, vertexGeom.getVertexCoordinate(inputVertexIndex));
-      keepIndex++;
-    }
-  }
-  if(shouldCancel)
-  {
-    return {};
-  }
+  messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, fmt::format("Copying vertices and vertex data to reduced geometry")});
 
-  // Now copy the vertex data from the source arrays to the reduced vertex attribute matrix arrays
+  // Copy the vertices and the vertex data from the source arrays to the reduced vertex attribute matrix arrays
+  std::vector<StreamCompaction::ArrayPair> arrays = {{vertexGeom.getVertices(), reducedVertexGeom.getVertices()}};
   const AttributeMatrix* sourceVertexAttrMatPtr = vertexGeom.getVertexAttributeMatrix();
   for(const auto& [identifier, object] : *sourceVertexAttrMatPtr)
   {
@@ -271,12 +234,10 @@ Result<> RemoveFlaggedVerticesFilter::executeImpl(DataStructure& dataStructure,
     const DataPath destinationPath = reducedVertexGeom.getVertexAttributeMatrixDataPath().createChildPath(src.getName());
 
     auto& dest = dataStructure.getDataRefAs<IDataArray>(destinationPath);
-    messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, fmt::format("Copying source array '{}' to reduced geometry vertex data.", src.getName())});
-
-    ExecuteDataFunction(RemoveFlaggedVerticesFunctor{}, src.getDataType(), src, dest, maskCompare, numVerticesToKeep);
+    arrays.emplace_back(&src, &dest);
   }
 
-  return {};
+  return vertexCompaction.copyArrays(arrays, shouldCancel);
 }
 
 namespace
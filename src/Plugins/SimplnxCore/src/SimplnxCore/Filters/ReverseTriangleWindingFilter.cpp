@@ -124,6 +124,7 @@ Result<> ReverseTriangleWindingFilter::executeImpl(DataStructure& dataStructure,
   ParallelDataAlgorithm dataAlg;
   dataAlg.setRange(0, triangleGeom.getNumberOfFaces());
   dataAlg.execute(ReverseWindingImpl(triangleGeom.getFaces()->getDataStoreRef()));
+  triangleGeom.markModified();
 
   return {};
 }
@@ -12,9 +12,12 @@
 #include "simplnx/Parameters/ArraySelectionParameter.hpp"
 #include "simplnx/Parameters/BoolParameter.hpp"
 #include "simplnx/Parameters/ChoicesParameter.hpp"
+#include "simplnx/Parameters/NumberParameter.hpp"
 #include "simplnx/Utilities/ClusteringUtilities.hpp"
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
+#include <random>
+
 using namespace nx::core;
 
 namespace
@@ -63,6 +66,10 @@ Parameters SilhouetteFilter::parameters() const
   params.insert(
       std::make_unique<ChoicesParameter>(k_DistanceMetric_Key, "Distance Metric", "Distance Metric type to be used for calculations", to_underlying(ClusterUtilities::DistanceMetric::Euclidean),
                                          ChoicesParameter::Choices{"Euclidean", "Squared Euclidean", "Manhattan", "Cosine", "Pearson", "Squared Pearson"})); // sequence dependent DO NOT REORDER
+  params.insertLinkableParameter(std::make_unique<BoolParameter>(k_UseSampling_Key, "Use Sampling",
+                                                                 "When true the average distances are estimated from a random sample of every cluster instead of every point", false));
+  params.insert(std::make_unique<UInt64Parameter>(k_SamplesPerCluster_Key, "Samples Per Cluster", "The maximum number of points of every cluster used to estimate the average distances", 1000));
+  params.insert(std::make_unique<NumberParameter<uint64>>(k_SeedValue_Key, "Seed Value", "The seed fed into the random generator that chooses the samples", std::mt19937::default_seed));
 
   // Create the parameter descriptors that are needed for this filter
   params.insertSeparator(Parameters::Separator{"Optional Data Mask"});
@@ -80,6 +87,8 @@ Parameters SilhouetteFilter::parameters() const
 
   // Associate the Linkable Parameter(s) to the children parameters that they control
   params.linkParameters(k_UseMask_Key, k_MaskArrayPath_Key, true);
+  params.linkParameters(k_UseSampling_Key, k_SamplesPerCluster_Key, true);
+  params.linkParameters(k_UseSampling_Key, k_SeedValue_Key, true);
 
   return params;
 }
@@ -105,9 +114,16 @@ IFilter::PreflightResult SilhouetteFilter::preflightImpl(const DataStructure& da
   auto pMaskArrayPathValue = filterArgs.value<DataPath>(k_MaskArrayPath_Key);
   auto pFeatureIdsArrayPathValue = filterArgs.value<DataPath>(k_FeatureIdsArrayPath_Key);
   auto pSilhouetteArrayPathValue = filterArgs.value<DataPath>(k_SilhouetteArrayPath_Key);
+  auto pUseSamplingValue = filterArgs.value<bool>(k_UseSampling_Key);
+  auto pSamplesPerClusterValue = filterArgs.value<uint64>(k_SamplesPerCluster_Key);
 
   nx::core::Result<OutputActions> resultOutputActions;
 
+  if(pUseSamplingValue && pSamplesPerClusterValue == 0)
+  {
+    return MakePreflightErrorResult(-8977, "The number of samples per cluster must be greater than 0 when sampling is used.");
+  }
+
   auto clusterArray = dataStructure.getDataAs<IDataArray>(pSelectedArrayPathValue);
   auto clusterIds = dataStructure.getDataAs<IDataArray>(pFeatureIdsArrayPathValue);
   if(clusterArray->getNumberOfTuples() != clusterIds->getNumberOfTuples())
@@ -154,6 +170,11 @@ Result<> SilhouetteFilter::executeImpl(DataStructure& dataStructure, const Argum
   inputValues.MaskArrayPath = maskPath;
   inputValues.FeatureIdsArrayPath = filterArgs.value<DataPath>(k_FeatureIdsArrayPath_Key);
   inputValues.SilhouetteArrayPath = filterArgs.value<DataPath>(k_SilhouetteArrayPath_Key);
+  if(filterArgs.value<bool>(k_UseSampling_Key))
+  {
+    inputValues.SamplesPerCluster = filterArgs.value<uint64>(k_SamplesPerCluster_Key);
+    inputValues.Seed = filterArgs.value<uint64>(k_SeedValue_Key);
+  }
 
   return Silhouette(dataStructure, messageHandler, shouldCancel, &inputValues)();
 }
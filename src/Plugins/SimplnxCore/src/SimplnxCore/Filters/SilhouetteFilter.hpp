@@ -30,6 +30,9 @@ public:
   static inline constexpr StringLiteral k_MaskArrayPath_Key = "mask_array_path";
   static inline constexpr StringLiteral k_FeatureIdsArrayPath_Key = "feature_ids_array_path";
   static inline constexpr StringLiteral k_SilhouetteArrayPath_Key = "silhouette_array_path";
+  static inline constexpr StringLiteral k_UseSampling_Key = "use_sampling";
+  static inline constexpr StringLiteral k_SamplesPerCluster_Key = "samples_per_cluster";
+  static inline constexpr StringLiteral k_SeedValue_Key = "seed_value";
 
   /**
    * @brief Reads SIMPL json and converts it simplnx Arguments.
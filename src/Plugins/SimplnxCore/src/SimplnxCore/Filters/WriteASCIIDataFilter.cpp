@@ -77,6 +77,8 @@ Parameters WriteASCIIDataFilter::parameters() const
                                                    ChoicesParameter::Choices{"Space", "Semicolon", "Comma", "Colon", "Tab"})); // sequence dependent DO NOT REORDER
   params.insert(std::make_unique<ChoicesParameter>(k_Includes_Key, "Header and Index Options", "Default Include is Headers only", to_underlying(Includes::Headers),
                                                    ChoicesParameter::Choices{"Neither", "Headers", "Index", "Both"})); // sequence dependent DO NOT REORDER
+  params.insert(std::make_unique<Int32Parameter>(k_FloatPrecision_Key, "Floating Point Precision",
+                                                 "Number of significant digits written for floating point values. 0 keeps the default formatting", 0));
   params.insertSeparator(Parameters::Separator{"Input Data Objects"});
   params.insert(std::make_unique<MultiArraySelectionParameter>(k_SelectedDataArrayPaths_Key, "Attribute Arrays to Export", "Data Arrays to be written to disk",
                                                                MultiArraySelectionParameter::ValueType{},
@@ -172,6 +174,8 @@ Result<> WriteASCIIDataFilter::executeImpl(DataStructure& dataStructure, const A
   const std::string delimiter = OStreamUtilities::DelimiterToString(filterArgs.value<ChoicesParameter::ValueType>(k_Delimiter_Key));
   auto selectedDataArrayPaths = filterArgs.value<MultiArraySelectionParameter::ValueType>(k_SelectedDataArrayPaths_Key);
   auto fileType = filterArgs.value<ChoicesParameter::ValueType>(k_OutputStyle_Key);
+  auto floatPrecision = filterArgs.value<int32>(k_FloatPrecision_Key);
+  const std::vector<int32> precisions(selectedDataArrayPaths.size(), floatPrecision);
 
   if(static_cast<WriteASCIIDataFilter::OutputStyle>(fileType) == WriteASCIIDataFilter::OutputStyle::SingleFile)
   {
@@ -200,7 +204,8 @@ Result<> WriteASCIIDataFilter::executeImpl(DataStructure& dataStructure, const A
         return MakeErrorResult(-11021, fmt::format("Unable to create output file {}", outputPath.string()));
       }
 
-      OStreamUtilities::PrintDataSetsToSingleFile(outStrm, selectedDataArrayPaths, dataStructure, messageHandler, shouldCancel, delimiter, includeIndex, includeHeaders);
+      OStreamUtilities::PrintDataSetsToSingleFile(outStrm, selectedDataArrayPaths, dataStructure, messageHandler, shouldCancel, delimiter, includeIndex, includeHeaders, true, "Index", {}, false,
+                                                  precisions);
     }
 
     Result<> commitResult = atomicFile.commit();
@@ -226,7 +231,7 @@ Result<> WriteASCIIDataFilter::executeImpl(DataStructure& dataStructure, const A
       }
     }
     return OStreamUtilities::PrintDataSetsToMultipleFiles(selectedDataArrayPaths, dataStructure, directoryPath.string(), messageHandler, shouldCancel, fileExtension, false, delimiter, includeIndex,
-                                                          includeHeaders, maxTuplePerLine);
+                                                          includeHeaders, maxTuplePerLine, precisions);
   }
 
   return {};
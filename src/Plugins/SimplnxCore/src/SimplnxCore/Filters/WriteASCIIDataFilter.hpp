@@ -46,6 +46,7 @@ public:
   static inline constexpr StringLiteral k_Delimiter_Key = "delimiter_index";
   static inline constexpr StringLiteral k_Includes_Key = "header_option_index";
   static inline constexpr StringLiteral k_SelectedDataArrayPaths_Key = "input_data_array_paths";
+  static inline constexpr StringLiteral k_FloatPrecision_Key = "float_precision";
 
   /**
    * @brief Reads SIMPL json and converts it simplnx Arguments.
@@ -1,5 +1,6 @@
 #include "WriteBinaryDataFilter.hpp"
 
+#include "simplnx/Common/AtomicFile.hpp"
 #include "simplnx/Common/TypeTraits.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataPath.hpp"
@@ -7,33 +8,16 @@
 #include "simplnx/Parameters/FileSystemPathParameter.hpp"
 #include "simplnx/Parameters/MultiArraySelectionParameter.hpp"
 #include "simplnx/Parameters/StringParameter.hpp"
+#include "simplnx/Utilities/BufferedBinaryWriter.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
-#include "simplnx/Utilities/OStreamUtilities.hpp"
 
 #include <filesystem>
+#include <fstream>
 
 namespace fs = std::filesystem;
 
 using namespace nx::core;
 
-namespace
-{
-struct ByteSwapArray
-{
-  template <typename ScalarType>
-  Result<> operator()(IDataArray* inputDataArray)
-  {
-    if constexpr(std::is_same_v<ScalarType, bool> || std::is_same_v<ScalarType, uint8> || std::is_same_v<ScalarType, int8>) // byte-swap unnecessary bail early
-    {
-      return {};
-    }
-    auto* dataArray = dynamic_cast<DataArray<ScalarType>*>(inputDataArray);
-    dataArray->byteSwapElements();
-    return {};
-  }
-};
-} // namespace
-
 namespace nx::core
 {
 //------------------------------------------------------------------------------
@@ -111,18 +95,7 @@ Result<> WriteBinaryDataFilter::executeImpl(DataStructure& dataStructure, const
 {
   const auto endianess = static_cast<endian>(filterArgs.value<ChoicesParameter::ValueType>(k_Endianess_Key));
   auto selectedDataArrayPaths = filterArgs.value<MultiArraySelectionParameter::ValueType>(k_SelectedDataArrayPaths_Key);
-  for(const auto& selectedArrayPath : selectedDataArrayPaths)
-  {
-    if(shouldCancel)
-    {
-      return {};
-    }
-    if(endian::native != endianess) // if requested endianess is not native then byteswap
-    {
-      auto* oldSelectedArray = dataStructure.getDataAs<IDataArray>(selectedArrayPath);
-      ExecuteDataFunction(ByteSwapArray{}, oldSelectedArray->getDataType(), oldSelectedArray);
-    }
-  }
+  auto fileExtension = filterArgs.value<StringParameter::ValueType>(k_FileExtension_Key);
 
   auto dirPath = filterArgs.value<FileSystemPathParameter::ValueType>(k_OutputPath_Key);
   // Make sure any directory path is also available as the user may have just typed
@@ -137,8 +110,50 @@ Result<> WriteBinaryDataFilter::executeImpl(DataStructure& dataStructure, const
   {
     return MakeErrorResult(-23430, fmt::format("{}({}): Function {}: Error. OutputPath must be a directory. '{}'", "WriteBinaryDataFilter::executeImpl", __FILE__, __LINE__, dirPath.string()));
   }
-  OStreamUtilities::PrintDataSetsToMultipleFiles(selectedDataArrayPaths, dataStructure, dirPath.string(), messageHandler, shouldCancel,
-                                                 filterArgs.value<StringParameter::ValueType>(k_FileExtension_Key), true);
+
+  // The values are byte swapped while they are buffered, so the selected arrays are never modified
+  for(const auto& selectedArrayPath : selectedDataArrayPaths)
+  {
+    if(shouldCancel)
+    {
+      return {};
+    }
+
+    auto atomicFileResult = AtomicFile::Create(dirPath / fmt::format("{}{}", selectedArrayPath.getTargetName(), fileExtension));
+    if(atomicFileResult.invalid())
+    {
+      return ConvertResult(std::move(atomicFileResult));
+    }
+    AtomicFile atomicFile = std::move(atomicFileResult.value());
+    messageHandler(IFilter::Message::Type::Info, fmt::format("Writing IArray ({}) to output file {}", selectedArrayPath.getTargetName(), atomicFile.tempFilePath().string()));
+
+    // Scope file writer in code block to get around file lock on windows (enforce destructor order)
+    {
+      std::ofstream outStrm(atomicFile.tempFilePath(), std::ios_base::out | std::ios_base::binary);
+      if(!outStrm.is_open())
+      {
+        return MakeErrorResult(-23431, fmt::format("File could not be opened for writing: '{}'", atomicFile.tempFilePath().string()));
+      }
+      BufferedBinaryWriter writer(outStrm);
+      const auto& dataArray = dataStructure.getDataRefAs<IDataArray>(selectedArrayPath);
+      Result<> writeResult = MergeResults(writer.writeDataStore(*dataArray.getIDataStore(), endianess, shouldCancel), writer.flush());
+      if(writeResult.invalid())
+      {
+        return writeResult;
+      }
+    }
+    if(shouldCancel)
+    {
+      return {};
+    }
+
+    Result<> commitResult = atomicFile.commit();
+    if(commitResult.invalid())
+    {
+      return commitResult;
+    }
+  }
+
   return {};
 }
 } // namespace nx::core
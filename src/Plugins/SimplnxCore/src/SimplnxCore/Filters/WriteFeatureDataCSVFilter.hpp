@@ -38,6 +38,7 @@ public:
   static inline constexpr StringLiteral k_WriteNumFeaturesLine_Key = "write_num_features_line";
   static inline constexpr StringLiteral k_DelimiterChoiceInt_Key = "delimiter_index";
   static inline constexpr StringLiteral k_CellFeatureAttributeMatrixPath_Key = "cell_feature_attribute_matrix_path";
+  static inline constexpr StringLiteral k_FloatPrecision_Key = "float_precision";
 
   /**
    * @brief Reads SIMPL json and converts it simplnx Arguments.
@@ -20,6 +20,7 @@ inline constexpr int32_t k_TriangleCountParseError = -1105;
 inline constexpr int32_t k_TriangleParseError = -1106;
 inline constexpr int32_t k_AttributeParseError = -1107;
 inline constexpr int32_t k_StlFileLengthError = -1108;
+inline constexpr int32_t k_NegativeWeldingTolerance = -1109;
 
 enum class StlFileType : int
 {
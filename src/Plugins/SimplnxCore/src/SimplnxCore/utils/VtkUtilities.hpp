@@ -1,5 +1,6 @@
 #pragma once
 
+#include "simplnx/Utilities/BufferedBinaryWriter.hpp"
 #include "simplnx/Utilities/OStreamUtilities.hpp"
 
 namespace nx::core
@@ -138,10 +139,10 @@ std::string TypeForPrimitive(const IFilter::MessageHandler& messageHandler)
 struct WriteVtkDataArrayFunctor
 {
   template <typename T>
-  void operator()(FILE* outputFile, bool binary, DataStructure& dataStructure, const DataPath& arrayPath, const IFilter::MessageHandler& messageHandler)
+  Result<> operator()(FILE* outputFile, bool binary, DataStructure& dataStructure, const DataPath& arrayPath, const IFilter::MessageHandler& messageHandler, const std::atomic_bool& shouldCancel)
   {
     auto* dataArray = dataStructure.getDataAs<DataArray<T>>(arrayPath);
-    auto& dataStore = dataArray->template getIDataStoreRefAs<DataStore<T>>();
+    const auto& dataStore = dataArray->getDataStoreRef();
 
     messageHandler(IFilter::Message::Type::Info, fmt::format("Writing Cell Data {}", arrayPath.getTargetName()));
 
@@ -161,16 +162,14 @@ struct WriteVtkDataArrayFunctor
     fprintf(outputFile, "LOOKUP_TABLE default\n");
     if(binary)
     {
-      if constexpr(endian::little == endian::native)
+      // VTK binary data is big endian. The values are swapped while they are buffered, so the array is left untouched.
+      BufferedBinaryWriter writer(outputFile);
+      Result<> writeResult = writer.writeValues(dataStore, endian::big, shouldCancel);
+      if(writeResult.valid())
       {
-        dataArray->byteSwapElements();
-      }
-      fwrite(dataStore.data(), sizeof(T), totalElements, outputFile);
-      fprintf(outputFile, "\n");
-      if constexpr(endian::little == endian::native)
-      {
-        dataArray->byteSwapElements();
+        writeResult = writer.write("\n");
       }
+      return MergeResults(std::move(writeResult), writer.flush());
     }
     else
     {
@@ -206,6 +205,7 @@ struct WriteVtkDataArrayFunctor
       buffer.append("\n");
       fprintf(outputFile, "%s", buffer.c_str());
     }
+    return {};
   }
 };
 
@@ -276,21 +276,12 @@ struct WriteVtkDataFunctor
 
     if(binary)
     {
-      // Swap to big Endian... because
-      if constexpr(endian::little == endian::native)
-      {
-        dataArrayRef.byteSwapElements();
-      }
-
-      auto result = dataStoreRef.writeBinaryFile(outStrm);
-      if(result.first != 0)
-      {
-      }
-
-      // Swap back to little endian
-      if constexpr(endian::little == endian::native)
+      // VTK binary data is big endian. The values are swapped while they are buffered, so the array is left untouched.
+      BufferedBinaryWriter writer(outStrm);
+      Result<> writeResult = MergeResults(writer.writeValues(dataStoreRef, endian::big, shouldCancel), writer.flush());
+      if(writeResult.invalid())
       {
-        dataArrayRef.byteSwapElements();
+        return writeResult;
       }
     }
     else
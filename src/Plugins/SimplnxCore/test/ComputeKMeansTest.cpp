@@ -1,6 +1,7 @@
 #include <catch2/catch.hpp>
 
 #include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/Parameters/ChoicesParameter.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
 
 #include "SimplnxCore/Filters/ComputeKMeansFilter.hpp"
@@ -121,3 +122,54 @@ TEST_CASE("SimplnxCore::ComputeKMeans: Valid Filter Execution", "[SimplnxCore][C
   WriteTestDataStructure(dataStructure, fs::path(fmt::format("{}/7_0_k_means_0_test.dream3d", unit_test::k_BinaryTestOutputDir)));
 #endif
 }
+
+TEST_CASE("SimplnxCore::ComputeKMeans: K-Means++ Initialization", "[SimplnxCore][ComputeKMeans]")
+{
+  const nx::core::UnitTest::TestFileSentinel testDataSentinel(nx::core::unit_test::k_CMakeExecutable, nx::core::unit_test::k_TestFilesDir, "k_files.tar.gz", "k_files");
+  DataStructure dataStructure = UnitTest::LoadDataStructure(fs::path(fmt::format("{}/k_files/7_0_means_exemplar.dream3d", unit_test::k_TestFilesDir)));
+
+  {
+    ComputeKMeansFilter filter;
+    Arguments args;
+
+    args.insertOrAssign(ComputeKMeansFilter::k_UseSeed_Key, std::make_any<bool>(true));
+    args.insertOrAssign(ComputeKMeansFilter::k_SeedValue_Key, std::make_any<uint64>(5489));
+    args.insertOrAssign(ComputeKMeansFilter::k_InitClusters_Key, std::make_any<uint64>(3));
+    args.insertOrAssign(ComputeKMeansFilter::k_InitializationMethod_Key, std::make_any<ChoicesParameter::ValueType>(1));
+    args.insertOrAssign(ComputeKMeansFilter::k_UseMask_Key, std::make_any<bool>(false));
+    args.insertOrAssign(ComputeKMeansFilter::k_SelectedArrayPath_Key, std::make_any<DataPath>(k_CellPath.createChildPath("DAMAGE")));
+    args.insertOrAssign(ComputeKMeansFilter::k_FeatureIdsArrayName_Key, std::make_any<std::string>(k_ClusterIdsNameNX));
+    args.insertOrAssign(ComputeKMeansFilter::k_FeatureAMPath_Key, std::make_any<DataPath>(k_ClusterDataPathNX));
+    args.insertOrAssign(ComputeKMeansFilter::k_MeansArrayName_Key, std::make_any<std::string>(k_MeansNameNX));
+
+    auto preflightResult = filter.preflight(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+  }
+
+  // The seeding differs from the random initialization but the clusters must show the same pattern
+  auto& clusterIds = dataStructure.getDataRefAs<Int32Array>(k_ClusterIdsPathNX);
+
+  int32 xVal = clusterIds[741];
+  int32 cVal = clusterIds[742];
+  int32 tVal = clusterIds[743];
+
+  REQUIRE(xVal != cVal);
+  REQUIRE(cVal != tVal);
+  REQUIRE(tVal != xVal);
+
+  for(auto index : k_XIndexes)
+  {
+    REQUIRE(xVal == clusterIds[index]);
+  }
+  for(auto index : k_CircleIndexes)
+  {
+    REQUIRE(cVal == clusterIds[index]);
+  }
+  for(auto index : k_TriangleIndexes)
+  {
+    REQUIRE(tVal == clusterIds[index]);
+  }
+}
@@ -1,10 +1,15 @@
 #include "SimplnxCore/Filters/InterpolatePointCloudToRegularGridFilter.hpp"
 #include "SimplnxCore/SimplnxCore_test_dirs.hpp"
 
+#include "simplnx/DataStructure/AttributeMatrix.hpp"
+#include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
+#include "simplnx/DataStructure/Geometry/VertexGeom.hpp"
+#include "simplnx/DataStructure/NeighborList.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
 
 #include <catch2/catch.hpp>
 
+#include <cmath>
 #include <string>
 
 namespace fs = std::filesystem;
@@ -170,3 +175,184 @@ TEST_CASE("SimplnxCore::InterpolatePointCloudToRegularGridFilter: Invalid Filter
   auto executeResult = filter.execute(dataStructure, args);
   SIMPLNX_RESULT_REQUIRE_INVALID(executeResult.result)
 }
+
+TEST_CASE("SimplnxCore::InterpolatePointCloudToRegularGridFilter: Binned Interpolation Matches Serial", "[SimplnxCore][InterpolatePointCloudToRegularGridFilter]")
+{
+  const nx::core::UnitTest::TestFileSentinel testDataSentinel(nx::core::unit_test::k_CMakeExecutable, nx::core::unit_test::k_TestFilesDir, "6_6_interpolate_point_cloud_to_regular_grid.tar.gz",
+                                                              "6_6_interpolate_point_cloud_to_regular_grid");
+
+  auto exemplarFilePath = fs::path(fmt::format("{}/6_6_interpolate_point_cloud_to_regular_grid/6_6_interpolate_point_cloud_to_regular_grid.dream3d", unit_test::k_TestFilesDir));
+  DataStructure dataStructure = UnitTest::LoadDataStructure(exemplarFilePath);
+
+  const DataPath serialGroupPath = k_ImageGeomPath.createChildPath("SerialInterpolatedData");
+  const DataPath binnedGroupPath = k_ImageGeomPath.createChildPath("BinnedInterpolatedData");
+
+  // A kernel smaller than the voxel spacing maps every point into its own voxel in both modes
+  for(const auto& [groupPath, useBinning] : std::vector<std::pair<DataPath, bool>>{{serialGroupPath, false}, {binnedGroupPath, true}})
+  {
+    InterpolatePointCloudToRegularGridFilter filter;
+    Arguments args;
+
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_UseMask_Key, std::make_any<bool>(true));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_StoreKernelDistances_Key, std::make_any<bool>(false));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolationTechnique_Key, std::make_any<uint64>(InterpolatePointCloudToRegularGridFilter::k_Uniform));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_UseBinnedInterpolation_Key, std::make_any<bool>(useBinning));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_KernelSize_Key, std::make_any<std::vector<float32>>(std::vector<float32>{0, 0, 0}));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_SelectedVertexGeometryPath_Key, std::make_any<DataPath>(k_VertexGeometryPath));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_SelectedImageGeometryPath_Key, std::make_any<DataPath>(k_ImageGeomPath));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_VoxelIndicesPath_Key, std::make_any<DataPath>(k_VoxelIndicesPath));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InputMaskPath_Key, std::make_any<DataPath>(k_MaskPath));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolateArrays_Key, std::make_any<std::vector<DataPath>>(std::vector<DataPath>{k_FaceAreasPath}));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_CopyArrays_Key, std::make_any<std::vector<DataPath>>(std::vector<DataPath>{k_VoxelIndicesPath}));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolatedGroupName_Key, std::make_any<std::string>(groupPath.getTargetName()));
+
+    auto preflightResult = filter.preflight(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+  }
+
+  UnitTest::CompareNeighborLists<float64>(dataStructure, serialGroupPath.createChildPath(k_FaceAreas), binnedGroupPath.createChildPath(k_FaceAreas));
+  UnitTest::CompareNeighborLists<uint64>(dataStructure, serialGroupPath.createChildPath(k_VoxelIndices), binnedGroupPath.createChildPath(k_VoxelIndices));
+}
+
+TEST_CASE("SimplnxCore::InterpolatePointCloudToRegularGridFilter: Binned Gaussian Interpolation", "[SimplnxCore][InterpolatePointCloudToRegularGridFilter]")
+{
+  DataStructure dataStructure;
+
+  auto* imageGeom = ImageGeom::Create(dataStructure, k_ImageGeometry);
+  imageGeom->setDimensions({3, 3, 3});
+  imageGeom->setSpacing({1.0f, 1.0f, 1.0f});
+  imageGeom->setOrigin({0.0f, 0.0f, 0.0f});
+
+  // One point in the center voxel and one point in the first voxel
+  const std::vector<usize> vertexTupleDims = {2};
+  auto* vertexGeom = VertexGeom::Create(dataStructure, k_PointCloudContainerName);
+  auto* coords = UnitTest::CreateTestDataArray<float32>(dataStructure, "Vertices", vertexTupleDims, {3}, vertexGeom->getId());
+  vertexGeom->setVertices(*coords);
+  auto* vertexAttributeMatrix = AttributeMatrix::Create(dataStructure, k_VertexData, vertexTupleDims, vertexGeom->getId());
+  vertexGeom->setVertexAttributeMatrix(*vertexAttributeMatrix);
+  auto* values = UnitTest::CreateTestDataArray<float32>(dataStructure, k_FaceAreas, vertexTupleDims, {1}, vertexAttributeMatrix->getId());
+  auto* voxelIndices = UnitTest::CreateTestDataArray<uint64>(dataStructure, k_VoxelIndices, vertexTupleDims, {1}, vertexAttributeMatrix->getId());
+  coords->fill(0.5f);
+  (*values)[0] = 2.0f;
+  (*values)[1] = 5.0f;
+  (*voxelIndices)[0] = 13;
+  (*voxelIndices)[1] = 0;
+
+  InterpolatePointCloudToRegularGridFilter filter;
+  Arguments args;
+
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_UseMask_Key, std::make_any<bool>(false));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_StoreKernelDistances_Key, std::make_any<bool>(true));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolationTechnique_Key, std::make_any<uint64>(InterpolatePointCloudToRegularGridFilter::k_Gaussian));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_UseBinnedInterpolation_Key, std::make_any<bool>(true));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_KernelSize_Key, std::make_any<std::vector<float32>>(std::vector<float32>{2, 2, 2}));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_GaussianSigmas_Key, std::make_any<std::vector<float32>>(std::vector<float32>{1, 1, 1}));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_SelectedVertexGeometryPath_Key, std::make_any<DataPath>(k_VertexGeometryPath));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_SelectedImageGeometryPath_Key, std::make_any<DataPath>(k_ImageGeomPath));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_VoxelIndicesPath_Key, std::make_any<DataPath>(k_VoxelIndicesPath));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolateArrays_Key, std::make_any<std::vector<DataPath>>(std::vector<DataPath>{k_FaceAreasPath}));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_CopyArrays_Key, std::make_any<std::vector<DataPath>>(std::vector<DataPath>{k_VoxelIndicesPath}));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolatedGroupName_Key, std::make_any<std::string>(k_GaussianInterpolatedDataComputed.getTargetName()));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_KernelDistancesArrayName_Key, std::make_any<std::string>(k_GaussianKernalDistancesComputed.getTargetName()));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+  const auto& interpolated = dataStructure.getDataRefAs<Float32NeighborList>(k_GaussianFaceAreasComputed);
+  const auto& copied = dataStructure.getDataRefAs<UInt64NeighborList>(k_GaussianVoxelIndicesComputed);
+  const auto& distances = dataStructure.getDataRefAs<Float32NeighborList>(k_GaussianKernalDistancesComputed);
+
+  // Every voxel is within one voxel of the center, so every list holds the center point. The entries
+  // of a voxel are ordered by the index of the voxel containing the contributing point.
+  const float32 cornerWeight = std::exp(-1.5f);
+  const float32 cornerDistance = std::sqrt(3.0f);
+  for(int32 voxel = 0; voxel < 27; voxel++)
+  {
+    const bool nearFirstVoxel = voxel == 0 || voxel == 1 || voxel == 3 || voxel == 4 || voxel == 9 || voxel == 10 || voxel == 12 || voxel == 13;
+    REQUIRE(interpolated.getListSize(voxel) == (nearFirstVoxel ? 2 : 1));
+    REQUIRE(copied.at(voxel).back() == 13);
+  }
+
+  REQUIRE(copied.copyOfList(0) == std::vector<uint64>{0, 13});
+  REQUIRE(interpolated.at(0)[0] == Approx(5.0f));
+  REQUIRE(interpolated.at(0)[1] == Approx(2.0f * cornerWeight));
+  REQUIRE(distances.at(0)[0] == Approx(0.0f));
+  REQUIRE(distances.at(0)[1] == Approx(cornerDistance));
+
+  REQUIRE(copied.copyOfList(13) == std::vector<uint64>{0, 13});
+  REQUIRE(interpolated.at(13)[0] == Approx(5.0f * cornerWeight));
+  REQUIRE(interpolated.at(13)[1] == Approx(2.0f));
+
+  REQUIRE(interpolated.at(26)[0] == Approx(2.0f * cornerWeight));
+  REQUIRE(distances.at(26)[0] == Approx(cornerDistance));
+}
+
+TEST_CASE("SimplnxCore::InterpolatePointCloudToRegularGridFilter: Binned Interpolation Z Kernel Extent", "[SimplnxCore][InterpolatePointCloudToRegularGridFilter]")
+{
+  // The default mode keeps the DREAM3D 6.6 behavior and only spreads a point to its own and the lower z slices.
+  // The binned mode applies the kernel over its full z extent, so the two modes differ whenever the kernel spans
+  // more than one z slice. This pins both behaviors.
+  const DataPath serialGroupPath = k_ImageGeomPath.createChildPath("SerialInterpolatedData");
+  const DataPath binnedGroupPath = k_ImageGeomPath.createChildPath("BinnedInterpolatedData");
+
+  DataStructure dataStructure;
+
+  auto* imageGeom = ImageGeom::Create(dataStructure, k_ImageGeometry);
+  imageGeom->setDimensions({1, 1, 3});
+  imageGeom->setSpacing({1.0f, 1.0f, 1.0f});
+  imageGeom->setOrigin({0.0f, 0.0f, 0.0f});
+
+  // One point in the middle z slice
+  const std::vector<usize> vertexTupleDims = {1};
+  auto* vertexGeom = VertexGeom::Create(dataStructure, k_PointCloudContainerName);
+  auto* coords = UnitTest::CreateTestDataArray<float32>(dataStructure, "Vertices", vertexTupleDims, {3}, vertexGeom->getId());
+  vertexGeom->setVertices(*coords);
+  auto* vertexAttributeMatrix = AttributeMatrix::Create(dataStructure, k_VertexData, vertexTupleDims, vertexGeom->getId());
+  vertexGeom->setVertexAttributeMatrix(*vertexAttributeMatrix);
+  auto* values = UnitTest::CreateTestDataArray<float32>(dataStructure, k_FaceAreas, vertexTupleDims, {1}, vertexAttributeMatrix->getId());
+  auto* voxelIndices = UnitTest::CreateTestDataArray<uint64>(dataStructure, k_VoxelIndices, vertexTupleDims, {1}, vertexAttributeMatrix->getId());
+  coords->fill(0.5f);
+  (*coords)[2] = 1.5f;
+  (*values)[0] = 3.0f;
+  (*voxelIndices)[0] = 1;
+
+  for(const auto& [groupPath, useBinning] : std::vector<std::pair<DataPath, bool>>{{serialGroupPath, false}, {binnedGroupPath, true}})
+  {
+    InterpolatePointCloudToRegularGridFilter filter;
+    Arguments args;
+
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_UseMask_Key, std::make_any<bool>(false));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_StoreKernelDistances_Key, std::make_any<bool>(false));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolationTechnique_Key, std::make_any<uint64>(InterpolatePointCloudToRegularGridFilter::k_Uniform));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_UseBinnedInterpolation_Key, std::make_any<bool>(useBinning));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_KernelSize_Key, std::make_any<std::vector<float32>>(std::vector<float32>{0.5f, 0.5f, 2.0f}));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_SelectedVertexGeometryPath_Key, std::make_any<DataPath>(k_VertexGeometryPath));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_SelectedImageGeometryPath_Key, std::make_any<DataPath>(k_ImageGeomPath));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_VoxelIndicesPath_Key, std::make_any<DataPath>(k_VoxelIndicesPath));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolateArrays_Key, std::make_any<std::vector<DataPath>>(std::vector<DataPath>{k_FaceAreasPath}));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_CopyArrays_Key, std::make_any<std::vector<DataPath>>(std::vector<DataPath>{}));
+    args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolatedGroupName_Key, std::make_any<std::string>(groupPath.getTargetName()));
+
+    auto preflightResult = filter.preflight(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+  }
+
+  const auto& serial = dataStructure.getDataRefAs<Float32NeighborList>(serialGroupPath.createChildPath(k_FaceAreas));
+  REQUIRE(serial.copyOfList(0) == std::vector<float32>{3.0f});
+  REQUIRE(serial.copyOfList(1) == std::vector<float32>{3.0f});
+  REQUIRE(serial.getListSize(2) == 0);
+
+  const auto& binned = dataStructure.getDataRefAs<Float32NeighborList>(binnedGroupPath.createChildPath(k_FaceAreas));
+  REQUIRE(binned.copyOfList(0) == std::vector<float32>{3.0f});
+  REQUIRE(binned.copyOfList(1) == std::vector<float32>{3.0f});
+  REQUIRE(binned.copyOfList(2) == std::vector<float32>{3.0f});
+}
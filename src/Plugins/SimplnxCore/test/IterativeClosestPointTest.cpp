@@ -69,3 +69,65 @@ TEST_CASE("SimplnxCore::IterativeClosestPointFilter: Test Algorithm", "[DREAM3DR
   auto executeResult = filter.execute(dataStructure, args);
   REQUIRE(executeResult.result.valid());
 }
+
+TEST_CASE("SimplnxCore::IterativeClosestPointFilter: Sampling And Convergence", "[DREAM3DReview][IterativeClosestPointFilter]")
+{
+  IterativeClosestPointFilter filter;
+  DataStructure dataStructure;
+  Arguments args;
+
+  constexpr usize k_Dim = 5;
+  constexpr usize k_NumVertices = k_Dim * k_Dim * k_Dim;
+  constexpr float32 k_Shift = 0.1F;
+
+  auto* movingVertexGeom = VertexGeom::Create(dataStructure, "Moving");
+  auto* movingVertices = Float32Array::CreateWithStore<DataStore<float32>>(dataStructure, "Vertices", {k_NumVertices}, {3}, movingVertexGeom->getId());
+  movingVertexGeom->setVertices(*movingVertices);
+  auto* targetVertexGeom = VertexGeom::Create(dataStructure, "Target");
+  auto* targetVertices = Float32Array::CreateWithStore<DataStore<float32>>(dataStructure, "Vertices", {k_NumVertices}, {3}, targetVertexGeom->getId());
+  targetVertexGeom->setVertices(*targetVertices);
+
+  // The moving points are the target grid shifted along X by less than half the grid spacing
+  for(usize i = 0; i < k_NumVertices; i++)
+  {
+    const std::array<float32, 3> point = {static_cast<float32>(i % k_Dim), static_cast<float32>((i / k_Dim) % k_Dim), static_cast<float32>(i / (k_Dim * k_Dim))};
+    for(usize k = 0; k < 3; k++)
+    {
+      (*targetVertices)[3 * i + k] = point[k];
+      (*movingVertices)[3 * i + k] = point[k] + (k == 0 ? k_Shift : 0.0F);
+    }
+  }
+
+  DataPath transformArrayPath({"Transform Array"});
+
+  args.insertOrAssign(IterativeClosestPointFilter::k_MovingVertexPath_Key, std::make_any<DataPath>(DataPath({"Moving"})));
+  args.insertOrAssign(IterativeClosestPointFilter::k_TargetVertexPath_Key, std::make_any<DataPath>(DataPath({"Target"})));
+  args.insertOrAssign(IterativeClosestPointFilter::k_NumIterations_Key, std::make_any<uint64>(50));
+  args.insertOrAssign(IterativeClosestPointFilter::k_SamplingStride_Key, std::make_any<uint64>(2));
+  args.insertOrAssign(IterativeClosestPointFilter::k_ConvergenceTolerance_Key, std::make_any<float32>(1.0E-5F));
+  args.insertOrAssign(IterativeClosestPointFilter::k_ApplyTransformation_Key, std::make_any<bool>(true));
+  args.insertOrAssign(IterativeClosestPointFilter::k_TransformArrayPath_Key, std::make_any<DataPath>(transformArrayPath));
+
+  // Preflight the filter and check result
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+
+  // Execute the filter and check the result
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+
+  // The transform is stored row major and must be the inverse of the applied shift
+  const auto& transform = dataStructure.getDataRefAs<Float32Array>(transformArrayPath);
+  REQUIRE(transform[3] == Approx(-k_Shift).margin(1.0E-5));
+  REQUIRE(transform[7] == Approx(0.0F).margin(1.0E-5));
+  REQUIRE(transform[11] == Approx(0.0F).margin(1.0E-5));
+  for(usize i = 0; i < k_NumVertices * 3; i++)
+  {
+    REQUIRE((*movingVertices)[i] == Approx((*targetVertices)[i]).margin(1.0E-5));
+  }
+
+  // A sampling stride of 0 is rejected
+  args.insertOrAssign(IterativeClosestPointFilter::k_SamplingStride_Key, std::make_any<uint64>(0));
+  preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_INVALID(preflightResult.outputActions);
+}
@@ -3,6 +3,7 @@
 
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
+#include "simplnx/Utilities/ArrayThresholdEvaluator.hpp"
 
 #include <catch2/catch.hpp>
 
@@ -166,6 +167,74 @@ TEST_CASE("SimplnxCore::MultiThresholdObjects: Valid Execution", "[SimplnxCore][
   }
 }
 
+TEST_CASE("SimplnxCore::MultiThresholdObjects: Valid Execution - Nested Sets", "[SimplnxCore][MultiThresholdObjects]")
+{
+  DataStructure dataStructure = CreateTestDataStructure();
+
+  auto createThreshold = [](ArrayThreshold::ComparisonType comparisonType, float64 value, IArrayThreshold::UnionOperator unionOperator) {
+    auto threshold = std::make_shared<ArrayThreshold>();
+    threshold->setArrayPath(k_TestArrayIntPath);
+    threshold->setComparisonType(comparisonType);
+    threshold->setComparisonValue(value);
+    threshold->setUnionOperator(unionOperator);
+    return threshold;
+  };
+
+  // { Greater Than 2 AND Less Than 5 } OR Equals 1
+  auto rangeSet = std::make_shared<ArrayThresholdSet>();
+  rangeSet->setArrayThresholds({createThreshold(ArrayThreshold::ComparisonType::GreaterThan, 2.0, IArrayThreshold::UnionOperator::And),
+                                createThreshold(ArrayThreshold::ComparisonType::LessThan, 5.0, IArrayThreshold::UnionOperator::And)});
+  ArrayThresholdSet::CollectionType thresholds = {rangeSet, createThreshold(ArrayThreshold::ComparisonType::Operator_Equal, 1.0, IArrayThreshold::UnionOperator::Or)};
+  // Expected results for the values 0 to 4, every value above 4 gives expectedAbove4
+  std::vector<bool> expected = {false, true, false, true, true};
+  bool expectedAbove4 = false;
+
+  SECTION("Inverted Threshold")
+  {
+    // ... AND NOT Equals 3
+    auto notThree = createThreshold(ArrayThreshold::ComparisonType::Operator_Equal, 3.0, IArrayThreshold::UnionOperator::And);
+    notThree->setInverted(true);
+    thresholds.push_back(notThree);
+    expected = {false, true, false, false, true};
+  }
+  SECTION("Inverted Set")
+  {
+    rangeSet->setInverted(true);
+    expected = {true, true, true, false, false};
+    expectedAbove4 = true;
+  }
+  expected.resize(20, expectedAbove4);
+
+  ArrayThresholdSet thresholdSet;
+  thresholdSet.setArrayThresholds(thresholds);
+
+  MultiThresholdObjectsFilter filter;
+  Arguments args;
+  args.insertOrAssign(MultiThresholdObjectsFilter::k_ArrayThresholdsObject_Key, std::make_any<ArrayThresholdSet>(thresholdSet));
+  args.insertOrAssign(MultiThresholdObjectsFilter::k_CreatedDataName_Key, std::make_any<std::string>(k_ThresholdArrayName));
+  args.insertOrAssign(MultiThresholdObjectsFilter::k_CreatedMaskType_Key, std::make_any<DataType>(DataType::boolean));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+  auto* thresholdArray = dataStructure.getDataAs<BoolArray>(k_ThresholdArrayPath);
+  REQUIRE(thresholdArray != nullptr);
+
+  auto evaluatorResult = ArrayThresholdEvaluator::Create(thresholdSet, dataStructure);
+  SIMPLNX_RESULT_REQUIRE_VALID(evaluatorResult)
+  std::vector<uint64> bitMask = evaluatorResult.value().createBitMask();
+  REQUIRE(bitMask.size() == 1);
+
+  for(usize i = 0; i < 20; i++)
+  {
+    REQUIRE((*thresholdArray)[i] == expected[i]);
+    REQUIRE(ArrayThresholdEvaluator::TestBit(bitMask, i) == expected[i]);
+  }
+}
+
 TEMPLATE_TEST_CASE("SimplnxCore::MultiThresholdObjects: Valid Execution - Custom Values", "[SimplnxCore][MultiThresholdObjects]", int8, uint8, int16, uint16, int32, uint32, int64, uint64, float32,
                    float64)
 {
@@ -1,22 +1,34 @@
+#include "SimplnxCore/Filters/ReadCSVFileFilter.hpp"
 #include "SimplnxCore/SimplnxCore_test_dirs.hpp"
 
 #include "simplnx/Core/Application.hpp"
+#include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/Filter/Actions/CreateArrayAction.hpp"
 #include "simplnx/Filter/Actions/DeleteDataAction.hpp"
 #include "simplnx/Filter/Arguments.hpp"
 #include "simplnx/Filter/FilterHandle.hpp"
+#include "simplnx/Parameters/ArrayCreationParameter.hpp"
 #include "simplnx/Parameters/ChoicesParameter.hpp"
+#include "simplnx/Parameters/FileSystemPathParameter.hpp"
 #include "simplnx/Parameters/GeneratedFileListParameter.hpp"
+#include "simplnx/Parameters/ReadCSVFileParameter.hpp"
 #include "simplnx/Pipeline/Pipeline.hpp"
 #include "simplnx/Pipeline/PipelineFilter.hpp"
+#include "simplnx/Pipeline/PipelineResultCache.hpp"
 #include "simplnx/Plugin/AbstractPlugin.hpp"
 
 #include <catch2/catch.hpp>
 
 #include <nlohmann/json.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <filesystem>
 #include <fstream>
+#include <limits>
+#include <mutex>
+#include <thread>
 #include <typeinfo>
 
 namespace fs = std::filesystem;
@@ -110,6 +122,108 @@ protected:
     return {};
   }
 };
+/**
+ * @brief Creates an array and records how many instances are inside executeImpl at the same time
+ * and how many DataObjects they see. When waiting for an overlap is enabled, each instance waits
+ * for another instance to join, so that the high-water mark only reaches 2 if the pipeline really
+ * runs them concurrently.
+ */
+class ConcurrencyProbeFilter : public IFilter
+{
+public:
+  static inline constexpr StringLiteral k_ArrayPath_Key = "array_path";
+  static inline constexpr StringLiteral k_FilePath_Key = "file_path";
+
+  static inline std::mutex s_Mutex;
+  static inline std::condition_variable s_ActiveChanged;
+  static inline bool s_WaitForOverlap = false;
+  static inline int32 s_ActiveCount = 0;
+  static inline int32 s_MaxActiveCount = 0;
+  static inline usize s_MinObjectCount = std::numeric_limits<usize>::max();
+
+  static void Reset(bool waitForOverlap)
+  {
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    s_WaitForOverlap = waitForOverlap;
+    s_ActiveCount = 0;
+    s_MaxActiveCount = 0;
+    s_MinObjectCount = std::numeric_limits<usize>::max();
+  }
+
+  ConcurrencyProbeFilter() = default;
+
+  ~ConcurrencyProbeFilter() noexcept override = default;
+
+  ConcurrencyProbeFilter(const ConcurrencyProbeFilter&) = delete;
+  ConcurrencyProbeFilter(ConcurrencyProbeFilter&&) noexcept = delete;
+
+  ConcurrencyProbeFilter& operator=(const ConcurrencyProbeFilter&) = delete;
+  ConcurrencyProbeFilter& operator=(ConcurrencyProbeFilter&&) noexcept = delete;
+
+  std::string name() const override
+  {
+    return "ConcurrencyProbeFilter";
+  }
+
+  std::string className() const override
+  {
+    return "ConcurrencyProbeFilter";
+  }
+
+  Uuid uuid() const override
+  {
+    static constexpr Uuid uuid = *Uuid::FromString("3c0e1f55-7d3c-4b8e-9a21-5f6de2c1a0b4");
+    return uuid;
+  }
+
+  std::string humanName() const override
+  {
+    return "Concurrency Probe Filter";
+  }
+
+  Parameters parameters() const override
+  {
+    Parameters params;
+    params.insert(std::make_unique<ArrayCreationParameter>(k_ArrayPath_Key, "Array Path", "", DataPath{}));
+    params.insert(std::make_unique<FileSystemPathParameter>(k_FilePath_Key, "File Path", "The file is never written", fs::temp_directory_path() / "ConcurrencyProbe.txt",
+                                                            FileSystemPathParameter::ExtensionsType{}, FileSystemPathParameter::PathType::OutputFile, true));
+    return params;
+  }
+
+  VersionType parametersVersion() const override
+  {
+    return 1;
+  }
+
+  UniquePointer clone() const override
+  {
+    return std::make_unique<ConcurrencyProbeFilter>();
+  }
+
+protected:
+  PreflightResult preflightImpl(const DataStructure& dataStructure, const Arguments& args, const MessageHandler& messageHandler, const std::atomic_bool& shouldCancel) const override
+  {
+    OutputActions outputActions;
+    outputActions.appendAction(std::make_unique<CreateArrayAction>(DataType::int32, std::vector<usize>{10}, std::vector<usize>{1}, args.value<DataPath>(k_ArrayPath_Key)));
+    return {std::move(outputActions)};
+  }
+
+  Result<> executeImpl(DataStructure& dataStructure, const Arguments& args, const PipelineFilter* pipelineNode, const MessageHandler& messageHandler,
+                       const std::atomic_bool& shouldCancel) const override
+  {
+    std::unique_lock<std::mutex> lock(s_Mutex);
+    s_MinObjectCount = std::min(s_MinObjectCount, dataStructure.getSize());
+    s_MaxActiveCount = std::max(s_MaxActiveCount, ++s_ActiveCount);
+    s_ActiveChanged.notify_all();
+    if(s_WaitForOverlap)
+    {
+      // Only times out if the pipeline runs the instances one after another
+      s_ActiveChanged.wait_for(lock, std::chrono::seconds(30), [] { return s_MaxActiveCount >= 2; });
+    }
+    --s_ActiveCount;
+    return {};
+  }
+};
 } // namespace
 
 TEST_CASE("PipelineTest:Execute Pipeline")
@@ -385,3 +499,356 @@ TEST_CASE("PipelineTest:PipelineDeferredActionTest")
   DataObject* executeObject = dataStructure.getData(k_DeferredActionPath);
   REQUIRE(executeObject == nullptr);
 }
+
+TEST_CASE("PipelineTest:Concurrent Execution")
+{
+  auto app = Application::GetOrCreateInstance();
+  app->loadPlugins(unit_test::k_BuildDir.view());
+
+  const DataPath group1Path({"Foo"});
+  const DataPath group2Path({"Bar"});
+  const DataPath childPath({"Foo", "Baz"});
+
+  Arguments args1;
+  args1.insert("data_object_path", std::make_any<DataPath>(group1Path));
+  Arguments args2;
+  args2.insert("data_object_path", std::make_any<DataPath>(group2Path));
+  Arguments args3;
+  args3.insert("data_object_path", std::make_any<DataPath>(childPath));
+
+  Pipeline pipeline("Concurrent Test Pipeline");
+  REQUIRE(pipeline.push_back(k_CreateDataGroupHandle, args1));
+  REQUIRE(pipeline.push_back(k_CreateDataGroupHandle, args2));
+  REQUIRE(pipeline.push_back(k_CreateDataGroupHandle, args3));
+  pipeline.setConcurrentExecutionEnabled(true);
+  REQUIRE(pipeline.isConcurrentExecutionEnabled());
+
+  DataStructure dataStructure;
+  REQUIRE(pipeline.preflight(dataStructure, false));
+
+  DataStructure executeStructure;
+  REQUIRE(pipeline.execute(executeStructure, false));
+  REQUIRE(executeStructure.getData(group1Path) != nullptr);
+  REQUIRE(executeStructure.getData(group2Path) != nullptr);
+  REQUIRE(executeStructure.getData(childPath) != nullptr);
+  REQUIRE(!pipeline.hasErrors());
+
+  // "Foo" and "Bar" share the first wave, so only the state after "Bar" matches the serial pipeline
+  REQUIRE(!pipeline.at(0)->hasResumableDataStructure());
+  REQUIRE(pipeline.at(1)->hasResumableDataStructure());
+  REQUIRE(pipeline.at(2)->hasResumableDataStructure());
+  REQUIRE(pipeline.at(1)->getDataStructure().getData(group1Path) != nullptr);
+  REQUIRE(pipeline.at(1)->getDataStructure().getData(group2Path) != nullptr);
+  REQUIRE(pipeline.at(1)->getDataStructure().getData(childPath) == nullptr);
+
+  REQUIRE(!pipeline.executeFrom(1));
+  REQUIRE(pipeline.executeFrom(2));
+  REQUIRE(pipeline.at(2)->getDataStructure().getData(childPath) != nullptr);
+}
+
+TEST_CASE("PipelineTest:Concurrent Execution Result Cache")
+{
+  auto app = Application::GetOrCreateInstance();
+  app->loadPlugins(unit_test::k_BuildDir.view());
+
+  const fs::path cacheDir = fs::path(unit_test::k_BinaryTestOutputDir.view()) / "ConcurrentPipelineResultCache";
+  fs::remove_all(cacheDir);
+
+  Pipeline pipeline("Concurrent Result Cache Test Pipeline");
+  for(const auto& path : {DataPath({"Foo"}), DataPath({"Bar"}), DataPath({"Foo", "Baz"})})
+  {
+    Arguments args;
+    args.insert("data_object_path", std::make_any<DataPath>(path));
+    REQUIRE(pipeline.push_back(k_CreateDataGroupHandle, args));
+  }
+  auto resultCache = std::make_shared<PipelineResultCache>(cacheDir);
+  resultCache->setEnabled(true);
+  resultCache->setMinimumExecutionTime(std::chrono::milliseconds(0));
+  pipeline.setResultCache(resultCache);
+  pipeline.setConcurrentExecutionEnabled(true);
+
+  DataStructure dataStructure;
+  REQUIRE(pipeline.preflight(dataStructure, false));
+  REQUIRE(pipeline.execute());
+
+  // Only states that the serial pipeline also passes through are stored
+  const std::vector<std::string> keys = PipelineResultCache::CreateKeys(pipeline);
+  REQUIRE(!resultCache->contains(keys[0]));
+  REQUIRE(resultCache->contains(keys[1]));
+  REQUIRE(resultCache->contains(keys[2]));
+
+  Result<DataStructure> loadResult = resultCache->load(keys[1]);
+  REQUIRE(loadResult.valid());
+  REQUIRE(loadResult.value().getData(DataPath({"Foo"})) != nullptr);
+  REQUIRE(loadResult.value().getData(DataPath({"Bar"})) != nullptr);
+  REQUIRE(loadResult.value().getData(DataPath({"Foo", "Baz"})) == nullptr);
+
+  fs::remove_all(cacheDir);
+}
+
+TEST_CASE("PipelineTest:Result Cache")
+{
+  auto app = Application::GetOrCreateInstance();
+  app->loadPlugins(unit_test::k_BuildDir.view());
+
+  const fs::path cacheDir = fs::path(unit_test::k_BinaryTestOutputDir.view()) / "PipelineResultCache";
+  fs::remove_all(cacheDir);
+
+  const DataPath group1Path({"Foo"});
+  const DataPath group2Path({"Foo", "Bar"});
+
+  Arguments args1;
+  args1.insert("data_object_path", std::make_any<DataPath>(group1Path));
+  Arguments args2;
+  args2.insert("data_object_path", std::make_any<DataPath>(group2Path));
+
+  auto resultCache = std::make_shared<PipelineResultCache>(cacheDir);
+  resultCache->setEnabled(true);
+  resultCache->setMinimumExecutionTime(std::chrono::milliseconds(0));
+
+  Pipeline pipeline("Result Cache Test Pipeline");
+  REQUIRE(pipeline.push_back(k_CreateDataGroupHandle, args1));
+  REQUIRE(pipeline.push_back(k_CreateDataGroupHandle, args2));
+  pipeline.setResultCache(resultCache);
+
+  std::vector<std::string> keys = PipelineResultCache::CreateKeys(pipeline);
+  REQUIRE(keys.size() == 2);
+  REQUIRE(keys[0] != keys[1]);
+  REQUIRE(!resultCache->contains(keys[0]));
+
+  REQUIRE(pipeline.execute());
+  REQUIRE(resultCache->contains(keys[0]));
+  REQUIRE(resultCache->contains(keys[1]));
+
+  // Changing the last filter only invalidates its own key
+  Arguments changedArgs;
+  changedArgs.insert("data_object_path", std::make_any<DataPath>(DataPath({"Foo", "Baz"})));
+  dynamic_cast<PipelineFilter*>(pipeline.at(1))->setArguments(changedArgs);
+  std::vector<std::string> changedKeys = PipelineResultCache::CreateKeys(pipeline);
+  REQUIRE(changedKeys[0] == keys[0]);
+  REQUIRE(changedKeys[1] != keys[1]);
+
+  DataStructure dataStructure;
+  REQUIRE(pipeline.execute(dataStructure, false));
+  REQUIRE(dataStructure.getData(group1Path) != nullptr);
+  REQUIRE(dataStructure.getData(DataPath({"Foo", "Baz"})) != nullptr);
+  REQUIRE(dataStructure.getData(group2Path) == nullptr);
+
+  Result<DataStructure> loadResult = resultCache->load(keys[0]);
+  REQUIRE(loadResult.valid());
+  REQUIRE(loadResult.value().getData(group1Path) != nullptr);
+
+  fs::remove_all(cacheDir);
+}
+
+TEST_CASE("PipelineTest:Result Cache Stops At Writers")
+{
+  auto app = Application::GetOrCreateInstance();
+  app->loadPlugins(unit_test::k_BuildDir.view());
+
+  const fs::path cacheDir = fs::path(unit_test::k_BinaryTestOutputDir.view()) / "PipelineResultCacheWriters";
+  fs::remove_all(cacheDir);
+
+  Arguments args1;
+  args1.insert("data_object_path", std::make_any<DataPath>(DataPath({"Foo"})));
+  Arguments probeArgs;
+  probeArgs.insert(ConcurrencyProbeFilter::k_ArrayPath_Key, std::make_any<DataPath>(DataPath({"Probe"})));
+  probeArgs.insert(ConcurrencyProbeFilter::k_FilePath_Key, std::make_any<fs::path>(fs::temp_directory_path() / "ResultCacheProbe.txt"));
+  Arguments args2;
+  args2.insert("data_object_path", std::make_any<DataPath>(DataPath({"Bar"})));
+
+  Pipeline pipeline("Result Cache Writer Test Pipeline");
+  REQUIRE(pipeline.push_back(k_CreateDataGroupHandle, args1));
+  REQUIRE(pipeline.push_back(std::make_unique<ConcurrencyProbeFilter>(), probeArgs));
+  REQUIRE(pipeline.push_back(k_CreateDataGroupHandle, args2));
+
+  // The probe writes a file, so neither it nor anything after it may be restored in its place
+  const std::vector<std::string> keys = PipelineResultCache::CreateKeys(pipeline);
+  REQUIRE(keys.size() == 3);
+  REQUIRE(!keys[0].empty());
+  REQUIRE(keys[1].empty());
+  REQUIRE(keys[2].empty());
+
+  auto resultCache = std::make_shared<PipelineResultCache>(cacheDir);
+  resultCache->setMinimumExecutionTime(std::chrono::milliseconds(0));
+  pipeline.setResultCache(resultCache);
+  ConcurrencyProbeFilter::Reset(false);
+
+  SECTION("Disabled")
+  {
+    REQUIRE(!resultCache->isEnabled());
+    REQUIRE(pipeline.execute());
+    REQUIRE(!resultCache->contains(keys[0]));
+    REQUIRE(!fs::exists(cacheDir));
+  }
+  SECTION("Enabled")
+  {
+    resultCache->setEnabled(true);
+    REQUIRE(pipeline.execute());
+    REQUIRE(resultCache->contains(keys[0]));
+    REQUIRE(std::distance(fs::directory_iterator(cacheDir), fs::directory_iterator{}) == 1);
+  }
+
+  fs::remove_all(cacheDir);
+  fs::remove(fs::temp_directory_path() / "ResultCacheProbe.txt");
+}
+
+TEST_CASE("PipelineTest:Result Cache Size Limit")
+{
+  const fs::path cacheDir = fs::path(unit_test::k_BinaryTestOutputDir.view()) / "PipelineResultCacheSizeLimit";
+  fs::remove_all(cacheDir);
+
+  DataStructure dataStructure;
+  REQUIRE(DataGroup::Create(dataStructure, "Foo") != nullptr);
+
+  PipelineResultCache resultCache(cacheDir);
+  resultCache.setEnabled(true);
+
+  SECTION("Too Large")
+  {
+    resultCache.setMaximumSize(1);
+    REQUIRE(resultCache.store("entry1", dataStructure).invalid());
+    REQUIRE(!resultCache.contains("entry1"));
+  }
+  SECTION("Evicts Least Recently Used")
+  {
+    REQUIRE(resultCache.store("entry1", dataStructure).valid());
+    REQUIRE(resultCache.store("entry2", dataStructure).valid());
+    REQUIRE(resultCache.contains("entry1"));
+    REQUIRE(resultCache.contains("entry2"));
+
+    const fs::path entry1Path = cacheDir / fmt::format("entry1{}", PipelineResultCache::k_Extension.view());
+    const fs::path entry2Path = cacheDir / fmt::format("entry2{}", PipelineResultCache::k_Extension.view());
+    const auto now = fs::file_time_type::clock::now();
+    fs::last_write_time(entry1Path, now - std::chrono::hours(2));
+    fs::last_write_time(entry2Path, now - std::chrono::hours(1));
+
+    // Restoring entry1 makes entry2 the least recently used entry
+    REQUIRE(resultCache.load("entry1").valid());
+
+    const uint64 entrySize = fs::file_size(entry1Path);
+    resultCache.setMaximumSize(entrySize * 5 / 2);
+    REQUIRE(resultCache.store("entry3", dataStructure).valid());
+    REQUIRE(resultCache.contains("entry1"));
+    REQUIRE(!resultCache.contains("entry2"));
+    REQUIRE(resultCache.contains("entry3"));
+  }
+
+  fs::remove_all(cacheDir);
+}
+
+TEST_CASE("PipelineTest:Result Cache Input File Stamp")
+{
+  const fs::path csvPath = fs::path(unit_test::k_BinaryTestOutputDir.view()) / "PipelineResultCacheInput.csv";
+  {
+    std::ofstream csvFile(csvPath);
+    csvFile << "A,B\n1,2\n";
+  }
+
+  // The CSV file is only referenced through the ReadCSVData value, not a path argument
+  ReadCSVData readCSVData;
+  readCSVData.inputFilePath = csvPath.string();
+  Arguments args;
+  args.insert(ReadCSVFileFilter::k_ReadCSVData_Key, std::make_any<ReadCSVData>(readCSVData));
+
+  Pipeline pipeline("Result Cache Input File Test Pipeline");
+  REQUIRE(pipeline.push_back(std::make_unique<ReadCSVFileFilter>(), args));
+
+  const std::vector<std::string> keys = PipelineResultCache::CreateKeys(pipeline);
+  REQUIRE(keys.size() == 1);
+  REQUIRE(!keys[0].empty());
+  REQUIRE(PipelineResultCache::CreateKeys(pipeline) == keys);
+
+  {
+    std::ofstream csvFile(csvPath, std::ios::app);
+    csvFile << "3,4\n";
+  }
+  const std::vector<std::string> changedKeys = PipelineResultCache::CreateKeys(pipeline);
+  REQUIRE(changedKeys[0] != keys[0]);
+
+  fs::remove(csvPath);
+}
+
+TEST_CASE("PipelineTest:Concurrent Execution Overlaps Filters")
+{
+  if(std::thread::hardware_concurrency() < 2)
+  {
+    return;
+  }
+
+  const DataPath array1Path({"Array1"});
+  const DataPath array2Path({"Array2"});
+
+  Arguments args1;
+  args1.insert(ConcurrencyProbeFilter::k_ArrayPath_Key, std::make_any<DataPath>(array1Path));
+  args1.insert(ConcurrencyProbeFilter::k_FilePath_Key, std::make_any<fs::path>(fs::temp_directory_path() / "ConcurrencyProbe1.txt"));
+  Arguments args2;
+  args2.insert(ConcurrencyProbeFilter::k_ArrayPath_Key, std::make_any<DataPath>(array2Path));
+  args2.insert(ConcurrencyProbeFilter::k_FilePath_Key, std::make_any<fs::path>(fs::temp_directory_path() / "ConcurrencyProbe2.txt"));
+
+  Pipeline pipeline("Concurrent Probe Pipeline");
+  REQUIRE(pipeline.push_back(std::make_unique<ConcurrencyProbeFilter>(), args1));
+  REQUIRE(pipeline.push_back(std::make_unique<ConcurrencyProbeFilter>(), args2));
+
+  SECTION("Serial")
+  {
+    ConcurrencyProbeFilter::Reset(false);
+    DataStructure dataStructure;
+    REQUIRE(pipeline.preflight(dataStructure, false));
+    REQUIRE(pipeline.execute(dataStructure, false));
+    REQUIRE(ConcurrencyProbeFilter::s_MaxActiveCount == 1);
+  }
+#ifdef SIMPLNX_ENABLE_MULTICORE
+  SECTION("Concurrent")
+  {
+    ConcurrencyProbeFilter::Reset(true);
+    pipeline.setConcurrentExecutionEnabled(true);
+    DataStructure dataStructure;
+    REQUIRE(pipeline.preflight(dataStructure, false));
+    REQUIRE(pipeline.execute(dataStructure, false));
+    REQUIRE(dataStructure.getData(array1Path) != nullptr);
+    REQUIRE(dataStructure.getData(array2Path) != nullptr);
+    REQUIRE(ConcurrencyProbeFilter::s_MaxActiveCount == 2);
+  }
+#endif
+}
+
+TEST_CASE("PipelineTest:Concurrent Execution Runs HDF5 Filters Alone")
+{
+  // Filters that share a wave see each other's created arrays, filters that run alone only see their own
+  auto createPipeline = [](const std::string& extension) {
+    auto pipeline = std::make_unique<Pipeline>("Concurrent HDF5 Pipeline");
+    for(int32 i = 1; i <= 2; i++)
+    {
+      Arguments args;
+      args.insert(ConcurrencyProbeFilter::k_ArrayPath_Key, std::make_any<DataPath>(DataPath({fmt::format("Array{}", i)})));
+      args.insert(ConcurrencyProbeFilter::k_FilePath_Key, std::make_any<fs::path>(fs::temp_directory_path() / fmt::format("ConcurrencyProbe{}{}", i, extension)));
+      pipeline->push_back(std::make_unique<ConcurrencyProbeFilter>(), args);
+    }
+    pipeline->setConcurrentExecutionEnabled(true);
+    return pipeline;
+  };
+
+  SECTION("Text files")
+  {
+    ConcurrencyProbeFilter::Reset(false);
+    auto pipeline = createPipeline(".txt");
+    DataStructure dataStructure;
+    REQUIRE(pipeline->preflight(dataStructure, false));
+    REQUIRE(pipeline->execute(dataStructure, false));
+    REQUIRE(ConcurrencyProbeFilter::s_MinObjectCount == 2);
+  }
+  SECTION("HDF5 files")
+  {
+    for(const std::string extension : {".dream3d", ".h5", ".HDF5"})
+    {
+      ConcurrencyProbeFilter::Reset(false);
+      auto pipeline = createPipeline(extension);
+      DataStructure dataStructure;
+      REQUIRE(pipeline->preflight(dataStructure, false));
+      REQUIRE(pipeline->execute(dataStructure, false));
+      REQUIRE(ConcurrencyProbeFilter::s_MinObjectCount == 1);
+      REQUIRE(ConcurrencyProbeFilter::s_MaxActiveCount == 1);
+    }
+  }
+}
@@ -5,17 +5,70 @@
 #include "simplnx/Parameters/ArrayCreationParameter.hpp"
 #include "simplnx/Parameters/FileSystemPathParameter.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
+#include "simplnx/Utilities/GeometryUtilities.hpp"
 #include "simplnx/Utilities/Parsing/HDF5/Writers/FileWriter.hpp"
 
 #include <catch2/catch.hpp>
 
 #include <filesystem>
 #include <string>
+#include <vector>
 
 namespace fs = std::filesystem;
 using namespace nx::core;
 using namespace nx::core::Constants;
 
+namespace
+{
+// Two triangles as an STL file stores them: every face has its own copy of its vertices.
+// Vertex 3 is an exact copy of vertex 1 and vertex 5 is 1e-4 away from vertex 2.
+const std::vector<float32> k_SoupVertices = {0.0F, 0.0F, 0.0F, 1.0F, 0.0F, 0.0F, 0.0F, 1.0F, 0.0F, 1.0F, 0.0F, 0.0F, 1.0F, 1.0F, 0.0F, 0.0001F, 1.0F, 0.0F};
+const std::vector<IGeometry::MeshIndexType> k_SoupFaces = {0, 1, 2, 3, 4, 5};
+
+TriangleGeom& CreateSoupGeometry(DataStructure& dataStructure)
+{
+  const usize numVertices = k_SoupVertices.size() / 3;
+  const usize numFaces = k_SoupFaces.size() / 3;
+
+  TriangleGeom* triangleGeom = TriangleGeom::Create(dataStructure, "Triangle Geometry");
+  REQUIRE(triangleGeom != nullptr);
+  AttributeMatrix* faceData = AttributeMatrix::Create(dataStructure, INodeGeometry2D::k_FaceDataName, {numFaces}, triangleGeom->getId());
+  triangleGeom->setFaceAttributeMatrix(*faceData);
+  AttributeMatrix* vertexData = AttributeMatrix::Create(dataStructure, INodeGeometry0D::k_VertexDataName, {numVertices}, triangleGeom->getId());
+  triangleGeom->setVertexAttributeMatrix(*vertexData);
+
+  auto* vertices = IGeometry::SharedVertexList::CreateWithStore<DataStore<float32>>(dataStructure, "Vertices", {numVertices}, {3}, triangleGeom->getId());
+  REQUIRE(vertices != nullptr);
+  std::copy(k_SoupVertices.begin(), k_SoupVertices.end(), vertices->begin());
+  triangleGeom->setVertices(*vertices);
+
+  auto* faces = IGeometry::SharedFaceList::CreateWithStore<DataStore<IGeometry::MeshIndexType>>(dataStructure, "Faces", {numFaces}, {3}, triangleGeom->getId());
+  REQUIRE(faces != nullptr);
+  std::copy(k_SoupFaces.begin(), k_SoupFaces.end(), faces->begin());
+  triangleGeom->setFaceList(*faces);
+  return *triangleGeom;
+}
+
+void RequireWeldedGeometry(const TriangleGeom& triangleGeom, const std::vector<float32>& expectedVertices, const std::vector<IGeometry::MeshIndexType>& expectedFaces)
+{
+  REQUIRE(triangleGeom.getNumberOfVertices() == expectedVertices.size() / 3);
+  REQUIRE(triangleGeom.getNumberOfFaces() == expectedFaces.size() / 3);
+  REQUIRE(triangleGeom.getVertexAttributeMatrix()->getNumTuples() == expectedVertices.size() / 3);
+  REQUIRE(triangleGeom.getFaceAttributeMatrix()->getNumTuples() == expectedFaces.size() / 3);
+
+  const auto& vertices = triangleGeom.getVertices()->getDataStoreRef();
+  for(usize i = 0; i < expectedVertices.size(); i++)
+  {
+    REQUIRE(vertices[i] == expectedVertices[i]);
+  }
+  const auto& faces = triangleGeom.getFaces()->getDataStoreRef();
+  for(usize i = 0; i < expectedFaces.size(); i++)
+  {
+    REQUIRE(faces[i] == expectedFaces[i]);
+  }
+}
+} // namespace
+
 TEST_CASE("SimplnxCore::ReadStlFileFilter:Valid_File", "[SimplnxCore][ReadStlFileFilter]")
 {
   const nx::core::UnitTest::TestFileSentinel testDataSentinel(nx::core::unit_test::k_CMakeExecutable, nx::core::unit_test::k_TestFilesDir, "ReadSTLFileTest.tar.gz", "ReadSTLFileTest");
@@ -134,3 +187,77 @@ TEST_CASE("SimplnxCore::ReadStlFileFilter:AttributeParseError", "[SimplnxCore][R
 
   REQUIRE(executeResult.result.errors().front().code == -1107);
 }
+
+TEST_CASE("SimplnxCore::ReadStlFileFilter:NegativeWeldingTolerance", "[SimplnxCore][ReadStlFileFilter]")
+{
+  const nx::core::UnitTest::TestFileSentinel testDataSentinel(nx::core::unit_test::k_CMakeExecutable, nx::core::unit_test::k_TestFilesDir, "ReadSTLFileTest.tar.gz", "ReadSTLFileTest");
+
+  // Instantiate the filter, a DataStructure object and an Arguments Object
+  DataStructure dataStructure;
+  Arguments args;
+  ReadStlFileFilter filter;
+
+  DataPath triangleGeomDataPath({"[Triangle Geometry]"});
+
+  std::string inputFile = fmt::format("{}/ReadSTLFileTest/ASTMD638_specimen.stl", unit_test::k_TestFilesDir);
+
+  // Create default Parameters for the filter.
+  args.insertOrAssign(ReadStlFileFilter::k_StlFilePath_Key, std::make_any<FileSystemPathParameter::ValueType>(fs::path(inputFile)));
+  args.insertOrAssign(ReadStlFileFilter::k_CreatedTriangleGeometryPath_Key, std::make_any<DataPath>(triangleGeomDataPath));
+  args.insertOrAssign(ReadStlFileFilter::k_WeldingTolerance_Key, std::make_any<float32>(-1.0F));
+
+  // Preflight the filter and check result
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_INVALID(preflightResult.outputActions);
+
+  REQUIRE(preflightResult.outputActions.errors().front().code == -1109);
+}
+
+TEST_CASE("SimplnxCore::ReadStlFileFilter:FindUniqueVertexIds", "[SimplnxCore][ReadStlFileFilter]")
+{
+  DataStore<float32> vertices(std::vector<usize>{k_SoupVertices.size() / 3}, std::vector<usize>{3}, 0.0F);
+  std::copy(k_SoupVertices.begin(), k_SoupVertices.end(), vertices.begin());
+  std::vector<IGeometry::MeshIndexType> uniqueIds;
+
+  SECTION("Exact")
+  {
+    REQUIRE(GeometryUtilities::FindUniqueVertexIds(vertices, 0.0F, uniqueIds) == 5);
+    REQUIRE(uniqueIds == std::vector<IGeometry::MeshIndexType>{0, 1, 2, 1, 3, 4});
+  }
+  SECTION("Tolerance Below Gap")
+  {
+    REQUIRE(GeometryUtilities::FindUniqueVertexIds(vertices, 0.00001F, uniqueIds) == 5);
+    REQUIRE(uniqueIds == std::vector<IGeometry::MeshIndexType>{0, 1, 2, 1, 3, 4});
+  }
+  SECTION("Tolerance Above Gap")
+  {
+    REQUIRE(GeometryUtilities::FindUniqueVertexIds(vertices, 0.001F, uniqueIds) == 4);
+    REQUIRE(uniqueIds == std::vector<IGeometry::MeshIndexType>{0, 1, 2, 1, 3, 2});
+  }
+}
+
+TEST_CASE("SimplnxCore::ReadStlFileFilter:EliminateDuplicateNodes", "[SimplnxCore][ReadStlFileFilter]")
+{
+  DataStructure dataStructure;
+  TriangleGeom& triangleGeom = CreateSoupGeometry(dataStructure);
+
+  SECTION("Exact")
+  {
+    Result<> result = GeometryUtilities::EliminateDuplicateNodes(triangleGeom);
+    SIMPLNX_RESULT_REQUIRE_VALID(result);
+    RequireWeldedGeometry(triangleGeom, {0.0F, 0.0F, 0.0F, 1.0F, 0.0F, 0.0F, 0.0F, 1.0F, 0.0F, 1.0F, 1.0F, 0.0F, 0.0001F, 1.0F, 0.0F}, {0, 1, 2, 1, 3, 4});
+  }
+  SECTION("Tolerance")
+  {
+    // The near duplicate is merged into the first occurrence and keeps its coordinates
+    Result<> result = GeometryUtilities::EliminateDuplicateNodes(triangleGeom, std::nullopt, 0.001F);
+    SIMPLNX_RESULT_REQUIRE_VALID(result);
+    RequireWeldedGeometry(triangleGeom, {0.0F, 0.0F, 0.0F, 1.0F, 0.0F, 0.0F, 0.0F, 1.0F, 0.0F, 1.0F, 1.0F, 0.0F}, {0, 1, 2, 1, 3, 2});
+  }
+  SECTION("Tolerance With Scale")
+  {
+    Result<> result = GeometryUtilities::EliminateDuplicateNodes(triangleGeom, 2.0F, 0.001F);
+    SIMPLNX_RESULT_REQUIRE_VALID(result);
+    RequireWeldedGeometry(triangleGeom, {0.0F, 0.0F, 0.0F, 2.0F, 0.0F, 0.0F, 0.0F, 2.0F, 0.0F, 2.0F, 2.0F, 0.0F}, {0, 1, 2, 1, 3, 2});
+  }
+}
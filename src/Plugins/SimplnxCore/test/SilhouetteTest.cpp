@@ -80,3 +80,40 @@ TEST_CASE("SimplnxCore::SilhouetteFilter: Means Test", "[SimplnxCore][Silhouette
 
   UnitTest::CompareArrays<float64>(dataStructure, k_MeansSilhouettePath, k_MeansSilhouettePathNX);
 }
+
+TEST_CASE("SimplnxCore::SilhouetteFilter: Sampling Test", "[SimplnxCore][SilhouetteFilter]")
+{
+  const nx::core::UnitTest::TestFileSentinel testDataSentinel(nx::core::unit_test::k_CMakeExecutable, nx::core::unit_test::k_TestFilesDir, "k_files.tar.gz", "k_files");
+  DataStructure dataStructure = UnitTest::LoadDataStructure(fs::path(fmt::format("{}/k_files/7_0_silhouette_exemplar.dream3d", unit_test::k_TestFilesDir)));
+
+  SilhouetteFilter filter;
+  Arguments args;
+
+  args.insertOrAssign(SilhouetteFilter::k_UseMask_Key, std::make_any<bool>(false));
+  args.insertOrAssign(SilhouetteFilter::k_SelectedArrayPath_Key, std::make_any<DataPath>(k_CellPath.createChildPath("DAMAGE")));
+  args.insertOrAssign(SilhouetteFilter::k_FeatureIdsArrayPath_Key, std::make_any<DataPath>(k_MeansClusterIdsPath));
+  args.insertOrAssign(SilhouetteFilter::k_SilhouetteArrayPath_Key, std::make_any<DataPath>(k_MeansSilhouettePathNX));
+  args.insertOrAssign(SilhouetteFilter::k_UseSampling_Key, std::make_any<bool>(true));
+
+  SECTION("Zero Samples")
+  {
+    args.insertOrAssign(SilhouetteFilter::k_SamplesPerCluster_Key, std::make_any<uint64>(0));
+
+    auto preflightResult = filter.preflight(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_INVALID(preflightResult.outputActions);
+  }
+
+  SECTION("Samples Cover Every Cluster")
+  {
+    // A sample at least as large as every cluster holds every point, so the result is exact
+    args.insertOrAssign(SilhouetteFilter::k_SamplesPerCluster_Key, std::make_any<uint64>(std::numeric_limits<uint32>::max()));
+
+    auto preflightResult = filter.preflight(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+
+    UnitTest::CompareArrays<float64>(dataStructure, k_MeansSilhouettePath, k_MeansSilhouettePathNX);
+  }
+}
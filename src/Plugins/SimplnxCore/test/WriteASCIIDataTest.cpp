@@ -9,6 +9,8 @@
 
 #include <filesystem>
 #include <fstream>
+#include <iomanip>
+#include <sstream>
 #include <stdexcept>
 
 namespace fs = std::filesystem;
@@ -218,3 +220,86 @@ TEST_CASE("SimplnxCore::WriteASCIIData: Valid filter execution")
   RunASCIIDataTest<float32>(dataStructure).execute();
   RunASCIIDataTest<float64>(dataStructure).execute();
 } // end of test case
+
+TEST_CASE("SimplnxCore::WriteASCIIData: Chunked output and precision")
+{
+  // Enough tuples to span several formatting chunks
+  constexpr usize k_LargeNumTuples = 5003;
+  const fs::path outputDir = fs::path(fmt::format("{}/ascii_data_chunked", unit_test::k_BinaryTestOutputDir));
+
+  DataStructure dataStructure;
+  auto* floatArray = UnitTest::CreateTestDataArray<float32>(dataStructure, "Floats", {k_LargeNumTuples}, {2});
+  auto* intArray = UnitTest::CreateTestDataArray<int32>(dataStructure, "Ints", {k_LargeNumTuples}, {1});
+  for(usize i = 0; i < k_LargeNumTuples; i++)
+  {
+    (*floatArray)[i * 2] = static_cast<float32>(i) * 0.1234567F;
+    (*floatArray)[i * 2 + 1] = -1.0F / static_cast<float32>(i + 1);
+    (*intArray)[i] = static_cast<int32>(i) - 2500;
+  }
+  const std::vector<DataPath> selectedPaths = {DataPath({"Floats"}), DataPath({"Ints"})};
+
+  auto readFile = [](const fs::path& filePath) {
+    std::ifstream file(filePath, std::ios_base::binary);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+  };
+
+  SECTION("Single File")
+  {
+    constexpr int32 k_Precision = 4;
+    const fs::path outputPath = outputDir / "single_file.csv";
+
+    WriteASCIIDataFilter filter;
+    Arguments args;
+    args.insertOrAssign(WriteASCIIDataFilter::k_OutputStyle_Key, std::make_any<ChoicesParameter::ValueType>(k_SingleFile));
+    args.insertOrAssign(WriteASCIIDataFilter::k_OutputPath_Key, std::make_any<fs::path>(outputPath));
+    args.insertOrAssign(WriteASCIIDataFilter::k_Delimiter_Key, std::make_any<ChoicesParameter::ValueType>(2));
+    args.insertOrAssign(WriteASCIIDataFilter::k_Includes_Key, std::make_any<ChoicesParameter::ValueType>(3));
+    args.insertOrAssign(WriteASCIIDataFilter::k_SelectedDataArrayPaths_Key, std::make_any<MultiArraySelectionParameter::ValueType>(selectedPaths));
+    args.insertOrAssign(WriteASCIIDataFilter::k_FloatPrecision_Key, std::make_any<int32>(k_Precision));
+
+    auto preflightResult = filter.preflight(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+
+    std::ostringstream expected;
+    expected << std::setprecision(k_Precision) << "Index,Floats_0,Floats_1,Ints\n";
+    for(usize i = 0; i < k_LargeNumTuples; i++)
+    {
+      expected << i << "," << (*floatArray)[i * 2] << "," << (*floatArray)[i * 2 + 1] << "," << (*intArray)[i] << "\n";
+    }
+    REQUIRE(readFile(outputPath) == expected.str());
+  }
+
+  SECTION("Multiple Files")
+  {
+    constexpr int32 k_TuplesPerLine = 3;
+
+    WriteASCIIDataFilter filter;
+    Arguments args;
+    args.insertOrAssign(WriteASCIIDataFilter::k_OutputStyle_Key, std::make_any<ChoicesParameter::ValueType>(k_MultipleFiles));
+    args.insertOrAssign(WriteASCIIDataFilter::k_OutputDir_Key, std::make_any<fs::path>(outputDir));
+    args.insertOrAssign(WriteASCIIDataFilter::k_FileExtension_Key, std::make_any<std::string>(".txt"));
+    args.insertOrAssign(WriteASCIIDataFilter::k_MaxTuplePerLine_Key, std::make_any<int32>(k_TuplesPerLine));
+    args.insertOrAssign(WriteASCIIDataFilter::k_Delimiter_Key, std::make_any<ChoicesParameter::ValueType>(k_TabDelimiter));
+    args.insertOrAssign(WriteASCIIDataFilter::k_SelectedDataArrayPaths_Key, std::make_any<MultiArraySelectionParameter::ValueType>(selectedPaths));
+
+    auto preflightResult = filter.preflight(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+
+    std::string expectedFloats;
+    std::string expectedInts;
+    for(usize i = 0; i < k_LargeNumTuples; i++)
+    {
+      const char separator = (i + 1) % k_TuplesPerLine == 0 ? '\n' : '\t';
+      expectedFloats += fmt::format("{}\t{}{}", (*floatArray)[i * 2], (*floatArray)[i * 2 + 1], separator);
+      expectedInts += fmt::format("{}{}", (*intArray)[i], separator);
+    }
+    REQUIRE(readFile(outputDir / "Floats.txt") == expectedFloats);
+    REQUIRE(readFile(outputDir / "Ints.txt") == expectedInts);
+  }
+}
@@ -87,6 +87,9 @@
 
 #include <fmt/ranges.h>
 
+#include <numeric>
+#include <utility>
+
 using namespace nx::core;
 using namespace nx::core::CxPybind;
 namespace py = pybind11;
@@ -149,24 +152,177 @@ auto BindVectorParameter(py::handle scope, const char* name)
 #define SIMPLNX_PY_BIND_NUMBER_PARAMETER(scope, className) BindNumberParameter<className>(scope, #className)
 #define SIMPLNX_PY_BIND_VECTOR_PARAMETER(scope, className) BindVectorParameter<className>(scope, #className)
 
+template <class T>
+IDataStore::ShapeType GetNumPyShape(const AbstractDataStore<T>& dataStore)
+{
+  IDataStore::ShapeType shape = dataStore.getTupleShape();
+  IDataStore::ShapeType componentShape = dataStore.getComponentShape();
+  shape.insert(shape.end(), componentShape.cbegin(), componentShape.cend());
+  return shape;
+}
+
+/**
+ * @brief Returns a NumPy array that uses the buffer of the DataStore. The owner is set as the
+ * base of the array so the buffer stays alive as long as the array does. The buffer is pinned,
+ * so copies of the store made later, e.g. pipeline snapshots, copy the values instead of sharing
+ * them and the view keeps tracking the store.
+ */
+template <class T>
+py::array_t<T, py::array::c_style> CreateNumPyView(DataStore<T>& dataStore, const py::handle& owner)
+{
+  return py::array_t<T, py::array::c_style>(GetNumPyShape(dataStore), dataStore.pinBuffer(), owner);
+}
+
+/**
+ * @brief Returns a window of numTuples tuples starting at startTuple. In-memory stores return a
+ * view that shares their pinned buffer. Other stores load the tuples into a new array, so changes
+ * to it must be written back with WriteNumPyWindow().
+ */
+template <class T>
+py::array_t<T, py::array::c_style> CreateNumPyWindow(AbstractDataStore<T>& dataStore, usize startTuple, usize numTuples, const py::handle& owner)
+{
+  if(startTuple + numTuples > dataStore.getNumberOfTuples())
+  {
+    throw py::index_error(fmt::format("The window of {} tuples starting at tuple {} is out of range of the {} tuples in the data store.", numTuples, startTuple, dataStore.getNumberOfTuples()));
+  }
+  IDataStore::ShapeType shape = dataStore.getComponentShape();
+  shape.insert(shape.begin(), numTuples);
+  const usize startIndex = startTuple * dataStore.getNumberOfComponents();
+
+  auto* memoryStore = dynamic_cast<DataStore<T>*>(&dataStore);
+  if(memoryStore != nullptr)
+  {
+    return py::array_t<T, py::array::c_style>(shape, memoryStore->pinBuffer() + startIndex, owner);
+  }
+
+  py::array_t<T, py::array::c_style> window(shape);
+  nonstd::span<T> buffer(window.mutable_data(), static_cast<usize>(window.size()));
+  Result<> result;
+  {
+    // Out-of-core stores may have to read the values from disk
+    py::gil_scoped_release releaseGIL{};
+    result = dataStore.copyIntoBuffer(startIndex, buffer);
+  }
+  if(result.invalid())
+  {
+    throw std::runtime_error(result.errors().front().message);
+  }
+  return window;
+}
+
+template <class T>
+void WriteNumPyWindow(AbstractDataStore<T>& dataStore, usize startTuple, const py::array_t<T, py::array::c_style | py::array::forcecast>& values)
+{
+  const usize startIndex = startTuple * dataStore.getNumberOfComponents();
+  auto* memoryStore = dynamic_cast<DataStore<T>*>(&dataStore);
+  if(memoryStore != nullptr && values.data() == std::as_const(*memoryStore).data() + startIndex)
+  {
+    // The window is a view of the store, its values are already in place
+    return;
+  }
+  nonstd::span<const T> buffer(values.data(), static_cast<usize>(values.size()));
+  Result<> result;
+  {
+    py::gil_scoped_release releaseGIL{};
+    result = dataStore.copyFromBuffer(startIndex, buffer);
+  }
+  if(result.invalid())
+  {
+    throw std::runtime_error(result.errors().front().message);
+  }
+}
+
+/**
+ * @brief Creates a pinned DataStore that uses the memory of the NumPy array without copying it.
+ * The DataStore holds a reference to the array until it is destroyed and copies of it copy the
+ * values, so the array and the DataStore always see each other's writes. If no shapes are given,
+ * the last axis of the array is used as the component shape and the other axes as the tuple shape.
+ */
+template <class T>
+std::shared_ptr<DataStore<T>> CreateDataStoreFromNumPy(const py::array& array, std::optional<IDataStore::ShapeType> tupleShape, std::optional<IDataStore::ShapeType> componentShape)
+{
+  if(!py::isinstance<py::array_t<T>>(array))
+  {
+    throw std::invalid_argument(fmt::format("The NumPy array has the dtype '{}' but '{}' is required.", py::str(array.dtype()).cast<std::string>(), py::str(py::dtype::of<T>()).cast<std::string>()));
+  }
+  if((array.flags() & py::array::c_style) == 0)
+  {
+    throw std::invalid_argument("The NumPy array must be C contiguous. Use numpy.ascontiguousarray() to create a contiguous copy.");
+  }
+  if(!array.writeable())
+  {
+    throw std::invalid_argument("The NumPy array must be writeable.");
+  }
+
+  if(!tupleShape.has_value() || !componentShape.has_value())
+  {
+    IDataStore::ShapeType arrayShape(array.shape(), array.shape() + array.ndim());
+    if(arrayShape.empty())
+    {
+      arrayShape.push_back(1);
+    }
+    if(!componentShape.has_value())
+    {
+      componentShape = arrayShape.size() > 1 ? IDataStore::ShapeType{arrayShape.back()} : IDataStore::ShapeType{1};
+    }
+    if(!tupleShape.has_value())
+    {
+      const usize numComponents = std::accumulate(componentShape->cbegin(), componentShape->cend(), static_cast<usize>(1), std::multiplies<>());
+      tupleShape = IDataStore::ShapeType{numComponents == 0 ? 0 : static_cast<usize>(array.size()) / numComponents};
+      if(arrayShape.size() > 1 && arrayShape.back() == numComponents)
+      {
+        tupleShape = IDataStore::ShapeType(arrayShape.cbegin(), arrayShape.cend() - 1);
+      }
+    }
+  }
+  const usize numTuples = std::accumulate(tupleShape->cbegin(), tupleShape->cend(), static_cast<usize>(1), std::multiplies<>());
+  const usize numComponents = std::accumulate(componentShape->cbegin(), componentShape->cend(), static_cast<usize>(1), std::multiplies<>());
+  if(numTuples * numComponents != static_cast<usize>(array.size()))
+  {
+    throw std::invalid_argument(fmt::format("The tuple shape {} and component shape {} require {} values but the NumPy array has {} values.", fmt::join(*tupleShape, "x"), fmt::join(*componentShape, "x"),
+                                            numTuples * numComponents, array.size()));
+  }
+
+  auto* owner = new py::object(array);
+  std::shared_ptr<T[]> buffer(static_cast<T*>(array.mutable_data()), [owner](T*) {
+    // The last reference may be released by a thread that does not hold the GIL or after the interpreter has shut down
+    if(Py_IsInitialized() == 0)
+    {
+      return;
+    }
+    py::gil_scoped_acquire acquireGIL{};
+    delete owner;
+  });
+  return std::make_shared<DataStore<T>>(std::move(buffer), std::move(*tupleShape), std::move(*componentShape));
+}
+
+template <class T>
+auto BindAbstractDataStore(py::handle scope, const char* name)
+{
+  py::class_<AbstractDataStore<T>, IDataStore, std::shared_ptr<AbstractDataStore<T>>> abstractDataStore(scope, name);
+  abstractDataStore.def(
+      "npview_window", [](py::object self, usize startTuple, usize numTuples) { return CreateNumPyWindow<T>(self.cast<AbstractDataStore<T>&>(), startTuple, numTuples, self); }, "start_tuple"_a,
+      "num_tuples"_a,
+      "Returns a NumPy array for the tuples [start_tuple, start_tuple + num_tuples). In-memory stores return a view of their buffer. Out-of-core stores load the tuples into a new array, call "
+      "write_window() to store changes.");
+  abstractDataStore.def(
+      "write_window", [](AbstractDataStore<T>& dataStore, usize startTuple, const py::array_t<T, py::array::c_style | py::array::forcecast>& values) { WriteNumPyWindow<T>(dataStore, startTuple, values); },
+      "start_tuple"_a, "values"_a, "Writes the values into the store starting at start_tuple. Does nothing if the values are a view of the store returned by npview_window().");
+  return abstractDataStore;
+}
+
 template <class T>
 auto BindDataStore(py::handle scope, const char* name)
 {
   py::class_<DataStore<T>, AbstractDataStore<T>, std::shared_ptr<DataStore<T>>> dataStore(scope, name);
   dataStore.def(py::init<const IDataStore::ShapeType&, const IDataStore::ShapeType&, std::optional<T>>(), "tuple_shape"_a, "component_shape"_a, "init_value"_a = std::optional<T>{});
+  dataStore.def(py::init(&CreateDataStoreFromNumPy<T>), "array"_a, "tuple_shape"_a = std::optional<IDataStore::ShapeType>{}, "component_shape"_a = std::optional<IDataStore::ShapeType>{},
+                "Creates a DataStore that uses the memory of a C contiguous NumPy array without copying it");
   dataStore.def_property_readonly_static("dtype", []([[maybe_unused]] py::object self) { return py::dtype::of<T>(); });
-  dataStore.def(
-      "npview",
-      [](DataStore<T>& dataStore) {
-        IDataStore::ShapeType shape = dataStore.getTupleShape();
-        IDataStore::ShapeType componentShape = dataStore.getComponentShape();
-        shape.insert(shape.end(), componentShape.cbegin(), componentShape.cend());
-        return py::array_t<T, py::array::c_style>(shape, dataStore.data(), py::cast(dataStore));
-      },
-      py::return_value_policy::reference_internal);
+  dataStore.def("npview", [](py::object self) { return CreateNumPyView<T>(self.cast<DataStore<T>&>(), self); });
   dataStore.def("__getitem__", &DataStore<T>::at);
   dataStore.def("__len__", &DataStore<T>::getSize);
-  dataStore.def("resize_tuples", &DataStore<T>::resizeTuples, "Resize the tuples with the given shape");
+  dataStore.def("resize_tuples", &DataStore<T>::resizeTuples, "Resize the tuples with the given shape", py::call_guard<py::gil_scoped_release>());
   return dataStore;
 }
 
@@ -175,25 +331,39 @@ auto BindDataArray(py::handle scope, const char* name)
 {
   py::class_<DataArray<T>, IDataArray, std::shared_ptr<DataArray<T>>> dataArray(scope, name);
   dataArray.def_property_readonly_static("dtype", []([[maybe_unused]] py::object self) { return py::dtype::of<T>(); });
+  dataArray.def("npview", [](py::object self) {
+    auto& dataArray = self.cast<DataArray<T>&>();
+    auto* dataStore = dynamic_cast<DataStore<T>*>(dataArray.getDataStore());
+    if(dataStore == nullptr)
+    {
+      throw py::type_error(fmt::format("The DataArray '{}' is not stored in memory. Use npview_window() to access it in windows.", dataArray.getName()));
+    }
+    return CreateNumPyView<T>(*dataStore, self);
+  });
+  dataArray.def(
+      "npview_window", [](py::object self, usize startTuple, usize numTuples) { return CreateNumPyWindow<T>(self.cast<DataArray<T>&>().getDataStoreRef(), startTuple, numTuples, self); },
+      "start_tuple"_a, "num_tuples"_a,
+      "Returns a NumPy array for the tuples [start_tuple, start_tuple + num_tuples). In-memory arrays return a view of their buffer. Out-of-core arrays load the tuples into a new array, call "
+      "write_window() to store changes.");
+  dataArray.def(
+      "write_window",
+      [](DataArray<T>& dataArray, usize startTuple, const py::array_t<T, py::array::c_style | py::array::forcecast>& values) { WriteNumPyWindow<T>(dataArray.getDataStoreRef(), startTuple, values); },
+      "start_tuple"_a, "values"_a, "Writes the values into the array starting at start_tuple. Does nothing if the values are a view of the array returned by npview_window().");
   dataArray.def(
-      "npview",
-      [](DataArray<T>& dataArray) {
-        using DataArrayType = DataArray<T>;
-        using DataStoreType = DataStore<T>;
-        const typename DataArrayType::store_type& abstractDataStore = dataArray.getDataStoreRef();
-        const DataStoreType& dataStore = dynamic_cast<const DataStoreType&>(abstractDataStore);
-        IDataStore::ShapeType shape = dataStore.getTupleShape();
-        IDataStore::ShapeType componentShape = dataStore.getComponentShape();
-        shape.insert(shape.end(), componentShape.cbegin(), componentShape.cend());
-        return py::array_t<T, py::array::c_style>(shape, dataStore.data(), py::cast(dataStore));
+      "adopt_numpy",
+      [](DataArray<T>& dataArray, const py::array& array) {
+        auto store = CreateDataStoreFromNumPy<T>(array, dataArray.getTupleShape(), dataArray.getComponentShape());
+        dataArray.setDataStore(std::move(store));
       },
-      py::return_value_policy::reference_internal);
+      "array"_a,
+      "Replaces the values of the DataArray with the memory of a C contiguous NumPy array without copying it. The array must have the same number of values as the DataArray and keeps them alive "
+      "for as long as the DataArray uses them. Writes through the array and through the DataArray stay visible to each other, copies of the DataArray copy the values.");
   return dataArray;
 }
 
 #define SIMPLNX_PY_BIND_DATA_ARRAY(scope, className) BindDataArray<className::value_type>(scope, #className)
 #define SIMPLNX_PY_BIND_DATA_STORE(scope, className) BindDataStore<className::value_type>(scope, #className)
-#define SIMPLNX_PY_BIND_ABSTRACT_DATA_STORE(scope, className) SIMPLNX_PY_BIND_CLASS_VARIADIC(scope, className, IDataStore, std::shared_ptr<className>)
+#define SIMPLNX_PY_BIND_ABSTRACT_DATA_STORE(scope, className) BindAbstractDataStore<className::value_type>(scope, #className)
 
 template <class GeomT>
 auto BindCreateGeometry2DAction(py::handle scope, const char* name)
@@ -861,7 +1031,7 @@ PYBIND11_MODULE(simplnx, mod)
         nodeGeometry0D.resizeVertexList(size);
         nodeGeometry0D.getVertexAttributeMatrix()->resizeTuples({size});
       },
-      "This will resize the shared vertex list and also resize the associated attribute matrix");
+      "This will resize the shared vertex list and also resize the associated attribute matrix", py::call_guard<py::gil_scoped_release>());
   py::class_<VertexGeom, INodeGeometry0D, std::shared_ptr<VertexGeom>> vertexGeom(mod, "VertexGeom");
 
   py::class_<INodeGeometry1D, INodeGeometry0D, std::shared_ptr<INodeGeometry1D>> iNodeGeometry1D(mod, "INodeGeometry1D");
@@ -871,7 +1041,7 @@ PYBIND11_MODULE(simplnx, mod)
         nodeGeometry1D.resizeEdgeList(size);
         nodeGeometry1D.getEdgeAttributeMatrix()->resizeTuples({size});
       },
-      "This will resize the shared edge list and also resize the associated attribute matrix");
+      "This will resize the shared edge list and also resize the associated attribute matrix", py::call_guard<py::gil_scoped_release>());
   py::class_<EdgeGeom, INodeGeometry1D, std::shared_ptr<EdgeGeom>> edgeGeom(mod, "EdgeGeom");
 
   py::class_<INodeGeometry2D, INodeGeometry1D, std::shared_ptr<INodeGeometry2D>> iNodeGeometry2D(mod, "INodeGeometry2D");
@@ -881,7 +1051,7 @@ PYBIND11_MODULE(simplnx, mod)
         nodeGeometry2D.resizeFaceList(size);
         nodeGeometry2D.getEdgeAttributeMatrix()->resizeTuples({size});
       },
-      "This will resize the shared triangle list and also resize the associated attribute matrix");
+      "This will resize the shared triangle list and also resize the associated attribute matrix", py::call_guard<py::gil_scoped_release>());
   py::class_<TriangleGeom, INodeGeometry2D, std::shared_ptr<TriangleGeom>> triangleGeom(mod, "TriangleGeom");
   py::class_<QuadGeom, INodeGeometry2D, std::shared_ptr<QuadGeom>> quadGeom(mod, "QuadGeom");
 
@@ -892,14 +1062,14 @@ PYBIND11_MODULE(simplnx, mod)
         nodeGeometry3D.resizePolyhedraList(size);
         nodeGeometry3D.getPolyhedraAttributeMatrix()->resizeTuples({size});
       },
-      "This will resize the shared polyhedra list and also resize the associated attribute matrix");
+      "This will resize the shared polyhedra list and also resize the associated attribute matrix", py::call_guard<py::gil_scoped_release>());
   py::class_<TetrahedralGeom, INodeGeometry3D, std::shared_ptr<TetrahedralGeom>> tetrahedralGeom(mod, "TetrahedralGeom");
   py::class_<HexahedralGeom, INodeGeometry3D, std::shared_ptr<HexahedralGeom>> hexahedralGeom(mod, "HexahedralGeom");
 
   py::class_<DataGroup, BaseGroup, std::shared_ptr<DataGroup>> dataGroup(mod, "DataGroup");
 
   py::class_<AttributeMatrix, BaseGroup, std::shared_ptr<AttributeMatrix>> attributeMatrix(mod, "AttributeMatrix");
-  attributeMatrix.def("resize_tuples", &AttributeMatrix::resizeTuples, "Resize the tuples with the given shape");
+  attributeMatrix.def("resize_tuples", &AttributeMatrix::resizeTuples, "Resize the tuples with the given shape", py::call_guard<py::gil_scoped_release>());
   attributeMatrix.def_property_readonly("tuple_shape", &AttributeMatrix::getShape, "Returns the Tuple dimensions of the AttributeMatrix");
   attributeMatrix.def_property_readonly("size", &AttributeMatrix::getNumTuples, "Returns the total number of tuples");
 
@@ -918,7 +1088,7 @@ PYBIND11_MODULE(simplnx, mod)
   iDataArray.def_property_readonly("tdims", &IDataArray::getTupleShape);
   iDataArray.def_property_readonly("cdims", &IDataArray::getComponentShape);
   iDataArray.def_property_readonly("data_type", &IDataArray::getDataType);
-  iDataArray.def("resize_tuples", &IDataArray::resizeTuples, "Resize the tuples with the given shape");
+  iDataArray.def("resize_tuples", &IDataArray::resizeTuples, "Resize the tuples with the given shape", py::call_guard<py::gil_scoped_release>());
 
   py::class_<StringArray, IArray, std::shared_ptr<StringArray>> stringArray(mod, "StringArray");
   stringArray.def(
@@ -1309,7 +1479,8 @@ PYBIND11_MODULE(simplnx, mod)
   py::class_<IFilter::MessageHandler> messageHandler(filter, "MessageHandler");
   messageHandler.def(py::init<>());
   messageHandler.def_readwrite("callback", &IFilter::MessageHandler::m_Callback);
-  messageHandler.def("__call__", [](const IFilter::MessageHandler& self, const IFilter::Message& message) { self(message); });
+  // The handler may forward the message to another thread or wait for a lock, so it must not hold the GIL
+  messageHandler.def("__call__", [](const IFilter::MessageHandler& self, const IFilter::Message& message) { self(message); }, py::call_guard<py::gil_scoped_release>());
 
   py::class_<IFilter::PreflightValue> preflightValue(filter, "PreflightValue");
   preflightValue.def(py::init<>());
@@ -1423,7 +1594,11 @@ PYBIND11_MODULE(simplnx, mod)
       },
       "path"_a);
   pipeline.def_property("name", &Pipeline::getName, &Pipeline::setName);
-  pipeline.def("execute", &ExecutePipeline);
+  pipeline.def_property("concurrent_execution", &Pipeline::isConcurrentExecutionEnabled, &Pipeline::setConcurrentExecutionEnabled);
+  pipeline.def_property("snapshot_isolation", &Pipeline::isSnapshotIsolationEnabled, &Pipeline::setSnapshotIsolationEnabled);
+  pipeline.def("preflight", [](Pipeline& self) { return self.preflight(); }, py::call_guard<py::gil_scoped_release>());
+  // Python filters in the pipeline acquire the GIL for themselves, everything else runs without it
+  pipeline.def("execute", &ExecutePipeline, py::call_guard<py::gil_scoped_release>());
   pipeline.def(
       "__getitem__", [](Pipeline& self, Pipeline::index_type index) { return self.at(index); }, py::return_value_policy::reference_internal);
   pipeline.def("__len__", &Pipeline::size);
@@ -4,15 +4,22 @@
 #include "simplnx/Common/StringLiteralFormatting.hpp"
 #include "simplnx/Core/Application.hpp"
 #include "simplnx/Pipeline/Pipeline.hpp"
+#include "simplnx/Pipeline/PipelineBatch.hpp"
+#include "simplnx/Pipeline/PipelineResultCache.hpp"
 #include "simplnx/SIMPLNXVersion.hpp"
 #include "simplnx/SimplnxPython.hpp"
+#include "simplnx/Utilities/ExecutionContext.hpp"
+#include "simplnx/Utilities/MemoryUtilities.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 #include "simplnx/Utilities/TimeUtilities.hpp"
 
 #include <fmt/format.h>
 
+#include <charconv>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <optional>
 #include <ostream>
 #include <string>
 
@@ -41,6 +48,13 @@ constexpr int32 k_PreflightPipelineError = -110;
 constexpr int32 k_InvalidArgumentError = -120;
 constexpr int32 k_LogFileError = -121;
 constexpr int32 k_NullLogFileError = -122;
+constexpr int32 k_NullCacheDirectoryError = -123;
+constexpr int32 k_InvalidThreadingValueError = -124;
+constexpr int32 k_MissingManifestError = -125;
+constexpr int32 k_SummaryFileError = -126;
+constexpr int32 k_BatchJobsFailedError = -127;
+constexpr int32 k_InvalidBatchValueError = -128;
+constexpr int32 k_InvalidCacheSizeError = -129;
 
 constexpr StringLiteral k_HelpParamLong = "--help";
 constexpr StringLiteral k_ExecuteParamLong = "--execute";
@@ -48,6 +62,17 @@ constexpr StringLiteral k_PreflightParamLong = "--preflight";
 constexpr StringLiteral k_LogFileParamLong = "--logfile";
 constexpr StringLiteral k_ConvertParamLong = "--convert";
 constexpr StringLiteral k_ConvertOutputParamLong = "--convert-output";
+constexpr StringLiteral k_CacheParamLong = "--cache";
+constexpr StringLiteral k_CacheSizeParamLong = "--cache-size";
+constexpr StringLiteral k_MaxThreadsParamLong = "--max-threads";
+constexpr StringLiteral k_GrainSizeParamLong = "--grain-size";
+constexpr StringLiteral k_NumaNodeParamLong = "--numa-node";
+constexpr StringLiteral k_FirstTouchParamLong = "--first-touch";
+constexpr StringLiteral k_BatchParamLong = "--batch";
+constexpr StringLiteral k_ManifestParamLong = "--manifest";
+constexpr StringLiteral k_JobsParamLong = "--jobs";
+constexpr StringLiteral k_MemoryBudgetParamLong = "--memory-budget";
+constexpr StringLiteral k_SummaryParamLong = "--summary";
 
 constexpr StringLiteral k_HelpParamShort = "-h";
 constexpr StringLiteral k_ExecuteParamShort = "-e";
@@ -55,6 +80,17 @@ constexpr StringLiteral k_PreflightParamShort = "-p";
 constexpr StringLiteral k_LogFileParamShort = "-l";
 constexpr StringLiteral k_ConvertParamShort = "-c";
 constexpr StringLiteral k_ConvertOutputParamShort = "-co";
+constexpr StringLiteral k_CacheParamShort = "-ca";
+constexpr StringLiteral k_CacheSizeParamShort = "-cs";
+constexpr StringLiteral k_MaxThreadsParamShort = "-mt";
+constexpr StringLiteral k_GrainSizeParamShort = "-gs";
+constexpr StringLiteral k_NumaNodeParamShort = "-nn";
+constexpr StringLiteral k_FirstTouchParamShort = "-ft";
+constexpr StringLiteral k_BatchParamShort = "-b";
+constexpr StringLiteral k_ManifestParamShort = "-m";
+constexpr StringLiteral k_JobsParamShort = "-j";
+constexpr StringLiteral k_MemoryBudgetParamShort = "-mb";
+constexpr StringLiteral k_SummaryParamShort = "-s";
 
 void LoadApp()
 {
@@ -130,6 +166,35 @@ private:
 
 CliStream cliOut;
 
+std::shared_ptr<PipelineResultCache> resultCache;
+std::optional<uint64> resultCacheSizeMiB;
+
+/**
+ * @brief Threading values given on the command line. They override the values from the preferences.
+ */
+struct ThreadingOptions
+{
+  std::optional<usize> maxThreads;
+  std::optional<usize> grainSize;
+  std::optional<int32> numaNode;
+  bool firstTouch = false;
+};
+
+ThreadingOptions threadingOptions;
+
+/**
+ * @brief Values that only apply to batch mode.
+ */
+struct BatchOptions
+{
+  std::string manifestPath;
+  std::string summaryPath;
+  usize maxJobs = 0;
+  std::optional<uint64> memoryBudgetMiB;
+};
+
+BatchOptions batchOptions;
+
 enum class ArgumentType
 {
   Invalid,
@@ -138,7 +203,18 @@ enum class ArgumentType
   Help,
   Logfile,
   Convert,
-  ConvertOutput
+  ConvertOutput,
+  Cache,
+  CacheSize,
+  MaxThreads,
+  GrainSize,
+  NumaNode,
+  FirstTouch,
+  Batch,
+  Manifest,
+  Jobs,
+  MemoryBudget,
+  Summary
 };
 
 struct Argument
@@ -237,6 +313,60 @@ Result<CliArguments> ParseParameters(int argc, char* argv[])
       std::string argStr = ParseArgument(argc, argv, index);
       args.emplace_back(ArgumentType::ConvertOutput, argStr);
     }
+    else if(arg == k_CacheParamLong || arg == k_CacheParamShort)
+    {
+      std::string argStr = ParseArgument(argc, argv, index);
+      args.emplace_back(ArgumentType::Cache, argStr);
+    }
+    else if(arg == k_CacheSizeParamLong || arg == k_CacheSizeParamShort)
+    {
+      std::string argStr = ParseArgument(argc, argv, index);
+      args.emplace_back(ArgumentType::CacheSize, argStr);
+    }
+    else if(arg == k_MaxThreadsParamLong || arg == k_MaxThreadsParamShort)
+    {
+      std::string argStr = ParseArgument(argc, argv, index);
+      args.emplace_back(ArgumentType::MaxThreads, argStr);
+    }
+    else if(arg == k_GrainSizeParamLong || arg == k_GrainSizeParamShort)
+    {
+      std::string argStr = ParseArgument(argc, argv, index);
+      args.emplace_back(ArgumentType::GrainSize, argStr);
+    }
+    else if(arg == k_NumaNodeParamLong || arg == k_NumaNodeParamShort)
+    {
+      std::string argStr = ParseArgument(argc, argv, index);
+      args.emplace_back(ArgumentType::NumaNode, argStr);
+    }
+    else if(arg == k_FirstTouchParamLong || arg == k_FirstTouchParamShort)
+    {
+      args.emplace_back(ArgumentType::FirstTouch);
+    }
+    else if(arg == k_BatchParamLong || arg == k_BatchParamShort)
+    {
+      std::string argStr = ParseArgument(argc, argv, index);
+      args.emplace_back(ArgumentType::Batch, argStr);
+    }
+    else if(arg == k_ManifestParamLong || arg == k_ManifestParamShort)
+    {
+      std::string argStr = ParseArgument(argc, argv, index);
+      args.emplace_back(ArgumentType::Manifest, argStr);
+    }
+    else if(arg == k_JobsParamLong || arg == k_JobsParamShort)
+    {
+      std::string argStr = ParseArgument(argc, argv, index);
+      args.emplace_back(ArgumentType::Jobs, argStr);
+    }
+    else if(arg == k_MemoryBudgetParamLong || arg == k_MemoryBudgetParamShort)
+    {
+      std::string argStr = ParseArgument(argc, argv, index);
+      args.emplace_back(ArgumentType::MemoryBudget, argStr);
+    }
+    else if(arg == k_SummaryParamLong || arg == k_SummaryParamShort)
+    {
+      std::string argStr = ParseArgument(argc, argv, index);
+      args.emplace_back(ArgumentType::Summary, argStr);
+    }
     else
     {
       args.emplace_back(ArgumentType::Invalid, arg);
@@ -292,6 +422,17 @@ Result<> ExecutePipeline(Pipeline& pipeline)
   cliOut << "\n-------------------------";
   cliOut.endline();
 
+  if(resultCache != nullptr)
+  {
+    if(resultCacheSizeMiB.has_value())
+    {
+      resultCache->setMaximumSize(*resultCacheSizeMiB * 1024 * 1024);
+    }
+    cliOut << fmt::format("Using result cache at path: '{}' with a size limit of {} MiB", resultCache->getCacheDirectory().string(), resultCache->getMaximumSize() / (1024 * 1024));
+    cliOut.endline();
+    pipeline.setResultCache(resultCache);
+  }
+
   if(!pipeline.execute())
   {
     std::string ss = "Error executing pipeline";
@@ -445,7 +586,35 @@ void DisplayDefaultHelp()
          << "\t Preflight the pipeline at the target filepath. Optionally, create a log file at the specified path.\n";
   cliOut << fmt::format("\t {}|{} <pipeline filepath>  [{}|{} <log filepath>]\t", k_ConvertParamLong, k_ConvertParamShort, k_LogFileParamLong, k_LogFileParamShort)
          << "\t Convert the SIMPL pipeline at the target filepath. Optionally, create a log file at the specified path.";
-  cliOut << fmt::format("\t <operand [argument]>  [{}|{} <log filepath>]\t", k_LogFileParamLong, k_LogFileParamShort) << "\t Creates a log file at the specified path.";
+  cliOut << fmt::format("\t <operand [argument]>  [{}|{} <log filepath>]\t", k_LogFileParamLong, k_LogFileParamShort) << "\t Creates a log file at the specified path.\n";
+  cliOut << fmt::format("\t {}|{} <pipeline filepath> [{}|{} <cache directory>] [{}|{} <MiB>]\t", k_ExecuteParamLong, k_ExecuteParamShort, k_CacheParamLong, k_CacheParamShort,
+                        k_CacheSizeParamLong, k_CacheSizeParamShort)
+         << "\t Restores unchanged pipeline steps from the cache directory and stores new results there, up to the size limit.\n";
+  cliOut << fmt::format("\t <operand [argument]>  [{}|{} <count>] [{}|{} <count>] [{}|{} <node>] [{}|{}]\t", k_MaxThreadsParamLong, k_MaxThreadsParamShort, k_GrainSizeParamLong,
+                        k_GrainSizeParamShort, k_NumaNodeParamLong, k_NumaNodeParamShort, k_FirstTouchParamLong, k_FirstTouchParamShort)
+         << "\t Limits the threads, sets the parallel grain size, pins the threads to a NUMA node or enables first touch allocation.\n";
+  cliOut << fmt::format("\t {}|{} <pipeline filepath> {}|{} <manifest filepath> [{}|{} <count>] [{}|{} <MiB>] [{}|{} <summary filepath>]\t", k_BatchParamLong, k_BatchParamShort,
+                        k_ManifestParamLong, k_ManifestParamShort, k_JobsParamLong, k_JobsParamShort, k_MemoryBudgetParamLong, k_MemoryBudgetParamShort, k_SummaryParamLong, k_SummaryParamShort)
+         << "\t Execute the pipeline once for every job in the manifest file.";
+  cliOut.endline();
+}
+
+void DisplayBatchHelp()
+{
+  cliOut << "To execute a pipeline once for every job of a manifest file:\n\t";
+  cliOut << fmt::format("\t {}|{} <pipeline filepath> {}|{} <manifest filepath> [{}|{} <count>] [{}|{} <MiB>] [{}|{} <summary filepath>]\t", k_BatchParamLong, k_BatchParamShort,
+                        k_ManifestParamLong, k_ManifestParamShort, k_JobsParamLong, k_JobsParamShort, k_MemoryBudgetParamLong, k_MemoryBudgetParamShort, k_SummaryParamLong, k_SummaryParamShort)
+         << "\t Runs up to <count> jobs at the same time while their estimated memory fits in the budget. Optionally, writes a JSON summary of every job.";
+  cliOut.endline();
+}
+
+void DisplayThreadingHelp()
+{
+  cliOut << "To control the threads used while executing a pipeline:\n\t";
+  cliOut << fmt::format("\t {}|{} <count>\t", k_MaxThreadsParamLong, k_MaxThreadsParamShort) << "\t Maximum number of threads. 0 uses all threads.\n\t";
+  cliOut << fmt::format("\t {}|{} <count>\t", k_GrainSizeParamLong, k_GrainSizeParamShort) << "\t Minimum number of elements per parallel task. 0 lets TBB decide.\n\t";
+  cliOut << fmt::format("\t {}|{} <node>\t", k_NumaNodeParamLong, k_NumaNodeParamShort) << "\t Pins the threads to the NUMA node. -1 does not pin the threads.\n\t";
+  cliOut << fmt::format("\t {}|{}\t", k_FirstTouchParamLong, k_FirstTouchParamShort) << "\t New arrays are initialized by the threads that work on them.";
   cliOut.endline();
 }
 
@@ -481,6 +650,15 @@ void DisplayConvertOutputHelp()
   cliOut.endline();
 }
 
+void DisplayCacheHelp()
+{
+  cliOut << "To execute a target pipeline file using a result cache:\n\t";
+  cliOut << fmt::format("\t {}|{} <pipeline filepath> [{}|{} <cache directory>] [{}|{} <MiB>]\t", k_ExecuteParamLong, k_ExecuteParamShort, k_CacheParamLong, k_CacheParamShort,
+                        k_CacheSizeParamLong, k_CacheSizeParamShort)
+         << "\t Restores unchanged pipeline steps from the cache directory and stores new results there, up to the size limit.";
+  cliOut.endline();
+}
+
 void DisplayLogfileHelp()
 {
   cliOut << "To export output a log file:\n\t";
@@ -517,6 +695,42 @@ Result<> DisplayHelpMenu(const std::vector<Argument>& arguments)
     DisplayLogfileHelp();
     return {};
   }
+  case ArgumentType::Cache: {
+    [[fallthrough]];
+  }
+  case ArgumentType::CacheSize: {
+    DisplayCacheHelp();
+    return {};
+  }
+  case ArgumentType::MaxThreads: {
+    [[fallthrough]];
+  }
+  case ArgumentType::GrainSize: {
+    [[fallthrough]];
+  }
+  case ArgumentType::NumaNode: {
+    [[fallthrough]];
+  }
+  case ArgumentType::FirstTouch: {
+    DisplayThreadingHelp();
+    return {};
+  }
+  case ArgumentType::Batch: {
+    [[fallthrough]];
+  }
+  case ArgumentType::Manifest: {
+    [[fallthrough]];
+  }
+  case ArgumentType::Jobs: {
+    [[fallthrough]];
+  }
+  case ArgumentType::MemoryBudget: {
+    [[fallthrough]];
+  }
+  case ArgumentType::Summary: {
+    DisplayBatchHelp();
+    return {};
+  }
   case ArgumentType::Invalid: {
     [[fallthrough]];
   }
@@ -540,6 +754,209 @@ Result<> SetLogFile(const Argument& argument)
   std::filesystem::path filepath(argument.value);
   return cliOut.setLogFile(filepath);
 }
+
+Result<> SetCacheDirectory(const Argument& argument)
+{
+  if(argument.value.empty())
+  {
+    std::string errorMessage = "The result cache cannot be used with an empty directory path.";
+    return nx::core::MakeErrorResult(k_NullCacheDirectoryError, errorMessage);
+  }
+  resultCache = std::make_shared<PipelineResultCache>(std::filesystem::path(argument.value));
+  resultCache->setEnabled(true);
+  return {};
+}
+
+Result<int64> ParseIntegerArgument(const Argument& argument, int64 minimum, int32 errorCode)
+{
+  int64 value = 0;
+  const char* end = argument.value.data() + argument.value.size();
+  const auto parseResult = std::from_chars(argument.value.data(), end, value);
+  if(argument.value.empty() || parseResult.ec != std::errc() || parseResult.ptr != end || value < minimum)
+  {
+    std::string errorMessage = fmt::format("Invalid value '{}'. Expected an integer of at least {}.", argument.value, minimum);
+    return nx::core::MakeErrorResult<int64>(errorCode, errorMessage);
+  }
+  return {value};
+}
+
+Result<> SetCacheSize(const Argument& argument)
+{
+  Result<int64> parseResult = ParseIntegerArgument(argument, 1, k_InvalidCacheSizeError);
+  if(parseResult.invalid())
+  {
+    return ConvertResult(std::move(parseResult));
+  }
+  resultCacheSizeMiB = static_cast<uint64>(parseResult.value());
+  return {};
+}
+
+Result<> SetThreadingOption(const Argument& argument)
+{
+  if(argument.type == ArgumentType::FirstTouch)
+  {
+    threadingOptions.firstTouch = true;
+    return {};
+  }
+
+  const int64 minimum = argument.type == ArgumentType::NumaNode ? ExecutionContext::k_AnyNumaNode : 0;
+  Result<int64> parseResult = ParseIntegerArgument(argument, minimum, k_InvalidThreadingValueError);
+  if(parseResult.invalid())
+  {
+    return ConvertResult(std::move(parseResult));
+  }
+  const int64 value = parseResult.value();
+  switch(argument.type)
+  {
+  case ArgumentType::MaxThreads: {
+    threadingOptions.maxThreads = static_cast<usize>(value);
+    break;
+  }
+  case ArgumentType::GrainSize: {
+    threadingOptions.grainSize = static_cast<usize>(value);
+    break;
+  }
+  case ArgumentType::NumaNode: {
+    threadingOptions.numaNode = static_cast<int32>(value);
+    break;
+  }
+  default: {
+    break;
+  }
+  }
+  return {};
+}
+
+/**
+ * @brief Applies the threading values from the command line on top of the default context that was created from the preferences.
+ */
+void ApplyThreadingOptions()
+{
+  ExecutionContext executionContext = ExecutionContext::Current();
+  if(threadingOptions.maxThreads.has_value())
+  {
+    executionContext.setMaxConcurrency(*threadingOptions.maxThreads);
+  }
+  if(threadingOptions.grainSize.has_value())
+  {
+    executionContext.setGrainSize(*threadingOptions.grainSize);
+  }
+  if(threadingOptions.numaNode.has_value())
+  {
+    executionContext.setNumaNode(*threadingOptions.numaNode);
+  }
+  if(threadingOptions.firstTouch)
+  {
+    executionContext.setFirstTouchAllocation(true);
+  }
+  ExecutionContext::SetDefault(executionContext);
+}
+
+Result<> SetBatchOption(const Argument& argument)
+{
+  switch(argument.type)
+  {
+  case ArgumentType::Manifest: {
+    batchOptions.manifestPath = argument.value;
+    return {};
+  }
+  case ArgumentType::Summary: {
+    batchOptions.summaryPath = argument.value;
+    return {};
+  }
+  default: {
+    break;
+  }
+  }
+
+  Result<int64> parseResult = ParseIntegerArgument(argument, 0, k_InvalidBatchValueError);
+  if(parseResult.invalid())
+  {
+    return ConvertResult(std::move(parseResult));
+  }
+  if(argument.type == ArgumentType::Jobs)
+  {
+    batchOptions.maxJobs = static_cast<usize>(parseResult.value());
+  }
+  else
+  {
+    batchOptions.memoryBudgetMiB = static_cast<uint64>(parseResult.value());
+  }
+  return {};
+}
+
+Result<> ExecuteBatch(const Argument& arg)
+{
+  const std::string& pipelinePath = arg.value;
+  if(batchOptions.manifestPath.empty())
+  {
+    std::string errorMessage = fmt::format("Batch mode requires a manifest file. Use {}|{} <manifest filepath>.", k_ManifestParamLong, k_ManifestParamShort);
+    return nx::core::MakeErrorResult(k_MissingManifestError, errorMessage);
+  }
+
+  cliOut << fmt::format("Executing pipeline '{}' for every job in '{}'", pipelinePath, batchOptions.manifestPath);
+  cliOut.endline();
+  Result<PipelineBatch> batchResult = PipelineBatch::FromFiles(pipelinePath, batchOptions.manifestPath);
+  if(batchResult.invalid())
+  {
+    return ConvertResult(std::move(batchResult));
+  }
+  PipelineBatch& batch = batchResult.value();
+  batch.setMaxConcurrentJobs(batchOptions.maxJobs);
+  // Without a budget the jobs share the physical memory of the machine
+  const uint64 memoryBudget = batchOptions.memoryBudgetMiB.has_value() ? *batchOptions.memoryBudgetMiB * 1024 * 1024 : Memory::GetTotalMemory();
+  batch.setMemoryBudget(memoryBudget);
+
+  const usize numJobs = batch.getJobs().size();
+  usize finishedJobs = 0;
+  const auto startTime = std::chrono::steady_clock::now();
+#if SIMPLNX_EMBED_PYTHON
+  // Python filters running on the job threads need to acquire the GIL themselves
+  py::gil_scoped_release releaseGil;
+#endif
+  std::vector<PipelineBatch::JobReport> reports = batch.execute(false, [&finishedJobs, numJobs](const PipelineBatch::JobReport& report) {
+    finishedJobs++;
+    const float64 seconds = std::chrono::duration<float64>(report.preflightTime + report.executeTime).count();
+    cliOut << fmt::format("{} [{}/{}] {} {} ({:.2f} s)", timestamp(), finishedJobs, numJobs, report.result.valid() ? "Finished" : "Failed", report.name, seconds);
+    cliOut.endline();
+    if(report.result.invalid())
+    {
+      for(const auto& error : report.result.errors())
+      {
+        cliOut << fmt::format("    Error {}: {}", error.code, error.message);
+        cliOut.endline();
+      }
+    }
+  });
+  const float64 totalSeconds = std::chrono::duration<float64>(std::chrono::steady_clock::now() - startTime).count();
+
+  nlohmann::json summary = PipelineBatch::CreateSummary(reports);
+  summary["pipeline"] = pipelinePath;
+  summary["total_seconds"] = totalSeconds;
+  const usize failedJobs = summary["failed_jobs"].get<usize>();
+  cliOut << fmt::format("Finished {} jobs in {:.2f} s. {} failed.", numJobs, totalSeconds, failedJobs);
+  cliOut.endline();
+
+  if(!batchOptions.summaryPath.empty())
+  {
+    std::ofstream summaryFile(batchOptions.summaryPath, std::ios_base::out | std::ios_base::trunc);
+    summaryFile << summary.dump(2);
+    if(!summaryFile.good())
+    {
+      std::string errorMessage = fmt::format("Failed to write the batch summary to '{}'", batchOptions.summaryPath);
+      return nx::core::MakeErrorResult(k_SummaryFileError, errorMessage);
+    }
+    cliOut << fmt::format("Batch summary written to '{}'", batchOptions.summaryPath);
+    cliOut.endline();
+  }
+
+  if(failedJobs != 0)
+  {
+    std::string errorMessage = fmt::format("{} of {} batch jobs failed", failedJobs, numJobs);
+    return nx::core::MakeErrorResult(k_BatchJobsFailedError, errorMessage);
+  }
+  return {};
+}
 } // namespace
 
 int main(int argc, char* argv[])
@@ -575,6 +992,43 @@ int main(int argc, char* argv[])
       results.push_back(SetLogFile(argument));
       break;
     }
+    case ArgumentType::Cache: {
+      results.push_back(SetCacheDirectory(argument));
+      break;
+    }
+    case ArgumentType::CacheSize: {
+      results.push_back(SetCacheSize(argument));
+      break;
+    }
+    case ArgumentType::MaxThreads: {
+      [[fallthrough]];
+    }
+    case ArgumentType::GrainSize: {
+      [[fallthrough]];
+    }
+    case ArgumentType::NumaNode: {
+      [[fallthrough]];
+    }
+    case ArgumentType::FirstTouch: {
+      results.push_back(SetThreadingOption(argument));
+      break;
+    }
+    case ArgumentType::Manifest: {
+      [[fallthrough]];
+    }
+    case ArgumentType::Jobs: {
+      [[fallthrough]];
+    }
+    case ArgumentType::MemoryBudget: {
+      [[fallthrough]];
+    }
+    case ArgumentType::Summary: {
+      results.push_back(SetBatchOption(argument));
+      break;
+    }
+    case ArgumentType::Batch: {
+      [[fallthrough]];
+    }
     case ArgumentType::Convert: {
       [[fallthrough]];
     }
@@ -596,6 +1050,7 @@ int main(int argc, char* argv[])
   // Load the Simplnx Application instance and load the plugins
   auto app = nx::core::Application::GetOrCreateInstance();
   LoadApp();
+  ApplyThreadingOptions();
 
 #if SIMPLNX_EMBED_PYTHON
   nx::python::OutputCallback outputCallback = [](const std::string& message) { std::cout << message << "\n"; };
@@ -674,6 +1129,27 @@ int main(int argc, char* argv[])
       fmt::print("Python exception: {}\n", exception.what());
       return 1;
     }
+#endif
+    catch(const std::exception& exception)
+    {
+      fmt::print("Exception: {}\n", exception.what());
+      return 1;
+    }
+    break;
+  }
+  case ArgumentType::Batch: {
+    try
+    {
+      cliOut << "###### BATCH MODE ########\n";
+      auto result = ExecuteBatch(arguments[0]);
+      results.push_back(result);
+    }
+#if SIMPLNX_EMBED_PYTHON
+    catch(const py::error_already_set& exception)
+    {
+      fmt::print("Python exception: {}\n", exception.what());
+      return 1;
+    }
 #endif
     catch(const std::exception& exception)
     {
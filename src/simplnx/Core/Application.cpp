@@ -3,6 +3,7 @@
 #include "simplnx/Filter/FilterList.hpp"
 #include "simplnx/Plugin/AbstractPlugin.hpp"
 #include "simplnx/Plugin/PluginLoader.hpp"
+#include "simplnx/Utilities/ExecutionContext.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 
 #include <fmt/core.h>
@@ -170,6 +171,7 @@ void Application::loadPreferences()
   std::string applicationName = getApplicationName(this);
   const auto filepath = Preferences::DefaultFilePath(applicationName);
   m_Preferences->loadFromFile(filepath);
+  ExecutionContext::SetDefault(ExecutionContext::FromPreferences(*m_Preferences));
 }
 void Application::savePreferences()
 {
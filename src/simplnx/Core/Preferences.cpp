@@ -83,6 +83,11 @@ void Preferences::setDefaultValues()
 #else
   m_DefaultValues[k_ForceOocData_Key] = false;
 #endif
+
+  m_DefaultValues[k_MaxThreads_Key] = 0;
+  m_DefaultValues[k_ParallelGrainSize_Key] = 0;
+  m_DefaultValues[k_NumaNode_Key] = -1;
+  m_DefaultValues[k_FirstTouchAllocation_Key] = false;
 }
 
 std::string Preferences::defaultLargeDataFormat() const
@@ -281,4 +286,24 @@ uint64 Preferences::largeDataStructureSize() const
 {
   return value(k_LargeDataStructureSize_Key).get<uint64>();
 }
+
+int64 Preferences::maxThreads() const
+{
+  return valueAs<int64>(k_MaxThreads_Key);
+}
+
+int64 Preferences::parallelGrainSize() const
+{
+  return valueAs<int64>(k_ParallelGrainSize_Key);
+}
+
+int32 Preferences::numaNode() const
+{
+  return valueAs<int32>(k_NumaNode_Key);
+}
+
+bool Preferences::firstTouchAllocation() const
+{
+  return valueAs<bool>(k_FirstTouchAllocation_Key);
+}
 } // namespace nx::core
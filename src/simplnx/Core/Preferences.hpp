@@ -23,6 +23,10 @@ public:
   static inline constexpr StringLiteral k_PreferredLargeDataFormat_Key = "large_data_format";      // string
   static inline constexpr StringLiteral k_LargeDataStructureSize_Key = "large_datastructure_size"; // bytes
   static inline constexpr StringLiteral k_ForceOocData_Key = "force_ooc_data";                     // boolean
+  static inline constexpr StringLiteral k_MaxThreads_Key = "max_threads";                          // integer, 0 uses all threads
+  static inline constexpr StringLiteral k_ParallelGrainSize_Key = "parallel_grain_size";           // integer, 0 lets TBB decide
+  static inline constexpr StringLiteral k_NumaNode_Key = "numa_node";                              // integer, -1 does not pin threads
+  static inline constexpr StringLiteral k_FirstTouchAllocation_Key = "first_touch_allocation";     // boolean
 
   static std::filesystem::path DefaultFilePath(const std::string& applicationName);
 
@@ -88,6 +92,11 @@ public:
   void updateMemoryDefaults();
   uint64 largeDataStructureSize() const;
 
+  int64 maxThreads() const;
+  int64 parallelGrainSize() const;
+  int32 numaNode() const;
+  bool firstTouchAllocation() const;
+
 protected:
   void setDefaultValues();
 
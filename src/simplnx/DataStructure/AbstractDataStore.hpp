@@ -829,6 +829,40 @@ public:
     return {};
   }
 
+  /**
+   * @brief Copies buffer.size() values starting at startIndex into the buffer.
+   * Stores that do not keep their values in memory load only the requested values,
+   * so this can be used to walk a large store in windows.
+   * @param startIndex
+   * @param buffer
+   * @return Result<>
+   */
+  virtual Result<> copyIntoBuffer(usize startIndex, nonstd::span<T> buffer) const
+  {
+    if(startIndex + buffer.size() > getSize())
+    {
+      return MakeErrorResult(-14603, fmt::format("Unable to copy {} values starting at index {} out of the data store. The data store only contains {} values.", buffer.size(), startIndex, getSize()));
+    }
+    std::copy(begin() + startIndex, begin() + (startIndex + buffer.size()), buffer.begin());
+    return {};
+  }
+
+  /**
+   * @brief Copies the values of the buffer into the store starting at startIndex.
+   * @param startIndex
+   * @param buffer
+   * @return Result<>
+   */
+  virtual Result<> copyFromBuffer(usize startIndex, nonstd::span<const T> buffer)
+  {
+    if(startIndex + buffer.size() > getSize())
+    {
+      return MakeErrorResult(-14604, fmt::format("Unable to copy {} values into the data store starting at index {}. The data store only contains {} values.", buffer.size(), startIndex, getSize()));
+    }
+    std::copy(buffer.begin(), buffer.end(), begin() + startIndex);
+    return {};
+  }
+
   /**
    * @brief Sets all the components of tuple i to value.
    * @param i
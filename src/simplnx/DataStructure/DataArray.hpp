@@ -693,6 +693,20 @@ public:
     return m_DataStore->memoryUsage();
   }
 
+  /**
+   * @brief Replaces an in-memory DataStore that may be shared with other
+   * DataArrays by a copy-on-write copy. Other store types are left untouched.
+   */
+  void detachDataStore() override
+  {
+    if(m_DataStore == nullptr || m_DataStore->getStoreType() != IDataStore::StoreType::InMemory)
+    {
+      return;
+    }
+    std::shared_ptr<IDataStore> storeCopy = m_DataStore->deepCopy();
+    m_DataStore = std::dynamic_pointer_cast<store_type>(storeCopy);
+  }
+
 protected:
   /**
    * @brief Constructs a DataArray with the specified name and DataStore.
@@ -3,6 +3,7 @@
 #include "simplnx/Common/Types.hpp"
 #include "simplnx/simplnx_export.hpp"
 
+#include <functional>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -189,3 +190,26 @@ private:
   std::vector<std::string> m_Path;
 };
 } // namespace nx::core
+
+namespace std
+{
+template <>
+struct hash<::nx::core::DataPath>
+{
+  /**
+   * @brief Hash operator for placing in a collection that requires hashing values.
+   * @param value
+   * @return std::size_t
+   */
+  std::size_t operator()(const ::nx::core::DataPath& value) const noexcept
+  {
+    std::hash<std::string> hasher;
+    std::size_t seed = value.getLength();
+    for(::nx::core::usize index = 0; index < value.getLength(); index++)
+    {
+      seed ^= hasher(value[index]) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+  }
+};
+} // namespace std
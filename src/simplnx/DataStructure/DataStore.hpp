@@ -1,15 +1,18 @@
 #pragma once
 
 #include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/Utilities/ExecutionContext.hpp"
 
 #include <fmt/core.h>
 #include <nonstd/span.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <optional>
 #include <stdexcept>
@@ -21,6 +24,30 @@ namespace nx::core
  * @class DataStore
  * @brief The DataStore class handles the storing and retrieval of data for
  * use in DataArrays.
+ *
+ * Copies of a DataStore share their values until they are written to
+ * (copy-on-write). Sharing is tracked per page of k_CopyOnWritePageBytes. The
+ * copied DataStore keeps reading and writing its own buffer, so pointers
+ * retrieved from it stay valid, and its copies read the pages of that buffer.
+ * Before the copied DataStore writes to a page that copies still read, the
+ * page is preserved for them. A copy copies a page to a buffer of its own
+ * when it writes to it. The non-const operator[] may be used to write, so it
+ * counts as a write. data() and createSpan() need contiguous values, so a copy
+ * takes all remaining pages when they are called. Writing through a pointer
+ * or span from the non-const data() or createSpan() after the store was
+ * copied again also changes that copy, use pinBuffer() for pointers that
+ * outlive copies.
+ *
+ * Values of a DataStore may be read from several threads while other threads
+ * write and copy its pages. Buffers that a store stops reading from are kept
+ * alive until the store is copied, resized or destroyed, so a concurrent
+ * reader never sees a released buffer. A copy must not be read while the
+ * DataStore it was copied from is written by another thread.
+ *
+ * A pinned store never shares its buffer, because memory outside of the
+ * DataStore, e.g. a NumPy array, reads and writes the buffer directly. Copies
+ * of a pinned store copy its values immediately and the pinned store keeps
+ * writing to the same buffer.
  * @tparam T
  */
 template <typename T>
@@ -37,6 +64,9 @@ public:
   static constexpr const char k_DataObjectId[] = "DataObjectId";
   static constexpr const char k_DataArrayTypeName[] = "DataArray";
 
+  static constexpr usize k_CopyOnWritePageBytes = 65536;
+  static constexpr usize k_CopyOnWritePageSize = std::max<usize>(k_CopyOnWritePageBytes / sizeof(T), 1);
+
   /**
    * @brief Creates a new DataStore with a single tuple dimensions of 'numTuples' and
    * a single component dimension of {1}
@@ -65,7 +95,10 @@ public:
     resizeTuples(m_TupleShape);
     if(m_InitValue.has_value())
     {
-      std::fill_n(data(), this->getSize(), *m_InitValue);
+      // The first write places the memory pages, so large buffers are filled by the threads of the current context
+      T* buffer = data();
+      const T fillValue = *m_InitValue;
+      ExecutionContext::Current().initializeBuffer(this->getSize(), [buffer, fillValue](usize begin, usize end) { std::fill(buffer + begin, buffer + end, fillValue); });
     }
   }
 
@@ -82,11 +115,39 @@ public:
   , m_Data(std::move(buffer))
   , m_NumComponents(std::accumulate(m_ComponentShape.cbegin(), m_ComponentShape.cend(), static_cast<size_t>(1), std::multiplies<>()))
   , m_NumTuples(std::accumulate(m_TupleShape.cbegin(), m_TupleShape.cend(), static_cast<size_t>(1), std::multiplies<>()))
+  , m_OwnValues(m_Data.get())
+  , m_Values(m_Data.get())
+  , m_WritableValues(m_Data.get())
   {
     // Because no init value is passed into the constructor, we will use a "mudflap" style value that is easy to debug.
     m_InitValue = GetMudflap<T>();
   }
 
+  /**
+   * @brief Constructs a pinned DataStore that uses an existing buffer without
+   * copying it. The buffer is released through its deleter once this DataStore
+   * is destroyed, so the deleter can keep the owner of foreign memory alive,
+   * e.g. a NumPy array. This DataStore always reads and writes the adopted
+   * buffer, copies of it get their own copy of the values.
+   * @param buffer
+   * @param tupleShape
+   * @param componentShape
+   */
+  DataStore(std::shared_ptr<value_type[]> buffer, ShapeType tupleShape, ShapeType componentShape)
+  : parent_type()
+  , m_ComponentShape(std::move(componentShape))
+  , m_TupleShape(std::move(tupleShape))
+  , m_Data(std::move(buffer))
+  , m_NumComponents(std::accumulate(m_ComponentShape.cbegin(), m_ComponentShape.cend(), static_cast<size_t>(1), std::multiplies<>()))
+  , m_NumTuples(std::accumulate(m_TupleShape.cbegin(), m_TupleShape.cend(), static_cast<size_t>(1), std::multiplies<>()))
+  , m_OwnValues(m_Data.get())
+  , m_Values(m_Data.get())
+  , m_WritableValues(m_Data.get())
+  , m_Pinned(true)
+  {
+    m_InitValue = GetMudflap<T>();
+  }
+
   /**
    * @brief Copy constructor
    * @param other
@@ -99,10 +160,21 @@ public:
   , m_NumTuples(other.m_NumTuples)
   , m_InitValue(other.m_InitValue)
   {
-    const usize count = other.getSize();
-    auto* data = new value_type[count];
-    std::memcpy(data, other.m_Data.get(), count * sizeof(T));
-    m_Data.reset(data);
+    const usize size = this->getSize();
+    const bool hasValues = other.m_Data != nullptr || other.m_CopyOnWrite != nullptr;
+    if(!other.isPinned() && hasValues && size != 0)
+    {
+      other.shareValuesWith(*this);
+      return;
+    }
+    auto values = new value_type[size];
+    const value_type* otherValues = other.m_Values.load(std::memory_order_acquire);
+    if(otherValues != nullptr)
+    {
+      std::copy(otherValues, otherValues + size, values);
+    }
+    m_Data.reset(values);
+    setOwnValues(values);
   }
 
   /**
@@ -117,6 +189,11 @@ public:
   , m_NumComponents(std::move(other.m_NumComponents))
   , m_NumTuples(std::move(other.m_NumTuples))
   , m_InitValue(other.m_InitValue)
+  , m_OwnValues(other.m_OwnValues.exchange(nullptr, std::memory_order_acq_rel))
+  , m_Values(other.m_Values.exchange(nullptr, std::memory_order_acq_rel))
+  , m_WritableValues(other.m_WritableValues.exchange(nullptr, std::memory_order_acq_rel))
+  , m_CopyOnWrite(std::move(other.m_CopyOnWrite))
+  , m_Pinned(other.m_Pinned.load(std::memory_order_acquire))
   {
   }
 
@@ -132,7 +209,21 @@ public:
    * @param rhs
    * @return
    */
-  DataStore& operator=(DataStore&& rhs) = default;
+  DataStore& operator=(DataStore&& rhs) noexcept
+  {
+    m_ComponentShape = std::move(rhs.m_ComponentShape);
+    m_TupleShape = std::move(rhs.m_TupleShape);
+    m_Data = std::move(rhs.m_Data);
+    m_NumComponents = rhs.m_NumComponents;
+    m_NumTuples = rhs.m_NumTuples;
+    m_InitValue = rhs.m_InitValue;
+    m_OwnValues.store(rhs.m_OwnValues.exchange(nullptr, std::memory_order_acq_rel), std::memory_order_release);
+    m_Values.store(rhs.m_Values.exchange(nullptr, std::memory_order_acq_rel), std::memory_order_release);
+    m_WritableValues.store(rhs.m_WritableValues.exchange(nullptr, std::memory_order_acq_rel), std::memory_order_release);
+    m_CopyOnWrite = std::move(rhs.m_CopyOnWrite);
+    m_Pinned.store(rhs.m_Pinned.load(std::memory_order_acquire), std::memory_order_release);
+    return *this;
+  }
 
   ~DataStore() override = default;
 
@@ -146,21 +237,35 @@ public:
   }
 
   /**
-   * @brief Returns the pointer to the allocated data. Const version
+   * @brief Returns the pointer to the allocated data. Const version. A copy
+   * takes the pages it still reads from other DataStores first, so the values
+   * are contiguous. Returns nullptr if the DataStore was moved from.
    * @return
    */
   const T* data() const
   {
-    return m_Data.get();
+    const value_type* values = m_Values.load(std::memory_order_acquire);
+    if(values != nullptr || m_CopyOnWrite == nullptr)
+    {
+      return values;
+    }
+    return takePages(0, m_CopyOnWrite->numPages, false);
   }
 
   /**
-   * @brief Returns the pointer to the allocated data. Non-const version
+   * @brief Returns the pointer to the allocated data. Non-const version. All
+   * pages that are still read from or by other DataStores are copied first.
+   * Returns nullptr if the DataStore was moved from.
    * @return
    */
   T* data()
   {
-    return m_Data.get();
+    value_type* values = m_WritableValues.load(std::memory_order_acquire);
+    if(values != nullptr || m_CopyOnWrite == nullptr)
+    {
+      return values;
+    }
+    return takePages(0, m_CopyOnWrite->numPages, true);
   }
 
   /**
@@ -227,10 +332,11 @@ public:
 
     usize newSize = getNumberOfComponents() * m_NumTuples;
 
-    if(m_Data.get() == nullptr) // Data was never allocated
+    if(m_Data.get() == nullptr && m_CopyOnWrite == nullptr) // Data was never allocated
     {
       auto data = new value_type[newSize];
       m_Data.reset(data);
+      setOwnValues(data);
       return;
     }
 
@@ -247,7 +353,7 @@ public:
     auto data = new value_type[newSize];
     for(usize i = 0; i < newSize && i < oldSize; i++)
     {
-      data[i] = m_Data.get()[i];
+      data[i] = readableValues(i)[i];
     }
 
     // If we are sizing to a larger number of tuples, initialize the leftover array with the init
@@ -258,7 +364,12 @@ public:
       data[i] = initValue;
     }
 
+    // Copies keep the previous buffer alive and it is not written anymore
     m_Data.reset(data);
+    setOwnValues(data);
+    m_CopyOnWrite.reset();
+    // Nothing outside of this store knows the new buffer
+    m_Pinned.store(false, std::memory_order_release);
   }
 
   /**
@@ -269,7 +380,7 @@ public:
    */
   value_type getValue(usize index) const override
   {
-    return m_Data.get()[index];
+    return readableValues(index)[index];
   }
 
   /**
@@ -279,7 +390,7 @@ public:
    */
   void setValue(usize index, value_type value) override
   {
-    m_Data.get()[index] = value;
+    writableValues(index)[index] = value;
   }
 
   /**
@@ -290,18 +401,19 @@ public:
    */
   const_reference operator[](usize index) const override
   {
-    return m_Data.get()[index];
+    return readableValues(index)[index];
   }
 
   /**
    * @brief Returns the value found at the specified index of the DataStore.
-   * This can be used to edit the value found at the specified index.
+   * This can be used to edit the value found at the specified index, so the
+   * page holding it is copied if it is shared. Use the const version to read.
    * @param  index
    * @return reference
    */
   reference operator[](usize index) override
   {
-    return m_Data.get()[index];
+    return writableValues(index)[index];
   }
 
   /**
@@ -316,11 +428,12 @@ public:
     {
       throw std::runtime_error("");
     }
-    return m_Data.get()[index];
+    return readableValues(index)[index];
   }
 
   /**
-   * @brief Returns a deep copy of the data store and all its data.
+   * @brief Returns a deep copy of the data store and all its data. The values
+   * are shared until either store is written to.
    * @return std::unique_ptr<IDataStore>
    */
   std::unique_ptr<IDataStore> deepCopy() const override
@@ -337,6 +450,41 @@ public:
     return std::make_unique<DataStore<T>>(this->getTupleShape(), this->getComponentShape(), static_cast<T>(0));
   }
 
+  Result<> copyIntoBuffer(usize startIndex, nonstd::span<T> buffer) const override
+  {
+    if(startIndex + buffer.size() > this->getSize())
+    {
+      return parent_type::copyIntoBuffer(startIndex, buffer);
+    }
+    const usize endIndex = startIndex + buffer.size();
+    for(usize index = startIndex; index < endIndex;)
+    {
+      // Every page may come from a different buffer while the values are shared
+      const usize pageEnd = std::min((index / k_CopyOnWritePageSize + 1) * k_CopyOnWritePageSize, endIndex);
+      const value_type* values = readableValues(index);
+      std::copy(values + index, values + pageEnd, buffer.data() + (index - startIndex));
+      index = pageEnd;
+    }
+    return {};
+  }
+
+  Result<> copyFromBuffer(usize startIndex, nonstd::span<const T> buffer) override
+  {
+    if(startIndex + buffer.size() > this->getSize())
+    {
+      return parent_type::copyFromBuffer(startIndex, buffer);
+    }
+    const usize endIndex = startIndex + buffer.size();
+    for(usize index = startIndex; index < endIndex;)
+    {
+      const usize pageEnd = std::min((index / k_CopyOnWritePageSize + 1) * k_CopyOnWritePageSize, endIndex);
+      value_type* values = writableValues(index);
+      std::copy(buffer.data() + (index - startIndex), buffer.data() + (pageEnd - startIndex), values + index);
+      index = pageEnd;
+    }
+    return {};
+  }
+
   nonstd::span<T> createSpan()
   {
     return {data(), this->getSize()};
@@ -362,7 +510,7 @@ public:
   {
     usize totalElements = getNumberOfComponents() * getNumberOfTuples();
 
-    outputStream.write(reinterpret_cast<char*>(m_Data.get()), sizeof(T) * totalElements);
+    outputStream.write(reinterpret_cast<const char*>(data()), sizeof(T) * totalElements);
 
     if(outputStream.bad())
     {
@@ -372,13 +520,380 @@ public:
     return {0, ""};
   }
 
+  /**
+   * @brief Returns true if some of the values are still read from the buffer of
+   * another DataStore or if copies still read values from the buffer of this one.
+   * @return bool
+   */
+  bool isShared() const
+  {
+    return m_CopyOnWrite != nullptr && m_WritableValues.load(std::memory_order_acquire) == nullptr;
+  }
+
+  /**
+   * @brief Gives this store a buffer of its own and pins it, so the buffer stays
+   * the one this store reads and writes until it is resized. Call this before
+   * exposing data() to memory that outlives the call, e.g. a NumPy view.
+   * Copies made afterwards copy the values instead of sharing them.
+   * @return T*
+   */
+  T* pinBuffer()
+  {
+    T* values = data();
+    m_Pinned.store(true, std::memory_order_release);
+    return values;
+  }
+
+  /**
+   * @brief Returns true if the buffer is pinned, either because it was adopted
+   * or because pinBuffer() was called.
+   * @return bool
+   */
+  bool isPinned() const
+  {
+    return m_Pinned.load(std::memory_order_acquire);
+  }
+
 private:
+  /**
+   * @brief The pages of the buffer of a DataStore as one generation of its copies
+   * reads them. A page points into the buffer until the DataStore writes to it.
+   * The page is then preserved, i.e. copied to the preserved buffer, first.
+   */
+  struct SharedPages
+  {
+    std::shared_ptr<value_type[]> buffer;
+    std::unique_ptr<std::atomic<const value_type*>[]> pages;
+    std::unique_ptr<value_type[]> preserved;
+  };
+
+  /**
+   * @brief The copy-on-write state of a DataStore: the pages it still reads from
+   * the DataStores it was copied from and the pages of its own buffer that its
+   * copies still read.
+   */
+  struct CopyOnWritePages
+  {
+    usize numPages = 0;
+    // Set while the page is read from another DataStore
+    std::unique_ptr<std::atomic<const SharedPages*>[]> readFrom;
+    std::vector<std::shared_ptr<SharedPages>> sources;
+    usize numSourcePages = 0;
+    // Set while copies may read the page from m_Data
+    std::unique_ptr<std::atomic<bool>[]> readByCopies;
+    std::vector<std::weak_ptr<SharedPages>> copies;
+    usize numPagesReadByCopies = 0;
+    // Copies reuse the shared pages of the previous copy if no page was taken or preserved since
+    usize numChanges = 0;
+    usize numChangesAtLastCopy = 0;
+    std::mutex mutex;
+  };
+
+  usize getNumberOfPages() const
+  {
+    return (this->getSize() + k_CopyOnWritePageSize - 1) / k_CopyOnWritePageSize;
+  }
+
+  /**
+   * @brief Sets the buffer that this DataStore reads and writes directly.
+   * @param values
+   */
+  void setOwnValues(value_type* values)
+  {
+    m_OwnValues.store(values, std::memory_order_release);
+    m_Values.store(values, std::memory_order_release);
+    m_WritableValues.store(values, std::memory_order_release);
+  }
+
+  /**
+   * @brief Returns the buffer holding the current value at 'index'. Returns nullptr
+   * if the DataStore was moved from.
+   * @param index
+   * @return const value_type*
+   */
+  const value_type* readableValues(usize index) const
+  {
+    const value_type* values = m_Values.load(std::memory_order_acquire);
+    if(values != nullptr || m_CopyOnWrite == nullptr)
+    {
+      return values;
+    }
+    const usize page = index / k_CopyOnWritePageSize;
+    const SharedPages* sharedPages = m_CopyOnWrite->readFrom[page].load(std::memory_order_acquire);
+    if(sharedPages != nullptr)
+    {
+      return sharedPages->pages[page].load(std::memory_order_acquire);
+    }
+    return m_OwnValues.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Returns the buffer that the value at 'index' is written to. A page read
+   * from another DataStore is copied first and a page read by copies is preserved
+   * for them first. Returns nullptr if the DataStore was moved from.
+   * @param index
+   * @return value_type*
+   */
+  value_type* writableValues(usize index)
+  {
+    value_type* values = m_WritableValues.load(std::memory_order_acquire);
+    if(values != nullptr || m_CopyOnWrite == nullptr)
+    {
+      return values;
+    }
+    const usize page = index / k_CopyOnWritePageSize;
+    if(m_CopyOnWrite->readFrom[page].load(std::memory_order_acquire) == nullptr && !m_CopyOnWrite->readByCopies[page].load(std::memory_order_acquire))
+    {
+      return m_OwnValues.load(std::memory_order_acquire);
+    }
+    return takePages(page, page + 1, true);
+  }
+
+  /**
+   * @brief Copies the pages in [firstPage, endPage) that are still read from other
+   * DataStores to the buffer of this DataStore and, if 'preserve' is set, preserves
+   * the pages that copies still read before they are written. Returns the buffer of
+   * this DataStore, which it reads directly again once it holds every page.
+   * @param firstPage
+   * @param endPage
+   * @param preserve
+   * @return value_type*
+   */
+  value_type* takePages(usize firstPage, usize endPage, bool preserve) const
+  {
+    CopyOnWritePages& copyOnWrite = *m_CopyOnWrite;
+    std::lock_guard<std::mutex> lock(copyOnWrite.mutex);
+    const usize size = this->getSize();
+
+    if(copyOnWrite.numSourcePages != 0 && m_Data == nullptr)
+    {
+      adoptOrAllocateBuffer();
+    }
+    value_type* values = m_Data.get();
+    for(usize page = firstPage; page < endPage && copyOnWrite.numSourcePages != 0; page++)
+    {
+      const SharedPages* sharedPages = copyOnWrite.readFrom[page].load(std::memory_order_relaxed);
+      if(sharedPages == nullptr)
+      {
+        continue;
+      }
+      const usize begin = page * k_CopyOnWritePageSize;
+      const usize end = std::min(begin + k_CopyOnWritePageSize, size);
+      const value_type* source = sharedPages->pages[page].load(std::memory_order_acquire);
+      std::copy(source + begin, source + end, values + begin);
+      copyOnWrite.readFrom[page].store(nullptr, std::memory_order_release);
+      copyOnWrite.numSourcePages--;
+      copyOnWrite.numChanges++;
+    }
+
+    if(preserve && copyOnWrite.numPagesReadByCopies != 0)
+    {
+      std::erase_if(copyOnWrite.copies, [](const std::weak_ptr<SharedPages>& copy) { return copy.expired(); });
+      const bool hasCopies = !copyOnWrite.copies.empty();
+      // Once all copies are gone, no page needs to be preserved anymore
+      const usize firstPreservedPage = hasCopies ? firstPage : 0;
+      const usize endPreservedPage = hasCopies ? endPage : copyOnWrite.numPages;
+      for(usize page = firstPreservedPage; page < endPreservedPage; page++)
+      {
+        if(!copyOnWrite.readByCopies[page].load(std::memory_order_relaxed))
+        {
+          continue;
+        }
+        if(hasCopies)
+        {
+          preservePage(page);
+        }
+        copyOnWrite.readByCopies[page].store(false, std::memory_order_release);
+        copyOnWrite.numPagesReadByCopies--;
+        copyOnWrite.numChanges++;
+      }
+    }
+
+    if(copyOnWrite.numSourcePages == 0)
+    {
+      // The sources stay referenced until the next copy, resize or destruction for concurrent readers
+      m_Values.store(values, std::memory_order_release);
+      if(copyOnWrite.numPagesReadByCopies == 0)
+      {
+        copyOnWrite.copies.clear();
+        m_WritableValues.store(values, std::memory_order_release);
+      }
+    }
+    return values;
+  }
+
+  /**
+   * @brief Gives a DataStore that does not hold any page yet its own buffer. If all
+   * pages are read from one buffer that nobody else reads or writes anymore, that
+   * buffer is reused instead of copied. Called with the mutex of m_CopyOnWrite held.
+   */
+  void adoptOrAllocateBuffer() const
+  {
+    CopyOnWritePages& copyOnWrite = *m_CopyOnWrite;
+    const usize size = this->getSize();
+    if(copyOnWrite.sources.size() == 1 && copyOnWrite.sources.front().use_count() == 1 && copyOnWrite.sources.front()->buffer.use_count() == 1)
+    {
+      SharedPages& sharedPages = *copyOnWrite.sources.front();
+      value_type* buffer = sharedPages.buffer.get();
+      // Preserved pages hold the values of this store, the buffer was written after they were preserved
+      for(usize page = 0; page < copyOnWrite.numPages; page++)
+      {
+        const value_type* source = sharedPages.pages[page].load(std::memory_order_relaxed);
+        if(source != buffer)
+        {
+          const usize begin = page * k_CopyOnWritePageSize;
+          const usize end = std::min(begin + k_CopyOnWritePageSize, size);
+          std::copy(source + begin, source + end, buffer + begin);
+        }
+      }
+      m_Data = sharedPages.buffer;
+      m_OwnValues.store(buffer, std::memory_order_release);
+      for(usize page = 0; page < copyOnWrite.numPages; page++)
+      {
+        copyOnWrite.readFrom[page].store(nullptr, std::memory_order_release);
+      }
+      copyOnWrite.numSourcePages = 0;
+      copyOnWrite.numChanges++;
+      return;
+    }
+    // The pages of the new buffer are only backed by memory once they are copied
+    m_Data.reset(new value_type[size]);
+    m_OwnValues.store(m_Data.get(), std::memory_order_release);
+  }
+
+  /**
+   * @brief Copies 'page' of m_Data to the preserved buffer of every generation of
+   * copies that still reads it from m_Data. Called with the mutex of m_CopyOnWrite held.
+   * @param page
+   */
+  void preservePage(usize page) const
+  {
+    const value_type* values = m_Data.get();
+    const usize size = this->getSize();
+    const usize begin = page * k_CopyOnWritePageSize;
+    const usize end = std::min(begin + k_CopyOnWritePageSize, size);
+    for(const auto& copy : m_CopyOnWrite->copies)
+    {
+      std::shared_ptr<SharedPages> sharedPages = copy.lock();
+      if(sharedPages == nullptr || sharedPages->pages[page].load(std::memory_order_relaxed) != values)
+      {
+        continue;
+      }
+      if(sharedPages->preserved == nullptr)
+      {
+        sharedPages->preserved.reset(new value_type[size]);
+      }
+      std::copy(values + begin, values + end, sharedPages->preserved.get() + begin);
+      sharedPages->pages[page].store(sharedPages->preserved.get(), std::memory_order_release);
+    }
+  }
+
+  /**
+   * @brief Makes 'copy' read the current values of this DataStore. Pages this
+   * DataStore holds are read from its buffer, the other pages from the same
+   * DataStores this one reads them from. Called from the copy constructor. The
+   * DataStore must not be used by other threads while it is copied.
+   * @param copy
+   */
+  void shareValuesWith(DataStore& copy) const
+  {
+    const usize numPages = getNumberOfPages();
+    if(m_CopyOnWrite == nullptr)
+    {
+      m_CopyOnWrite = CreatePages(numPages);
+    }
+    CopyOnWritePages& copyOnWrite = *m_CopyOnWrite;
+    std::erase_if(copyOnWrite.copies, [](const std::weak_ptr<SharedPages>& previousCopy) { return previousCopy.expired(); });
+
+    std::shared_ptr<SharedPages> ownPages;
+    if(!copyOnWrite.copies.empty() && copyOnWrite.numChanges == copyOnWrite.numChangesAtLastCopy)
+    {
+      ownPages = copyOnWrite.copies.back().lock();
+    }
+    if(ownPages == nullptr && copyOnWrite.numSourcePages != numPages)
+    {
+      ownPages = std::make_shared<SharedPages>();
+      ownPages->buffer = m_Data;
+      ownPages->pages = std::make_unique<std::atomic<const value_type*>[]>(numPages);
+      for(usize page = 0; page < numPages; page++)
+      {
+        const bool isOwnPage = copyOnWrite.readFrom[page].load(std::memory_order_relaxed) == nullptr;
+        ownPages->pages[page].store(isOwnPage ? m_Data.get() : nullptr, std::memory_order_relaxed);
+        if(isOwnPage && !copyOnWrite.readByCopies[page].load(std::memory_order_relaxed))
+        {
+          copyOnWrite.readByCopies[page].store(true, std::memory_order_relaxed);
+          copyOnWrite.numPagesReadByCopies++;
+        }
+      }
+      copyOnWrite.copies.push_back(ownPages);
+      copyOnWrite.numChangesAtLastCopy = copyOnWrite.numChanges;
+    }
+
+    std::unique_ptr<CopyOnWritePages> copyPages = CreatePages(numPages);
+    for(usize page = 0; page < numPages; page++)
+    {
+      const SharedPages* sharedPages = copyOnWrite.readFrom[page].load(std::memory_order_relaxed);
+      copyPages->readFrom[page].store(sharedPages != nullptr ? sharedPages : ownPages.get(), std::memory_order_relaxed);
+    }
+    copyPages->numSourcePages = numPages;
+
+    // Sources that no page is read from anymore are released here
+    std::vector<std::shared_ptr<SharedPages>> sources;
+    for(auto& source : copyOnWrite.sources)
+    {
+      bool isRead = false;
+      for(usize page = 0; page < numPages && !isRead; page++)
+      {
+        isRead = copyOnWrite.readFrom[page].load(std::memory_order_relaxed) == source.get();
+      }
+      if(isRead)
+      {
+        sources.push_back(std::move(source));
+      }
+    }
+    copyOnWrite.sources = sources;
+    if(ownPages != nullptr)
+    {
+      sources.push_back(std::move(ownPages));
+    }
+    copyPages->sources = std::move(sources);
+
+    if(copyOnWrite.numPagesReadByCopies != 0)
+    {
+      m_WritableValues.store(nullptr, std::memory_order_release);
+    }
+    copy.m_CopyOnWrite = std::move(copyPages);
+  }
+
+  static std::unique_ptr<CopyOnWritePages> CreatePages(usize numPages)
+  {
+    auto copyOnWrite = std::make_unique<CopyOnWritePages>();
+    copyOnWrite->numPages = numPages;
+    copyOnWrite->readFrom = std::make_unique<std::atomic<const SharedPages*>[]>(numPages);
+    copyOnWrite->readByCopies = std::make_unique<std::atomic<bool>[]>(numPages);
+    for(usize page = 0; page < numPages; page++)
+    {
+      copyOnWrite->readFrom[page].store(nullptr, std::memory_order_relaxed);
+      copyOnWrite->readByCopies[page].store(false, std::memory_order_relaxed);
+    }
+    return copyOnWrite;
+  }
+
   ShapeType m_ComponentShape;
   ShapeType m_TupleShape;
-  std::unique_ptr<value_type[]> m_Data = nullptr;
+  // The buffer this store reads and writes directly, null while a copy does not hold any page yet
+  mutable std::shared_ptr<value_type[]> m_Data = nullptr;
   size_t m_NumComponents = {0};
   size_t m_NumTuples = {0};
   std::optional<T> m_InitValue;
+  // m_Data.get() once it is allocated
+  mutable std::atomic<value_type*> m_OwnValues = nullptr;
+  // m_Data.get() once no value is read from another DataStore, nullptr before
+  mutable std::atomic<value_type*> m_Values = nullptr;
+  // m_Data.get() once no value is read from or by another DataStore, nullptr before
+  mutable std::atomic<value_type*> m_WritableValues = nullptr;
+  mutable std::unique_ptr<CopyOnWritePages> m_CopyOnWrite;
+  std::atomic<bool> m_Pinned = false;
 };
 
 // Declare aliases
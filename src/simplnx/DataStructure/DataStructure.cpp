@@ -17,6 +17,7 @@
 
 #include <fmt/core.h>
 
+#include <algorithm>
 #include <numeric>
 #include <sstream>
 #include <stdexcept>
@@ -24,6 +25,7 @@
 namespace
 {
 const std::string k_Delimiter = "|--";
+constexpr nx::core::usize k_MinPathCacheSize = 1024;
 }
 
 namespace nx::core
@@ -268,31 +270,7 @@ DataObject* DataStructure::getData(const std::optional<DataObject::IdType>& iden
 
 DataObject* DataStructure::getData(const DataPath& path)
 {
-  if(path.empty())
-  {
-    return nullptr;
-  }
-  DataObject* targetObject = m_RootGroup[path[0]];
-  for(usize index = 1; index < path.getLength(); index++)
-  {
-    if(targetObject == nullptr)
-    {
-      return nullptr;
-    }
-    if(!targetObject->isGroup())
-    {
-      return nullptr;
-    }
-    auto* groupObject = static_cast<BaseGroup*>(targetObject);
-    DataObject* childObject = (*groupObject)[path[index]];
-    if(childObject == nullptr)
-    {
-      return nullptr;
-    }
-    targetObject = childObject;
-  }
-
-  return targetObject;
+  return const_cast<DataObject*>(findData(path));
 }
 
 DataObject& DataStructure::getDataRef(const DataPath& path)
@@ -346,18 +324,40 @@ const DataObject* DataStructure::getData(const std::optional<DataObject::IdType>
 }
 
 const DataObject* DataStructure::getData(const DataPath& path) const
+{
+  return findData(path);
+}
+
+const DataObject* DataStructure::findData(const DataPath& path) const
 {
   if(path.empty())
   {
     return nullptr;
   }
-  const DataObject* targetObject = m_RootGroup[path[0]];
-  for(usize index = 1; index < path.getLength(); index++)
+
   {
-    if(targetObject == nullptr)
+    std::shared_lock<std::shared_mutex> lock(m_PathCacheMutex);
+    auto iter = m_PathCache.find(path);
+    if(iter != m_PathCache.end())
     {
-      return nullptr;
+      const DataObject* cachedObject = resolveCachedPath(path, iter->second);
+      if(cachedObject != nullptr)
+      {
+        return cachedObject;
+      }
     }
+  }
+
+  std::vector<DataObject::IdType> pathIds;
+  pathIds.reserve(path.getLength());
+  const DataObject* targetObject = m_RootGroup[path[0]];
+  if(targetObject == nullptr)
+  {
+    return nullptr;
+  }
+  pathIds.push_back(targetObject->getId());
+  for(usize index = 1; index < path.getLength(); index++)
+  {
     if(!targetObject->isGroup())
     {
       return nullptr;
@@ -369,11 +369,41 @@ const DataObject* DataStructure::getData(const DataPath& path) const
       return nullptr;
     }
     targetObject = childObject;
+    pathIds.push_back(targetObject->getId());
   }
 
+  std::unique_lock<std::shared_mutex> lock(m_PathCacheMutex);
+  // Entries of removed or renamed objects are only replaced when their path is looked up again, so the cache is bounded here
+  if(m_PathCache.size() >= std::max(k_MinPathCacheSize, 2 * m_DataObjects.size()))
+  {
+    m_PathCache.clear();
+  }
+  m_PathCache.insert_or_assign(path, std::move(pathIds));
   return targetObject;
 }
 
+const DataObject* DataStructure::resolveCachedPath(const DataPath& path, const std::vector<DataObject::IdType>& pathIds) const
+{
+  // Names are unique among the children of a group, so a child with the cached id and the
+  // expected name is the same object a search by name would find
+  const DataMap* dataMap = &m_RootGroup;
+  const DataObject* dataObject = nullptr;
+  for(usize index = 0; index < pathIds.size(); index++)
+  {
+    if(dataMap == nullptr)
+    {
+      return nullptr;
+    }
+    dataObject = (*dataMap)[pathIds[index]];
+    if(dataObject == nullptr || dataObject->getName() != path[index])
+    {
+      return nullptr;
+    }
+    dataMap = dataObject->isGroup() ? &static_cast<const BaseGroup*>(dataObject)->getDataMap() : nullptr;
+  }
+  return dataObject;
+}
+
 const DataObject& DataStructure::getDataRef(const DataPath& path) const
 {
   const DataObject* object = getData(path);
@@ -771,6 +801,8 @@ DataStructure& DataStructure::operator=(DataStructure&& rhs) noexcept
 void DataStructure::applyAllDataStructure()
 {
   m_RootGroup.setDataStructure(this);
+  std::unique_lock<std::shared_mutex> lock(m_PathCacheMutex);
+  m_PathCache.clear();
 }
 
 nonstd::expected<void, std::string> DataStructure::validateNumberOfTuples(const std::vector<DataPath>& dataPaths) const
@@ -982,6 +1014,19 @@ uint64 DataStructure::memoryUsage() const
   return memory;
 }
 
+void DataStructure::detachDataStores()
+{
+  for(const auto& dataIter : m_DataObjects)
+  {
+    auto dataArray = std::dynamic_pointer_cast<IDataArray>(dataIter.second.lock());
+    if(dataArray == nullptr)
+    {
+      continue;
+    }
+    dataArray->detachDataStore();
+  }
+}
+
 Result<> DataStructure::transferDataArraysOoc()
 {
   auto* preferences = Application::GetOrCreateInstance()->getPreferences();
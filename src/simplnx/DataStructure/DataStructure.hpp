@@ -14,8 +14,10 @@
 #include <memory>
 #include <optional>
 #include <set>
+#include <shared_mutex>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 namespace nx::core
@@ -891,6 +893,14 @@ public:
 
   uint64 memoryUsage() const;
 
+  /**
+   * @brief Gives every in-memory IDataArray its own copy-on-write DataStore.
+   * Copies of a DataStructure share their DataStores. Calling this on a copy
+   * makes it an independent snapshot without copying any array data until
+   * either DataStructure writes to an array.
+   */
+  void detachDataStores();
+
   /**
    * @brief Transfers array data to OOC if available.
    * @return Result with Warnings and errors
@@ -1021,6 +1031,24 @@ private:
    */
   void notify(const std::shared_ptr<AbstractDataStructureMessage>& msg);
 
+  /**
+   * @brief Finds the DataObject at the path. Paths that were found before are resolved
+   * through the path cache instead of searching each group for the names in the path.
+   * @param path
+   * @return const DataObject*
+   */
+  const DataObject* findData(const DataPath& path) const;
+
+  /**
+   * @brief Returns the DataObject the cached ids lead to if every id is still a child
+   * of the previous object and still has the name at the same position in the path.
+   * Returns nullptr if the DataStructure was changed in a way that invalidates the ids.
+   * @param path
+   * @param pathIds
+   * @return const DataObject*
+   */
+  const DataObject* resolveCachedPath(const DataPath& path, const std::vector<DataObject::IdType>& pathIds) const;
+
   ////////////
   // Variables
   SignalType m_Signal;
@@ -1028,5 +1056,7 @@ private:
   DataMap m_RootGroup;
   bool m_IsValid = false;
   DataObject::IdType m_NextId = 1;
+  mutable std::unordered_map<DataPath, std::vector<DataObject::IdType>> m_PathCache;
+  mutable std::shared_mutex m_PathCacheMutex;
 };
 } // namespace nx::core
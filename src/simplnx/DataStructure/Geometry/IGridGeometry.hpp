@@ -164,6 +164,24 @@ public:
    */
   virtual std::optional<usize> getIndex(float64 xCoord, float64 yCoord, float64 zCoord) const = 0;
 
+  /**
+   * @brief Returns the volume of a cell. The size is computed from the spacing or bounds of the grid
+   * so no array is needed, unlike findElementSizes().
+   * @param idx
+   * @return float32
+   */
+  virtual float32 getElementSize(usize idx) const = 0;
+
+  /**
+   * @brief Returns the volume of a cell. The size is computed from the spacing or bounds of the grid
+   * so no array is needed, unlike findElementSizes().
+   * @param x
+   * @param y
+   * @param z
+   * @return float32
+   */
+  virtual float32 getElementSize(usize x, usize y, usize z) const = 0;
+
   /**
    * @brief
    * @return
@@ -60,6 +60,7 @@ const INodeGeometry0D::SharedVertexList& INodeGeometry0D::getVerticesRef() const
 void INodeGeometry0D::setVertices(const INodeGeometry0D::SharedVertexList& vertices)
 {
   m_VertexDataArrayId = vertices.getId();
+  markModified();
 }
 
 std::optional<DataObject::IdType> INodeGeometry0D::getVertexListId() const
@@ -70,11 +71,13 @@ std::optional<DataObject::IdType> INodeGeometry0D::getVertexListId() const
 void INodeGeometry0D::setVertexListId(const std::optional<IdType>& vertices)
 {
   m_VertexDataArrayId = vertices;
+  markModified();
 }
 
 void INodeGeometry0D::resizeVertexList(usize size)
 {
   getVerticesRef().getIDataStoreRef().resizeTuples({size});
+  markModified();
 }
 
 usize INodeGeometry0D::getNumberOfVertices() const
@@ -168,6 +171,11 @@ void INodeGeometry0D::setVertexCoordinate(usize vertId, const Point3D<float32>&
   {
     vertices[offset + i] = coordinate[i];
   }
+  markModified();
+}
+
+void INodeGeometry0D::markModified()
+{
 }
 
 Point3D<float32> INodeGeometry0D::getVertexCoordinate(usize vertId) const
@@ -118,6 +118,13 @@ public:
    */
   void setVertexCoordinate(usize vertId, const Point3D<float32>& coords);
 
+  /**
+   * @brief Tells the geometry that its vertex or element lists were edited directly through their
+   * data arrays so that cached data derived from them is rebuilt. Replacing, resizing or editing
+   * the lists through the geometry's own functions already does this.
+   */
+  virtual void markModified();
+
   /****************************************************************************
    * These functions get values related to where the Vertex Coordinates are
    * stored in the DataStructure
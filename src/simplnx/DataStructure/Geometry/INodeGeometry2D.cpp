@@ -27,6 +27,7 @@ INodeGeometry2D::OptionalId INodeGeometry2D::getFaceListId() const
 void INodeGeometry2D::setFaceListId(const OptionalId& facesId)
 {
   m_FaceListId = facesId;
+  markModified();
 }
 
 INodeGeometry2D::SharedFaceList* INodeGeometry2D::getFaces()
@@ -70,11 +71,13 @@ const INodeGeometry2D::SharedFaceList& INodeGeometry2D::getFacesRef() const
 void INodeGeometry2D::setFaceList(const SharedFaceList& faces)
 {
   m_FaceListId = faces.getId();
+  markModified();
 }
 
 void INodeGeometry2D::resizeFaceList(usize size)
 {
   getFacesRef().getIDataStoreRef().resizeTuples({size});
+  markModified();
 }
 
 usize INodeGeometry2D::getNumberOfFaces() const
@@ -95,6 +98,7 @@ void INodeGeometry2D::setFacePointIds(usize faceId, nonstd::span<usize> vertexId
   {
     faces[offset + i] = vertexIds[i];
   }
+  markModified();
 }
 
 void INodeGeometry2D::getFacePointIds(usize faceId, nonstd::span<usize> vertexIds) const
@@ -161,12 +161,15 @@ IGeometry::StatusCode ImageGeom::findElementSizes(bool recalculate)
     return -1;
   }
 
+  auto dataStore = std::make_unique<DataStore<float32>>(std::vector<usize>{getNumberOfCells()}, std::vector<usize>{1}, getElementSize(0));
   if(voxelSizes == nullptr)
   {
-    float32 initValue = res[0] * res[1] * res[2];
-    auto dataStore = std::make_unique<DataStore<float32>>(std::vector<usize>{getNumberOfCells()}, std::vector<usize>{1}, initValue);
     voxelSizes = DataArray<float32>::Create(*getDataStructure(), k_VoxelSizes, std::move(dataStore), getId());
   }
+  else
+  {
+    voxelSizes->setDataStore(std::move(dataStore));
+  }
   if(voxelSizes == nullptr)
   {
     m_ElementSizesId.reset();
@@ -465,6 +468,16 @@ std::optional<usize> ImageGeom::getIndex(float64 xCoord, float64 yCoord, float64
   return (m_Dimensions[1] * m_Dimensions[0] * z) + (m_Dimensions[0] * y) + x;
 }
 
+float32 ImageGeom::getElementSize(usize /*idx*/) const
+{
+  return m_Spacing[0] * m_Spacing[1] * m_Spacing[2];
+}
+
+float32 ImageGeom::getElementSize(usize /*x*/, usize /*y*/, usize /*z*/) const
+{
+  return m_Spacing[0] * m_Spacing[1] * m_Spacing[2];
+}
+
 ImageGeom::ErrorType ImageGeom::computeCellIndex(const Point3D<float32>& coords, SizeVec3& index) const
 {
   ImageGeom::ErrorType err = ImageGeom::ErrorType::NoError;
@@ -332,6 +332,22 @@ public:
    */
   std::optional<usize> getIndex(float64 xCoord, float64 yCoord, float64 zCoord) const override;
 
+  /**
+   * @brief
+   * @param idx
+   * @return float32
+   */
+  float32 getElementSize(usize idx) const override;
+
+  /**
+   * @brief
+   * @param x
+   * @param y
+   * @param z
+   * @return float32
+   */
+  float32 getElementSize(usize x, usize y, usize z) const override;
+
   /**
    * @brief
    * @param coords
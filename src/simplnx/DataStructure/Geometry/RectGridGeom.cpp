@@ -343,6 +343,10 @@ IGeometry::StatusCode RectGridGeom::findElementSizes(bool recalculate)
   {
     sizeArray = DataArray<float32>::Create(*getDataStructure(), k_VoxelSizes, std::move(sizes), getId());
   }
+  else
+  {
+    sizeArray->setDataStore(std::move(sizes));
+  }
   if(sizeArray == nullptr)
   {
     m_ElementSizesId.reset();
@@ -700,6 +704,29 @@ std::optional<usize> RectGridGeom::getIndex(float64 xCoord, float64 yCoord, floa
   return (ySize * xSize * z) + (xSize * y) + x;
 }
 
+float32 RectGridGeom::getElementSize(usize idx) const
+{
+  const usize xDim = m_Dimensions[0];
+  const usize yDim = m_Dimensions[1];
+  return getElementSize(idx % xDim, (idx / xDim) % yDim, idx / (xDim * yDim));
+}
+
+float32 RectGridGeom::getElementSize(usize x, usize y, usize z) const
+{
+  const auto& xBnds = *getXBounds();
+  const auto& yBnds = *getYBounds();
+  const auto& zBnds = *getZBounds();
+  const float32 xRes = xBnds[x + 1] - xBnds[x];
+  const float32 yRes = yBnds[y + 1] - yBnds[y];
+  const float32 zRes = zBnds[z + 1] - zBnds[z];
+  // A cell with bounds in the wrong order has no valid size
+  if(xRes <= 0.0f || yRes <= 0.0f || zRes <= 0.0f)
+  {
+    return 0.0f;
+  }
+  return zRes * yRes * xRes;
+}
+
 void RectGridGeom::checkUpdatedIdsImpl(const std::unordered_map<DataObject::IdType, DataObject::IdType>& updatedIdsMap)
 {
   IGridGeometry::checkUpdatedIdsImpl(updatedIdsMap);
@@ -4,6 +4,7 @@
 #include "simplnx/DataStructure/DataStructure.hpp"
 #include "simplnx/DataStructure/DynamicListArray.hpp"
 #include "simplnx/Utilities/GeometryHelpers.hpp"
+#include "simplnx/Utilities/TriangleBVH.hpp"
 
 #include <stdexcept>
 
@@ -21,6 +22,16 @@ TriangleGeom::TriangleGeom(DataStructure& dataStructure, std::string name, IdTyp
   m_UnitDimensionality = 2;
 }
 
+TriangleGeom::TriangleGeom(const TriangleGeom& other)
+: INodeGeometry2D(other)
+{
+}
+
+TriangleGeom::TriangleGeom(TriangleGeom&& other)
+: INodeGeometry2D(std::move(other))
+{
+}
+
 IGeometry::Type TriangleGeom::getGeomType() const
 {
   return IGeometry::Type::Triangle;
@@ -332,3 +343,28 @@ IGeometry::StatusCode TriangleGeom::findUnsharedEdges(bool recalculate)
   m_UnsharedEdgeListId = unsharedEdgeList->getId();
   return 1;
 }
+
+std::shared_ptr<const TriangleBVH> TriangleGeom::getBVH() const
+{
+  std::lock_guard<std::mutex> lock(m_BVHMutex);
+  // Clear the flag before building so edits made during the build trigger another rebuild
+  if(m_BVHStale.exchange(false) || m_BVH == nullptr)
+  {
+    m_BVH = std::make_shared<const TriangleBVH>(*this);
+  }
+  return m_BVH;
+}
+
+void TriangleGeom::invalidateBVH()
+{
+  // Only written when not already set, so edits of single vertices in parallel loops stay cheap
+  if(!m_BVHStale.load(std::memory_order_relaxed))
+  {
+    m_BVHStale.store(true);
+  }
+}
+
+void TriangleGeom::markModified()
+{
+  invalidateBVH();
+}
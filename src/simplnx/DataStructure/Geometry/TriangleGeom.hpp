@@ -5,8 +5,14 @@
 
 #include <nonstd/span.hpp>
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+
 namespace nx::core
 {
+class TriangleBVH;
+
 /**
  * @class TriangleGeom
  * @brief
@@ -47,16 +53,16 @@ public:
   static TriangleGeom* Import(DataStructure& dataStructure, std::string name, IdType importId, const std::optional<IdType>& parentId = {});
 
   /**
-   * @brief
+   * @brief The spatial index is not copied, copies build their own on first use.
    * @param other
    */
-  TriangleGeom(const TriangleGeom& other) = default;
+  TriangleGeom(const TriangleGeom& other);
 
   /**
    * @brief
    * @param other
    */
-  TriangleGeom(TriangleGeom&& other) = default;
+  TriangleGeom(TriangleGeom&& other);
 
   ~TriangleGeom() noexcept override = default;
 
@@ -166,6 +172,25 @@ public:
    */
   StatusCode findUnsharedEdges(bool recalculate) override;
 
+  /**
+   * @brief Returns the bounding volume hierarchy of the triangles. The hierarchy is built on first
+   * use and shared by later calls until the geometry is marked as modified. Code that edits the
+   * vertex or face arrays directly must call markModified() or invalidateBVH() afterwards.
+   * Safe to call concurrently.
+   * @return std::shared_ptr<const TriangleBVH>
+   */
+  std::shared_ptr<const TriangleBVH> getBVH() const;
+
+  /**
+   * @brief Discards the bounding volume hierarchy so the next call to getBVH() rebuilds it.
+   */
+  void invalidateBVH();
+
+  /**
+   * @brief Invalidates the bounding volume hierarchy.
+   */
+  void markModified() override;
+
 protected:
   /**
    * @brief
@@ -181,5 +206,10 @@ protected:
    * @param importId
    */
   TriangleGeom(DataStructure& dataStructure, std::string name, IdType importId);
+
+private:
+  mutable std::shared_ptr<const TriangleBVH> m_BVH;
+  mutable std::mutex m_BVHMutex;
+  mutable std::atomic_bool m_BVHStale = false;
 };
 } // namespace nx::core
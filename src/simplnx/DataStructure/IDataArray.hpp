@@ -158,6 +158,13 @@ public:
    */
   virtual std::string getDataFormat() const = 0;
 
+  /**
+   * @brief Replaces an in-memory IDataStore that may be shared with other
+   * DataArrays by a copy-on-write copy, so writes to this array do not affect
+   * the other DataArrays. Other store types are left untouched.
+   */
+  virtual void detachDataStore() = 0;
+
 protected:
   IDataArray(DataStructure& dataStructure, std::string name)
   : IArray(dataStructure, std::move(name))
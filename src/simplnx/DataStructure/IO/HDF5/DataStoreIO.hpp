@@ -176,13 +176,25 @@ inline Result<> WriteDataStore(nx::core::HDF5::DatasetWriter& datasetWriter, con
   if(dataStore.getChunkShape().has_value() == false)
   {
     usize count = dataStore.getSize();
-    auto dataPtr = std::make_unique<T[]>(count);
-    for(usize i = 0; i < count; ++i)
+    std::unique_ptr<T[]> dataPtr;
+    nonstd::span<const T> values;
+    // In-memory stores are written from their own buffer. Other stores are copied out first.
+    if(const auto* memoryStore = dynamic_cast<const DataStore<T>*>(&dataStore); memoryStore != nullptr)
     {
-      dataPtr[i] = dataStore[i];
+      values = memoryStore->createSpan();
+    }
+    else
+    {
+      dataPtr = std::make_unique<T[]>(count);
+      Result<> copyResult = dataStore.copyIntoBuffer(0, nonstd::span<T>{dataPtr.get(), count});
+      if(copyResult.invalid())
+      {
+        return copyResult;
+      }
+      values = nonstd::span<const T>{dataPtr.get(), count};
     }
 
-    Result<> result = datasetWriter.writeSpan(h5dims, nonstd::span<const T>{dataPtr.get(), count});
+    Result<> result = datasetWriter.writeSpan(h5dims, values);
     if(result.invalid())
     {
       std::string ss = "Failed to write DataStore span to Dataset";
@@ -29,9 +29,9 @@ public:
    * Returns a Result<> with any errors or warnings encountered during the process.
    * @param parentGroup
    * @param dataReader
-   * @return Result<>
+   * @return PackedLists
    */
-  static std::vector<shared_vector_type> ReadHdf5Data(const nx::core::HDF5::GroupReader& parentGroup, const nx::core::HDF5::DatasetReader& dataReader)
+  static typename data_type::PackedLists ReadHdf5Data(const nx::core::HDF5::GroupReader& parentGroup, const nx::core::HDF5::DatasetReader& dataReader)
   {
     auto numNeighborsAttributeName = dataReader.getAttribute("Linked NumNeighbors Dataset");
     auto numNeighborsName = numNeighborsAttributeName.readAsString();
@@ -47,23 +47,26 @@ public:
       throw std::runtime_error(fmt::format("Error reading neighbor list from DataStore from HDF5 at {}/{}", nx::core::HDF5::Support::GetObjectPath(dataReader.getParentId()), dataReader.getName()));
     }
 
-    std::vector<shared_vector_type> dataVector;
-    usize offset = 0;
-    const auto numTuples = numNeighborsStore.getNumberOfTuples();
+    const usize numTuples = numNeighborsStore.getNumberOfTuples();
+    std::vector<usize> offsets(numTuples + 1, 0);
     for(usize i = 0; i < numTuples; i++)
     {
-      const auto numNeighbors = numNeighborsStore[i];
-      auto sharedVector = std::make_shared<std::vector<T>>(numNeighbors);
-      std::vector<T>& vector = *sharedVector.get();
-
-      size_t neighborListStart = offset;
-      size_t neighborListEnd = offset + numNeighbors;
-      sharedVector->assign(flatDataStore.begin() + neighborListStart, flatDataStore.begin() + neighborListEnd);
-      offset += numNeighbors;
-      dataVector.push_back(sharedVector);
+      const int32 numNeighbors = numNeighborsStore[i];
+      if(numNeighbors < 0)
+      {
+        throw std::runtime_error(fmt::format("Error reading neighbor list from HDF5 at {}/{}: list {} has a negative size", nx::core::HDF5::Support::GetObjectPath(dataReader.getParentId()),
+                                             dataReader.getName(), i));
+      }
+      offsets[i + 1] = offsets[i] + static_cast<usize>(numNeighbors);
+    }
+    if(offsets.back() > flatDataStore.size())
+    {
+      throw std::runtime_error(fmt::format("Error reading neighbor list from HDF5 at {}/{}: {} values are linked but only {} are stored",
+                                           nx::core::HDF5::Support::GetObjectPath(dataReader.getParentId()), dataReader.getName(), offsets.back(), flatDataStore.size()));
     }
 
-    return dataVector;
+    flatDataStore.resize(offsets.back());
+    return {std::move(flatDataStore), std::move(offsets)};
   }
 
   /**
@@ -81,8 +84,8 @@ public:
                     const std::optional<DataObject::IdType>& parentId, bool useEmptyDataStore = false) const override
   {
     auto datasetReader = parentGroup.openDataset(objectName);
-    auto dataVector = ReadHdf5Data(parentGroup, datasetReader);
-    auto* dataObject = data_type::Import(dataStructureReader.getDataStructure(), objectName, importId, dataVector, parentId);
+    auto packedLists = ReadHdf5Data(parentGroup, datasetReader);
+    auto* dataObject = data_type::Import(dataStructureReader.getDataStructure(), objectName, importId, std::move(packedLists), parentId);
     if(dataObject == nullptr)
     {
       std::string ss = "Failed to import NeighborList from HDF5";
@@ -104,16 +107,13 @@ public:
     DataStructure tmp;
 
     // Create NumNeighbors DataStore
-    const auto& neighborData = neighborList.getValues();
-    const usize arraySize = neighborData.size();
+    const std::vector<usize> offsets = neighborList.getListOffsets();
+    const usize arraySize = offsets.size() - 1;
     auto* numNeighborsArray = Int32Array::CreateWithStore<Int32DataStore>(tmp, neighborList.getNumNeighborsArrayName(), std::vector<usize>{arraySize}, std::vector<usize>{1});
     auto& numNeighborsStore = numNeighborsArray->getDataStoreRef();
-    usize totalItems = 0;
     for(usize i = 0; i < arraySize; i++)
     {
-      const auto numNeighbors = neighborData[i]->size();
-      numNeighborsStore[i] = static_cast<int32>(numNeighbors);
-      totalItems += numNeighbors;
+      numNeighborsStore[i] = static_cast<int32>(offsets[i + 1] - offsets[i]);
     }
 
     // Write NumNeighbors data
@@ -124,23 +124,11 @@ public:
       return result;
     }
 
-    // Create flattened neighbor DataStore
-    DataStore<T> flattenedData(totalItems, static_cast<T>(0));
-    usize offset = 0;
-    for(const auto& segment : neighborData)
-    {
-      usize numElements = segment->size();
-      if(numElements == 0)
-      {
-        continue;
-      }
-      T* start = segment->data();
-      for(usize i = 0; i < numElements; i++)
-      {
-        flattenedData[offset + i] = start[i];
-      }
-      offset += numElements;
-    }
+    // Pack the lists straight into the buffer of the flattened DataStore
+    const usize totalItems = offsets.back();
+    std::shared_ptr<T[]> flattenedBuffer(new T[totalItems]);
+    neighborList.copyPackedValues(offsets, nonstd::span<T>(flattenedBuffer.get(), totalItems));
+    DataStore<T> flattenedData(std::move(flattenedBuffer), std::vector<usize>{totalItems}, std::vector<usize>{1});
 
     // Write flattened array to HDF5 as a separate array
     auto datasetWriter = parentGroupWriter.createDatasetWriter(neighborList.getName());
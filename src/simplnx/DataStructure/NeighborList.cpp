@@ -1,11 +1,56 @@
 #include "NeighborList.hpp"
 
-#include "simplnx/DataStructure/DataArray.hpp"
-#include "simplnx/DataStructure/DataStore.hpp"
 #include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
 
 namespace nx::core
 {
+namespace
+{
+template <typename T, typename GetListFunc>
+class PackListsImpl
+{
+public:
+  PackListsImpl(const GetListFunc& getList, nonstd::span<const usize> offsets, nonstd::span<T> values)
+  : m_GetList(getList)
+  , m_Offsets(offsets)
+  , m_Values(values)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      const nonstd::span<const T> list = m_GetList(i);
+      std::copy(list.begin(), list.end(), m_Values.begin() + m_Offsets[i]);
+    }
+  }
+
+private:
+  const GetListFunc& m_GetList;
+  nonstd::span<const usize> m_Offsets;
+  nonstd::span<T> m_Values;
+};
+
+/**
+ * @brief Copies list i returned by getList(i) to values starting at offsets[i] in parallel.
+ */
+template <typename T, typename GetListFunc>
+void PackLists(const GetListFunc& getList, nonstd::span<const usize> offsets, nonstd::span<T> values)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, offsets.size() - 1);
+  dataAlg.execute(PackListsImpl<T, GetListFunc>(getList, offsets, values));
+}
+} // namespace
+
 template <typename T>
 NeighborList<T>::NeighborList(DataStructure& dataStructure, const std::string& name, usize numTuples)
 : INeighborList(dataStructure, name, numTuples)
@@ -17,10 +62,33 @@ NeighborList<T>::NeighborList(DataStructure& dataStructure, const std::string& n
 template <typename T>
 NeighborList<T>::NeighborList(DataStructure& dataStructure, const std::string& name, const std::vector<SharedVectorType>& dataVector, IdType importId)
 : INeighborList(dataStructure, name, dataVector.size(), importId)
-, m_Array(dataVector)
 , m_IsAllocated(true)
 , m_InitValue(static_cast<T>(0.0))
 {
+  PackedLists packedLists;
+  packedLists.offsets.resize(dataVector.size() + 1, 0);
+  for(usize i = 0; i < dataVector.size(); i++)
+  {
+    packedLists.offsets[i + 1] = packedLists.offsets[i] + (dataVector[i] == nullptr ? 0 : dataVector[i]->size());
+  }
+  packedLists.values.resize(packedLists.offsets.back());
+  auto getList = [&dataVector](usize index) {
+    return dataVector[index] == nullptr ? nonstd::span<const T>{} : nonstd::span<const T>(dataVector[index]->data(), dataVector[index]->size());
+  };
+  PackLists<T>(getList, packedLists.offsets, nonstd::span<T>(packedLists.values));
+  setStorage(CreateStorage(std::move(packedLists)));
+}
+
+template <typename T>
+NeighborList<T>::NeighborList(const NeighborList& other)
+: INeighborList(other)
+, m_Storage(other.m_Storage)
+, m_StoragePtr(other.m_StoragePtr.load(std::memory_order_acquire))
+, m_UniqueStorage(false)
+, m_IsAllocated(other.m_IsAllocated)
+, m_InitValue(other.m_InitValue)
+{
+  other.m_UniqueStorage.store(false, std::memory_order_release);
 }
 
 template <typename T>
@@ -45,6 +113,130 @@ NeighborList<T>* NeighborList<T>::Import(DataStructure& dataStructure, const std
   return data.get();
 }
 
+template <typename T>
+NeighborList<T>* NeighborList<T>::Import(DataStructure& dataStructure, const std::string& name, IdType importId, PackedLists packedLists, const std::optional<IdType>& parentId)
+{
+  auto data = std::shared_ptr<NeighborList>(new NeighborList(dataStructure, name, std::vector<SharedVectorType>{}, importId));
+  data->setPackedLists(std::move(packedLists));
+  if(!AttemptToAddObject(dataStructure, data, parentId))
+  {
+    return nullptr;
+  }
+  return data.get();
+}
+
+template <typename T>
+std::shared_ptr<typename NeighborList<T>::ListStorage> NeighborList<T>::CreateStorage(PackedLists packedLists)
+{
+  if(packedLists.offsets.empty())
+  {
+    packedLists.offsets.push_back(0);
+  }
+  const std::vector<usize>& offsets = packedLists.offsets;
+  if(offsets.front() != 0 || offsets.back() > packedLists.values.size() || !std::is_sorted(offsets.begin(), offsets.end()))
+  {
+    throw std::runtime_error(fmt::format("{}:({}): NeighborList offsets do not describe the {} packed values", __FILE__, __LINE__, packedLists.values.size()));
+  }
+  auto storage = std::make_shared<ListStorage>();
+  storage->overflow.resize(offsets.size() - 1);
+  storage->values = std::move(packedLists.values);
+  storage->offsets = std::move(packedLists.offsets);
+  return storage;
+}
+
+template <typename T>
+std::shared_ptr<typename NeighborList<T>::ListStorage> NeighborList<T>::CompactStorage(const ListStorage& storage)
+{
+  auto getList = [&storage](usize index) {
+    const std::unique_ptr<VectorType>& overflow = storage.overflow[index];
+    if(overflow != nullptr)
+    {
+      return nonstd::span<const T>(overflow->data(), overflow->size());
+    }
+    return nonstd::span<const T>(storage.values.data() + storage.offsets[index], storage.offsets[index + 1] - storage.offsets[index]);
+  };
+
+  const usize numLists = storage.overflow.size();
+  PackedLists packedLists;
+  packedLists.offsets.resize(numLists + 1, 0);
+  for(usize i = 0; i < numLists; i++)
+  {
+    packedLists.offsets[i + 1] = packedLists.offsets[i] + getList(i).size();
+  }
+  packedLists.values.resize(packedLists.offsets.back());
+  PackLists<T>(getList, packedLists.offsets, nonstd::span<T>(packedLists.values));
+  return CreateStorage(std::move(packedLists));
+}
+
+template <typename T>
+const typename NeighborList<T>::ListStorage& NeighborList<T>::readableStorage() const
+{
+  return *m_StoragePtr.load(std::memory_order_acquire);
+}
+
+template <typename T>
+typename NeighborList<T>::ListStorage& NeighborList<T>::writableStorage()
+{
+  if(m_UniqueStorage.load(std::memory_order_acquire))
+  {
+    return *m_StoragePtr.load(std::memory_order_relaxed);
+  }
+
+  std::lock_guard<std::mutex> lock(m_StorageMutex);
+  if(!m_UniqueStorage.load(std::memory_order_relaxed))
+  {
+    if(m_Storage.use_count() > 1)
+    {
+      // Readers on other threads may still be using the shared storage
+      m_PreviousStorage = std::exchange(m_Storage, CompactStorage(*m_Storage));
+      m_StoragePtr.store(m_Storage.get(), std::memory_order_release);
+    }
+    m_UniqueStorage.store(true, std::memory_order_release);
+  }
+  return *m_Storage;
+}
+
+template <typename T>
+void NeighborList<T>::setStorage(std::shared_ptr<ListStorage> storage)
+{
+  m_PreviousStorage.reset();
+  m_Storage = std::move(storage);
+  m_StoragePtr.store(m_Storage.get(), std::memory_order_release);
+  m_UniqueStorage.store(true, std::memory_order_release);
+}
+
+template <typename T>
+void NeighborList<T>::resizeLists(usize numLists)
+{
+  ListStorage& storage = writableStorage();
+  const usize oldNumLists = storage.overflow.size();
+  if(numLists < oldNumLists)
+  {
+    storage.offsets.resize(numLists + 1);
+    storage.values.resize(storage.offsets.back());
+  }
+  else
+  {
+    storage.offsets.resize(numLists + 1, storage.offsets.back());
+  }
+  // Moving the overflow pointers keeps references to the remaining lists valid
+  storage.overflow.resize(numLists);
+}
+
+template <typename T>
+typename NeighborList<T>::VectorType& NeighborList<T>::overflowList(usize grainId)
+{
+  ListStorage& storage = writableStorage();
+  // Different threads may move the same list to the overflow area
+  std::lock_guard<std::mutex> lock(m_StorageMutex);
+  std::unique_ptr<VectorType>& overflow = storage.overflow[grainId];
+  if(overflow == nullptr)
+  {
+    overflow = std::make_unique<VectorType>(storage.values.begin() + storage.offsets[grainId], storage.values.begin() + storage.offsets[grainId + 1]);
+  }
+  return *overflow;
+}
+
 template <typename T>
 DataObject* NeighborList<T>::shallowCopy()
 {
@@ -62,15 +254,9 @@ std::shared_ptr<DataObject> NeighborList<T>::deepCopy(const DataPath& copyPath)
   // Don't construct with identifier since it will get created when inserting into data structure
   auto copy = std::shared_ptr<NeighborList<T>>(new NeighborList<T>(dataStruct, copyPath.getTargetName(), getNumberOfTuples()));
   copy->setNumNeighborsArrayName(getNumNeighborsArrayName());
-  copy->m_Array.reserve(m_Array.size());
-  for(usize i = 0; i < m_Array.size(); ++i)
-  {
-    copy->m_Array.push_back(std::make_shared<VectorType>(m_Array[i]->size()));
-    for(usize j = 0; j < m_Array[i]->size(); ++j)
-    {
-      (*copy->m_Array[i])[j] = (*m_Array[i])[j];
-    }
-  }
+  copy->setStorage(CompactStorage(readableStorage()));
+  copy->m_IsAllocated = m_IsAllocated;
+  copy->m_InitValue = m_InitValue;
   if(dataStruct.insert(copy, copyPath.getParent()))
   {
     return copy;
@@ -101,7 +287,7 @@ int32 NeighborList<T>::eraseTuples(const std::vector<usize>& idxs)
     return 0;
   }
 
-  usize arraySize = m_Array.size();
+  usize arraySize = static_cast<usize>(getNumberOfLists());
   // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
   // off the end of the array and return an error code.
   for(usize idx : idxs)
@@ -112,16 +298,15 @@ int32 NeighborList<T>::eraseTuples(const std::vector<usize>& idxs)
     }
   }
 
-  std::vector<SharedVectorType> replacement(arraySize - idxsSize);
+  std::vector<usize> keptLists;
+  keptLists.reserve(arraySize - idxsSize);
 
   usize idxsIndex = 0;
-  usize rIdx = 0;
   for(usize dIdx = 0; dIdx < arraySize; ++dIdx)
   {
     if(dIdx != idxs[idxsIndex])
     {
-      replacement[rIdx] = m_Array[dIdx];
-      ++rIdx;
+      keptLists.push_back(dIdx);
     }
     else
     {
@@ -132,24 +317,42 @@ int32 NeighborList<T>::eraseTuples(const std::vector<usize>& idxs)
       }
     }
   }
-  m_Array = replacement;
-  setNumberOfTuples(m_Array.size());
+
+  auto getList = [this, &keptLists](usize index) { return std::as_const(*this).getListSpan(keptLists[index]); };
+  PackedLists packedLists;
+  packedLists.offsets.resize(keptLists.size() + 1, 0);
+  for(usize i = 0; i < keptLists.size(); i++)
+  {
+    packedLists.offsets[i + 1] = packedLists.offsets[i] + getList(i).size();
+  }
+  packedLists.values.resize(packedLists.offsets.back());
+  PackLists<T>(getList, packedLists.offsets, nonstd::span<T>(packedLists.values));
+  setStorage(CreateStorage(std::move(packedLists)));
+  setNumberOfTuples(keptLists.size());
   return err;
 }
 
 template <typename T>
 void NeighborList<T>::copyTuple(usize currentPos, usize newPos)
 {
-  m_Array[newPos] = m_Array[currentPos];
+  if(currentPos == newPos)
+  {
+    return;
+  }
+  const nonstd::span<const T> source = std::as_const(*this).getListSpan(currentPos);
+  VectorType values(source.begin(), source.end());
+  ListStorage& storage = writableStorage();
+  storage.overflow[newPos] = std::make_unique<VectorType>(std::move(values));
 }
 
 template <typename T>
 usize NeighborList<T>::getSize() const
 {
+  const ListStorage& storage = readableStorage();
   usize total = 0;
-  for(usize dIdx = 0; dIdx < m_Array.size(); ++dIdx)
+  for(usize dIdx = 0; dIdx < storage.overflow.size(); ++dIdx)
   {
-    total += m_Array[dIdx]->size();
+    total += getListSpan(dIdx).size();
   }
   return total;
 }
@@ -157,12 +360,7 @@ usize NeighborList<T>::getSize() const
 template <typename T>
 usize NeighborList<T>::size() const
 {
-  usize total = 0;
-  for(usize dIdx = 0; dIdx < m_Array.size(); ++dIdx)
-  {
-    total += m_Array[dIdx]->size();
-  }
-  return total;
+  return getSize();
 }
 
 template <typename T>
@@ -180,38 +378,21 @@ void NeighborList<T>::setNumberOfComponents(int32 nc)
 template <typename T>
 usize NeighborList<T>::getTypeSize() const
 {
-  return sizeof(SharedVectorType);
+  return sizeof(T);
 }
 
 template <typename T>
 void NeighborList<T>::initializeWithZeros()
 {
-  m_Array.clear();
-  m_IsAllocated = false;
+  clearAllLists();
 }
 
 template <typename T>
 int32 NeighborList<T>::resizeTotalElements(usize size)
 {
-  usize old = m_Array.size();
-  m_Array.resize(size);
+  resizeLists(size);
   setNumberOfTuples(size);
-  if(size >= old)
-  {
-    // Initialize with zero length Vectors
-    for(usize i = old; i < m_Array.size(); ++i)
-    {
-      m_Array[i] = SharedVectorType(new VectorType);
-    }
-  }
-  if(size == 0)
-  {
-    m_IsAllocated = false;
-  }
-  else
-  {
-    m_IsAllocated = true;
-  }
+  m_IsAllocated = size != 0;
   return 1;
 }
 
@@ -224,110 +405,106 @@ void NeighborList<T>::resizeTuples(usize numTuples)
 template <typename T>
 void NeighborList<T>::addEntry(int32 grainId, value_type value)
 {
-  if(grainId >= static_cast<int32>(m_Array.size()))
+  if(grainId >= getNumberOfLists())
   {
-    usize old = m_Array.size();
-    m_Array.resize(grainId + 1);
+    resizeLists(grainId + 1);
     m_IsAllocated = true;
-    // Initialize with zero length Vectors
-    for(usize i = old; i < m_Array.size(); ++i)
-    {
-      m_Array[i] = SharedVectorType(new VectorType);
-    }
   }
-  m_Array[grainId]->push_back(value);
-  setNumberOfTuples(m_Array.size());
+  overflowList(grainId).push_back(value);
+  setNumberOfTuples(getNumberOfLists());
 }
 
 template <typename T>
 void NeighborList<T>::clearAllLists()
 {
-  m_Array.clear();
+  setStorage(std::make_shared<ListStorage>());
   m_IsAllocated = false;
 }
 
 template <typename T>
 void NeighborList<T>::setList(int32 grainId, const SharedVectorType& neighborList)
 {
-  if(grainId >= static_cast<int32>(m_Array.size()))
+  setList(grainId, neighborList == nullptr ? nonstd::span<const T>{} : nonstd::span<const T>(neighborList->data(), neighborList->size()));
+}
+
+template <typename T>
+void NeighborList<T>::setList(int32 grainId, nonstd::span<const T> values)
+{
+  if(grainId >= getNumberOfLists())
   {
-    usize old = m_Array.size();
-    m_Array.resize(grainId + 1);
+    resizeLists(grainId + 1);
     m_IsAllocated = true;
-    // Initialize with zero length Vectors
-    for(usize i = old; i < m_Array.size(); ++i)
-    {
-      m_Array[i] = SharedVectorType(new VectorType);
-    }
   }
-  m_Array[grainId] = neighborList;
+  ListStorage& storage = writableStorage();
+  storage.overflow[grainId] = std::make_unique<VectorType>(values.begin(), values.end());
 }
 
 template <typename T>
 T NeighborList<T>::getValue(int32 grainId, int32 index, bool& ok) const
 {
-  SharedVectorType vec = m_Array[grainId];
-  if(index < 0 || static_cast<usize>(index) >= vec->size())
+  const nonstd::span<const T> list = getListSpan(grainId);
+  if(index < 0 || static_cast<usize>(index) >= list.size())
   {
     ok = false;
     return static_cast<T>(-1);
   }
-  return (*vec)[index];
+  return list[index];
 }
 
 template <typename T>
 int32 NeighborList<T>::getNumberOfLists() const
 {
-  return static_cast<int32>(m_Array.size());
+  return static_cast<int32>(readableStorage().overflow.size());
 }
 
 template <typename T>
 int32 NeighborList<T>::getListSize(int32 grainId) const
 {
-  return static_cast<int32>(m_Array[grainId]->size());
+  return static_cast<int32>(getListSpan(grainId).size());
 }
 
 template <typename T>
-typename NeighborList<T>::VectorType& NeighborList<T>::getListReference(int32 grainId) const
+typename NeighborList<T>::VectorType& NeighborList<T>::getListReference(int32 grainId)
 {
-  return *(m_Array[grainId]);
+  return overflowList(grainId);
 }
 
 template <typename T>
 typename NeighborList<T>::SharedVectorType NeighborList<T>::getList(int32 grainId) const
 {
-  return m_Array[grainId];
+  const nonstd::span<const T> list = getListSpan(grainId);
+  return std::make_shared<VectorType>(list.begin(), list.end());
 }
 
 template <typename T>
 typename NeighborList<T>::VectorType NeighborList<T>::copyOfList(int32 grainId) const
 {
-  VectorType copy(*(m_Array[grainId]));
-  return copy;
+  const nonstd::span<const T> list = getListSpan(grainId);
+  return VectorType(list.begin(), list.end());
 }
 
 template <typename T>
 typename NeighborList<T>::VectorType& NeighborList<T>::operator[](int32 grainId)
 {
-  return *(m_Array[grainId]);
+  return overflowList(grainId);
 }
 
 template <typename T>
 typename NeighborList<T>::VectorType& NeighborList<T>::operator[](usize grainId)
 {
-  return *(m_Array[grainId]);
+  return overflowList(grainId);
 }
 
 template <typename T>
-const typename NeighborList<T>::VectorType& NeighborList<T>::at(int32 grainId) const
+nonstd::span<const T> NeighborList<T>::at(int32 grainId) const
 {
-  return *(m_Array[grainId]);
+  return getListSpan(grainId);
 }
 
 template <typename T>
-const typename NeighborList<T>::VectorType& NeighborList<T>::at(usize grainId) const
+nonstd::span<const T> NeighborList<T>::at(usize grainId) const
 {
-  return *(m_Array[grainId]);
+  return getListSpan(grainId);
 }
 
 template <typename T>
@@ -344,45 +521,110 @@ void NeighborList<T>::resizeTuples(const std::vector<usize>& tupleShape)
 }
 
 template <typename T>
-const std::vector<typename NeighborList<T>::SharedVectorType>& NeighborList<T>::getValues() const
+nonstd::span<T> NeighborList<T>::getListSpan(usize grainId)
+{
+  ListStorage& storage = writableStorage();
+  const std::unique_ptr<VectorType>& overflow = storage.overflow[grainId];
+  if(overflow != nullptr)
+  {
+    return {overflow->data(), overflow->size()};
+  }
+  return {storage.values.data() + storage.offsets[grainId], storage.offsets[grainId + 1] - storage.offsets[grainId]};
+}
+
+template <typename T>
+nonstd::span<const T> NeighborList<T>::getListSpan(usize grainId) const
+{
+  const ListStorage& storage = readableStorage();
+  const std::unique_ptr<VectorType>& overflow = storage.overflow[grainId];
+  if(overflow != nullptr)
+  {
+    return {overflow->data(), overflow->size()};
+  }
+  return {storage.values.data() + storage.offsets[grainId], storage.offsets[grainId + 1] - storage.offsets[grainId]};
+}
+
+template <typename T>
+void NeighborList<T>::allocateLists(nonstd::span<const usize> listSizes)
 {
-  return m_Array;
+  PackedLists packedLists;
+  packedLists.offsets.resize(listSizes.size() + 1, 0);
+  for(usize i = 0; i < listSizes.size(); i++)
+  {
+    packedLists.offsets[i + 1] = packedLists.offsets[i] + listSizes[i];
+  }
+  packedLists.values.assign(packedLists.offsets.back(), m_InitValue);
+  setPackedLists(std::move(packedLists));
 }
 
 template <typename T>
-typename NeighborList<T>::iterator NeighborList<T>::begin()
+void NeighborList<T>::swapLists(usize first, usize second)
 {
-  return m_Array.begin();
+  if(first == second)
+  {
+    return;
+  }
+  VectorType& firstList = overflowList(first);
+  VectorType& secondList = overflowList(second);
+  firstList.swap(secondList);
 }
 
 template <typename T>
-typename NeighborList<T>::iterator NeighborList<T>::end()
+std::vector<usize> NeighborList<T>::getListOffsets() const
 {
-  return m_Array.end();
+  const usize numLists = readableStorage().overflow.size();
+  std::vector<usize> offsets(numLists + 1, 0);
+  for(usize i = 0; i < numLists; i++)
+  {
+    offsets[i + 1] = offsets[i] + getListSpan(i).size();
+  }
+  return offsets;
+}
+
+template <typename T>
+void NeighborList<T>::copyPackedValues(nonstd::span<const usize> offsets, nonstd::span<T> values) const
+{
+  const usize numLists = readableStorage().overflow.size();
+  if(offsets.size() != numLists + 1 || values.size() < offsets.back())
+  {
+    throw std::runtime_error(fmt::format("{}:({}): Packed NeighborList buffers do not match the {} lists", __FILE__, __LINE__, numLists));
+  }
+
+  auto getList = [this](usize index) { return getListSpan(index); };
+  PackLists<T>(getList, offsets, values);
 }
 
 template <typename T>
-typename NeighborList<T>::const_iterator NeighborList<T>::begin() const
+typename NeighborList<T>::PackedLists NeighborList<T>::pack() const
 {
-  return m_Array.begin();
+  PackedLists packedLists;
+  packedLists.offsets = getListOffsets();
+  packedLists.values.resize(packedLists.offsets.back());
+  copyPackedValues(packedLists.offsets, packedLists.values);
+  return packedLists;
 }
 
 template <typename T>
-typename NeighborList<T>::const_iterator NeighborList<T>::end() const
+void NeighborList<T>::setPackedLists(nonstd::span<const T> values, nonstd::span<const usize> offsets)
 {
-  return m_Array.end();
+  PackedLists packedLists;
+  packedLists.values.assign(values.begin(), values.end());
+  packedLists.offsets.assign(offsets.begin(), offsets.end());
+  setPackedLists(std::move(packedLists));
 }
 
 template <typename T>
-typename NeighborList<T>::const_iterator NeighborList<T>::cbegin() const
+void NeighborList<T>::setPackedLists(PackedLists packedLists)
 {
-  return m_Array.begin();
+  setStorage(CreateStorage(std::move(packedLists)));
+  m_IsAllocated = getNumberOfLists() != 0;
+  setNumberOfTuples(getNumberOfLists());
 }
 
 template <typename T>
-typename NeighborList<T>::const_iterator NeighborList<T>::cend() const
+void NeighborList<T>::compact()
 {
-  return m_Array.end();
+  setStorage(CompactStorage(readableStorage()));
 }
 
 template <>
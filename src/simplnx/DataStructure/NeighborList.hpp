@@ -4,6 +4,13 @@
 #include "simplnx/Common/Types.hpp"
 #include "simplnx/DataStructure/INeighborList.hpp"
 
+#include <nonstd/span.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace nx::core
 {
 namespace NeighborListConstants
@@ -13,7 +20,20 @@ inline constexpr StringLiteral k_TypeName = "NeighborList<T>";
 
 /**
  * @class NeighborList
- * @brief
+ * @brief Stores a variable length list of values per tuple.
+ *
+ * The values of all lists are packed back to back into one buffer and
+ * located through an offsets array. Writing to a list through a VectorType
+ * reference, e.g. operator[] or addEntry(), moves that list into its own
+ * growable vector in the overflow area, where it can be appended to in place.
+ * compact() packs the overflowed lists back into the buffer. Lists are never
+ * shared with the caller: getList() returns a copy and setList() copies the
+ * given values.
+ *
+ * Shallow copies share the buffers until either side writes to them, the
+ * writing side then copies the buffers once. VectorType references and spans
+ * are invalidated when the list is replaced, the lists are compacted or the
+ * NeighborList is copied.
  * @tparam T
  */
 template <class T>
@@ -23,11 +43,36 @@ public:
   using value_type = T;
   using VectorType = std::vector<T>;
   using SharedVectorType = std::shared_ptr<VectorType>;
-  using iterator = typename std::vector<SharedVectorType>::iterator;
-  using const_iterator = typename std::vector<SharedVectorType>::const_iterator;
+
+  /**
+   * @brief Contiguous copy of every list. The values of list i are
+   * values[offsets[i]] to values[offsets[i + 1] - 1], so offsets holds one
+   * entry more than there are lists.
+   */
+  struct PackedLists
+  {
+    std::vector<T> values;
+    std::vector<usize> offsets;
+
+    usize getNumberOfLists() const
+    {
+      return offsets.empty() ? 0 : offsets.size() - 1;
+    }
+
+    nonstd::span<const T> getList(usize index) const
+    {
+      return {values.data() + offsets[index], offsets[index + 1] - offsets[index]};
+    }
+  };
 
   NeighborList() = default;
 
+  /**
+   * @brief Shares the lists of other until either NeighborList writes to them.
+   * @param other
+   */
+  NeighborList(const NeighborList& other);
+
   /**
    * @brief
    * @param dataStructure
@@ -50,6 +95,17 @@ public:
    */
   static NeighborList* Import(DataStructure& dataStructure, const std::string& name, IdType importId, const std::vector<SharedVectorType>& data, const std::optional<IdType>& parentId = {});
 
+  /**
+   * @brief Imports the lists stored in packedLists without copying the values.
+   * @param dataStructure
+   * @param name
+   * @param importId
+   * @param packedLists
+   * @param parentId
+   * @return NeighborList<T>*
+   */
+  static NeighborList* Import(DataStructure& dataStructure, const std::string& name, IdType importId, PackedLists packedLists, const std::optional<IdType>& parentId = {});
+
   ~NeighborList() override = default;
 
   /**
@@ -169,12 +225,20 @@ public:
   void clearAllLists();
 
   /**
-   * @brief setList
+   * @brief Replaces the target list with a copy of neighborList. A null
+   * neighborList sets an empty list.
    * @param grainId
    * @param neighborList
    */
   void setList(int32 grainId, const SharedVectorType& neighborList);
 
+  /**
+   * @brief Replaces the target list with a copy of values.
+   * @param grainId
+   * @param values
+   */
+  void setList(int32 grainId, nonstd::span<const T> values);
+
   /**
    * @brief getValue
    * @param grainId
@@ -198,14 +262,19 @@ public:
   int32 getListSize(int32 grainId) const;
 
   /**
-   * @brief Returns a reference to the target grain ID's data.
+   * @brief Returns a reference to the target grain ID's data. The list is moved
+   * to the overflow area so it can grow in place.
    * @param grainId
    * @return VectorType&
    */
-  VectorType& getListReference(int32 grainId) const;
+  VectorType& getListReference(int32 grainId);
 
   /**
-   * @brief getList
+   * @brief Returns a copy of the target list that the caller owns.
+   *
+   * Unlike earlier versions the returned vector is not the stored list, changes
+   * made through it are not written back. Use setList() or getListReference()
+   * to modify a list and at() to read it without copying.
    * @param grainId
    * @return SharedVectorType
    */
@@ -289,32 +358,36 @@ public:
   VectorType copyOfList(int32 grainId) const;
 
   /**
-   * @brief operator []
+   * @brief Returns a reference to the target list. The list is copied to the
+   * overflow area on first access so it can grow in place, read only callers
+   * should use at() or getListSpan() instead.
    * @param grainId
    * @return VectorType&
    */
   VectorType& operator[](int32 grainId);
 
   /**
-   * @brief operator []
+   * @brief Returns a reference to the target list. The list is copied to the
+   * overflow area on first access so it can grow in place, read only callers
+   * should use at() or getListSpan() instead.
    * @param grainId
    * @return VectorType&
    */
   VectorType& operator[](usize grainId);
 
   /**
-   * @brief Returns a const reference to the VectorType value found at the specified index. This cannot be used to edit the VectorType value found at the specified index.
+   * @brief Returns a read only span over the list found at the specified index.
    * @param grainId
-   * @return const VectorType&
+   * @return nonstd::span<const T>
    */
-  const VectorType& at(int32 grainId) const;
+  nonstd::span<const T> at(int32 grainId) const;
 
   /**
-   * @brief Returns a const reference to the VectorType value found at the specified index. This cannot be used to edit the VectorType value found at the specified index.
+   * @brief Returns a read only span over the list found at the specified index.
    * @param grainId
-   * @return const VectorType&
+   * @return nonstd::span<const T>
    */
-  const VectorType& at(usize grainId) const;
+  nonstd::span<const T> at(usize grainId) const;
 
   /**
    * @brief Returns the DataArray's value type as an enum
@@ -333,14 +406,79 @@ public:
    */
   void resizeTuples(const std::vector<usize>& tupleShape) override;
 
-  const std::vector<SharedVectorType>& getValues() const;
+  /**
+   * @brief Returns a span over the target list without copying it or moving it
+   * to the overflow area. The span is invalidated when the list is resized or
+   * replaced.
+   * @param grainId
+   * @return nonstd::span<T>
+   */
+  nonstd::span<T> getListSpan(usize grainId);
 
-  iterator begin();
-  iterator end();
-  const_iterator begin() const;
-  const_iterator end() const;
-  const_iterator cbegin() const;
-  const_iterator cend() const;
+  /**
+   * @brief Returns a span over the target list without copying it. The span is
+   * invalidated when the list is resized or replaced.
+   * @param grainId
+   * @return nonstd::span<const T>
+   */
+  nonstd::span<const T> getListSpan(usize grainId) const;
+
+  /**
+   * @brief Replaces all lists with lists of the given sizes, filled with the init
+   * value and packed into one buffer. Different lists can then be written through
+   * getListSpan() from different threads, e.g. inside a ParallelDataAlgorithm,
+   * without any further allocation.
+   * @param listSizes
+   */
+  void allocateLists(nonstd::span<const usize> listSizes);
+
+  /**
+   * @brief Swaps the values of two lists.
+   * @param first
+   * @param second
+   */
+  void swapLists(usize first, usize second);
+
+  /**
+   * @brief Returns the offset of each list inside the packed values followed by
+   * the total number of values.
+   * @return std::vector<usize>
+   */
+  std::vector<usize> getListOffsets() const;
+
+  /**
+   * @brief Copies all lists back to back into values in parallel. The offsets must
+   * come from getListOffsets() and values must hold offsets.back() elements.
+   * @param offsets
+   * @param values
+   */
+  void copyPackedValues(nonstd::span<const usize> offsets, nonstd::span<T> values) const;
+
+  /**
+   * @brief Returns a packed copy of all lists.
+   * @return PackedLists
+   */
+  PackedLists pack() const;
+
+  /**
+   * @brief Replaces all lists with the lists stored in the packed buffer.
+   * @param values
+   * @param offsets
+   */
+  void setPackedLists(nonstd::span<const T> values, nonstd::span<const usize> offsets);
+
+  /**
+   * @brief Replaces all lists with the lists stored in packedLists without
+   * copying the values.
+   * @param packedLists
+   */
+  void setPackedLists(PackedLists packedLists);
+
+  /**
+   * @brief Packs the lists in the overflow area back into the value buffer.
+   * Invalidates all VectorType references and spans.
+   */
+  void compact();
 
 protected:
   /**
@@ -354,9 +492,51 @@ protected:
   NeighborList(DataStructure& dataStructure, const std::string& name, const std::vector<SharedVectorType>& dataVector, IdType importId);
 
 private:
-  std::vector<SharedVectorType> m_Array;
-  bool m_IsAllocated;
-  value_type m_InitValue;
+  /**
+   * @brief List i is stored in values[offsets[i]] to values[offsets[i + 1] - 1]
+   * unless overflow[i] is set. Then overflow[i] holds its values and the packed
+   * range is unused. overflow holds one entry per list.
+   */
+  struct ListStorage
+  {
+    std::vector<T> values;
+    std::vector<usize> offsets = {0};
+    std::vector<std::unique_ptr<VectorType>> overflow;
+  };
+
+  static std::shared_ptr<ListStorage> CreateStorage(PackedLists packedLists);
+
+  static std::shared_ptr<ListStorage> CompactStorage(const ListStorage& storage);
+
+  const ListStorage& readableStorage() const;
+
+  /**
+   * @brief Returns the storage after copying it if it is still shared with a
+   * shallow copy. Can be called from several threads at once.
+   * @return ListStorage&
+   */
+  ListStorage& writableStorage();
+
+  void setStorage(std::shared_ptr<ListStorage> storage);
+
+  /**
+   * @brief Adds empty lists until there are numLists lists or removes the lists past numLists.
+   * @param numLists
+   */
+  void resizeLists(usize numLists);
+
+  VectorType& overflowList(usize grainId);
+
+  std::shared_ptr<ListStorage> m_Storage = std::make_shared<ListStorage>();
+  // m_Storage.get(), read by the const accessors while another thread may be copying the storage
+  std::atomic<ListStorage*> m_StoragePtr = m_Storage.get();
+  // False while m_Storage may be shared with a shallow copy
+  mutable std::atomic<bool> m_UniqueStorage = true;
+  // The shared storage that was last copied, kept alive for readers that still use it
+  std::shared_ptr<ListStorage> m_PreviousStorage;
+  std::mutex m_StorageMutex;
+  bool m_IsAllocated = false;
+  value_type m_InitValue = {};
 };
 
 template <>
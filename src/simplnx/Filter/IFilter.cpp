@@ -195,54 +195,92 @@ IFilter::PreflightResult IFilter::preflight(const DataStructure& data, const Arg
 }
 
 IFilter::ExecuteResult IFilter::execute(DataStructure& dataStructure, const Arguments& args, const PipelineFilter* pipelineFilter, const MessageHandler& messageHandler,
-                                        const std::atomic_bool& shouldCancel) const
+                                        const std::atomic_bool& shouldCancel, const ExecutionContext& executionContext) const
 {
+  // All stages run in the context so the arrays created by the OutputActions are allocated by its threads
+  ExecuteResult executeResult;
+  executionContext.execute([&]() {
+    ExecutionStage stage = executeBegin(dataStructure, args, messageHandler, shouldCancel);
+    executeCompute(dataStructure, stage, pipelineFilter, messageHandler, shouldCancel, executionContext);
+    executeResult = executeEnd(dataStructure, std::move(stage));
+  });
+  return executeResult;
+}
+
+IFilter::ExecutionStage IFilter::executeBegin(DataStructure& dataStructure, const Arguments& args, const MessageHandler& messageHandler, const std::atomic_bool& shouldCancel) const
+{
+  ExecutionStage stage;
+
   PreflightResult preflightResult = preflight(dataStructure, args, messageHandler, shouldCancel);
+  stage.outputValues = std::move(preflightResult.outputValues);
   if(preflightResult.outputActions.invalid())
   {
-    return ExecuteResult{ConvertResult(std::move(preflightResult.outputActions)), std::move(preflightResult.outputValues)};
+    stage.result = ConvertResult(std::move(preflightResult.outputActions));
+    return stage;
   }
 
-  OutputActions outputActions = std::move(preflightResult.outputActions.value());
+  stage.outputActions = std::move(preflightResult.outputActions.value());
 
   Result<> outputActionsResult = ConvertResult(std::move(preflightResult.outputActions));
 
-  Result<> actionsResult = outputActions.applyRegular(dataStructure, IDataAction::Mode::Execute);
+  Result<> actionsResult = stage.outputActions.applyRegular(dataStructure, IDataAction::Mode::Execute);
 
-  Result<> preflightActionsResult = MergeResults(std::move(outputActionsResult), std::move(actionsResult));
+  stage.result = MergeResults(std::move(outputActionsResult), std::move(actionsResult));
 
-  if(preflightActionsResult.invalid())
+  if(stage.result.invalid())
   {
-    return ExecuteResult{std::move(preflightActionsResult), std::move(preflightResult.outputValues)};
+    return stage;
   }
 
   Parameters params = parameters();
   // We can discard the warnings since they're already reported in preflight
   auto [resolvedArgs, warnings] = GetResolvedArgs(args, params, *this);
+  stage.resolvedArgs = std::move(resolvedArgs);
 
-  Result<> executeImplResult = executeImpl(dataStructure, resolvedArgs, pipelineFilter, messageHandler, shouldCancel);
+  return stage;
+}
+
+void IFilter::executeCompute(DataStructure& dataStructure, ExecutionStage& stage, const PipelineFilter* pipelineFilter, const MessageHandler& messageHandler,
+                             const std::atomic_bool& shouldCancel, const ExecutionContext& executionContext) const
+{
+  if(stage.result.invalid())
+  {
+    return;
+  }
+
+  Result<> executeImplResult;
+  executionContext.execute([&]() { executeImplResult = executeImpl(dataStructure, stage.resolvedArgs, pipelineFilter, messageHandler, shouldCancel); });
   if(shouldCancel)
   {
-    return {MakeErrorResult(-1, "Filter cancelled")};
+    stage.cancelled = true;
+    return;
   }
 
-  Result<> preflightActionsExecuteResult = MergeResults(std::move(preflightActionsResult), std::move(executeImplResult));
+  stage.result = MergeResults(std::move(stage.result), std::move(executeImplResult));
+}
+
+IFilter::ExecuteResult IFilter::executeEnd(DataStructure& dataStructure, ExecutionStage&& stage) const
+{
+  if(stage.cancelled)
+  {
+    return {MakeErrorResult(-1, "Filter cancelled")};
+  }
 
-  if(preflightActionsExecuteResult.invalid())
+  if(stage.result.invalid())
   {
-    return ExecuteResult{std::move(preflightActionsExecuteResult), std::move(preflightResult.outputValues)};
+    return ExecuteResult{std::move(stage.result), std::move(stage.outputValues)};
   }
   // Apply any deferred actions
-  Result<> deferredActionsResult = outputActions.applyDeferred(dataStructure, IDataAction::Mode::Execute);
+  Result<> deferredActionsResult = stage.outputActions.applyDeferred(dataStructure, IDataAction::Mode::Execute);
 
   // Validate the Geometry and Attribute Matrix objects
   Result<> validGeometryAndAttributeMatrices = MergeResults(dataStructure.validateGeometries(), dataStructure.validateAttributeMatrices());
   validGeometryAndAttributeMatrices = MergeResults(validGeometryAndAttributeMatrices, deferredActionsResult);
 
   // Merge all the results together.
-  Result<> finalResult = MergeResults(std::move(preflightActionsExecuteResult), std::move(validGeometryAndAttributeMatrices));
+  Result<> finalResult = MergeResults(std::move(stage.result), std::move(validGeometryAndAttributeMatrices));
 
-  return ExecuteResult{std::move(finalResult), std::move(preflightResult.outputValues)};
+  return ExecuteResult{std::move(finalResult), std::move(stage.outputValues)};
 }
 
 nlohmann::json IFilter::toJson(const Arguments& args) const
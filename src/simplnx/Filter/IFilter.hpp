@@ -6,6 +6,7 @@
 #include "simplnx/Filter/Arguments.hpp"
 #include "simplnx/Filter/Output.hpp"
 #include "simplnx/Filter/Parameters.hpp"
+#include "simplnx/Utilities/ExecutionContext.hpp"
 #include "simplnx/simplnx_export.hpp"
 
 #include <nonstd/expected.hpp>
@@ -100,6 +101,19 @@ public:
     std::vector<PreflightValue> outputValues;
   };
 
+  /**
+   * @brief Holds the state of an execution that is split into its stages with executeBegin(),
+   * executeCompute() and executeEnd().
+   */
+  struct ExecutionStage
+  {
+    Result<> result;
+    OutputActions outputActions;
+    std::vector<PreflightValue> outputValues;
+    Arguments resolvedArgs;
+    bool cancelled = false;
+  };
+
   virtual ~IFilter() noexcept;
 
   IFilter(const IFilter&) = delete;
@@ -178,10 +192,45 @@ public:
    * @param pipelineNode = nullptr
    * @param messageHandler = {}
    * @param shouldCancel
+   * @param executionContext The threads the filter runs on, defaults to the context of the calling thread
    * @return ExecuteResult
    */
   ExecuteResult execute(DataStructure& dataStructure, const Arguments& args, const PipelineFilter* pipelineNode = nullptr, const MessageHandler& messageHandler = {},
-                        const std::atomic_bool& shouldCancel = false) const;
+                        const std::atomic_bool& shouldCancel = false, const ExecutionContext& executionContext = ExecutionContext::Current()) const;
+
+  /**
+   * @brief First stage of execute(). Preflights the filter and applies the regular OutputActions
+   * which are the only changes made to the layout of the DataStructure before executeEnd().
+   * execute() is equivalent to calling executeBegin(), executeCompute() and executeEnd() in order.
+   * @param dataStructure
+   * @param args
+   * @param messageHandler = {}
+   * @param shouldCancel
+   * @return ExecutionStage
+   */
+  ExecutionStage executeBegin(DataStructure& dataStructure, const Arguments& args, const MessageHandler& messageHandler = {}, const std::atomic_bool& shouldCancel = false) const;
+
+  /**
+   * @brief Second stage of execute(). Runs the filter's algorithm if the first stage succeeded.
+   * Schedulers may run this stage of filters that work on disjoint data concurrently.
+   * @param dataStructure
+   * @param stage
+   * @param pipelineNode = nullptr
+   * @param messageHandler = {}
+   * @param shouldCancel
+   * @param executionContext The threads the algorithm runs on, defaults to the context of the calling thread
+   */
+  void executeCompute(DataStructure& dataStructure, ExecutionStage& stage, const PipelineFilter* pipelineNode = nullptr, const MessageHandler& messageHandler = {},
+                      const std::atomic_bool& shouldCancel = false, const ExecutionContext& executionContext = ExecutionContext::Current()) const;
+
+  /**
+   * @brief Last stage of execute(). Applies the deferred OutputActions and validates the
+   * geometries and attribute matrices.
+   * @param dataStructure
+   * @param stage
+   * @return ExecuteResult
+   */
+  ExecuteResult executeEnd(DataStructure& dataStructure, ExecutionStage&& stage) const;
 
   /**
    * @brief Converts the given arguments to a JSON representation using the filter's parameters.
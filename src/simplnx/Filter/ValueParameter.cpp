@@ -6,4 +6,14 @@ ValueParameter::Type ValueParameter::type() const
 {
   return Type::Value;
 }
+
+std::vector<std::filesystem::path> ValueParameter::inputPaths([[maybe_unused]] const std::any& value) const
+{
+  return {};
+}
+
+std::vector<std::filesystem::path> ValueParameter::outputPaths([[maybe_unused]] const std::any& value) const
+{
+  return {};
+}
 } // namespace nx::core
@@ -3,6 +3,9 @@
 #include "simplnx/Common/Result.hpp"
 #include "simplnx/Filter/AbstractParameter.hpp"
 
+#include <filesystem>
+#include <vector>
+
 namespace nx::core
 {
 /**
@@ -32,6 +35,23 @@ public:
    */
   virtual Result<> validate(const std::any& value) const = 0;
 
+  /**
+   * @brief Returns the files and directories on disk that the given value reads from.
+   * Used to detect when a stored result is stale because an input changed.
+   * Parameters that reference input files must override this. The default returns no paths.
+   * @param value
+   * @return std::vector<std::filesystem::path>
+   */
+  virtual std::vector<std::filesystem::path> inputPaths(const std::any& value) const;
+
+  /**
+   * @brief Returns the files and directories on disk that the given value writes to.
+   * Parameters that reference output files must override this. The default returns no paths.
+   * @param value
+   * @return std::vector<std::filesystem::path>
+   */
+  virtual std::vector<std::filesystem::path> outputPaths(const std::any& value) const;
+
 protected:
   ValueParameter() = delete;
   using AbstractParameter::AbstractParameter;
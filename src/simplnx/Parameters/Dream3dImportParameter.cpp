@@ -146,6 +146,12 @@ std::any Dream3dImportParameter::defaultValue() const
   return m_DefaultValue;
 }
 
+//-----------------------------------------------------------------------------
+std::vector<std::filesystem::path> Dream3dImportParameter::inputPaths(const std::any& value) const
+{
+  return {GetAnyRef<ValueType>(value).FilePath};
+}
+
 //-----------------------------------------------------------------------------
 Result<> Dream3dImportParameter::validate(const std::any& value) const
 {
@@ -85,6 +85,13 @@ public:
    */
   Result<> validate(const std::any& value) const override;
 
+  /**
+   * @brief Returns the .dream3d file that is imported.
+   * @param value
+   * @return std::vector<std::filesystem::path>
+   */
+  std::vector<std::filesystem::path> inputPaths(const std::any& value) const override;
+
   /**
    * @brief
    * @param importData
@@ -194,6 +194,26 @@ FileSystemPathParameter::ExtensionsType FileSystemPathParameter::getAvailableExt
   return m_AvailableExtensions;
 }
 
+//-----------------------------------------------------------------------------
+std::vector<std::filesystem::path> FileSystemPathParameter::inputPaths(const std::any& value) const
+{
+  if(m_PathType != PathType::InputFile && m_PathType != PathType::InputDir)
+  {
+    return {};
+  }
+  return {GetAnyRef<ValueType>(value)};
+}
+
+//-----------------------------------------------------------------------------
+std::vector<std::filesystem::path> FileSystemPathParameter::outputPaths(const std::any& value) const
+{
+  if(m_PathType != PathType::OutputFile && m_PathType != PathType::OutputDir)
+  {
+    return {};
+  }
+  return {GetAnyRef<ValueType>(value)};
+}
+
 //-----------------------------------------------------------------------------
 Result<> FileSystemPathParameter::validate(const std::any& value) const
 {
@@ -115,6 +115,20 @@ public:
    */
   Result<> validate(const std::any& value) const override;
 
+  /**
+   * @brief Returns the path if it is an input file or directory. Output paths are not inputs.
+   * @param value
+   * @return std::vector<std::filesystem::path>
+   */
+  std::vector<std::filesystem::path> inputPaths(const std::any& value) const override;
+
+  /**
+   * @brief Returns the path if it is an output file or directory.
+   * @param value
+   * @return std::vector<std::filesystem::path>
+   */
+  std::vector<std::filesystem::path> outputPaths(const std::any& value) const override;
+
   /**
    * @brief
    * @param value
@@ -147,6 +147,14 @@ std::any GeneratedFileListParameter::defaultValue() const
   return m_DefaultValue;
 }
 
+//-----------------------------------------------------------------------------
+std::vector<std::filesystem::path> GeneratedFileListParameter::inputPaths(const std::any& valueRef) const
+{
+  const auto& value = GetAnyRef<ValueType>(valueRef);
+  const std::vector<std::string> fileList = value.generate();
+  return {fileList.cbegin(), fileList.cend()};
+}
+
 //-----------------------------------------------------------------------------
 Result<> GeneratedFileListParameter::validate(const std::any& valueRef) const
 {
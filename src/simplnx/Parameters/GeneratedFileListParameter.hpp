@@ -90,6 +90,13 @@ public:
    */
   Result<> validate(const std::any& value) const override;
 
+  /**
+   * @brief Returns every file in the generated file list.
+   * @param value
+   * @return std::vector<std::filesystem::path>
+   */
+  std::vector<std::filesystem::path> inputPaths(const std::any& value) const override;
+
 protected:
   /**
    * @brief
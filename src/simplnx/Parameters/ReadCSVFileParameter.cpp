@@ -85,6 +85,13 @@ std::any ReadCSVFileParameter::defaultValue() const
   return m_DefaultValue;
 }
 
+// -----------------------------------------------------------------------------
+std::vector<std::filesystem::path> ReadCSVFileParameter::inputPaths(const std::any& value) const
+{
+  const auto& data = std::any_cast<const ReadCSVData&>(value);
+  return {data.inputFilePath};
+}
+
 // -----------------------------------------------------------------------------
 Result<> ReadCSVFileParameter::validate(const std::any& value) const
 {
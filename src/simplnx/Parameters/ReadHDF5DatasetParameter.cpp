@@ -196,6 +196,13 @@ std::any ReadHDF5DatasetParameter::defaultValue() const
   return m_DefaultValue;
 }
 
+// -----------------------------------------------------------------------------
+std::vector<std::filesystem::path> ReadHDF5DatasetParameter::inputPaths(const std::any& value) const
+{
+  const auto& data = std::any_cast<const ValueType&>(value);
+  return {data.inputFile};
+}
+
 // -----------------------------------------------------------------------------
 Result<> ReadHDF5DatasetParameter::validate(const std::any& value) const
 {
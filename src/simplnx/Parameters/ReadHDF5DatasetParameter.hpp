@@ -117,6 +117,13 @@ public:
    */
   Result<> validate(const std::any& value) const override;
 
+  /**
+   * @brief Returns the HDF5 file that the datasets are read from.
+   * @param value
+   * @return std::vector<std::filesystem::path>
+   */
+  std::vector<std::filesystem::path> inputPaths(const std::any& value) const override;
+
 protected:
   /**
    * @brief Converts the given value to JSON.
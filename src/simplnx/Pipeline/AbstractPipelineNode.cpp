@@ -63,9 +63,25 @@ const DataStructure& AbstractPipelineNode::getDataStructure() const
   return m_DataStructure;
 }
 
+bool AbstractPipelineNode::hasResumableDataStructure() const
+{
+  return m_HasResumableDataStructure;
+}
+
 void AbstractPipelineNode::setDataStructure(const DataStructure& dataStructure)
 {
   m_DataStructure = dataStructure;
+  m_HasResumableDataStructure = true;
+  // Isolated snapshots keep later writes out of the stored DataStructure at the cost of copying the written pages
+  const auto* pipeline = dynamic_cast<const Pipeline*>(this);
+  if(pipeline == nullptr)
+  {
+    pipeline = m_Parent;
+  }
+  if(pipeline != nullptr && pipeline->isSnapshotIsolationEnabled())
+  {
+    m_DataStructure.detachDataStores();
+  }
 }
 
 void AbstractPipelineNode::checkDataStructureSize(DataStructure& dataStructure)
@@ -202,6 +202,14 @@ public:
    */
   const DataStructure& getDataStructure() const;
 
+  /**
+   * @brief Returns true if the stored DataStructure is the pipeline's state after
+   * executing this node, so the pipeline can be resumed from it. Returns false
+   * otherwise.
+   * @return bool
+   */
+  bool hasResumableDataStructure() const;
+
   /**
    * @brief Returns a const reference to the preflight DataStructure.
    * @return const DataStructure&
@@ -277,7 +285,10 @@ protected:
 
   /**
    * @brief Updates the stored DataStructure. This should only be called from
-   * within the execute(DataStructure&) method.
+   * within the execute(DataStructure&) method. If snapshot isolation is enabled
+   * on the pipeline, the stored DataStructure is a copy-on-write snapshot that is
+   * not affected by later writes to the provided DataStructure. Otherwise it
+   * shares its arrays with the provided DataStructure.
    * @param dataStructure
    */
   void setDataStructure(const DataStructure& dataStructure);
@@ -332,6 +343,7 @@ private:
   DataStructure m_DataStructure;
   DataStructure m_PreflightStructure;
   bool m_IsPreflighted = false;
+  bool m_HasResumableDataStructure = true;
   SignalType m_Signal;
   FaultState m_FaultState = FaultState::None;
   bool m_IsDisabled = false;
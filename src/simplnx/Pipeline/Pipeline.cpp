@@ -1,6 +1,7 @@
 #include "Pipeline.hpp"
 
 #include "simplnx/Core/Application.hpp"
+#include "simplnx/Filter/DataParameter.hpp"
 #include "simplnx/Filter/FilterHandle.hpp"
 #include "simplnx/Filter/FilterList.hpp"
 #include "simplnx/Pipeline/Messaging/NodeAddedMessage.hpp"
@@ -8,13 +9,19 @@
 #include "simplnx/Pipeline/Messaging/NodeRemovedMessage.hpp"
 #include "simplnx/Pipeline/Messaging/PipelineNodeMessage.hpp"
 #include "simplnx/Pipeline/PipelineFilter.hpp"
+#include "simplnx/Pipeline/PipelineResultCache.hpp"
 #include "simplnx/Pipeline/PlaceholderFilter.hpp"
+#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
 
 #include <nlohmann/json.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <filesystem>
 #include <fstream>
+#include <set>
 #include <stdexcept>
+#include <typeindex>
 
 using namespace nx::core;
 
@@ -57,6 +64,150 @@ nlohmann::json CreatePipelineJson(std::string_view name, nlohmann::json filterAr
 
   return jsonObject;
 }
+
+/**
+ * @brief DataPaths read and written by a single pipeline node. Barrier nodes
+ * could not be analyzed and are never run alongside other nodes.
+ */
+struct NodeDataAccess
+{
+  std::vector<DataPath> readPaths;
+  std::vector<DataPath> writePaths;
+  std::vector<std::filesystem::path> filePaths;
+  bool isBarrier = false;
+};
+
+/**
+ * @brief Returns true if one path is equal to or contains the other.
+ * @param lhs
+ * @param rhs
+ * @return bool
+ */
+bool PathsOverlap(const DataPath& lhs, const DataPath& rhs)
+{
+  usize length = std::min(lhs.getLength(), rhs.getLength());
+  for(usize i = 0; i < length; i++)
+  {
+    if(lhs[i] != rhs[i])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool AnyPathsOverlap(const std::vector<DataPath>& lhs, const std::vector<DataPath>& rhs)
+{
+  for(const auto& lhsPath : lhs)
+  {
+    for(const auto& rhsPath : rhs)
+    {
+      if(PathsOverlap(lhsPath, rhsPath))
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Returns true if the value argument type has no effect on data outside
+ * of the filter's DataPath arguments.
+ * @param value
+ * @return bool
+ */
+bool IsIndependentValue(const std::any& value)
+{
+  static const std::set<std::type_index> k_IndependentTypes = {
+      typeid(bool),        typeid(int8),         typeid(uint8),   typeid(int16),    typeid(uint16),   typeid(int32),
+      typeid(uint32),      typeid(int64),        typeid(uint64),  typeid(float32),  typeid(float64),  typeid(std::string),
+      typeid(DataType),    typeid(NumericType),  typeid(std::vector<int32>), typeid(std::vector<uint64>), typeid(std::vector<float32>),
+      typeid(std::vector<float64>), typeid(std::vector<std::vector<float64>>)};
+  return k_IndependentTypes.count(std::type_index(value.type())) > 0;
+}
+
+NodeDataAccess CollectDataAccess(const AbstractPipelineNode& node)
+{
+  NodeDataAccess access;
+  const auto* filterNode = dynamic_cast<const PipelineFilter*>(&node);
+  if(filterNode == nullptr || filterNode->getFilter() == nullptr || !filterNode->isPreflighted())
+  {
+    access.isBarrier = true;
+    return access;
+  }
+
+  const Parameters parameters = filterNode->getParameters();
+  const Arguments arguments = filterNode->getArguments();
+  for(const auto& [key, parameter] : parameters)
+  {
+    if(!arguments.contains(key) || !parameters.isParameterActive(key, arguments))
+    {
+      continue;
+    }
+    const std::any& value = arguments.at(key);
+    if(parameter->type() == IParameter::Type::Data)
+    {
+      const auto& dataParameter = dynamic_cast<const DataParameter&>(parameter.getRef());
+      auto& paths = dataParameter.mutability() == DataParameter::Mutability::Const ? access.readPaths : access.writePaths;
+      if(const auto* path = std::any_cast<DataPath>(&value); path != nullptr)
+      {
+        paths.push_back(*path);
+      }
+      else if(const auto* pathList = std::any_cast<std::vector<DataPath>>(&value); pathList != nullptr)
+      {
+        paths.insert(paths.end(), pathList->begin(), pathList->end());
+      }
+      else
+      {
+        access.isBarrier = true;
+      }
+    }
+    else if(const auto* filePath = std::any_cast<std::filesystem::path>(&value); filePath != nullptr)
+    {
+      access.filePaths.push_back(*filePath);
+    }
+    else if(!IsIndependentValue(value))
+    {
+      access.isBarrier = true;
+    }
+  }
+
+  // The HDF5 library is not thread safe
+  if(filterNode->usesHdf5Files())
+  {
+    access.isBarrier = true;
+  }
+
+  std::vector<DataPath> createdPaths = filterNode->getCreatedPaths();
+  access.writePaths.insert(access.writePaths.end(), createdPaths.begin(), createdPaths.end());
+  for(const auto& modification : filterNode->getDataObjectModificationNotifications())
+  {
+    access.writePaths.push_back(modification.modifiedPath);
+  }
+
+  if(access.readPaths.empty() && access.writePaths.empty())
+  {
+    access.isBarrier = true;
+  }
+  return access;
+}
+
+bool AccessesConflict(const NodeDataAccess& lhs, const NodeDataAccess& rhs)
+{
+  if(lhs.isBarrier || rhs.isBarrier)
+  {
+    return true;
+  }
+  for(const auto& lhsFile : lhs.filePaths)
+  {
+    if(std::find(rhs.filePaths.begin(), rhs.filePaths.end(), lhsFile) != rhs.filePaths.end())
+    {
+      return true;
+    }
+  }
+  return AnyPathsOverlap(lhs.writePaths, rhs.writePaths) || AnyPathsOverlap(lhs.writePaths, rhs.readPaths) || AnyPathsOverlap(lhs.readPaths, rhs.writePaths);
+}
 } // namespace
 
 Pipeline::Pipeline(const std::string& name, FilterList* filterList)
@@ -71,6 +222,10 @@ Pipeline::Pipeline(const Pipeline& other)
 , m_Name(other.m_Name)
 , m_Collection(other.m_Collection)
 , m_FilterList(other.m_FilterList)
+, m_ConcurrentExecution(other.m_ConcurrentExecution)
+, m_SnapshotIsolation(other.m_SnapshotIsolation)
+, m_ResultCache(other.m_ResultCache)
+, m_ExecutionContext(other.m_ExecutionContext)
 {
   resetCollectionParent();
 }
@@ -80,6 +235,10 @@ Pipeline::Pipeline(Pipeline&& other) noexcept
 , m_Name(std::move(other.m_Name))
 , m_Collection(std::move(other.m_Collection))
 , m_FilterList(std::move(other.m_FilterList))
+, m_ConcurrentExecution(other.m_ConcurrentExecution)
+, m_SnapshotIsolation(other.m_SnapshotIsolation)
+, m_ResultCache(std::move(other.m_ResultCache))
+, m_ExecutionContext(std::move(other.m_ExecutionContext))
 {
   resetCollectionParent();
 }
@@ -97,6 +256,10 @@ Pipeline& Pipeline::operator=(const Pipeline& rhs) noexcept
   m_Name = rhs.m_Name;
   m_Collection = rhs.m_Collection;
   m_FilterList = rhs.m_FilterList;
+  m_ConcurrentExecution = rhs.m_ConcurrentExecution;
+  m_SnapshotIsolation = rhs.m_SnapshotIsolation;
+  m_ResultCache = rhs.m_ResultCache;
+  m_ExecutionContext = rhs.m_ExecutionContext;
   resetCollectionParent();
   return *this;
 }
@@ -106,6 +269,10 @@ Pipeline& Pipeline::operator=(Pipeline&& rhs) noexcept
   m_Name = std::move(rhs.m_Name);
   m_Collection = std::move(rhs.m_Collection);
   m_FilterList = std::move(rhs.m_FilterList);
+  m_ConcurrentExecution = rhs.m_ConcurrentExecution;
+  m_SnapshotIsolation = rhs.m_SnapshotIsolation;
+  m_ResultCache = std::move(rhs.m_ResultCache);
+  m_ExecutionContext = std::move(rhs.m_ExecutionContext);
   resetCollectionParent();
   return *this;
 }
@@ -304,11 +471,33 @@ bool Pipeline::canExecuteFrom(index_type index) const
 }
 
 bool Pipeline::executeFrom(index_type index, DataStructure& dataStructure, const std::atomic_bool& shouldCancel)
+{
+  if(!m_ExecutionContext.has_value())
+  {
+    return executeInContextFrom(index, dataStructure, shouldCancel);
+  }
+  bool returnValue = false;
+  m_ExecutionContext->execute([&]() { returnValue = executeInContextFrom(index, dataStructure, shouldCancel); });
+  return returnValue;
+}
+
+bool Pipeline::executeInContextFrom(index_type index, DataStructure& dataStructure, const std::atomic_bool& shouldCancel)
 {
   if(!canExecuteFrom(index))
   {
     return false;
   }
+
+  std::vector<std::string> cacheKeys;
+  if(m_ResultCache != nullptr && m_ResultCache->isEnabled())
+  {
+    cacheKeys = PipelineResultCache::CreateKeys(*this);
+    if(index == 0 && dataStructure.getSize() == 0)
+    {
+      index = restoreFromResultCache(cacheKeys, dataStructure);
+    }
+  }
+
   bool returnValue = true;
   // Send notification that the pipeline is executing
   sendPipelineRunStateMessage(RunState::Executing);
@@ -324,29 +513,45 @@ bool Pipeline::executeFrom(index_type index, DataStructure& dataStructure, const
   }
 
   clearFaultState();
-  // Loop over each filter and execute the filter.
-  for(auto iter = begin() + index; iter != end(); iter++)
+  if(m_ConcurrentExecution)
   {
-    auto* filter = iter->get();
-    if(filter->isDisabled())
+    returnValue = executeConcurrentlyFrom(index, dataStructure, cacheKeys, shouldCancel);
+  }
+  else
+  {
+    // Loop over each filter and execute the filter.
+    for(auto iter = begin() + index; iter != end(); iter++)
     {
-      continue;
-    }
+      auto* filter = iter->get();
+      if(filter->isDisabled())
+      {
+        continue;
+      }
 
-    bool success = filter->execute(dataStructure, shouldCancel);
-    // Check if the filter was cancelled, and send out signal if it was.
-    if(shouldCancel)
-    {
-      sendCancelledMessage();
-      break;
-    }
+      const auto startTime = std::chrono::steady_clock::now();
+      bool success = filter->execute(dataStructure, shouldCancel);
+      const auto executionTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+      // Check if the filter was cancelled, and send out signal if it was.
+      if(shouldCancel)
+      {
+        sendCancelledMessage();
+        break;
+      }
 
-    setHasWarnings(filter->hasWarnings());
-    if(!success)
-    {
-      setHasErrors();
-      returnValue = false;
-      break;
+      setHasWarnings(filter->hasWarnings());
+      if(!success)
+      {
+        setHasErrors();
+        returnValue = false;
+        break;
+      }
+
+      const std::string& cacheKey = cacheKeys.empty() ? std::string{} : cacheKeys[iter - begin()];
+      if(!cacheKey.empty() && executionTime >= m_ResultCache->getMinimumExecutionTime())
+      {
+        // A failed cache write only means this node is executed again next time
+        m_ResultCache->store(cacheKey, dataStructure);
+      }
     }
   }
 
@@ -359,6 +564,74 @@ bool Pipeline::executeFrom(index_type index, DataStructure& dataStructure, const
   return returnValue;
 }
 
+void Pipeline::setConcurrentExecutionEnabled(bool enabled)
+{
+  m_ConcurrentExecution = enabled;
+}
+
+bool Pipeline::isConcurrentExecutionEnabled() const
+{
+  return m_ConcurrentExecution;
+}
+
+void Pipeline::setSnapshotIsolationEnabled(bool enabled)
+{
+  m_SnapshotIsolation = enabled;
+}
+
+bool Pipeline::isSnapshotIsolationEnabled() const
+{
+  return m_SnapshotIsolation;
+}
+
+void Pipeline::setResultCache(std::shared_ptr<PipelineResultCache> resultCache)
+{
+  m_ResultCache = std::move(resultCache);
+}
+
+std::shared_ptr<PipelineResultCache> Pipeline::getResultCache() const
+{
+  return m_ResultCache;
+}
+
+void Pipeline::setExecutionContext(std::optional<ExecutionContext> executionContext)
+{
+  m_ExecutionContext = std::move(executionContext);
+}
+
+std::optional<ExecutionContext> Pipeline::getExecutionContext() const
+{
+  return m_ExecutionContext;
+}
+
+Pipeline::index_type Pipeline::restoreFromResultCache(const std::vector<std::string>& cacheKeys, DataStructure& dataStructure)
+{
+  for(index_type cachedIndex = cacheKeys.size(); cachedIndex > 0; cachedIndex--)
+  {
+    const std::string& key = cacheKeys[cachedIndex - 1];
+    if(!m_ResultCache->contains(key))
+    {
+      continue;
+    }
+    Result<DataStructure> loadResult = m_ResultCache->load(key);
+    if(loadResult.invalid())
+    {
+      continue;
+    }
+    dataStructure = std::move(loadResult.value());
+    for(index_type restoredIndex = 0; restoredIndex < cachedIndex; restoredIndex++)
+    {
+      if(at(restoredIndex)->isEnabled())
+      {
+        at(restoredIndex)->sendFilterUpdateMessage(static_cast<int32>(restoredIndex), "Restored from cache");
+      }
+    }
+    at(cachedIndex - 1)->setDataStructure(dataStructure);
+    return cachedIndex;
+  }
+  return 0;
+}
+
 bool Pipeline::executeFrom(index_type index, const std::atomic_bool& shouldCancel)
 {
   if(index == 0)
@@ -371,10 +644,152 @@ bool Pipeline::executeFrom(index_type index, const std::atomic_bool& shouldCance
   }
 
   auto* node = at(index - 1);
+  if(!node->hasResumableDataStructure())
+  {
+    return false;
+  }
+  // Resume from a copy-on-write copy so the previous node's snapshot stays intact
   DataStructure dataStructure = node->getDataStructure();
+  dataStructure.detachDataStores();
   return executeFrom(index, dataStructure, shouldCancel);
 }
 
+bool Pipeline::executeConcurrentlyFrom(index_type index, DataStructure& dataStructure, const std::vector<std::string>& cacheKeys, const std::atomic_bool& shouldCancel)
+{
+  // Collect the enabled nodes and what each of them touches
+  std::vector<AbstractPipelineNode*> nodes;
+  std::vector<index_type> nodeIndices;
+  std::vector<NodeDataAccess> accesses;
+  for(auto iter = begin() + index; iter != end(); iter++)
+  {
+    auto* node = iter->get();
+    if(node->isDisabled())
+    {
+      continue;
+    }
+    nodes.push_back(node);
+    nodeIndices.push_back(iter - begin());
+    accesses.push_back(CollectDataAccess(*node));
+  }
+
+  // Each node runs one wave after the latest earlier node it conflicts with
+  std::vector<usize> levels(nodes.size(), 0);
+  usize numLevels = 0;
+  for(usize current = 0; current < nodes.size(); current++)
+  {
+    for(usize previous = 0; previous < current; previous++)
+    {
+      if(levels[previous] + 1 > levels[current] && AccessesConflict(accesses[previous], accesses[current]))
+      {
+        levels[current] = levels[previous] + 1;
+      }
+    }
+    numLevels = std::max(numLevels, levels[current] + 1);
+  }
+  std::vector<std::vector<usize>> waves(numLevels);
+  for(usize current = 0; current < nodes.size(); current++)
+  {
+    waves[levels[current]].push_back(current);
+  }
+
+  std::vector<bool> executed(nodes.size(), false);
+  usize numExecuted = 0;
+  usize prefixLength = 0;
+  auto prefixStartTime = std::chrono::steady_clock::now();
+  for(const auto& wave : waves)
+  {
+    bool success = true;
+    if(wave.size() == 1 || accesses[wave.front()].isBarrier)
+    {
+      for(usize nodeIndex : wave)
+      {
+        success = nodes[nodeIndex]->execute(dataStructure, shouldCancel) && success;
+      }
+    }
+    else
+    {
+      // Structural changes are applied in pipeline order, only the algorithms run concurrently
+      for(usize nodeIndex : wave)
+      {
+        dynamic_cast<PipelineFilter*>(nodes[nodeIndex])->executeBegin(dataStructure, shouldCancel);
+      }
+      {
+        // The tasks run on worker threads, which do not see the context installed on this thread
+        const ExecutionContext executionContext = ExecutionContext::Current();
+        ParallelTaskAlgorithm taskRunner;
+        for(usize nodeIndex : wave)
+        {
+          auto* filterNode = dynamic_cast<PipelineFilter*>(nodes[nodeIndex]);
+          taskRunner.execute([filterNode, &dataStructure, &shouldCancel, &executionContext]() {
+            executionContext.execute([&]() { filterNode->executeCompute(dataStructure, shouldCancel); });
+          });
+        }
+        taskRunner.wait();
+      }
+      for(usize nodeIndex : wave)
+      {
+        success = dynamic_cast<PipelineFilter*>(nodes[nodeIndex])->executeEnd(dataStructure) && success;
+      }
+    }
+
+    // The DataStructure only matches the serial pipeline's state after a node once every
+    // earlier node and no later node has executed. Other snapshots can not be resumed from.
+    for(usize nodeIndex : wave)
+    {
+      executed[nodeIndex] = true;
+    }
+    numExecuted += wave.size();
+    while(prefixLength < nodes.size() && executed[prefixLength])
+    {
+      prefixLength++;
+    }
+    const bool isPrefix = numExecuted == prefixLength;
+    for(usize nodeIndex : wave)
+    {
+      if(!isPrefix || nodeIndex + 1 != prefixLength)
+      {
+        nodes[nodeIndex]->clearDataStructure();
+        nodes[nodeIndex]->m_HasResumableDataStructure = false;
+      }
+    }
+    if(isPrefix)
+    {
+      nodes[prefixLength - 1]->setDataStructure(dataStructure);
+    }
+
+    // Check if the filters were cancelled, and send out signal if they were.
+    if(shouldCancel)
+    {
+      sendCancelledMessage();
+      return true;
+    }
+
+    for(usize nodeIndex : wave)
+    {
+      setHasWarnings(nodes[nodeIndex]->hasWarnings());
+    }
+    if(!success)
+    {
+      setHasErrors();
+      return false;
+    }
+
+    if(isPrefix)
+    {
+      const auto now = std::chrono::steady_clock::now();
+      const std::string& cacheKey = cacheKeys.empty() ? std::string{} : cacheKeys[nodeIndices[prefixLength - 1]];
+      if(!cacheKey.empty() && now - prefixStartTime >= m_ResultCache->getMinimumExecutionTime())
+      {
+        // A failed cache write only means these nodes are executed again next time
+        m_ResultCache->store(cacheKey, dataStructure);
+      }
+      prefixStartTime = now;
+    }
+  }
+
+  return true;
+}
+
 bool Pipeline::hasWarningsBeforeIndex(index_type index) const
 {
   for(usize i = 0; i < index; i++)
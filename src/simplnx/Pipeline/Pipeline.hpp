@@ -6,12 +6,16 @@
 #include "simplnx/Pipeline/AbstractPipelineNode.hpp"
 #include "simplnx/Pipeline/Messaging/PipelineNodeObserver.hpp"
 
+#include <memory>
+#include <optional>
+#include <string>
 #include <vector>
 
 namespace nx::core
 {
 class FilterHandle;
 class FilterList;
+class PipelineResultCache;
 
 /**
  * @class Pipeline
@@ -285,6 +289,82 @@ public:
    */
   bool executeFrom(index_type index, const std::atomic_bool& shouldCancel = false);
 
+  /**
+   * @brief Enables or disables concurrent execution of independent filters.
+   *
+   * When enabled, filters whose DataPath arguments, created paths and modified
+   * paths do not overlap are grouped together and their algorithms are run
+   * concurrently. Preflighting, OutputActions and notifications are still
+   * processed in pipeline order. Filters with arguments that cannot be analyzed
+   * and filters that read or write HDF5 files always run on their own. A node
+   * executed out of pipeline order does not keep its DataStructure snapshot and
+   * the pipeline can not be resumed after it. Filters that add or remove DataObjects from within
+   * their algorithm instead of through OutputActions must not be run with this
+   * option enabled. The pipeline must be preflighted before executing.
+   * Concurrent execution is disabled by default.
+   * @param enabled
+   */
+  void setConcurrentExecutionEnabled(bool enabled);
+
+  /**
+   * @brief Returns true if independent filters are executed concurrently.
+   * Returns false otherwise.
+   * @return bool
+   */
+  bool isConcurrentExecutionEnabled() const;
+
+  /**
+   * @brief Enables or disables isolated DataStructure snapshots.
+   *
+   * Every node keeps the DataStructure as it was after the node executed. By
+   * default these snapshots share their arrays with the DataStructure that
+   * the following filters write to. When enabled, each snapshot is made
+   * copy-on-write, so it keeps its values and every array page that a later
+   * filter writes to is copied once per snapshot. Snapshot isolation is
+   * disabled by default.
+   * @param enabled
+   */
+  void setSnapshotIsolationEnabled(bool enabled);
+
+  /**
+   * @brief Returns true if node snapshots are isolated from later writes.
+   * Returns false otherwise.
+   * @return bool
+   */
+  bool isSnapshotIsolationEnabled() const;
+
+  /**
+   * @brief Sets the cache used to store and restore node results. When an
+   * enabled cache is set and the pipeline is executed from the start with an empty
+   * DataStructure, execution resumes after the last node whose result is
+   * cached. Results of nodes executed serially are stored as they complete.
+   * Pass nullptr or a disabled cache to disable caching.
+   * @param resultCache
+   */
+  void setResultCache(std::shared_ptr<PipelineResultCache> resultCache);
+
+  /**
+   * @brief Returns the cache used to store and restore node results. Returns
+   * nullptr if caching is disabled.
+   * @return std::shared_ptr<PipelineResultCache>
+   */
+  std::shared_ptr<PipelineResultCache> getResultCache() const;
+
+  /**
+   * @brief Sets the context that the filters of this pipeline are executed in,
+   * which limits the threads the pipeline uses. Without a context the pipeline
+   * runs in ExecutionContext::Current() of the thread that executes it.
+   * @param executionContext
+   */
+  void setExecutionContext(std::optional<ExecutionContext> executionContext);
+
+  /**
+   * @brief Returns the context that the filters of this pipeline are executed in
+   * if one was set.
+   * @return std::optional<ExecutionContext>
+   */
+  std::optional<ExecutionContext> getExecutionContext() const;
+
   /**
    * @brief Returns the getSize of the pipeline segment.
    * @return usize
@@ -651,11 +731,50 @@ private:
    */
   bool hasErrorsBeforeIndex(index_type index) const;
 
+  /**
+   * @brief Executes the pipeline segment from the target index by grouping
+   * independent filters into waves and running each wave's algorithms
+   * concurrently. Only the last node of an executed pipeline prefix keeps its
+   * snapshot and stores its result in the cache. Returns true if all filters
+   * succeeded. Returns false otherwise.
+   * @param index
+   * @param dataStructure
+   * @param cacheKeys
+   * @param shouldCancel
+   * @return bool
+   */
+  bool executeConcurrentlyFrom(index_type index, DataStructure& dataStructure, const std::vector<std::string>& cacheKeys, const std::atomic_bool& shouldCancel);
+
+  /**
+   * @brief Executes the pipeline segment from the target index on the calling
+   * thread's current ExecutionContext. Returns true if all filters succeeded.
+   * Returns false otherwise.
+   * @param index
+   * @param dataStructure
+   * @param shouldCancel
+   * @return bool
+   */
+  bool executeInContextFrom(index_type index, DataStructure& dataStructure, const std::atomic_bool& shouldCancel);
+
+  /**
+   * @brief Replaces the DataStructure with the result of the last enabled node
+   * that is found in the result cache and returns the index to continue
+   * execution from. Returns 0 if no node's result is cached.
+   * @param cacheKeys
+   * @param dataStructure
+   * @return index_type
+   */
+  index_type restoreFromResultCache(const std::vector<std::string>& cacheKeys, DataStructure& dataStructure);
+
   ////////////
   // Variables
   std::string m_Name;
   collection_type m_Collection;
   FilterList* m_FilterList = nullptr;
   uint64 m_MemoryRequired = 0;
+  bool m_ConcurrentExecution = false;
+  bool m_SnapshotIsolation = false;
+  std::shared_ptr<PipelineResultCache> m_ResultCache;
+  std::optional<ExecutionContext> m_ExecutionContext;
 };
 } // namespace nx::core
@@ -0,0 +1,445 @@
+#include "PipelineBatch.hpp"
+
+#include "simplnx/Common/ScopeGuard.hpp"
+#include "simplnx/Pipeline/Pipeline.hpp"
+#include "simplnx/Pipeline/PipelineFilter.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+namespace fs = std::filesystem;
+using namespace nx::core;
+
+namespace
+{
+constexpr int32 k_ManifestFileError = -4650;
+constexpr int32 k_PipelineFileError = -4651;
+constexpr int32 k_MissingJobsError = -4652;
+constexpr int32 k_InvalidJobError = -4653;
+constexpr int32 k_InvalidOverrideError = -4654;
+constexpr int32 k_FilterIndexError = -4655;
+constexpr int32 k_ParameterKeyError = -4656;
+constexpr int32 k_PreflightJobError = -4657;
+constexpr int32 k_ExecuteJobError = -4658;
+constexpr int32 k_JobCancelledError = -4659;
+constexpr int32 k_JobExceptionError = -4660;
+
+constexpr StringLiteral k_PipelineItemsKey = "pipeline";
+constexpr StringLiteral k_ArgsKey = "args";
+constexpr StringLiteral k_ArgValueKey = "value";
+
+Result<nlohmann::json> ReadJsonFile(const fs::path& path, int32 errorCode)
+{
+  std::ifstream file(path);
+  if(!file.is_open())
+  {
+    return MakeErrorResult<nlohmann::json>(errorCode, fmt::format("Failed to open '{}'", path.string()));
+  }
+  nlohmann::json json = nlohmann::json::parse(file, nullptr, false);
+  if(json.is_discarded())
+  {
+    return MakeErrorResult<nlohmann::json>(errorCode, fmt::format("'{}' does not contain valid JSON", path.string()));
+  }
+  return {std::move(json)};
+}
+
+Result<PipelineBatch::Override> ParseOverride(const nlohmann::json& json, usize jobIndex)
+{
+  if(!json.is_object() || !json.contains(PipelineBatch::k_FilterIndexKey.view()) || !json.contains(PipelineBatch::k_ParameterKey.view()) ||
+     !json.contains(PipelineBatch::k_ValueKey.view()))
+  {
+    return MakeErrorResult<PipelineBatch::Override>(k_InvalidOverrideError, fmt::format("Job {}: every override requires the keys '{}', '{}' and '{}'", jobIndex,
+                                                                                         PipelineBatch::k_FilterIndexKey, PipelineBatch::k_ParameterKey, PipelineBatch::k_ValueKey));
+  }
+  const auto& filterIndexJson = json[PipelineBatch::k_FilterIndexKey];
+  const auto& parameterJson = json[PipelineBatch::k_ParameterKey];
+  if(!filterIndexJson.is_number_unsigned() || !parameterJson.is_string())
+  {
+    return MakeErrorResult<PipelineBatch::Override>(
+        k_InvalidOverrideError, fmt::format("Job {}: '{}' must be a non-negative integer and '{}' must be a string", jobIndex, PipelineBatch::k_FilterIndexKey, PipelineBatch::k_ParameterKey));
+  }
+
+  PipelineBatch::Override override;
+  override.filterIndex = filterIndexJson.get<usize>();
+  override.parameterKey = parameterJson.get<std::string>();
+  override.value = json[PipelineBatch::k_ValueKey];
+  return {std::move(override)};
+}
+
+/**
+ * @brief Collects the errors and warnings of every filter in the pipeline.
+ */
+Result<> CollectFilterResults(const Pipeline& pipeline)
+{
+  std::vector<Error> errors;
+  std::vector<Warning> warnings;
+  for(const auto& node : pipeline)
+  {
+    const auto* filterNode = dynamic_cast<const PipelineFilter*>(node.get());
+    if(filterNode == nullptr)
+    {
+      continue;
+    }
+    for(auto& error : filterNode->getErrors())
+    {
+      errors.push_back(std::move(error));
+    }
+    for(auto& warning : filterNode->getWarnings())
+    {
+      warnings.push_back(std::move(warning));
+    }
+  }
+  Result<> result;
+  if(!errors.empty())
+  {
+    result = {nonstd::make_unexpected(std::move(errors))};
+  }
+  result.warnings() = std::move(warnings);
+  return result;
+}
+
+Result<> MakeJobErrorResult(int32 code, std::string message, Result<> filterResults)
+{
+  Result<> result = MakeErrorResult(code, std::move(message));
+  return MergeResults(std::move(result), std::move(filterResults));
+}
+} // namespace
+
+/**
+ * @brief Admits jobs while their combined memory estimate fits in the budget.
+ */
+class PipelineBatch::MemoryGate
+{
+public:
+  explicit MemoryGate(uint64 memoryBudget)
+  : m_MemoryBudget(memoryBudget)
+  {
+  }
+
+  /**
+   * @brief Blocks until the memory fits next to the running jobs or no other job is running.
+   * Jobs are admitted in arrival order, so smaller jobs that arrive later can not keep a job
+   * that is larger than the budget from ever running alone.
+   */
+  void acquire(uint64 memory)
+  {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    const uint64 ticket = m_NextTicket++;
+    m_Condition.wait(lock, [this, ticket, memory]() {
+      return ticket == m_NextAdmittedTicket && (m_MemoryBudget == 0 || m_RunningJobs == 0 || m_ReservedMemory + memory <= m_MemoryBudget);
+    });
+    m_NextAdmittedTicket++;
+    m_ReservedMemory += memory;
+    m_RunningJobs++;
+    lock.unlock();
+    // The next job in line may fit as well
+    m_Condition.notify_all();
+  }
+
+  void release(uint64 memory)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      m_ReservedMemory -= memory;
+      m_RunningJobs--;
+    }
+    m_Condition.notify_all();
+  }
+
+private:
+  uint64 m_MemoryBudget = 0;
+  uint64 m_ReservedMemory = 0;
+  usize m_RunningJobs = 0;
+  uint64 m_NextTicket = 0;
+  uint64 m_NextAdmittedTicket = 0;
+  std::mutex m_Mutex;
+  std::condition_variable m_Condition;
+};
+
+Result<PipelineBatch> PipelineBatch::FromJson(nlohmann::json pipelineJson, const nlohmann::json& manifestJson)
+{
+  if(!pipelineJson.contains(k_PipelineItemsKey.view()) || !pipelineJson[k_PipelineItemsKey].is_array())
+  {
+    return MakeErrorResult<PipelineBatch>(k_PipelineFileError, fmt::format("Pipeline JSON did not contain the array '{}'", k_PipelineItemsKey));
+  }
+  if(!manifestJson.contains(k_JobsKey.view()) || !manifestJson[k_JobsKey].is_array())
+  {
+    return MakeErrorResult<PipelineBatch>(k_MissingJobsError, fmt::format("Manifest JSON did not contain the array '{}'", k_JobsKey));
+  }
+
+  PipelineBatch batch;
+  batch.m_PipelineJson = std::move(pipelineJson);
+  const auto& jobsJson = manifestJson[k_JobsKey];
+  for(usize jobIndex = 0; jobIndex < jobsJson.size(); jobIndex++)
+  {
+    const auto& jobJson = jobsJson[jobIndex];
+    if(!jobJson.is_object())
+    {
+      return MakeErrorResult<PipelineBatch>(k_InvalidJobError, fmt::format("Job {} is not a JSON object", jobIndex));
+    }
+
+    Job job;
+    job.name = fmt::format("Job {}", jobIndex);
+    if(jobJson.contains(k_JobNameKey.view()) && jobJson[k_JobNameKey].is_string())
+    {
+      job.name = jobJson[k_JobNameKey].get<std::string>();
+    }
+    if(jobJson.contains(k_OverridesKey.view()))
+    {
+      const auto& overridesJson = jobJson[k_OverridesKey];
+      if(!overridesJson.is_array())
+      {
+        return MakeErrorResult<PipelineBatch>(k_InvalidJobError, fmt::format("Job {}: '{}' must be an array", jobIndex, k_OverridesKey));
+      }
+      for(const auto& overrideJson : overridesJson)
+      {
+        Result<Override> overrideResult = ParseOverride(overrideJson, jobIndex);
+        if(overrideResult.invalid())
+        {
+          return ConvertInvalidResult<PipelineBatch>(std::move(overrideResult));
+        }
+        job.overrides.push_back(std::move(overrideResult.value()));
+      }
+    }
+    batch.m_Jobs.push_back(std::move(job));
+  }
+
+  // Check the overrides up front so a typo fails the batch instead of every job
+  for(usize jobIndex = 0; jobIndex < batch.m_Jobs.size(); jobIndex++)
+  {
+    Result<nlohmann::json> jsonResult = batch.createPipelineJson(jobIndex);
+    if(jsonResult.invalid())
+    {
+      return ConvertInvalidResult<PipelineBatch>(std::move(jsonResult));
+    }
+  }
+  return {std::move(batch)};
+}
+
+Result<PipelineBatch> PipelineBatch::FromFiles(const std::filesystem::path& pipelinePath, const std::filesystem::path& manifestPath)
+{
+  Result<nlohmann::json> pipelineResult = ReadJsonFile(pipelinePath, k_PipelineFileError);
+  if(pipelineResult.invalid())
+  {
+    return ConvertInvalidResult<PipelineBatch>(std::move(pipelineResult));
+  }
+  Result<nlohmann::json> manifestResult = ReadJsonFile(manifestPath, k_ManifestFileError);
+  if(manifestResult.invalid())
+  {
+    return ConvertInvalidResult<PipelineBatch>(std::move(manifestResult));
+  }
+  return FromJson(std::move(pipelineResult.value()), manifestResult.value());
+}
+
+const std::vector<PipelineBatch::Job>& PipelineBatch::getJobs() const
+{
+  return m_Jobs;
+}
+
+usize PipelineBatch::getMaxConcurrentJobs() const
+{
+  return m_MaxConcurrentJobs;
+}
+
+void PipelineBatch::setMaxConcurrentJobs(usize maxJobs)
+{
+  m_MaxConcurrentJobs = maxJobs;
+}
+
+uint64 PipelineBatch::getMemoryBudget() const
+{
+  return m_MemoryBudget;
+}
+
+void PipelineBatch::setMemoryBudget(uint64 memoryBudget)
+{
+  m_MemoryBudget = memoryBudget;
+}
+
+Result<nlohmann::json> PipelineBatch::createPipelineJson(usize jobIndex) const
+{
+  const Job& job = m_Jobs.at(jobIndex);
+  nlohmann::json pipelineJson = m_PipelineJson;
+  auto& filtersJson = pipelineJson[k_PipelineItemsKey];
+  for(const auto& override : job.overrides)
+  {
+    if(override.filterIndex >= filtersJson.size())
+    {
+      return MakeErrorResult<nlohmann::json>(k_FilterIndexError,
+                                             fmt::format("{}: filter index {} is out of range. The pipeline has {} filters", job.name, override.filterIndex, filtersJson.size()));
+    }
+    auto& argsJson = filtersJson[override.filterIndex][k_ArgsKey];
+    if(!argsJson.contains(override.parameterKey) || !argsJson[override.parameterKey].is_object())
+    {
+      return MakeErrorResult<nlohmann::json>(k_ParameterKeyError, fmt::format("{}: filter {} has no parameter '{}'", job.name, override.filterIndex, override.parameterKey));
+    }
+    // Only the value is replaced so the parameter keeps its version
+    argsJson[override.parameterKey][k_ArgValueKey] = override.value;
+  }
+  return {std::move(pipelineJson)};
+}
+
+PipelineBatch::JobReport PipelineBatch::executeJob(usize jobIndex, const std::atomic_bool& shouldCancel, MemoryGate& memoryGate) const
+{
+  JobReport report;
+  report.name = m_Jobs[jobIndex].name;
+  if(shouldCancel)
+  {
+    report.result = MakeErrorResult(k_JobCancelledError, fmt::format("{}: cancelled before it started", report.name));
+    return report;
+  }
+
+  Result<nlohmann::json> jsonResult = createPipelineJson(jobIndex);
+  if(jsonResult.invalid())
+  {
+    report.result = ConvertResult(std::move(jsonResult));
+    return report;
+  }
+  Result<Pipeline> pipelineResult = Pipeline::FromJson(jsonResult.value());
+  if(pipelineResult.invalid())
+  {
+    report.result = ConvertResult(std::move(pipelineResult));
+    return report;
+  }
+  Pipeline& pipeline = pipelineResult.value();
+
+  // Preflighting also records the largest DataStructure the pipeline creates along the way
+  auto startTime = std::chrono::steady_clock::now();
+  report.memoryRequired = pipeline.checkMemoryRequired();
+  report.preflightTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+  if(pipeline.hasErrors())
+  {
+    report.result = MakeJobErrorResult(k_PreflightJobError, fmt::format("{}: preflight failed", report.name), CollectFilterResults(pipeline));
+    return report;
+  }
+
+  bool succeeded = false;
+  {
+    memoryGate.acquire(report.memoryRequired);
+    // Released even if a filter throws so the remaining jobs are not blocked
+    auto memoryGuard = MakeScopeGuard([&memoryGate, memoryRequired = report.memoryRequired]() noexcept { memoryGate.release(memoryRequired); });
+    startTime = std::chrono::steady_clock::now();
+    succeeded = pipeline.execute(shouldCancel);
+    report.executeTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+  }
+
+  if(shouldCancel)
+  {
+    report.result = MakeErrorResult(k_JobCancelledError, fmt::format("{}: cancelled while executing", report.name));
+  }
+  else if(!succeeded)
+  {
+    report.result = MakeJobErrorResult(k_ExecuteJobError, fmt::format("{}: execution failed", report.name), CollectFilterResults(pipeline));
+  }
+  else
+  {
+    report.result = CollectFilterResults(pipeline);
+  }
+  return report;
+}
+
+std::vector<PipelineBatch::JobReport> PipelineBatch::execute(const std::atomic_bool& shouldCancel, const JobCallback& callback) const
+{
+  std::vector<JobReport> reports(m_Jobs.size());
+  if(m_Jobs.empty())
+  {
+    return reports;
+  }
+
+  usize numWorkers = m_MaxConcurrentJobs;
+  if(numWorkers == 0)
+  {
+    numWorkers = std::max<usize>(std::thread::hardware_concurrency(), 1);
+  }
+  numWorkers = std::min(numWorkers, m_Jobs.size());
+
+  MemoryGate memoryGate(m_MemoryBudget);
+  std::atomic<usize> nextJob = 0;
+  std::mutex callbackMutex;
+  auto runJobs = [&]() {
+    for(usize jobIndex = nextJob++; jobIndex < m_Jobs.size(); jobIndex = nextJob++)
+    {
+      // An exception escaping a worker thread would terminate the process, so it becomes the job's error
+      JobReport report;
+      try
+      {
+        report = executeJob(jobIndex, shouldCancel, memoryGate);
+      } catch(const std::exception& exception)
+      {
+        report = JobReport{};
+        report.name = m_Jobs[jobIndex].name;
+        report.result = MakeErrorResult(k_JobExceptionError, fmt::format("{}: an exception was thrown: {}", report.name, exception.what()));
+      } catch(...)
+      {
+        report = JobReport{};
+        report.name = m_Jobs[jobIndex].name;
+        report.result = MakeErrorResult(k_JobExceptionError, fmt::format("{}: an unknown exception was thrown", report.name));
+      }
+      std::lock_guard<std::mutex> lock(callbackMutex);
+      if(callback)
+      {
+        callback(report);
+      }
+      reports[jobIndex] = std::move(report);
+    }
+  };
+
+  // Jobs block while they wait for memory, so they run on their own threads instead of TBB tasks.
+  // The filters inside each job still share the TBB thread pool.
+  std::vector<std::thread> workers;
+  workers.reserve(numWorkers - 1);
+  for(usize i = 1; i < numWorkers; i++)
+  {
+    workers.emplace_back(runJobs);
+  }
+  runJobs();
+  for(auto& worker : workers)
+  {
+    worker.join();
+  }
+  return reports;
+}
+
+nlohmann::json PipelineBatch::CreateSummary(const std::vector<JobReport>& reports)
+{
+  nlohmann::json jobsJson = nlohmann::json::array();
+  usize failedJobs = 0;
+  for(const auto& report : reports)
+  {
+    nlohmann::json errorsJson = nlohmann::json::array();
+    if(report.result.invalid())
+    {
+      failedJobs++;
+      for(const auto& error : report.result.errors())
+      {
+        errorsJson.push_back({{"code", error.code}, {"message", error.message}});
+      }
+    }
+    nlohmann::json warningsJson = nlohmann::json::array();
+    for(const auto& warning : report.result.warnings())
+    {
+      warningsJson.push_back({{"code", warning.code}, {"message", warning.message}});
+    }
+
+    nlohmann::json jobJson;
+    jobJson["name"] = report.name;
+    jobJson["succeeded"] = report.result.valid();
+    jobJson["memory_required"] = report.memoryRequired;
+    jobJson["preflight_seconds"] = std::chrono::duration<float64>(report.preflightTime).count();
+    jobJson["execute_seconds"] = std::chrono::duration<float64>(report.executeTime).count();
+    jobJson["errors"] = std::move(errorsJson);
+    jobJson["warnings"] = std::move(warningsJson);
+    jobsJson.push_back(std::move(jobJson));
+  }
+
+  nlohmann::json summary;
+  summary["total_jobs"] = reports.size();
+  summary["failed_jobs"] = failedJobs;
+  summary[k_JobsKey] = std::move(jobsJson);
+  return summary;
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/StringLiteral.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @class PipelineBatch
+ * @brief The PipelineBatch class runs one pipeline many times with different
+ * parameter values inside a single process.
+ *
+ * The pipeline JSON is parsed once. Each job replaces the values of selected
+ * filter parameters, typically the input and output file paths, and runs as
+ * its own Pipeline instance. Up to getMaxConcurrentJobs() jobs run at the same
+ * time. Before a job executes, its peak memory is estimated by preflighting it
+ * and the job waits until the estimate fits in the memory budget next to the
+ * jobs that are already running. Jobs start in the order they are ready, so a
+ * job that exceeds the budget on its own runs as soon as the jobs ahead of it
+ * have finished. Filters that read or write HDF5 files are preflighted and
+ * executed one at a time across all jobs because the HDF5 library is not
+ * thread safe.
+ *
+ * The manifest lists the jobs:
+ * {
+ *   "jobs": [
+ *     {
+ *       "name": "Slice_1",
+ *       "overrides": [
+ *         { "filter_index": 0, "parameter": "input_file", "value": "Data/Slice_1.ang" }
+ *       ]
+ *     }
+ *   ]
+ * }
+ */
+class SIMPLNX_EXPORT PipelineBatch
+{
+public:
+  static constexpr StringLiteral k_JobsKey = "jobs";
+  static constexpr StringLiteral k_JobNameKey = "name";
+  static constexpr StringLiteral k_OverridesKey = "overrides";
+  static constexpr StringLiteral k_FilterIndexKey = "filter_index";
+  static constexpr StringLiteral k_ParameterKey = "parameter";
+  static constexpr StringLiteral k_ValueKey = "value";
+
+  /**
+   * @brief Replaces the value of one filter parameter.
+   */
+  struct Override
+  {
+    usize filterIndex = 0;
+    std::string parameterKey;
+    nlohmann::json value;
+  };
+
+  struct Job
+  {
+    std::string name;
+    std::vector<Override> overrides;
+  };
+
+  /**
+   * @brief Describes the outcome of one job. The times are zero for stages that did not run.
+   */
+  struct JobReport
+  {
+    std::string name;
+    Result<> result;
+    uint64 memoryRequired = 0;
+    std::chrono::milliseconds preflightTime = {};
+    std::chrono::milliseconds executeTime = {};
+  };
+
+  using JobCallback = std::function<void(const JobReport&)>;
+
+  PipelineBatch() = default;
+
+  /**
+   * @brief Creates a batch from the pipeline JSON and the manifest JSON.
+   * @param pipelineJson
+   * @param manifestJson
+   * @return Result<PipelineBatch>
+   */
+  static Result<PipelineBatch> FromJson(nlohmann::json pipelineJson, const nlohmann::json& manifestJson);
+
+  /**
+   * @brief Creates a batch from a .d3dpipeline file and a manifest file.
+   * @param pipelinePath
+   * @param manifestPath
+   * @return Result<PipelineBatch>
+   */
+  static Result<PipelineBatch> FromFiles(const std::filesystem::path& pipelinePath, const std::filesystem::path& manifestPath);
+
+  /**
+   * @brief Returns the jobs in manifest order.
+   * @return const std::vector<Job>&
+   */
+  const std::vector<Job>& getJobs() const;
+
+  /**
+   * @brief Returns the maximum number of jobs that run at the same time. 0 means one job per hardware thread.
+   * @return usize
+   */
+  usize getMaxConcurrentJobs() const;
+
+  /**
+   * @brief Sets the maximum number of jobs that run at the same time. 0 means one job per hardware thread.
+   * @param maxJobs
+   */
+  void setMaxConcurrentJobs(usize maxJobs);
+
+  /**
+   * @brief Returns the memory budget in bytes shared by the running jobs. 0 means unlimited.
+   * @return uint64
+   */
+  uint64 getMemoryBudget() const;
+
+  /**
+   * @brief Sets the memory budget in bytes shared by the running jobs. 0 means unlimited.
+   * @param memoryBudget
+   */
+  void setMemoryBudget(uint64 memoryBudget);
+
+  /**
+   * @brief Returns the pipeline JSON of the job with its overrides applied.
+   * @param jobIndex
+   * @return Result<nlohmann::json>
+   */
+  Result<nlohmann::json> createPipelineJson(usize jobIndex) const;
+
+  /**
+   * @brief Runs all jobs and returns their reports in manifest order. The callback
+   * is called once per job as soon as it finishes. Calls to the callback do not overlap.
+   * Jobs that have not started when shouldCancel is set are reported as cancelled.
+   * A job that throws is reported as failed with the exception message.
+   * @param shouldCancel
+   * @param callback
+   * @return std::vector<JobReport>
+   */
+  std::vector<JobReport> execute(const std::atomic_bool& shouldCancel = false, const JobCallback& callback = {}) const;
+
+  /**
+   * @brief Creates a JSON summary of the job reports with their timings and errors.
+   * @param reports
+   * @return nlohmann::json
+   */
+  static nlohmann::json CreateSummary(const std::vector<JobReport>& reports);
+
+private:
+  class MemoryGate;
+
+  /**
+   * @brief Creates, preflights and executes one job while holding its share of the memory budget.
+   */
+  JobReport executeJob(usize jobIndex, const std::atomic_bool& shouldCancel, MemoryGate& memoryGate) const;
+
+  nlohmann::json m_PipelineJson;
+  std::vector<Job> m_Jobs;
+  usize m_MaxConcurrentJobs = 0;
+  uint64 m_MemoryBudget = 0;
+};
+} // namespace nx::core
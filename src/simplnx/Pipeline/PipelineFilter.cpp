@@ -2,8 +2,10 @@
 
 #include "simplnx/Core/Application.hpp"
 #include "simplnx/Filter/FilterList.hpp"
+#include "simplnx/Filter/ValueParameter.hpp"
 #include "simplnx/Pipeline/Messaging/FilterPreflightMessage.hpp"
 #include "simplnx/Pipeline/Messaging/OutputRenamedMessage.hpp"
+#include "simplnx/Utilities/Parsing/HDF5/H5.hpp"
 
 #include <nlohmann/json.hpp>
 
@@ -142,6 +144,13 @@ bool PipelineFilter::preflight(DataStructure& dataStructure, const std::atomic_b
 
 bool PipelineFilter::preflight(DataStructure& dataStructure, RenamedPaths& renamedPaths, const std::atomic_bool& shouldCancel, bool allowRenaming)
 {
+  // Readers open their files while preflighting
+  std::unique_lock<std::recursive_mutex> hdf5Lock;
+  if(usesHdf5Files())
+  {
+    hdf5Lock = std::unique_lock<std::recursive_mutex>(HDF5::GetLibraryMutex());
+  }
+
   sendFilterRunStateMessage(m_Index, RunState::Preflighting);
 
   std::vector<DataPath> oldCreatedPaths = m_CreatedPaths;
@@ -236,6 +245,20 @@ bool PipelineFilter::preflight(DataStructure& dataStructure, RenamedPaths& renam
 
 // -----------------------------------------------------------------------------
 bool PipelineFilter::execute(DataStructure& dataStructure, const std::atomic_bool& shouldCancel)
+{
+  std::unique_lock<std::recursive_mutex> hdf5Lock;
+  if(usesHdf5Files())
+  {
+    hdf5Lock = std::unique_lock<std::recursive_mutex>(HDF5::GetLibraryMutex());
+  }
+
+  executeBegin(dataStructure, shouldCancel);
+  executeCompute(dataStructure, shouldCancel);
+  return executeEnd(dataStructure);
+}
+
+// -----------------------------------------------------------------------------
+void PipelineFilter::executeBegin(DataStructure& dataStructure, const std::atomic_bool& shouldCancel)
 {
   this->sendFilterRunStateMessage(m_Index, nx::core::RunState::Executing);
   this->sendFilterUpdateMessage(m_Index, "Begin");
@@ -243,18 +266,38 @@ bool PipelineFilter::execute(DataStructure& dataStructure, const std::atomic_boo
   m_Warnings.clear();
   m_Errors.clear();
   clearFaultState();
-
-  IFilter::MessageHandler messageHandler{[this](const IFilter::Message& message) { this->notifyFilterMessage(message); }};
+  m_ExecutionStage.reset();
 
   if(m_Filter == nullptr)
   {
     m_Errors.push_back(Error{-11, "This filter is just a placeholder! The original filter could not be found. See the filter comments for more details."});
+    return;
   }
 
+  IFilter::MessageHandler messageHandler{[this](const IFilter::Message& message) { this->notifyFilterMessage(message); }};
+  m_ExecutionStage = m_Filter->executeBegin(dataStructure, getArguments(), messageHandler, shouldCancel);
+}
+
+// -----------------------------------------------------------------------------
+void PipelineFilter::executeCompute(DataStructure& dataStructure, const std::atomic_bool& shouldCancel)
+{
+  if(m_Filter == nullptr || !m_ExecutionStage.has_value())
+  {
+    return;
+  }
+
+  IFilter::MessageHandler messageHandler{[this](const IFilter::Message& message) { this->notifyFilterMessage(message); }};
+  m_Filter->executeCompute(dataStructure, *m_ExecutionStage, this, messageHandler, shouldCancel);
+}
+
+// -----------------------------------------------------------------------------
+bool PipelineFilter::executeEnd(DataStructure& dataStructure)
+{
   IFilter::ExecuteResult result;
-  if(m_Filter != nullptr)
+  if(m_Filter != nullptr && m_ExecutionStage.has_value())
   {
-    result = m_Filter->execute(dataStructure, getArguments(), this, messageHandler, shouldCancel);
+    result = m_Filter->executeEnd(dataStructure, std::move(*m_ExecutionStage));
+    m_ExecutionStage.reset();
     m_Warnings = result.result.warnings();
     m_PreflightValues = std::move(result.outputValues);
     if(result.result.invalid())
@@ -292,6 +335,40 @@ std::vector<DataObjectModification> PipelineFilter::getDataObjectModificationNot
   return m_DataModifiedActions;
 }
 
+bool PipelineFilter::usesHdf5Files() const
+{
+  if(m_Filter == nullptr)
+  {
+    return false;
+  }
+
+  const Parameters parameters = m_Filter->parameters();
+  for(const auto& [key, parameter] : parameters)
+  {
+    const auto* valueParameter = dynamic_cast<const ValueParameter*>(parameter.get());
+    if(valueParameter == nullptr)
+    {
+      continue;
+    }
+    const std::any value = m_Arguments.contains(key) ? m_Arguments.at(key) : valueParameter->defaultValue();
+    std::vector<std::filesystem::path> filePaths;
+    try
+    {
+      filePaths = valueParameter->inputPaths(value);
+      std::vector<std::filesystem::path> outputPaths = valueParameter->outputPaths(value);
+      filePaths.insert(filePaths.end(), outputPaths.begin(), outputPaths.end());
+    } catch(const std::bad_any_cast&)
+    {
+      continue;
+    }
+    if(std::any_of(filePaths.begin(), filePaths.end(), HDF5::IsHdf5FilePath))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
 namespace
 {
 /**
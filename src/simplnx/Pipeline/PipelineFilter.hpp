@@ -5,6 +5,8 @@
 
 #include <nod/nod.hpp>
 
+#include <optional>
+
 namespace nx::core
 {
 class FilterHandle;
@@ -144,6 +146,33 @@ public:
    */
   bool execute(DataStructure& dataStructure, const std::atomic_bool& shouldCancel) override;
 
+  /**
+   * @brief First stage of execute(): sends the start notifications, preflights the filter and
+   * applies its regular OutputActions. Calling executeBegin(), executeCompute() and executeEnd()
+   * in order is equivalent to execute().
+   * @param dataStructure
+   * @param shouldCancel
+   */
+  void executeBegin(DataStructure& dataStructure, const std::atomic_bool& shouldCancel);
+
+  /**
+   * @brief Second stage of execute(): runs the filter's algorithm. This stage does not change the
+   * layout of the DataStructure unless the filter itself does so and may run concurrently with the
+   * compute stage of filters that work on disjoint data.
+   * @param dataStructure
+   * @param shouldCancel
+   */
+  void executeCompute(DataStructure& dataStructure, const std::atomic_bool& shouldCancel);
+
+  /**
+   * @brief Last stage of execute(): applies the deferred OutputActions, stores the results and
+   * sends the end notifications.
+   * Returns true if execution succeeded. Otherwise, this returns false.
+   * @param dataStructure
+   * @return bool
+   */
+  bool executeEnd(DataStructure& dataStructure);
+
   /**
    * @brief Returns a vector of DataPaths created when preflighting the node.
    * @return std::vector<DataPath>
@@ -156,6 +185,14 @@ public:
    */
   std::vector<DataObjectModification> getDataObjectModificationNotifications() const;
 
+  /**
+   * @brief Returns true if any of the filter's value arguments reads or writes
+   * an HDF5 file. Such filters are preflighted and executed while holding
+   * HDF5::GetLibraryMutex(). Returns false otherwise.
+   * @return bool
+   */
+  bool usesHdf5Files() const;
+
   /**
    * @brief Returns a collection of warnings returned by the target filter.
    * This collection is cleared when the node is preflighted or executed.
@@ -236,5 +273,6 @@ private:
   std::vector<IFilter::PreflightValue> m_PreflightValues;
   std::vector<DataPath> m_CreatedPaths;
   std::vector<DataObjectModification> m_DataModifiedActions;
+  std::optional<IFilter::ExecutionStage> m_ExecutionStage;
 };
 } // namespace nx::core
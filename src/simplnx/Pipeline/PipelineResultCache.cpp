@@ -0,0 +1,320 @@
+#include "PipelineResultCache.hpp"
+
+#include "simplnx/Pipeline/Pipeline.hpp"
+#include "simplnx/Filter/ValueParameter.hpp"
+#include "simplnx/Pipeline/PipelineFilter.hpp"
+#include "simplnx/Utilities/MD5.hpp"
+#include "simplnx/Utilities/Parsing/DREAM3D/Dream3dIO.hpp"
+#include "simplnx/Utilities/Parsing/HDF5/H5.hpp"
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <tuple>
+
+namespace fs = std::filesystem;
+using namespace nx::core;
+
+namespace
+{
+constexpr int32 k_CacheEntryMissing = -4600;
+constexpr int32 k_CreateCacheDirectoryError = -4601;
+constexpr int32 k_CacheDisabledError = -4602;
+constexpr int32 k_CacheEntryTooLargeError = -4603;
+
+/**
+ * @brief Returns a string describing the current state of every input file
+ * or directory the node's value parameters read from. Returns an empty
+ * optional if an input cannot be determined, in which case the node must
+ * not be cached.
+ * @param filter
+ * @param arguments
+ * @return std::optional<std::string>
+ */
+std::optional<std::string> CreateInputFileStamp(const IFilter& filter, const Arguments& arguments)
+{
+  std::string stamp;
+  const Parameters parameters = filter.parameters();
+  for(const auto& [key, parameter] : parameters)
+  {
+    const auto* valueParameter = dynamic_cast<const ValueParameter*>(parameter.get());
+    if(valueParameter == nullptr || !arguments.contains(key))
+    {
+      continue;
+    }
+
+    std::vector<fs::path> inputPaths;
+    try
+    {
+      inputPaths = valueParameter->inputPaths(arguments.at(key));
+    } catch(const std::bad_any_cast&)
+    {
+      return {};
+    }
+
+    for(const auto& inputPath : inputPaths)
+    {
+      std::error_code errorCode;
+      const fs::file_status status = fs::status(inputPath, errorCode);
+      const auto writeTime = fs::last_write_time(inputPath, errorCode);
+      const uintmax_t fileSize = fs::is_regular_file(status) ? fs::file_size(inputPath, errorCode) : 0;
+      stamp += fmt::format("{}:{}:{}:{}:{};", key, inputPath.string(), static_cast<int32>(status.type()), fileSize, writeTime.time_since_epoch().count());
+    }
+  }
+  return stamp;
+}
+
+/**
+ * @brief Returns true if any of the node's value parameters writes to a file
+ * or directory. Such nodes have side effects outside of the DataStructure, so
+ * restoring a cached result in their place would silently skip them.
+ * @param filter
+ * @param arguments
+ * @return bool
+ */
+bool WritesOutputFiles(const IFilter& filter, const Arguments& arguments)
+{
+  const Parameters parameters = filter.parameters();
+  for(const auto& [key, parameter] : parameters)
+  {
+    const auto* valueParameter = dynamic_cast<const ValueParameter*>(parameter.get());
+    if(valueParameter == nullptr)
+    {
+      continue;
+    }
+    const std::any value = arguments.contains(key) ? arguments.at(key) : valueParameter->defaultValue();
+    try
+    {
+      if(!valueParameter->outputPaths(value).empty())
+      {
+        return true;
+      }
+    } catch(const std::bad_any_cast&)
+    {
+      // An unreadable value may still name an output, so treat it as one
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Returns the size of every complete entry in the cache directory
+ * ordered from the least to the most recently used entry.
+ * @param cacheDirectory
+ * @return std::vector<std::pair<fs::path, uintmax_t>>
+ */
+std::vector<std::pair<fs::path, uintmax_t>> ListEntries(const fs::path& cacheDirectory)
+{
+  std::vector<std::tuple<fs::file_time_type, fs::path, uintmax_t>> entries;
+  std::error_code errorCode;
+  for(const auto& directoryEntry : fs::directory_iterator(cacheDirectory, errorCode))
+  {
+    const fs::path& entryPath = directoryEntry.path();
+    if(!directoryEntry.is_regular_file(errorCode) || entryPath.extension() != PipelineResultCache::k_Extension.view())
+    {
+      continue;
+    }
+    const uintmax_t fileSize = directoryEntry.file_size(errorCode);
+    if(errorCode)
+    {
+      continue;
+    }
+    const fs::file_time_type writeTime = directoryEntry.last_write_time(errorCode);
+    if(errorCode)
+    {
+      continue;
+    }
+    entries.emplace_back(writeTime, entryPath, fileSize);
+  }
+  std::sort(entries.begin(), entries.end());
+
+  std::vector<std::pair<fs::path, uintmax_t>> sortedEntries;
+  sortedEntries.reserve(entries.size());
+  for(auto& [writeTime, entryPath, fileSize] : entries)
+  {
+    sortedEntries.emplace_back(std::move(entryPath), fileSize);
+  }
+  return sortedEntries;
+}
+} // namespace
+
+PipelineResultCache::PipelineResultCache(std::filesystem::path cacheDirectory)
+: m_CacheDirectory(std::move(cacheDirectory))
+{
+}
+
+PipelineResultCache::~PipelineResultCache() noexcept = default;
+
+const std::filesystem::path& PipelineResultCache::getCacheDirectory() const
+{
+  return m_CacheDirectory;
+}
+
+std::chrono::milliseconds PipelineResultCache::getMinimumExecutionTime() const
+{
+  return m_MinimumExecutionTime;
+}
+
+void PipelineResultCache::setMinimumExecutionTime(std::chrono::milliseconds minimumTime)
+{
+  m_MinimumExecutionTime = minimumTime;
+}
+
+bool PipelineResultCache::isEnabled() const
+{
+  return m_Enabled;
+}
+
+void PipelineResultCache::setEnabled(bool enabled)
+{
+  m_Enabled = enabled;
+}
+
+uint64 PipelineResultCache::getMaximumSize() const
+{
+  return m_MaximumSize;
+}
+
+void PipelineResultCache::setMaximumSize(uint64 maximumSize)
+{
+  m_MaximumSize = maximumSize;
+}
+
+std::vector<std::string> PipelineResultCache::CreateKeys(const Pipeline& pipeline)
+{
+  std::vector<std::string> keys(pipeline.size());
+  std::string previousKey;
+  for(usize i = 0; i < pipeline.size(); i++)
+  {
+    const AbstractPipelineNode* node = pipeline.at(i);
+    if(node->isDisabled())
+    {
+      continue;
+    }
+
+    std::string description = previousKey;
+    const auto* filterNode = dynamic_cast<const PipelineFilter*>(node);
+    if(filterNode != nullptr && filterNode->getFilter() != nullptr)
+    {
+      const IFilter* filter = filterNode->getFilter();
+      const Arguments arguments = filterNode->getArguments();
+      std::optional<std::string> inputFileStamp = CreateInputFileStamp(*filter, arguments);
+      if(!inputFileStamp.has_value() || WritesOutputFiles(*filter, arguments))
+      {
+        // Every later node depends on this node's output, so none of them can be cached either
+        break;
+      }
+      description += filter->uuid().str();
+      description += filter->toJson(arguments).dump();
+      description += *inputFileStamp;
+    }
+    else
+    {
+      description += node->toJson().dump();
+    }
+
+    MD5 md5;
+    md5.update(description.data(), static_cast<MD5::size_type>(description.size()));
+    keys[i] = md5.finalize().hexdigest();
+    previousKey = keys[i];
+  }
+  return keys;
+}
+
+bool PipelineResultCache::contains(const std::string& key) const
+{
+  std::error_code errorCode;
+  return !key.empty() && fs::is_regular_file(entryPath(key), errorCode);
+}
+
+Result<DataStructure> PipelineResultCache::load(const std::string& key) const
+{
+  if(!contains(key))
+  {
+    return MakeErrorResult<DataStructure>(k_CacheEntryMissing, fmt::format("No cached result exists for key '{}' in '{}'", key, m_CacheDirectory.string()));
+  }
+  // Restoring an entry counts as a use so that it is evicted after entries that are not restored
+  std::error_code errorCode;
+  fs::last_write_time(entryPath(key), fs::file_time_type::clock::now(), errorCode);
+  const std::lock_guard<std::recursive_mutex> hdf5Lock(HDF5::GetLibraryMutex());
+  return DREAM3D::ImportDataStructureFromFile(entryPath(key), false);
+}
+
+Result<> PipelineResultCache::store(const std::string& key, const DataStructure& dataStructure) const
+{
+  if(!m_Enabled)
+  {
+    return MakeErrorResult(k_CacheDisabledError, fmt::format("The result cache in '{}' is not enabled", m_CacheDirectory.string()));
+  }
+  if(dataStructure.memoryUsage() > m_MaximumSize)
+  {
+    return MakeErrorResult(k_CacheEntryTooLargeError, fmt::format("The result for key '{}' is larger than the cache size limit of {} bytes", key, m_MaximumSize));
+  }
+
+  std::error_code errorCode;
+  fs::create_directories(m_CacheDirectory, errorCode);
+  if(errorCode)
+  {
+    return MakeErrorResult(k_CreateCacheDirectoryError, fmt::format("Could not create the cache directory '{}': {}", m_CacheDirectory.string(), errorCode.message()));
+  }
+
+  // Write to a temporary file first so an interrupted write never leaves a partial entry behind
+  const fs::path finalPath = entryPath(key);
+  fs::path tempPath = finalPath;
+  tempPath += ".tmp";
+  Result<> writeResult;
+  {
+    const std::lock_guard<std::recursive_mutex> hdf5Lock(HDF5::GetLibraryMutex());
+    writeResult = DREAM3D::WriteFile(tempPath, dataStructure);
+  }
+  if(writeResult.invalid())
+  {
+    fs::remove(tempPath, errorCode);
+    return writeResult;
+  }
+  fs::rename(tempPath, finalPath, errorCode);
+  if(errorCode)
+  {
+    fs::remove(tempPath, errorCode);
+    return {};
+  }
+  evictEntries(finalPath);
+  return {};
+}
+
+void PipelineResultCache::evictEntries(const std::filesystem::path& keepPath) const
+{
+  std::vector<std::pair<fs::path, uintmax_t>> entries = ListEntries(m_CacheDirectory);
+  uint64 totalSize = 0;
+  for(const auto& entry : entries)
+  {
+    totalSize += entry.second;
+  }
+
+  // The least recently used entries are removed first. The new entry is only
+  // removed if it exceeds the limit on its own.
+  std::error_code errorCode;
+  for(const auto& [entryPath, fileSize] : entries)
+  {
+    if(totalSize <= m_MaximumSize)
+    {
+      break;
+    }
+    if(entryPath == keepPath && fileSize <= m_MaximumSize)
+    {
+      continue;
+    }
+    if(fs::remove(entryPath, errorCode))
+    {
+      totalSize -= fileSize;
+    }
+  }
+}
+
+std::filesystem::path PipelineResultCache::entryPath(const std::string& key) const
+{
+  return m_CacheDirectory / fmt::format("{}{}", key, k_Extension.view());
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/StringLiteral.hpp"
+#include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace nx::core
+{
+class Pipeline;
+
+/**
+ * @class PipelineResultCache
+ * @brief The PipelineResultCache class stores the DataStructure produced by
+ * pipeline nodes in a directory on disk so that unchanged pipeline prefixes
+ * can be restored instead of executed again.
+ *
+ * Each node is identified by a key that hashes the key of the previous
+ * enabled node together with the node's filter and arguments. Input files
+ * and directories reported by ValueParameter::inputPaths() contribute their
+ * size and modification time. A node's key therefore only matches if the
+ * node and everything before it is unchanged. Nodes that write files or
+ * directories are never restored from the cache, so the keys stop there.
+ *
+ * Caching is opt-in: a cache does nothing until it is enabled. The total
+ * size of the entries on disk is bounded by the maximum size, and the least
+ * recently used entries are removed when a new entry exceeds it.
+ */
+class SIMPLNX_EXPORT PipelineResultCache
+{
+public:
+  static constexpr StringLiteral k_Extension = ".dream3d";
+  static constexpr uint64 k_DefaultMaximumSize = 10ULL * 1024 * 1024 * 1024; // 10 GiB
+
+  /**
+   * @brief Constructs a cache that stores its entries in the specified directory.
+   * The directory is created when the first entry is stored.
+   * @param cacheDirectory
+   */
+  explicit PipelineResultCache(std::filesystem::path cacheDirectory);
+
+  ~PipelineResultCache() noexcept;
+
+  PipelineResultCache(const PipelineResultCache&) = default;
+  PipelineResultCache(PipelineResultCache&&) noexcept = default;
+  PipelineResultCache& operator=(const PipelineResultCache&) = default;
+  PipelineResultCache& operator=(PipelineResultCache&&) noexcept = default;
+
+  /**
+   * @brief Returns the directory used to store the cache entries.
+   * @return const std::filesystem::path&
+   */
+  const std::filesystem::path& getCacheDirectory() const;
+
+  /**
+   * @brief Returns the minimum execution time for a node's output to be stored.
+   * @return std::chrono::milliseconds
+   */
+  std::chrono::milliseconds getMinimumExecutionTime() const;
+
+  /**
+   * @brief Sets the minimum execution time for a node's output to be stored.
+   * Nodes that execute faster than this are recomputed instead of being
+   * written to disk. Defaults to one second.
+   * @param minimumTime
+   */
+  void setMinimumExecutionTime(std::chrono::milliseconds minimumTime);
+
+  /**
+   * @brief Returns true if the pipeline should restore and store entries.
+   * @return bool
+   */
+  bool isEnabled() const;
+
+  /**
+   * @brief Enables or disables the cache. Disabled by default.
+   * @param enabled
+   */
+  void setEnabled(bool enabled);
+
+  /**
+   * @brief Returns the maximum total size in bytes of the entries on disk.
+   * @return uint64
+   */
+  uint64 getMaximumSize() const;
+
+  /**
+   * @brief Sets the maximum total size in bytes of the entries on disk.
+   * Results that are larger than this on their own are never stored.
+   * Defaults to k_DefaultMaximumSize.
+   * @param maximumSize
+   */
+  void setMaximumSize(uint64 maximumSize);
+
+  /**
+   * @brief Computes the cache key of every node in the pipeline. Disabled nodes
+   * receive an empty key. Nodes whose input files cannot be stamped or that
+   * write files, and every node after them, also receive an empty key and are
+   * never cached.
+   * @param pipeline
+   * @return std::vector<std::string>
+   */
+  static std::vector<std::string> CreateKeys(const Pipeline& pipeline);
+
+  /**
+   * @brief Returns true if an entry exists for the specified key.
+   * @param key
+   * @return bool
+   */
+  bool contains(const std::string& key) const;
+
+  /**
+   * @brief Reads the DataStructure stored for the specified key.
+   * @param key
+   * @return Result<DataStructure>
+   */
+  Result<DataStructure> load(const std::string& key) const;
+
+  /**
+   * @brief Writes the DataStructure for the specified key and removes the least
+   * recently used entries until the cache fits in its maximum size. Returns an
+   * error without writing if the cache is disabled or the DataStructure is
+   * larger than the maximum size.
+   * @param key
+   * @param dataStructure
+   * @return Result<>
+   */
+  Result<> store(const std::string& key, const DataStructure& dataStructure) const;
+
+private:
+  /**
+   * @brief Returns the file path of the entry for the specified key.
+   * @param key
+   * @return std::filesystem::path
+   */
+  std::filesystem::path entryPath(const std::string& key) const;
+
+  /**
+   * @brief Removes the least recently used entries until the total size of the
+   * entries fits in the maximum size.
+   * @param keepPath Entry that is only removed if it exceeds the maximum size on its own
+   */
+  void evictEntries(const std::filesystem::path& keepPath) const;
+
+  std::filesystem::path m_CacheDirectory;
+  std::chrono::milliseconds m_MinimumExecutionTime = std::chrono::seconds(1);
+  uint64 m_MaximumSize = k_DefaultMaximumSize;
+  bool m_Enabled = false;
+};
+} // namespace nx::core
@@ -0,0 +1,291 @@
+#include "ArrayThresholdEvaluator.hpp"
+
+#include "simplnx/DataStructure/IDataArray.hpp"
+#include "simplnx/Utilities/FilterUtilities.hpp"
+
+using namespace nx::core;
+
+class ArrayThresholdEvaluator::Comparison
+{
+public:
+  Comparison() = default;
+  virtual ~Comparison() noexcept = default;
+
+  Comparison(const Comparison&) = delete;
+  Comparison(Comparison&&) noexcept = delete;
+  Comparison& operator=(const Comparison&) = delete;
+  Comparison& operator=(Comparison&&) noexcept = delete;
+
+  virtual void evaluate(usize startTuple, MaskSpan mask) const = 0;
+};
+
+namespace
+{
+template <typename T>
+class TypedComparison : public ArrayThresholdEvaluator::Comparison
+{
+public:
+  TypedComparison(const AbstractDataStore<T>& inputStore, ArrayThreshold::ComparisonType comparisonType, ArrayThreshold::ComparisonValue comparisonValue)
+  : m_InputStore(inputStore)
+  , m_ComparisonType(comparisonType)
+  , m_ComparisonValue(static_cast<T>(comparisonValue))
+  {
+  }
+
+  ~TypedComparison() noexcept override = default;
+
+  void evaluate(usize startTuple, ArrayThresholdEvaluator::MaskSpan mask) const override
+  {
+    std::array<T, ArrayThresholdEvaluator::k_TileSize> values = {};
+    const usize count = std::min(mask.size(), values.size());
+    m_InputStore.copyIntoBuffer(startTuple, nonstd::span<T>(values.data(), count));
+
+    switch(m_ComparisonType)
+    {
+    case ArrayThreshold::ComparisonType::GreaterThan:
+      compare(values, mask, count, [](T value, T comparisonValue) { return value > comparisonValue; });
+      break;
+    case ArrayThreshold::ComparisonType::LessThan:
+      compare(values, mask, count, [](T value, T comparisonValue) { return value < comparisonValue; });
+      break;
+    case ArrayThreshold::ComparisonType::Operator_Equal:
+      compare(values, mask, count, [](T value, T comparisonValue) { return value == comparisonValue; });
+      break;
+    case ArrayThreshold::ComparisonType::Operator_NotEqual:
+      compare(values, mask, count, [](T value, T comparisonValue) { return value != comparisonValue; });
+      break;
+    }
+  }
+
+private:
+  template <typename CompareFunc>
+  void compare(const std::array<T, ArrayThresholdEvaluator::k_TileSize>& values, ArrayThresholdEvaluator::MaskSpan mask, usize count, CompareFunc&& compareFunc) const
+  {
+    const T comparisonValue = m_ComparisonValue;
+    for(usize i = 0; i < count; i++)
+    {
+      mask[i] = static_cast<uint8>(compareFunc(values[i], comparisonValue));
+    }
+  }
+
+  const AbstractDataStore<T>& m_InputStore;
+  ArrayThreshold::ComparisonType m_ComparisonType;
+  T m_ComparisonValue;
+};
+
+struct CreateComparisonFunctor
+{
+  template <typename T>
+  std::shared_ptr<const ArrayThresholdEvaluator::Comparison> operator()(const IDataArray& inputArray, const ArrayThreshold& threshold)
+  {
+    const auto& inputStore = inputArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
+    return std::make_shared<TypedComparison<T>>(inputStore, threshold.getComparisonType(), threshold.getComparisonValue());
+  }
+};
+
+class CreateBitMaskImpl
+{
+public:
+  CreateBitMaskImpl(const ArrayThresholdEvaluator& evaluator, std::vector<uint64>& bitMask, const std::atomic_bool& shouldCancel)
+  : m_Evaluator(evaluator)
+  , m_BitMask(bitMask)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    constexpr usize k_WordsPerTile = ArrayThresholdEvaluator::k_TileSize / ArrayThresholdEvaluator::k_BitsPerWord;
+    const usize numTuples = m_Evaluator.getNumberOfTuples();
+    std::array<uint8, ArrayThresholdEvaluator::k_TileSize> mask = {};
+    for(usize tile = range.min(); tile < range.max(); tile++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      const usize startTuple = tile * ArrayThresholdEvaluator::k_TileSize;
+      const usize count = std::min(ArrayThresholdEvaluator::k_TileSize, numTuples - startTuple);
+      m_Evaluator.evaluate(startTuple, ArrayThresholdEvaluator::MaskSpan(mask.data(), count));
+
+      // Tiles are a whole number of words so every word is written by exactly one task
+      for(usize i = 0; i < count; i++)
+      {
+        m_BitMask[tile * k_WordsPerTile + i / ArrayThresholdEvaluator::k_BitsPerWord] |= static_cast<uint64>(mask[i]) << (i % ArrayThresholdEvaluator::k_BitsPerWord);
+      }
+    }
+  }
+
+private:
+  const ArrayThresholdEvaluator& m_Evaluator;
+  std::vector<uint64>& m_BitMask;
+  const std::atomic_bool& m_ShouldCancel;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+Result<ArrayThresholdEvaluator> ArrayThresholdEvaluator::Create(const ArrayThresholdSet& thresholds, const DataStructure& dataStructure)
+{
+  std::set<DataPath> thresholdPaths = thresholds.getRequiredPaths();
+  if(thresholdPaths.empty())
+  {
+    return MakeErrorResult<ArrayThresholdEvaluator>(k_EmptyThresholdsError, "No data arrays were found for calculating threshold");
+  }
+
+  ArrayThresholdEvaluator evaluator;
+  bool firstArray = true;
+  for(const auto& path : thresholdPaths)
+  {
+    const auto* inputArray = dataStructure.getDataAs<IDataArray>(path);
+    if(inputArray == nullptr)
+    {
+      return MakeErrorResult<ArrayThresholdEvaluator>(k_MissingArrayError, fmt::format("Could not find DataArray at path {}.", path.toString()));
+    }
+    if(inputArray->getNumberOfComponents() != 1)
+    {
+      return MakeErrorResult<ArrayThresholdEvaluator>(k_NonScalarArrayError, fmt::format("Data Array is not a Scalar Data Array. Data Arrays must only have a single component. '{}:{}'",
+                                                                                         path.toString(), inputArray->getNumberOfComponents()));
+    }
+    if(firstArray)
+    {
+      evaluator.m_NumTuples = inputArray->getNumberOfTuples();
+      firstArray = false;
+    }
+    else if(inputArray->getNumberOfTuples() != evaluator.m_NumTuples)
+    {
+      return MakeErrorResult<ArrayThresholdEvaluator>(k_UnequalTuplesError, fmt::format("Data Arrays do not have same equal number of tuples. '{}:{}' and '{}:{}'", thresholdPaths.begin()->toString(),
+                                                                                        evaluator.m_NumTuples, path.toString(), inputArray->getNumberOfTuples()));
+    }
+    evaluator.m_InputStores.push_back(inputArray->getIDataStore());
+  }
+
+  Result<usize> rootResult = evaluator.compile(thresholds, dataStructure);
+  if(rootResult.invalid())
+  {
+    return ConvertInvalidResult<ArrayThresholdEvaluator>(std::move(rootResult));
+  }
+  return {std::move(evaluator)};
+}
+
+// -----------------------------------------------------------------------------
+ArrayThresholdEvaluator::~ArrayThresholdEvaluator() noexcept = default;
+
+// -----------------------------------------------------------------------------
+usize ArrayThresholdEvaluator::getNumberOfTuples() const
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+const IParallelAlgorithm::AlgorithmStores& ArrayThresholdEvaluator::getInputStores() const
+{
+  return m_InputStores;
+}
+
+// -----------------------------------------------------------------------------
+Result<usize> ArrayThresholdEvaluator::compile(const IArrayThreshold& threshold, const DataStructure& dataStructure)
+{
+  const usize nodeIndex = m_Nodes.size();
+  m_Nodes.push_back({nullptr, {}, threshold.getUnionOperator(), threshold.isInverted()});
+
+  if(const auto* arrayThreshold = dynamic_cast<const ArrayThreshold*>(&threshold); arrayThreshold != nullptr)
+  {
+    const auto* inputArray = dataStructure.getDataAs<IDataArray>(arrayThreshold->getArrayPath());
+    if(inputArray == nullptr)
+    {
+      return MakeErrorResult<usize>(k_MissingArrayError, fmt::format("Could not find DataArray at path {}.", arrayThreshold->getArrayPath().toString()));
+    }
+    m_Nodes[nodeIndex].comparison = ExecuteDataFunction(CreateComparisonFunctor{}, inputArray->getDataType(), *inputArray, *arrayThreshold);
+  }
+  else if(const auto* thresholdSet = dynamic_cast<const ArrayThresholdSet*>(&threshold); thresholdSet != nullptr)
+  {
+    std::vector<usize> children;
+    for(const auto& child : thresholdSet->getArrayThresholds())
+    {
+      if(child == nullptr)
+      {
+        continue;
+      }
+      Result<usize> childResult = compile(*child, dataStructure);
+      if(childResult.invalid())
+      {
+        return childResult;
+      }
+      children.push_back(childResult.value());
+    }
+    // compile() appends to m_Nodes so the node is only looked up again once the children are done
+    m_Nodes[nodeIndex].children = std::move(children);
+  }
+
+  return {nodeIndex};
+}
+
+// -----------------------------------------------------------------------------
+void ArrayThresholdEvaluator::evaluate(usize startTuple, MaskSpan mask) const
+{
+  for(usize offset = 0; offset < mask.size(); offset += k_TileSize)
+  {
+    evaluateNode(0, startTuple + offset, mask.subspan(offset, std::min(k_TileSize, mask.size() - offset)));
+  }
+}
+
+// -----------------------------------------------------------------------------
+void ArrayThresholdEvaluator::evaluateNode(usize nodeIndex, usize startTuple, MaskSpan mask) const
+{
+  const Node& node = m_Nodes[nodeIndex];
+  if(node.comparison != nullptr)
+  {
+    node.comparison->evaluate(startTuple, mask);
+  }
+  else if(node.children.empty())
+  {
+    std::fill(mask.begin(), mask.end(), static_cast<uint8>(0));
+  }
+  else
+  {
+    evaluateNode(node.children.front(), startTuple, mask);
+
+    std::array<uint8, k_TileSize> childMask = {};
+    MaskSpan childSpan(childMask.data(), mask.size());
+    for(usize i = 1; i < node.children.size(); i++)
+    {
+      const usize childIndex = node.children[i];
+      evaluateNode(childIndex, startTuple, childSpan);
+      if(m_Nodes[childIndex].unionOperator == IArrayThreshold::UnionOperator::Or)
+      {
+        for(usize j = 0; j < mask.size(); j++)
+        {
+          mask[j] |= childSpan[j];
+        }
+      }
+      else
+      {
+        for(usize j = 0; j < mask.size(); j++)
+        {
+          mask[j] &= childSpan[j];
+        }
+      }
+    }
+  }
+
+  if(node.inverted)
+  {
+    for(uint8& value : mask)
+    {
+      value ^= 1;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+std::vector<uint64> ArrayThresholdEvaluator::createBitMask(const std::atomic_bool& shouldCancel) const
+{
+  std::vector<uint64> bitMask((m_NumTuples + k_BitsPerWord - 1) / k_BitsPerWord, 0);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, GetNumberOfTiles(m_NumTuples));
+  dataAlg.setGrainSize(1);
+  dataAlg.requireStoresInMemory(m_InputStores);
+  dataAlg.execute(CreateBitMaskImpl(*this, bitMask, shouldCancel));
+  return bitMask;
+}
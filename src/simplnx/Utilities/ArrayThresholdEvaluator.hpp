@@ -0,0 +1,199 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/Utilities/ArrayThreshold.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <fmt/format.h>
+#include <nonstd/span.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @brief ArrayThresholdEvaluator compiles an ArrayThresholdSet into a single predicate that is
+ * evaluated tuple by tuple. The tuples are processed in tiles of k_TileSize: every comparison reads
+ * its tile of the input array once and the results are combined in place, so no array sized
+ * temporaries are created and the tiles can be evaluated in parallel.
+ *
+ * The children of a set are combined from top to bottom. The first child provides the starting
+ * value and every following child is combined using its own union operator. A threshold or set
+ * that is inverted has its result negated before it is combined with its siblings.
+ */
+class SIMPLNX_EXPORT ArrayThresholdEvaluator
+{
+public:
+  static inline constexpr usize k_TileSize = 4096;
+  static inline constexpr usize k_BitsPerWord = 64;
+
+  static inline constexpr int32 k_MissingArrayError = -4810;
+  static inline constexpr int32 k_NonScalarArrayError = -4811;
+  static inline constexpr int32 k_UnequalTuplesError = -4812;
+  static inline constexpr int32 k_EmptyThresholdsError = -4813;
+  static inline constexpr int32 k_MaskSizeMismatchError = -4814;
+
+  using MaskSpan = nonstd::span<uint8>;
+
+  /**
+   * @brief Compiles the threshold set. All of the arrays it references must exist, be scalar and
+   * have the same number of tuples.
+   * @param thresholds
+   * @param dataStructure
+   * @return Result<ArrayThresholdEvaluator>
+   */
+  static Result<ArrayThresholdEvaluator> Create(const ArrayThresholdSet& thresholds, const DataStructure& dataStructure);
+
+  ArrayThresholdEvaluator(const ArrayThresholdEvaluator&) = default;
+  ArrayThresholdEvaluator(ArrayThresholdEvaluator&&) noexcept = default;
+  ArrayThresholdEvaluator& operator=(const ArrayThresholdEvaluator&) = default;
+  ArrayThresholdEvaluator& operator=(ArrayThresholdEvaluator&&) noexcept = default;
+  ~ArrayThresholdEvaluator() noexcept;
+
+  /**
+   * @brief Returns the number of tuples the thresholds are evaluated over.
+   * @return usize
+   */
+  usize getNumberOfTuples() const;
+
+  /**
+   * @brief Returns the stores of all the arrays the thresholds read.
+   * @return IParallelAlgorithm::AlgorithmStores
+   */
+  const IParallelAlgorithm::AlgorithmStores& getInputStores() const;
+
+  /**
+   * @brief Evaluates the tuples [startTuple, startTuple + mask.size()) and writes 1 into mask for
+   * every tuple that passes the thresholds and 0 for every other tuple.
+   * @param startTuple
+   * @param mask
+   */
+  void evaluate(usize startTuple, MaskSpan mask) const;
+
+  /**
+   * @brief Evaluates every tuple in parallel and writes trueValue or falseValue into the mask store.
+   * @param maskStore
+   * @param trueValue
+   * @param falseValue
+   * @param shouldCancel
+   * @return Result<>
+   */
+  template <typename T>
+  Result<> fillMask(AbstractDataStore<T>& maskStore, T trueValue, T falseValue, const std::atomic_bool& shouldCancel = false) const
+  {
+    if(maskStore.getSize() != getNumberOfTuples())
+    {
+      return MakeErrorResult(k_MaskSizeMismatchError, fmt::format("The mask store holds {} values but the thresholds are evaluated over {} tuples", maskStore.getSize(), getNumberOfTuples()));
+    }
+
+    IParallelAlgorithm::AlgorithmStores stores = getInputStores();
+    stores.push_back(&maskStore);
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, GetNumberOfTiles(getNumberOfTuples()));
+    dataAlg.setGrainSize(1);
+    dataAlg.requireStoresInMemory(stores);
+    dataAlg.execute(FillMaskImpl<T>(*this, maskStore, trueValue, falseValue, shouldCancel));
+    return {};
+  }
+
+  /**
+   * @brief Evaluates every tuple in parallel and returns the result packed into bits. Tuple i is
+   * stored in bit (i % k_BitsPerWord) of word (i / k_BitsPerWord). This uses an eighth of the
+   * memory of a boolean mask.
+   * @param shouldCancel
+   * @return std::vector<uint64>
+   */
+  std::vector<uint64> createBitMask(const std::atomic_bool& shouldCancel = false) const;
+
+  /**
+   * @brief Returns true if bit i of a mask created by createBitMask() is set.
+   * @param bitMask
+   * @param i
+   * @return bool
+   */
+  static bool TestBit(const std::vector<uint64>& bitMask, usize i)
+  {
+    return ((bitMask[i / k_BitsPerWord] >> (i % k_BitsPerWord)) & 1) != 0;
+  }
+
+  /**
+   * @brief Evaluates a single ArrayThreshold. Implemented for every DataType in the source file.
+   */
+  class Comparison;
+
+private:
+  struct Node
+  {
+    std::shared_ptr<const Comparison> comparison;
+    std::vector<usize> children;
+    IArrayThreshold::UnionOperator unionOperator = IArrayThreshold::UnionOperator::And;
+    bool inverted = false;
+  };
+
+  ArrayThresholdEvaluator() = default;
+
+  static usize GetNumberOfTiles(usize numTuples)
+  {
+    return (numTuples + k_TileSize - 1) / k_TileSize;
+  }
+
+  Result<usize> compile(const IArrayThreshold& threshold, const DataStructure& dataStructure);
+  void evaluateNode(usize nodeIndex, usize startTuple, MaskSpan mask) const;
+
+  template <typename T>
+  class FillMaskImpl
+  {
+  public:
+    FillMaskImpl(const ArrayThresholdEvaluator& evaluator, AbstractDataStore<T>& maskStore, T trueValue, T falseValue, const std::atomic_bool& shouldCancel)
+    : m_Evaluator(evaluator)
+    , m_MaskStore(maskStore)
+    , m_TrueValue(trueValue)
+    , m_FalseValue(falseValue)
+    , m_ShouldCancel(shouldCancel)
+    {
+    }
+
+    void operator()(const Range& range) const
+    {
+      const usize numTuples = m_Evaluator.getNumberOfTuples();
+      std::array<uint8, k_TileSize> mask = {};
+      std::array<T, k_TileSize> values = {};
+      for(usize tile = range.min(); tile < range.max(); tile++)
+      {
+        if(m_ShouldCancel)
+        {
+          return;
+        }
+        const usize startTuple = tile * k_TileSize;
+        const usize count = std::min(k_TileSize, numTuples - startTuple);
+        m_Evaluator.evaluate(startTuple, MaskSpan(mask.data(), count));
+        for(usize i = 0; i < count; i++)
+        {
+          values[i] = mask[i] != 0 ? m_TrueValue : m_FalseValue;
+        }
+        m_MaskStore.copyFromBuffer(startTuple, nonstd::span<const T>(values.data(), count));
+      }
+    }
+
+  private:
+    const ArrayThresholdEvaluator& m_Evaluator;
+    AbstractDataStore<T>& m_MaskStore;
+    T m_TrueValue;
+    T m_FalseValue;
+    const std::atomic_bool& m_ShouldCancel;
+  };
+
+  std::vector<Node> m_Nodes;
+  IParallelAlgorithm::AlgorithmStores m_InputStores;
+  usize m_NumTuples = 0;
+};
+} // namespace nx::core
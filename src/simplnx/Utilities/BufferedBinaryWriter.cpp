@@ -0,0 +1,148 @@
+#include "BufferedBinaryWriter.hpp"
+
+#include "simplnx/Utilities/FilterUtilities.hpp"
+
+#include <algorithm>
+
+using namespace nx::core;
+
+namespace
+{
+constexpr int32 k_WriteBlockError = -10180;
+
+struct WriteDataStoreFunctor
+{
+  template <typename T>
+  Result<> operator()(BufferedBinaryWriter& writer, const IDataStore& dataStore, endian byteOrder, const std::atomic_bool& shouldCancel)
+  {
+    return writer.writeValues(dynamic_cast<const AbstractDataStore<T>&>(dataStore), byteOrder, shouldCancel);
+  }
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+BufferedBinaryWriter::BufferedBinaryWriter(FILE* outputFile, usize blockSize)
+: m_OutputFile(outputFile)
+, m_BlockSize(std::max(blockSize, sizeof(uint64)))
+{
+  m_Blocks[0].reset(new std::byte[m_BlockSize]);
+  m_Blocks[1].reset(new std::byte[m_BlockSize]);
+}
+
+// -----------------------------------------------------------------------------
+BufferedBinaryWriter::BufferedBinaryWriter(std::ostream& outputStream, usize blockSize)
+: m_OutputStream(&outputStream)
+, m_BlockSize(std::max(blockSize, sizeof(uint64)))
+{
+  m_Blocks[0].reset(new std::byte[m_BlockSize]);
+  m_Blocks[1].reset(new std::byte[m_BlockSize]);
+}
+
+// -----------------------------------------------------------------------------
+BufferedBinaryWriter::~BufferedBinaryWriter() noexcept
+{
+  flush();
+}
+
+// -----------------------------------------------------------------------------
+Result<> BufferedBinaryWriter::write(const void* data, usize size)
+{
+  const auto* bytes = static_cast<const std::byte*>(data);
+  while(size > 0)
+  {
+    if(m_BlockFill == m_BlockSize)
+    {
+      Result<> submitResult = submitBlock();
+      if(submitResult.invalid())
+      {
+        return submitResult;
+      }
+    }
+    const usize count = std::min(size, m_BlockSize - m_BlockFill);
+    std::memcpy(m_Blocks[m_CurrentBlock].get() + m_BlockFill, bytes, count);
+    m_BlockFill += count;
+    bytes += count;
+    size -= count;
+  }
+  return {};
+}
+
+// -----------------------------------------------------------------------------
+Result<> BufferedBinaryWriter::write(std::string_view text)
+{
+  return write(text.data(), text.size());
+}
+
+// -----------------------------------------------------------------------------
+Result<> BufferedBinaryWriter::writeDataStore(const IDataStore& dataStore, endian byteOrder, const std::atomic_bool& shouldCancel)
+{
+  return ExecuteDataFunction(WriteDataStoreFunctor{}, dataStore.getDataType(), *this, dataStore, byteOrder, shouldCancel);
+}
+
+// -----------------------------------------------------------------------------
+Result<> BufferedBinaryWriter::flush()
+{
+  Result<> result;
+  if(m_BlockFill > 0)
+  {
+    result = submitBlock();
+  }
+  Result<> waitResult = waitForPendingWrite();
+  if(result.valid())
+  {
+    result = std::move(waitResult);
+  }
+  if(m_OutputFile != nullptr)
+  {
+    fflush(m_OutputFile);
+  }
+  else
+  {
+    m_OutputStream->flush();
+  }
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+Result<> BufferedBinaryWriter::submitBlock()
+{
+  // The other block may still be in flight, so it has to be finished before it is reused
+  Result<> waitResult = waitForPendingWrite();
+  if(waitResult.invalid())
+  {
+    return waitResult;
+  }
+
+  const std::byte* data = m_Blocks[m_CurrentBlock].get();
+  const usize size = m_BlockFill;
+  m_PendingWrite = std::async(std::launch::async, [this, data, size]() { return writeBytes(data, size); });
+
+  m_CurrentBlock = 1 - m_CurrentBlock;
+  m_BlockFill = 0;
+  return {};
+}
+
+// -----------------------------------------------------------------------------
+Result<> BufferedBinaryWriter::waitForPendingWrite()
+{
+  if(!m_PendingWrite.valid())
+  {
+    return {};
+  }
+  if(!m_PendingWrite.get())
+  {
+    return MakeErrorResult(k_WriteBlockError, "Error writing a block of binary data to the output file");
+  }
+  return {};
+}
+
+// -----------------------------------------------------------------------------
+bool BufferedBinaryWriter::writeBytes(const std::byte* data, usize size)
+{
+  if(m_OutputFile != nullptr)
+  {
+    return fwrite(data, 1, size, m_OutputFile) == size;
+  }
+  m_OutputStream->write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+  return !m_OutputStream->bad();
+}
@@ -0,0 +1,221 @@
+#pragma once
+
+#include "simplnx/Common/Bit.hpp"
+#include "simplnx/Common/Range.hpp"
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <nonstd/span.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @class BufferedBinaryWriter
+ * @brief Streams binary output to a FILE* or std::ostream through two large blocks.
+ *
+ * Values are converted and byte swapped in parallel while they are copied into the current block.
+ * A full block is written on a background thread while the other block is filled. The source data is
+ * never modified and does not need to be contiguous, so out-of-core stores can be written too.
+ *
+ * Anything written to the same file outside of the writer must come after flush() so the order is kept.
+ */
+class SIMPLNX_EXPORT BufferedBinaryWriter
+{
+public:
+  static inline constexpr usize k_DefaultBlockSize = 16 * 1024 * 1024;
+
+  explicit BufferedBinaryWriter(FILE* outputFile, usize blockSize = k_DefaultBlockSize);
+  explicit BufferedBinaryWriter(std::ostream& outputStream, usize blockSize = k_DefaultBlockSize);
+
+  /**
+   * @brief Writes any remaining data. Errors are only reported by an explicit call to flush().
+   */
+  ~BufferedBinaryWriter() noexcept;
+
+  BufferedBinaryWriter(const BufferedBinaryWriter&) = delete;
+  BufferedBinaryWriter(BufferedBinaryWriter&&) noexcept = delete;
+  BufferedBinaryWriter& operator=(const BufferedBinaryWriter&) = delete;
+  BufferedBinaryWriter& operator=(BufferedBinaryWriter&&) noexcept = delete;
+
+  /**
+   * @brief Appends raw bytes.
+   * @param data
+   * @param size
+   * @return Result<>
+   */
+  Result<> write(const void* data, usize size);
+
+  /**
+   * @brief Appends the characters of the text.
+   * @param text
+   * @return Result<>
+   */
+  Result<> write(std::string_view text);
+
+  /**
+   * @brief Appends all values of the data store converted to OutputT in the requested byte order.
+   * @param dataStore
+   * @param byteOrder
+   * @param shouldCancel
+   * @return Result<>
+   */
+  template <typename OutputT, typename T>
+  Result<> writeValuesAs(const AbstractDataStore<T>& dataStore, endian byteOrder, const std::atomic_bool& shouldCancel)
+  {
+    // Contiguous stores are read directly to avoid a virtual call per value
+    if(const auto* contiguousStore = dynamic_cast<const DataStore<T>*>(&dataStore); contiguousStore != nullptr)
+    {
+      const nonstd::span<const T> values = contiguousStore->createSpan();
+      return writeConvertedValues<OutputT>(values, values.size(), byteOrder, shouldCancel, {});
+    }
+    ParallelDataAlgorithm::AlgorithmStores stores = {&dataStore};
+    return writeConvertedValues<OutputT>(dataStore, dataStore.getSize(), byteOrder, shouldCancel, stores);
+  }
+
+  /**
+   * @brief Appends all values of the data store in the requested byte order.
+   * @param dataStore
+   * @param byteOrder
+   * @param shouldCancel
+   * @return Result<>
+   */
+  template <typename T>
+  Result<> writeValues(const AbstractDataStore<T>& dataStore, endian byteOrder, const std::atomic_bool& shouldCancel)
+  {
+    return writeValuesAs<T>(dataStore, byteOrder, shouldCancel);
+  }
+
+  /**
+   * @brief Appends the values in the requested byte order.
+   * @param values
+   * @param byteOrder
+   * @return Result<>
+   */
+  template <typename T>
+  Result<> writeValues(nonstd::span<const T> values, endian byteOrder)
+  {
+    const std::atomic_bool shouldCancel = false;
+    return writeConvertedValues<T>(values, values.size(), byteOrder, shouldCancel, {});
+  }
+
+  /**
+   * @brief Appends all values of the data store in the requested byte order, dispatching on the store's data type.
+   * @param dataStore
+   * @param byteOrder
+   * @param shouldCancel
+   * @return Result<>
+   */
+  Result<> writeDataStore(const IDataStore& dataStore, endian byteOrder, const std::atomic_bool& shouldCancel);
+
+  /**
+   * @brief Writes the current block, waits for all background writes and flushes the output.
+   * @return Result<>
+   */
+  Result<> flush();
+
+private:
+  /**
+   * @brief Copies values into a block, converting and byte swapping each one.
+   */
+  template <typename OutputT, typename SourceT>
+  class ConvertValuesImpl
+  {
+  public:
+    ConvertValuesImpl(const SourceT& source, usize sourceOffset, std::byte* destination, bool swapBytes)
+    : m_Source(source)
+    , m_SourceOffset(sourceOffset)
+    , m_Destination(destination)
+    , m_SwapBytes(swapBytes)
+    {
+    }
+
+    void operator()(const Range& range) const
+    {
+      for(usize i = range.min(); i < range.max(); i++)
+      {
+        auto value = static_cast<OutputT>(m_Source[m_SourceOffset + i]);
+        if(m_SwapBytes)
+        {
+          value = byteswap(value);
+        }
+        std::memcpy(m_Destination + i * sizeof(OutputT), &value, sizeof(OutputT));
+      }
+    }
+
+  private:
+    const SourceT& m_Source;
+    usize m_SourceOffset;
+    std::byte* m_Destination;
+    bool m_SwapBytes;
+  };
+
+  template <typename OutputT, typename SourceT>
+  Result<> writeConvertedValues(const SourceT& source, usize numValues, endian byteOrder, const std::atomic_bool& shouldCancel, const ParallelDataAlgorithm::AlgorithmStores& stores)
+  {
+    const bool swapBytes = sizeof(OutputT) > 1 && byteOrder != endian::native;
+    usize offset = 0;
+    while(offset < numValues)
+    {
+      if(shouldCancel)
+      {
+        return {};
+      }
+      usize capacity = (m_BlockSize - m_BlockFill) / sizeof(OutputT);
+      if(capacity == 0)
+      {
+        Result<> submitResult = submitBlock();
+        if(submitResult.invalid())
+        {
+          return submitResult;
+        }
+        capacity = m_BlockSize / sizeof(OutputT);
+      }
+      const usize count = std::min(capacity, numValues - offset);
+      std::byte* destination = m_Blocks[m_CurrentBlock].get() + m_BlockFill;
+
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, count);
+      dataAlg.requireStoresInMemory(stores);
+      dataAlg.execute(ConvertValuesImpl<OutputT, SourceT>(source, offset, destination, swapBytes));
+
+      m_BlockFill += count * sizeof(OutputT);
+      offset += count;
+    }
+    return {};
+  }
+
+  /**
+   * @brief Hands the current block to the background writer and switches to the other block.
+   */
+  Result<> submitBlock();
+
+  /**
+   * @brief Waits for the pending background write.
+   */
+  Result<> waitForPendingWrite();
+
+  bool writeBytes(const std::byte* data, usize size);
+
+  FILE* m_OutputFile = nullptr;
+  std::ostream* m_OutputStream = nullptr;
+  usize m_BlockSize = k_DefaultBlockSize;
+  std::array<std::unique_ptr<std::byte[]>, 2> m_Blocks; // Left uninitialized, so pages are only touched when they are used
+  usize m_CurrentBlock = 0;
+  usize m_BlockFill = 0;
+  std::future<bool> m_PendingWrite;
+};
+} // namespace nx::core
@@ -0,0 +1,640 @@
+#include "ClusteringUtilities.hpp"
+
+#include "simplnx/Utilities/DataArrayUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <random>
+#include <type_traits>
+
+using namespace nx::core;
+using namespace nx::core::ClusterUtilities;
+
+namespace
+{
+// Number of tuples read into one contiguous window. Chunks of this size are also the unit of work
+// of the parallel loops, so per chunk partial results keep the reductions deterministic.
+constexpr usize k_ChunkSize = 4096;
+// Upper bound on the number of partial cluster sums. Consecutive chunks are grouped into at most this
+// many blocks, so the memory for the partial sums does not grow with the number of tuples. The bound
+// is fixed rather than derived from the thread count so the results do not depend on the machine.
+constexpr usize k_MaxPartialBlocks = 256;
+
+/**
+ * @brief Distance between two contiguous tuples. The metric is a template argument so the switch in
+ * GetDistance is resolved at compile time and the component loop is inlined into the caller.
+ */
+template <DistanceMetric MetricV>
+inline float64 TupleDistance(const float64* left, const float64* right, usize numComponents)
+{
+  return GetDistance(left, 0, right, 0, numComponents, MetricV);
+}
+
+/**
+ * @brief Calls func with the distance metric as a compile time constant
+ */
+template <typename FuncT>
+void DispatchMetric(DistanceMetric distanceMetric, FuncT&& func)
+{
+  switch(distanceMetric)
+  {
+  case Euclidean:
+    func(std::integral_constant<DistanceMetric, Euclidean>{});
+    break;
+  case SquaredEuclidean:
+    func(std::integral_constant<DistanceMetric, SquaredEuclidean>{});
+    break;
+  case Manhattan:
+    func(std::integral_constant<DistanceMetric, Manhattan>{});
+    break;
+  case Cosine:
+    func(std::integral_constant<DistanceMetric, Cosine>{});
+    break;
+  case Pearson:
+    func(std::integral_constant<DistanceMetric, Pearson>{});
+    break;
+  case SquaredPearson:
+    func(std::integral_constant<DistanceMetric, SquaredPearson>{});
+    break;
+  }
+}
+
+usize NumberOfChunks(usize numTuples)
+{
+  return (numTuples + k_ChunkSize - 1) / k_ChunkSize;
+}
+
+/**
+ * @brief Returns the first chunk of the block when numChunks chunks are split into numBlocks blocks
+ */
+usize BlockStartChunk(usize block, usize numBlocks, usize numChunks)
+{
+  return block * numChunks / numBlocks;
+}
+
+/**
+ * @brief Assigns the masked tuples of every block of chunks to their closest center and optionally
+ * accumulates per block cluster sums and counts.
+ */
+template <DistanceMetric MetricV>
+class AssignClustersImpl
+{
+public:
+  AssignClustersImpl(const ClusterData& data, const std::vector<float64>& centers, usize numClusters, usize numBlocks, AbstractDataStore<int32>& featureIds, std::vector<float64>* partialSums,
+                     std::vector<usize>* partialCounts, std::vector<usize>& partialChanges)
+  : m_Data(data)
+  , m_Centers(centers)
+  , m_NumClusters(numClusters)
+  , m_NumBlocks(numBlocks)
+  , m_FeatureIds(featureIds)
+  , m_PartialSums(partialSums)
+  , m_PartialCounts(partialCounts)
+  , m_PartialChanges(partialChanges)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize numComponents = m_Data.numComponents;
+    const usize numRows = m_NumClusters + 1;
+    const usize numChunks = NumberOfChunks(m_Data.numTuples);
+    std::vector<float64> window(k_ChunkSize * numComponents);
+    for(usize block = range.min(); block < range.max(); block++)
+    {
+      float64* sums = m_PartialSums != nullptr ? m_PartialSums->data() + block * numRows * numComponents : nullptr;
+      usize* counts = m_PartialCounts != nullptr ? m_PartialCounts->data() + block * numRows : nullptr;
+      usize changes = 0;
+      const usize endChunk = BlockStartChunk(block + 1, m_NumBlocks, numChunks);
+      for(usize chunk = BlockStartChunk(block, m_NumBlocks, numChunks); chunk < endChunk; chunk++)
+      {
+        const usize start = chunk * k_ChunkSize;
+        const usize end = std::min(start + k_ChunkSize, m_Data.numTuples);
+        m_Data.readTuples(start, end, window.data());
+
+        for(usize tupleIndex = start; tupleIndex < end; tupleIndex++)
+        {
+          if(!m_Data.mask->isTrue(tupleIndex))
+          {
+            continue;
+          }
+          const float64* tuple = window.data() + (tupleIndex - start) * numComponents;
+          const int32 previousCluster = m_FeatureIds[tupleIndex];
+          int32 closestCluster = previousCluster;
+          float64 minDistance = std::numeric_limits<float64>::max();
+          for(usize cluster = 1; cluster <= m_NumClusters; cluster++)
+          {
+            const float64 distance = TupleDistance<MetricV>(tuple, m_Centers.data() + cluster * numComponents, numComponents);
+            if(distance < minDistance)
+            {
+              minDistance = distance;
+              closestCluster = static_cast<int32>(cluster);
+            }
+          }
+          if(closestCluster != previousCluster)
+          {
+            m_FeatureIds.setValue(tupleIndex, closestCluster);
+            changes++;
+          }
+          if(sums != nullptr)
+          {
+            float64* clusterSum = sums + static_cast<usize>(closestCluster) * numComponents;
+            for(usize comp = 0; comp < numComponents; comp++)
+            {
+              clusterSum[comp] += tuple[comp];
+            }
+          }
+          if(counts != nullptr)
+          {
+            counts[closestCluster]++;
+          }
+        }
+      }
+      m_PartialChanges[block] = changes;
+    }
+  }
+
+private:
+  const ClusterData& m_Data;
+  const std::vector<float64>& m_Centers;
+  usize m_NumClusters;
+  usize m_NumBlocks;
+  AbstractDataStore<int32>& m_FeatureIds;
+  std::vector<float64>* m_PartialSums;
+  std::vector<usize>* m_PartialCounts;
+  std::vector<usize>& m_PartialChanges;
+};
+
+/**
+ * @brief Lowers the k-means++ weight of every masked tuple to the weight of its distance to the
+ * newest seed and sums the weights of every chunk.
+ */
+template <DistanceMetric MetricV>
+class UpdateSeedWeightsImpl
+{
+public:
+  UpdateSeedWeightsImpl(const ClusterData& data, const std::vector<float64>& seedTuple, std::vector<float64>& weights, std::vector<float64>& chunkWeights)
+  : m_Data(data)
+  , m_SeedTuple(seedTuple)
+  , m_Weights(weights)
+  , m_ChunkWeights(chunkWeights)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize numComponents = m_Data.numComponents;
+    std::vector<float64> window(k_ChunkSize * numComponents);
+    for(usize chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      const usize start = chunk * k_ChunkSize;
+      const usize end = std::min(start + k_ChunkSize, m_Data.numTuples);
+      m_Data.readTuples(start, end, window.data());
+
+      float64 chunkWeight = 0.0;
+      for(usize tupleIndex = start; tupleIndex < end; tupleIndex++)
+      {
+        if(!m_Data.mask->isTrue(tupleIndex))
+        {
+          continue;
+        }
+        const float64 distance = TupleDistance<MetricV>(window.data() + (tupleIndex - start) * numComponents, m_SeedTuple.data(), numComponents);
+        float64 weight = MetricV == SquaredEuclidean ? distance : distance * distance;
+        weight = std::max(weight, 0.0);
+        m_Weights[tupleIndex] = std::min(m_Weights[tupleIndex], weight);
+        chunkWeight += m_Weights[tupleIndex];
+      }
+      m_ChunkWeights[chunk] = chunkWeight;
+    }
+  }
+
+private:
+  const ClusterData& m_Data;
+  const std::vector<float64>& m_SeedTuple;
+  std::vector<float64>& m_Weights;
+  std::vector<float64>& m_ChunkWeights;
+};
+
+/**
+ * @brief Computes the summed distance of every candidate medoid to all members of its cluster
+ */
+template <DistanceMetric MetricV>
+class MedoidCostImpl
+{
+public:
+  MedoidCostImpl(const std::vector<float64>& members, usize numMembers, usize numComponents, std::vector<float64>& costs, const std::atomic_bool& shouldCancel)
+  : m_Members(members)
+  , m_NumMembers(numMembers)
+  , m_NumComponents(numComponents)
+  , m_Costs(costs)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize candidate = range.min(); candidate < range.max(); candidate++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      const float64* candidateTuple = m_Members.data() + candidate * m_NumComponents;
+      float64 cost = 0.0;
+      for(usize member = 0; member < m_NumMembers; member++)
+      {
+        cost += TupleDistance<MetricV>(m_Members.data() + member * m_NumComponents, candidateTuple, m_NumComponents);
+      }
+      m_Costs[candidate] = cost;
+    }
+  }
+
+private:
+  const std::vector<float64>& m_Members;
+  usize m_NumMembers;
+  usize m_NumComponents;
+  std::vector<float64>& m_Costs;
+  const std::atomic_bool& m_ShouldCancel;
+};
+
+/**
+ * @brief Computes the silhouette of the masked tuples of every chunk against the reference tuples
+ */
+template <DistanceMetric MetricV>
+class SilhouetteImpl
+{
+public:
+  SilhouetteImpl(const ClusterData& data, const AbstractDataStore<int32>& featureIds, const std::vector<float64>& references, const std::vector<int32>& referenceClusters,
+                 const std::vector<float64>& referenceCounts, AbstractDataStore<float64>& silhouette, const std::atomic_bool& shouldCancel)
+  : m_Data(data)
+  , m_FeatureIds(featureIds)
+  , m_References(references)
+  , m_ReferenceClusters(referenceClusters)
+  , m_ReferenceCounts(referenceCounts)
+  , m_Silhouette(silhouette)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize numComponents = m_Data.numComponents;
+    const usize numClusters = m_ReferenceCounts.size();
+    const usize numReferences = m_ReferenceClusters.size();
+    std::vector<float64> window(k_ChunkSize * numComponents);
+    std::vector<float64> clusterDistances(numClusters);
+    for(usize chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      const usize start = chunk * k_ChunkSize;
+      const usize end = std::min(start + k_ChunkSize, m_Data.numTuples);
+      m_Data.readTuples(start, end, window.data());
+
+      for(usize tupleIndex = start; tupleIndex < end; tupleIndex++)
+      {
+        if(!m_Data.mask->isTrue(tupleIndex))
+        {
+          continue;
+        }
+        const float64* tuple = window.data() + (tupleIndex - start) * numComponents;
+        std::fill(clusterDistances.begin(), clusterDistances.end(), 0.0);
+        for(usize reference = 0; reference < numReferences; reference++)
+        {
+          clusterDistances[m_ReferenceClusters[reference]] += TupleDistance<MetricV>(tuple, m_References.data() + reference * numComponents, numComponents);
+        }
+        for(usize cluster = 1; cluster < numClusters; cluster++)
+        {
+          clusterDistances[cluster] /= m_ReferenceCounts[cluster];
+        }
+
+        const int32 ownCluster = m_FeatureIds[tupleIndex];
+        const float64 inClusterDistance = clusterDistances[ownCluster];
+        float64 outClusterMinDistance = 0.0;
+        float64 minDistance = std::numeric_limits<float64>::max();
+        for(usize cluster = 1; cluster < numClusters; cluster++)
+        {
+          if(static_cast<usize>(ownCluster) != cluster && clusterDistances[cluster] < minDistance)
+          {
+            minDistance = clusterDistances[cluster];
+            outClusterMinDistance = minDistance;
+          }
+        }
+        m_Silhouette.setValue(tupleIndex, (outClusterMinDistance - inClusterDistance) / std::max(outClusterMinDistance, inClusterDistance));
+      }
+    }
+  }
+
+private:
+  const ClusterData& m_Data;
+  const AbstractDataStore<int32>& m_FeatureIds;
+  const std::vector<float64>& m_References;
+  const std::vector<int32>& m_ReferenceClusters;
+  const std::vector<float64>& m_ReferenceCounts;
+  AbstractDataStore<float64>& m_Silhouette;
+  const std::atomic_bool& m_ShouldCancel;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+std::vector<float64> ClusterUtilities::ReadSelectedTuples(const ClusterData& data, const std::vector<usize>& tupleIds)
+{
+  const usize numComponents = data.numComponents;
+  std::vector<float64> tuples(tupleIds.size() * numComponents);
+  std::vector<float64> window(k_ChunkSize * numComponents);
+  usize windowStart = 0;
+  usize windowEnd = 0;
+  for(usize index = 0; index < tupleIds.size(); index++)
+  {
+    const usize tupleId = tupleIds[index];
+    if(tupleId < windowStart || tupleId >= windowEnd)
+    {
+      windowStart = tupleId - tupleId % k_ChunkSize;
+      windowEnd = std::min(windowStart + k_ChunkSize, data.numTuples);
+      data.readTuples(windowStart, windowEnd, window.data());
+    }
+    std::copy_n(window.data() + (tupleId - windowStart) * numComponents, numComponents, tuples.data() + index * numComponents);
+  }
+  return tuples;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<usize> ClusterUtilities::KMeansPlusPlusSeeds(const ClusterData& data, usize numClusters, uint64 seed, const std::atomic_bool& shouldCancel)
+{
+  std::vector<usize> maskedTuples;
+  for(usize tupleIndex = 0; tupleIndex < data.numTuples; tupleIndex++)
+  {
+    if(data.mask->isTrue(tupleIndex))
+    {
+      maskedTuples.push_back(tupleIndex);
+    }
+  }
+  if(maskedTuples.empty() || numClusters == 0)
+  {
+    return {};
+  }
+
+  std::mt19937_64 generator(seed);
+  std::uniform_int_distribution<usize> maskedDistribution(0, maskedTuples.size() - 1);
+  std::uniform_real_distribution<float64> unitDistribution(0.0, 1.0);
+
+  std::vector<usize> seeds;
+  seeds.reserve(numClusters);
+  seeds.push_back(maskedTuples[maskedDistribution(generator)]);
+
+  const usize numChunks = NumberOfChunks(data.numTuples);
+  std::vector<float64> weights(data.numTuples, std::numeric_limits<float64>::max());
+  std::vector<float64> chunkWeights(numChunks, 0.0);
+  while(seeds.size() < numClusters)
+  {
+    if(shouldCancel)
+    {
+      return {};
+    }
+    const std::vector<float64> seedTuple = ReadSelectedTuples(data, {seeds.back()});
+    DispatchMetric(data.distanceMetric, [&](auto metric) {
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, numChunks);
+      dataAlg.requireStoresInMemory(data.stores);
+      dataAlg.execute(UpdateSeedWeightsImpl<decltype(metric)::value>(data, seedTuple, weights, chunkWeights));
+    });
+
+    float64 totalWeight = 0.0;
+    for(float64 chunkWeight : chunkWeights)
+    {
+      totalWeight += chunkWeight;
+    }
+    if(!(totalWeight > 0.0))
+    {
+      // Every masked tuple coincides with a seed, so any choice is as good as another
+      seeds.push_back(maskedTuples[maskedDistribution(generator)]);
+      continue;
+    }
+
+    // Walk the chunk sums first and only scan the tuples of the chunk that holds the target
+    float64 target = unitDistribution(generator) * totalWeight;
+    usize chunk = 0;
+    while(chunk + 1 < numChunks && target >= chunkWeights[chunk])
+    {
+      target -= chunkWeights[chunk];
+      chunk++;
+    }
+    const usize start = chunk * k_ChunkSize;
+    const usize end = std::min(start + k_ChunkSize, data.numTuples);
+    usize chosen = seeds.back();
+    for(usize tupleIndex = start; tupleIndex < end; tupleIndex++)
+    {
+      if(!data.mask->isTrue(tupleIndex) || weights[tupleIndex] <= 0.0)
+      {
+        continue;
+      }
+      chosen = tupleIndex;
+      if(target < weights[tupleIndex])
+      {
+        break;
+      }
+      target -= weights[tupleIndex];
+    }
+    seeds.push_back(chosen);
+  }
+  return seeds;
+}
+
+// -----------------------------------------------------------------------------
+usize ClusterUtilities::AssignClusters(const ClusterData& data, const std::vector<float64>& centers, usize numClusters, AbstractDataStore<int32>& featureIds, std::vector<float64>* clusterSums,
+                                       std::vector<usize>* clusterCounts)
+{
+  const usize numBlocks = std::min(NumberOfChunks(data.numTuples), k_MaxPartialBlocks);
+  const usize numRows = numClusters + 1;
+  const usize numComponents = data.numComponents;
+
+  std::vector<float64> partialSums;
+  std::vector<usize> partialCounts;
+  std::vector<usize> partialChanges(numBlocks, 0);
+  if(clusterSums != nullptr)
+  {
+    partialSums.assign(numBlocks * numRows * numComponents, 0.0);
+  }
+  if(clusterCounts != nullptr)
+  {
+    partialCounts.assign(numBlocks * numRows, 0);
+  }
+
+  IParallelAlgorithm::AlgorithmStores stores = data.stores;
+  stores.push_back(&featureIds);
+  DispatchMetric(data.distanceMetric, [&](auto metric) {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numBlocks);
+    dataAlg.requireStoresInMemory(stores);
+    dataAlg.execute(AssignClustersImpl<decltype(metric)::value>(data, centers, numClusters, numBlocks, featureIds, clusterSums != nullptr ? &partialSums : nullptr,
+                                                                clusterCounts != nullptr ? &partialCounts : nullptr, partialChanges));
+  });
+
+  // Reduce the block results in block order so the sums do not depend on the thread count
+  if(clusterSums != nullptr)
+  {
+    clusterSums->assign(numRows * numComponents, 0.0);
+    for(usize block = 0; block < numBlocks; block++)
+    {
+      const float64* blockSums = partialSums.data() + block * numRows * numComponents;
+      for(usize index = 0; index < numRows * numComponents; index++)
+      {
+        (*clusterSums)[index] += blockSums[index];
+      }
+    }
+  }
+  if(clusterCounts != nullptr)
+  {
+    clusterCounts->assign(numRows, 0);
+    for(usize block = 0; block < numBlocks; block++)
+    {
+      for(usize row = 0; row < numRows; row++)
+      {
+        (*clusterCounts)[row] += partialCounts[block * numRows + row];
+      }
+    }
+  }
+  usize numChanges = 0;
+  for(usize changes : partialChanges)
+  {
+    numChanges += changes;
+  }
+  return numChanges;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<float64> ClusterUtilities::FindMedoids(const ClusterData& data, const AbstractDataStore<int32>& featureIds, usize numClusters, std::vector<usize>& medoidIds,
+                                                   const std::atomic_bool& shouldCancel)
+{
+  std::vector<std::vector<usize>> clusterMembers(numClusters);
+  for(usize tupleIndex = 0; tupleIndex < data.numTuples; tupleIndex++)
+  {
+    const int32 cluster = featureIds[tupleIndex];
+    if(cluster > 0 && static_cast<usize>(cluster) <= numClusters && data.mask->isTrue(tupleIndex))
+    {
+      clusterMembers[cluster - 1].push_back(tupleIndex);
+    }
+  }
+
+  std::vector<float64> minCosts(numClusters, std::numeric_limits<float64>::max());
+  for(usize cluster = 0; cluster < numClusters; cluster++)
+  {
+    const std::vector<usize>& members = clusterMembers[cluster];
+    if(members.empty())
+    {
+      continue;
+    }
+    const std::vector<float64> memberTuples = ReadSelectedTuples(data, members);
+    std::vector<float64> costs(members.size(), 0.0);
+    DispatchMetric(data.distanceMetric, [&](auto metric) {
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, members.size());
+      dataAlg.execute(MedoidCostImpl<decltype(metric)::value>(memberTuples, members.size(), data.numComponents, costs, shouldCancel));
+    });
+    if(shouldCancel)
+    {
+      return {};
+    }
+
+    for(usize candidate = 0; candidate < members.size(); candidate++)
+    {
+      if(costs[candidate] < minCosts[cluster])
+      {
+        minCosts[cluster] = costs[candidate];
+        medoidIds[cluster] = members[candidate];
+      }
+    }
+  }
+  return minCosts;
+}
+
+// -----------------------------------------------------------------------------
+Result<> ClusterUtilities::ComputeSilhouette(const ClusterData& data, const AbstractDataStore<int32>& featureIds, usize samplesPerCluster, uint64 seed, AbstractDataStore<float64>& silhouette,
+                                             const std::atomic_bool& shouldCancel)
+{
+  int32 maxCluster = 0;
+  for(usize tupleIndex = 0; tupleIndex < data.numTuples; tupleIndex++)
+  {
+    if(!data.mask->isTrue(tupleIndex))
+    {
+      continue;
+    }
+    const int32 cluster = featureIds[tupleIndex];
+    if(cluster < 0)
+    {
+      return MakeErrorResult(-54081, fmt::format("The cluster id at tuple {} is negative ({}). Cluster ids must be zero or greater.", tupleIndex, cluster));
+    }
+    maxCluster = std::max(maxCluster, cluster);
+  }
+  const usize numClusters = static_cast<usize>(maxCluster) + 1;
+
+  // The reference tuples are either all masked tuples or a per cluster reservoir sample of them
+  std::vector<usize> referenceIds;
+  if(samplesPerCluster == 0)
+  {
+    for(usize tupleIndex = 0; tupleIndex < data.numTuples; tupleIndex++)
+    {
+      if(data.mask->isTrue(tupleIndex))
+      {
+        referenceIds.push_back(tupleIndex);
+      }
+    }
+  }
+  else
+  {
+    std::mt19937_64 generator(seed);
+    std::vector<std::vector<usize>> reservoirs(numClusters);
+    std::vector<usize> seenCounts(numClusters, 0);
+    for(usize tupleIndex = 0; tupleIndex < data.numTuples; tupleIndex++)
+    {
+      if(!data.mask->isTrue(tupleIndex))
+      {
+        continue;
+      }
+      const usize cluster = static_cast<usize>(featureIds[tupleIndex]);
+      const usize seen = seenCounts[cluster]++;
+      if(seen < samplesPerCluster)
+      {
+        reservoirs[cluster].push_back(tupleIndex);
+        continue;
+      }
+      const usize slot = std::uniform_int_distribution<usize>(0, seen)(generator);
+      if(slot < samplesPerCluster)
+      {
+        reservoirs[cluster][slot] = tupleIndex;
+      }
+    }
+    for(const auto& reservoir : reservoirs)
+    {
+      referenceIds.insert(referenceIds.end(), reservoir.begin(), reservoir.end());
+    }
+    std::sort(referenceIds.begin(), referenceIds.end());
+  }
+
+  std::vector<int32> referenceClusters(referenceIds.size());
+  std::vector<float64> referenceCounts(numClusters, 0.0);
+  for(usize reference = 0; reference < referenceIds.size(); reference++)
+  {
+    referenceClusters[reference] = featureIds[referenceIds[reference]];
+    referenceCounts[referenceClusters[reference]]++;
+  }
+  const std::vector<float64> references = ReadSelectedTuples(data, referenceIds);
+  if(shouldCancel)
+  {
+    return {};
+  }
+
+  IParallelAlgorithm::AlgorithmStores stores = data.stores;
+  stores.push_back(&featureIds);
+  stores.push_back(&silhouette);
+  DispatchMetric(data.distanceMetric, [&](auto metric) {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, NumberOfChunks(data.numTuples));
+    dataAlg.requireStoresInMemory(stores);
+    dataAlg.execute(SilhouetteImpl<decltype(metric)::value>(data, featureIds, references, referenceClusters, referenceCounts, silhouette, shouldCancel));
+  });
+  return {};
+}
@@ -1,9 +1,21 @@
 #pragma once
 
+#include "simplnx/Common/Result.hpp"
 #include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/Utilities/IParallelAlgorithm.hpp"
 #include "simplnx/simplnx_export.hpp"
 
+#include <atomic>
 #include <cmath>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace nx::core
+{
+struct MaskCompare;
+}
 
 namespace nx::core::ClusterUtilities
 {
@@ -17,6 +29,12 @@ enum SIMPLNX_EXPORT DistanceMetric
   SquaredPearson
 };
 
+enum SIMPLNX_EXPORT InitializationMethod
+{
+  Random,
+  KMeansPlusPlus
+};
+
 /**
  * @brief The DistanceTemplate class contains a templated function getDistance to find the distance, via a variety of
  * metrics, between two vectors of arbitrary dimensions. The developer should ensure that the pointers passed to
@@ -134,4 +152,116 @@ float64 GetDistance(const leftDataType& leftVector, usize leftOffset, const righ
   // Return the correct primitive type for distance
   return dist;
 }
+
+/**
+ * @brief Copies the components of the tuples [startTuple, endTuple) into a contiguous float64 buffer.
+ */
+using TupleReader = std::function<void(usize startTuple, usize endTuple, float64* buffer)>;
+
+/**
+ * @brief The ClusterData struct describes the input of the parallel clustering functions below. The
+ * tuples are read in windows of contiguous float64 values so the distance loops run over raw memory
+ * instead of calling into the data store for every component.
+ */
+struct SIMPLNX_EXPORT ClusterData
+{
+  TupleReader readTuples;
+  usize numTuples = 0;
+  usize numComponents = 0;
+  const MaskCompare* mask = nullptr;
+  DistanceMetric distanceMetric = Euclidean;
+  IParallelAlgorithm::AlgorithmStores stores; // Stores accessed by readTuples and the mask
+};
+
+/**
+ * @brief Creates the ClusterData for a data store and mask.
+ * @param dataStore
+ * @param mask
+ * @param maskStore The data store behind the mask
+ * @param distanceMetric
+ * @return ClusterData
+ */
+template <typename T>
+ClusterData CreateClusterData(const AbstractDataStore<T>& dataStore, const MaskCompare& mask, const IDataStore* maskStore, DistanceMetric distanceMetric)
+{
+  ClusterData data;
+  data.numTuples = dataStore.getNumberOfTuples();
+  data.numComponents = dataStore.getNumberOfComponents();
+  data.mask = &mask;
+  data.distanceMetric = distanceMetric;
+  data.stores = {&dataStore, maskStore};
+  data.readTuples = [&dataStore, numComponents = data.numComponents](usize startTuple, usize endTuple, float64* buffer) {
+    for(usize index = startTuple * numComponents; index < endTuple * numComponents; index++)
+    {
+      *buffer++ = static_cast<float64>(dataStore[index]);
+    }
+  };
+  return data;
+}
+
+/**
+ * @brief Reads the components of the specified tuples into a contiguous buffer, one row per tuple.
+ * @param data
+ * @param tupleIds Tuple ids in ascending order
+ * @return std::vector<float64>
+ */
+SIMPLNX_EXPORT std::vector<float64> ReadSelectedTuples(const ClusterData& data, const std::vector<usize>& tupleIds);
+
+/**
+ * @brief Chooses initial cluster seeds with the k-means++ scheme. The first seed is chosen uniformly
+ * from the masked tuples and every further seed with a probability proportional to the squared
+ * distance to its nearest chosen seed (the distance itself for the squared Euclidean metric).
+ * Returns an empty vector if the mask excludes every tuple.
+ * @param data
+ * @param numClusters
+ * @param seed
+ * @param shouldCancel
+ * @return std::vector<usize> Tuple id of every seed
+ */
+SIMPLNX_EXPORT std::vector<usize> KMeansPlusPlusSeeds(const ClusterData& data, usize numClusters, uint64 seed, const std::atomic_bool& shouldCancel);
+
+/**
+ * @brief Assigns every masked tuple to the closest of the cluster centers in parallel. If several
+ * centers are equally close the lowest cluster id wins. The centers hold numClusters + 1 rows, row
+ * 0 is unused so cluster ids start at 1.
+ * @param data
+ * @param centers
+ * @param numClusters
+ * @param featureIds Receives the cluster id of every masked tuple
+ * @param clusterSums If not null, receives the component sums of the members of every cluster
+ * @param clusterCounts If not null, receives the number of members of every cluster
+ * @return usize The number of tuples whose cluster id changed
+ */
+SIMPLNX_EXPORT usize AssignClusters(const ClusterData& data, const std::vector<float64>& centers, usize numClusters, AbstractDataStore<int32>& featureIds, std::vector<float64>* clusterSums,
+                                    std::vector<usize>* clusterCounts);
+
+/**
+ * @brief Finds the member of every cluster that minimizes the summed distance to the other members.
+ * The candidates of each cluster are evaluated in parallel. Clusters without members keep their
+ * previous medoid.
+ * @param data
+ * @param featureIds
+ * @param numClusters
+ * @param medoidIds Holds the tuple id of the medoid of every cluster (index 0 is cluster 1)
+ * @param shouldCancel
+ * @return std::vector<float64> The summed distance of every medoid
+ */
+SIMPLNX_EXPORT std::vector<float64> FindMedoids(const ClusterData& data, const AbstractDataStore<int32>& featureIds, usize numClusters, std::vector<usize>& medoidIds,
+                                                const std::atomic_bool& shouldCancel);
+
+/**
+ * @brief Computes the silhouette of every masked tuple in parallel. With samplesPerCluster set to 0
+ * the average distances use every masked tuple. Otherwise they are estimated from at most
+ * samplesPerCluster randomly chosen members of every cluster, which bounds the cost to
+ * O(N * clusters * samplesPerCluster).
+ * @param data
+ * @param featureIds
+ * @param samplesPerCluster
+ * @param seed
+ * @param silhouette
+ * @param shouldCancel
+ * @return Result<>
+ */
+SIMPLNX_EXPORT Result<> ComputeSilhouette(const ClusterData& data, const AbstractDataStore<int32>& featureIds, usize samplesPerCluster, uint64 seed, AbstractDataStore<float64>& silhouette,
+                                          const std::atomic_bool& shouldCancel);
 } // namespace nx::core::ClusterUtilities
@@ -4,6 +4,7 @@
 #include "simplnx/Common/TypesUtility.hpp"
 #include "simplnx/Core/Application.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/StreamCompaction.hpp"
 
 #include <set>
 
@@ -372,6 +373,20 @@ void transferElementData(DataStructure& m_DataStructure, AttributeMatrix& destCe
   taskRunner.wait(); // This will spill over if the number of DataArrays to process does not divide evenly by the number of threads.
 }
 
+Result<> transferElementData(DataStructure& dataStructure, AttributeMatrix& destAttributeMatrix, const std::vector<DataPath>& sourceDataPaths, const StreamCompaction& compaction,
+                             const std::atomic_bool& shouldCancel, const IFilter::MessageHandler& messageHandler)
+{
+  std::vector<StreamCompaction::ArrayPair> arrays;
+  for(const auto& sourceDataPath : sourceDataPaths)
+  {
+    const auto& sourceArray = dataStructure.getDataRefAs<IDataArray>(sourceDataPath);
+    auto& destArray = dynamic_cast<IDataArray&>(destAttributeMatrix.at(sourceArray.getName()));
+    arrays.emplace_back(&sourceArray, &destArray);
+  }
+  messageHandler(fmt::format("Copying {} Data Arrays", arrays.size()));
+  return compaction.copyArrays(arrays, shouldCancel);
+}
+
 void CreateDataArrayActions(const DataStructure& dataStructure, const AttributeMatrix* sourceAttrMatPtr, const MultiArraySelectionParameter::ValueType& selectedArrayPaths,
                             const DataPath& reducedGeometryPathAttrMatPath, Result<OutputActions>& resultOutputActions)
 {
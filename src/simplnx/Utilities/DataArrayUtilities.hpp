@@ -103,6 +103,8 @@ namespace fs = std::filesystem;
 
 namespace nx::core
 {
+class StreamCompaction;
+
 template <class T>
 struct ConvertTo
 {
@@ -1068,14 +1070,45 @@ Result<> CopyData(const K& inputArray, K& destArray, usize destTupleOffset, usiz
     return MakeErrorResult(-2034, fmt::format("The total number of elements to copy ({}) is larger than the total available elements ({}).", elementsToCopy, availableElements));
   }
 
-  auto srcBegin = inputArray.begin() + (srcTupleOffset * sourceNumComponents);
-  auto srcEnd = srcBegin + (totalSrcTuples * sourceNumComponents);
-  auto dstBegin = destArray.begin() + (destTupleOffset * numComponents);
-  std::copy(srcBegin, srcEnd, dstBegin);
+  if constexpr(std::is_base_of_v<INeighborList, K>)
+  {
+    // Neighbor lists are not laid out tuple by tuple, so each list is copied on its own
+    for(usize i = 0; i < totalSrcTuples; i++)
+    {
+      destArray.setList(static_cast<int32>(destTupleOffset + i), inputArray.at(srcTupleOffset + i));
+    }
+  }
+  else
+  {
+    auto srcBegin = inputArray.begin() + (srcTupleOffset * sourceNumComponents);
+    auto srcEnd = srcBegin + (totalSrcTuples * sourceNumComponents);
+    auto dstBegin = destArray.begin() + (destTupleOffset * numComponents);
+    std::copy(srcBegin, srcEnd, dstBegin);
+  }
 
   return {};
 }
 
+/**
+ * @brief Swaps the tuples [tupleIdx, endTupleIdx) of the destArray with the same number of tuples starting at mirrorTupleIdx.
+ */
+template <class K>
+void SwapTuples(K& destArray, usize tupleIdx, usize endTupleIdx, usize mirrorTupleIdx)
+{
+  if constexpr(std::is_base_of_v<INeighborList, K>)
+  {
+    for(usize i = 0; i < endTupleIdx - tupleIdx; i++)
+    {
+      destArray.swapLists(tupleIdx + i, mirrorTupleIdx + i);
+    }
+  }
+  else
+  {
+    auto numComps = destArray.getNumberOfComponents();
+    std::swap_ranges(destArray.begin() + (tupleIdx * numComps), destArray.begin() + (endTupleIdx * numComps), destArray.begin() + (mirrorTupleIdx * numComps));
+  }
+}
+
 enum class Direction
 {
   X,
@@ -1185,13 +1218,12 @@ Result<> AppendDataX(const std::vector<const K*>& inputArrays, const std::vector
       // Mirror the array along the X axis if the mirror flag is true
       if(mirror)
       {
-        auto numComps = destArray.getNumberOfComponents();
         for(usize x = 0; x < appendDestXDim / 2; ++x)
         {
           usize tupleIdx = (z * appendYDim * appendDestXDim) + (y * appendDestXDim) + x;
           usize endTupleIdx = tupleIdx + 1;
           usize mirrorTupleIdx = (z * appendYDim * appendDestXDim) + (y * appendDestXDim) + (appendDestXDim - 1 - x);
-          std::swap_ranges(destArray.begin() + (tupleIdx * numComps), destArray.begin() + (endTupleIdx * numComps), destArray.begin() + (mirrorTupleIdx * numComps));
+          SwapTuples(destArray, tupleIdx, endTupleIdx, mirrorTupleIdx);
         }
       }
     }
@@ -1236,7 +1268,6 @@ Result<> AppendDataY(const std::vector<const K*>& inputArrays, const std::vector
   // Mirror the array along the Y axis if the mirror flag is true
   if(mirror)
   {
-    auto numComps = destArray.getNumberOfComponents();
     for(int z = 0; z < appendZDim; ++z)
     {
       for(int x = 0; x < appendXDim; ++x)
@@ -1246,7 +1277,7 @@ Result<> AppendDataY(const std::vector<const K*>& inputArrays, const std::vector
           usize tupleIdx = (z * appendDestYDim * appendXDim) + (y * appendXDim) + x;
           usize endTupleIdx = tupleIdx + 1;
           usize mirrorTupleIdx = (z * appendDestYDim * appendXDim) + ((appendDestYDim - 1 - y) * appendXDim) + x;
-          std::swap_ranges(destArray.begin() + (tupleIdx * numComps), destArray.begin() + (endTupleIdx * numComps), destArray.begin() + (mirrorTupleIdx * numComps));
+          SwapTuples(destArray, tupleIdx, endTupleIdx, mirrorTupleIdx);
         }
       }
     }
@@ -1277,13 +1308,12 @@ Result<> AppendDataZ(const std::vector<const K*>& inputArrays, const std::vector
   {
     auto appendDestZDim = newDestDims[0];
     auto sliceTupleCount = newDestDims[1] * newDestDims[2];
-    auto numComps = destArray.getNumberOfComponents();
     for(int i = 0; i < appendDestZDim / 2; ++i)
     {
       usize tupleIdx = i * sliceTupleCount;
       usize endTupleIdx = tupleIdx + sliceTupleCount;
       usize mirrorTupleIdx = (appendDestZDim - 1 - i) * sliceTupleCount;
-      std::swap_ranges(destArray.begin() + (tupleIdx * numComps), destArray.begin() + (endTupleIdx * numComps), destArray.begin() + (mirrorTupleIdx * numComps));
+      SwapTuples(destArray, tupleIdx, endTupleIdx, mirrorTupleIdx);
     }
   }
 
@@ -1402,10 +1432,10 @@ public:
     {
       using NeighborListType = NeighborList<T>;
       auto* destArrayPtr = dynamic_cast<NeighborListType*>(m_DestCellArray);
-      // Make sure the destination array is allocated AND each tuple list is initialized, so we can use the [] operator to copy over the data
-      if(destArrayPtr->getValues().empty() || destArrayPtr->getList(0) == nullptr)
+      // Make sure every tuple has a list before the lists are copied over
+      if(static_cast<usize>(destArrayPtr->getNumberOfLists()) != destArrayPtr->getNumberOfTuples())
       {
-        destArrayPtr->addEntry(destArrayPtr->getNumberOfTuples() - 1, 0);
+        destArrayPtr->resizeTuples(destArrayPtr->getNumberOfTuples());
       }
 
       std::vector<const NeighborListType*> castedArrays;
@@ -1478,10 +1508,10 @@ public:
     {
       using NeighborListT = NeighborList<T>;
       auto* destArray = dynamic_cast<NeighborListT*>(m_DestCellArray);
-      // Make sure the destination array is allocated AND each tuple list is initialized, so we can use the [] operator to copy over the data
-      if(destArray->getValues().empty() || destArray->getList(0) == nullptr)
+      // Make sure every tuple has a list before the lists are copied over
+      if(static_cast<usize>(destArray->getNumberOfLists()) != destArray->getNumberOfTuples())
       {
-        destArray->addEntry(destArray->getNumberOfTuples() - 1, 0);
+        destArray->resizeTuples(destArray->getNumberOfTuples());
       }
       std::vector<const NeighborListT*> castedArrays;
       castedArrays.reserve(m_InputCellArrays.size());
@@ -1956,6 +1986,20 @@ private:
 SIMPLNX_EXPORT void transferElementData(DataStructure& m_DataStructure, AttributeMatrix& destCellDataAM, const std::vector<DataPath>& sourceDataPaths, const std::vector<usize>& newEdgesIndexList,
                                         const std::atomic_bool& m_ShouldCancel, const IFilter::MessageHandler& m_MessageHandler);
 
+/**
+ * @brief Copies the kept tuples of every source array into the array of the same name in the destination
+ * Attribute Matrix. The arrays are copied in parallel blocks.
+ * @param dataStructure
+ * @param destAttributeMatrix The destination Attribute Matrix which must already hold one tuple per kept element
+ * @param sourceDataPaths The source data array paths that are to be copied
+ * @param compaction The compaction of the elements the source arrays belong to
+ * @param shouldCancel Should the algorithm be canceled
+ * @param messageHandler The message handler to use for messages.
+ * @return Result<>
+ */
+SIMPLNX_EXPORT Result<> transferElementData(DataStructure& dataStructure, AttributeMatrix& destAttributeMatrix, const std::vector<DataPath>& sourceDataPaths, const StreamCompaction& compaction,
+                                            const std::atomic_bool& shouldCancel, const IFilter::MessageHandler& messageHandler);
+
 SIMPLNX_EXPORT void CreateDataArrayActions(const DataStructure& dataStructure, const AttributeMatrix* sourceAttrMatPtr, const MultiArraySelectionParameter::ValueType& selectedArrayPaths,
                                            const DataPath& reducedGeometryPathAttrMatPath, Result<OutputActions>& resultOutputActions);
 } // namespace TransferGeometryElementData
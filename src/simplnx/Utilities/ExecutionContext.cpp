@@ -0,0 +1,263 @@
+#include "ExecutionContext.hpp"
+
+#include "simplnx/Core/Preferences.hpp"
+
+#ifdef SIMPLNX_ENABLE_MULTICORE
+#include <tbb/blocked_range.h>
+#include <tbb/info.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_arena.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+
+using namespace nx::core;
+
+namespace
+{
+thread_local const ExecutionContext* t_CurrentContext = nullptr;
+
+std::mutex& DefaultContextMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+ExecutionContext& DefaultContext()
+{
+  static ExecutionContext context;
+  return context;
+}
+
+// Incremented whenever the default context changes so threads know when their cached copy is stale
+std::atomic<uint64>& DefaultContextGeneration()
+{
+  static std::atomic<uint64> generation = 0;
+  return generation;
+}
+
+thread_local ExecutionContext t_CachedDefaultContext;
+thread_local uint64 t_CachedDefaultGeneration = std::numeric_limits<uint64>::max();
+
+/**
+ * @brief Installs a context as the current context of the calling thread and restores the previous one when destroyed.
+ */
+class CurrentContextGuard
+{
+public:
+  explicit CurrentContextGuard(const ExecutionContext* context)
+  : m_Previous(t_CurrentContext)
+  {
+    t_CurrentContext = context;
+  }
+
+  ~CurrentContextGuard() noexcept
+  {
+    t_CurrentContext = m_Previous;
+  }
+
+  CurrentContextGuard(const CurrentContextGuard&) = delete;
+  CurrentContextGuard(CurrentContextGuard&&) noexcept = delete;
+  CurrentContextGuard& operator=(const CurrentContextGuard&) = delete;
+  CurrentContextGuard& operator=(CurrentContextGuard&&) noexcept = delete;
+
+private:
+  const ExecutionContext* m_Previous = nullptr;
+};
+} // namespace
+
+#ifdef SIMPLNX_ENABLE_MULTICORE
+struct ExecutionContext::Arena
+{
+  Arena(int32 maxConcurrency, int32 numaNode)
+  : taskArena(tbb::task_arena::constraints(numaNode, maxConcurrency))
+  {
+  }
+
+  tbb::task_arena taskArena;
+};
+#else
+struct ExecutionContext::Arena
+{
+};
+#endif
+
+// -----------------------------------------------------------------------------
+ExecutionContext::ExecutionContext() = default;
+
+// -----------------------------------------------------------------------------
+ExecutionContext::~ExecutionContext() noexcept = default;
+
+// -----------------------------------------------------------------------------
+ExecutionContext ExecutionContext::FromPreferences(const Preferences& preferences)
+{
+  ExecutionContext context;
+  context.m_MaxConcurrency = static_cast<usize>(std::max<int64>(preferences.maxThreads(), 0));
+  context.m_GrainSize = static_cast<usize>(std::max<int64>(preferences.parallelGrainSize(), 0));
+  context.m_NumaNode = preferences.numaNode();
+  context.m_FirstTouchAllocation = preferences.firstTouchAllocation();
+  context.updateArena();
+  return context;
+}
+
+// -----------------------------------------------------------------------------
+ExecutionContext ExecutionContext::Current()
+{
+  if(t_CurrentContext != nullptr)
+  {
+    return *t_CurrentContext;
+  }
+  // Every parallel algorithm asks for the current context, so the default is only copied under the lock after it changed
+  if(DefaultContextGeneration().load(std::memory_order_acquire) != t_CachedDefaultGeneration)
+  {
+    std::lock_guard<std::mutex> lock(DefaultContextMutex());
+    t_CachedDefaultContext = DefaultContext();
+    t_CachedDefaultGeneration = DefaultContextGeneration().load(std::memory_order_relaxed);
+  }
+  return t_CachedDefaultContext;
+}
+
+// -----------------------------------------------------------------------------
+void ExecutionContext::SetDefault(const ExecutionContext& context)
+{
+  std::lock_guard<std::mutex> lock(DefaultContextMutex());
+  DefaultContext() = context;
+  DefaultContextGeneration().fetch_add(1, std::memory_order_release);
+}
+
+// -----------------------------------------------------------------------------
+std::vector<int32> ExecutionContext::NumaNodes()
+{
+#ifdef SIMPLNX_ENABLE_MULTICORE
+  std::vector<tbb::numa_node_id> numaNodes = tbb::info::numa_nodes();
+  return {numaNodes.begin(), numaNodes.end()};
+#else
+  return {k_AnyNumaNode};
+#endif
+}
+
+// -----------------------------------------------------------------------------
+usize ExecutionContext::getMaxConcurrency() const
+{
+  return m_MaxConcurrency;
+}
+
+// -----------------------------------------------------------------------------
+void ExecutionContext::setMaxConcurrency(usize maxConcurrency)
+{
+  m_MaxConcurrency = maxConcurrency;
+  updateArena();
+}
+
+// -----------------------------------------------------------------------------
+usize ExecutionContext::getConcurrency() const
+{
+#ifdef SIMPLNX_ENABLE_MULTICORE
+  if(m_Arena != nullptr)
+  {
+    return static_cast<usize>(m_Arena->taskArena.max_concurrency());
+  }
+  return static_cast<usize>(tbb::this_task_arena::max_concurrency());
+#else
+  return 1;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+usize ExecutionContext::getGrainSize() const
+{
+  return m_GrainSize;
+}
+
+// -----------------------------------------------------------------------------
+void ExecutionContext::setGrainSize(usize grainSize)
+{
+  m_GrainSize = grainSize;
+}
+
+// -----------------------------------------------------------------------------
+int32 ExecutionContext::getNumaNode() const
+{
+  return m_NumaNode;
+}
+
+// -----------------------------------------------------------------------------
+void ExecutionContext::setNumaNode(int32 numaNode)
+{
+  m_NumaNode = numaNode;
+  updateArena();
+}
+
+// -----------------------------------------------------------------------------
+bool ExecutionContext::getFirstTouchAllocation() const
+{
+  return m_FirstTouchAllocation;
+}
+
+// -----------------------------------------------------------------------------
+void ExecutionContext::setFirstTouchAllocation(bool firstTouch)
+{
+  m_FirstTouchAllocation = firstTouch;
+}
+
+// -----------------------------------------------------------------------------
+void ExecutionContext::execute(const std::function<void()>& function) const
+{
+  CurrentContextGuard guard(this);
+#ifdef SIMPLNX_ENABLE_MULTICORE
+  if(m_Arena != nullptr)
+  {
+    // Re-entering the arena from one of its own threads runs the function directly
+    m_Arena->taskArena.execute(function);
+    return;
+  }
+#endif
+  function();
+}
+
+// -----------------------------------------------------------------------------
+void ExecutionContext::initializeBuffer(usize size, const std::function<void(usize, usize)>& initializer) const
+{
+#ifdef SIMPLNX_ENABLE_MULTICORE
+  if(m_FirstTouchAllocation && size >= k_FirstTouchMinimumSize && getConcurrency() > 1)
+  {
+    execute([size, &initializer]() {
+      // The static partitioner hands every thread one contiguous block, so each thread touches the pages it is most likely to work on
+      tbb::parallel_for(
+          tbb::blocked_range<usize>(0, size), [&initializer](const tbb::blocked_range<usize>& range) { initializer(range.begin(), range.end()); }, tbb::static_partitioner());
+    });
+    return;
+  }
+#endif
+  initializer(0, size);
+}
+
+// -----------------------------------------------------------------------------
+void ExecutionContext::updateArena()
+{
+#ifdef SIMPLNX_ENABLE_MULTICORE
+  const std::vector<int32> numaNodes = NumaNodes();
+  const bool pinToNode = m_NumaNode != k_AnyNumaNode && std::find(numaNodes.cbegin(), numaNodes.cend(), m_NumaNode) != numaNodes.cend();
+  if(m_MaxConcurrency == 0 && !pinToNode)
+  {
+    m_Arena.reset();
+    return;
+  }
+  // task_arena::automatic is only declared, so it is copied into locals instead of being bound to a reference by ?:
+  int32 maxConcurrency = tbb::task_arena::automatic;
+  if(m_MaxConcurrency != 0)
+  {
+    maxConcurrency = static_cast<int32>(m_MaxConcurrency);
+  }
+  int32 numaNode = tbb::task_arena::automatic;
+  if(pinToNode)
+  {
+    numaNode = m_NumaNode;
+  }
+  m_Arena = std::make_shared<Arena>(maxConcurrency, numaNode);
+#endif
+}
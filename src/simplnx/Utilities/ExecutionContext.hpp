@@ -0,0 +1,151 @@
+#pragma once
+
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace nx::core
+{
+class Preferences;
+
+/**
+ * @class ExecutionContext
+ * @brief Describes where and how the parallel algorithms of a filter run.
+ *
+ * A context limits the number of threads, optionally pins those threads to a NUMA node and
+ * carries a grain size hint for the Parallel*Algorithm classes. Code that runs inside execute()
+ * uses a TBB arena with these limits, so every parallel algorithm started from it is confined to
+ * the arena. The context is also installed as ExecutionContext::Current() for the calling thread
+ * while execute() runs. TBB worker threads do not see the installed context but still run in its arena.
+ *
+ * Copies of a context share the same arena. When nothing is installed, Current() returns the
+ * default context, which the Application creates from the Preferences.
+ */
+class SIMPLNX_EXPORT ExecutionContext
+{
+public:
+  static inline constexpr int32 k_AnyNumaNode = -1;
+  static inline constexpr usize k_FirstTouchMinimumSize = 1024 * 1024; // Buffers with fewer values are initialized serially
+
+  ExecutionContext();
+  ~ExecutionContext() noexcept;
+
+  ExecutionContext(const ExecutionContext&) = default;
+  ExecutionContext(ExecutionContext&&) noexcept = default;
+  ExecutionContext& operator=(const ExecutionContext&) = default;
+  ExecutionContext& operator=(ExecutionContext&&) noexcept = default;
+
+  /**
+   * @brief Creates a context from the threading values of the preferences.
+   * @param preferences
+   * @return ExecutionContext
+   */
+  static ExecutionContext FromPreferences(const Preferences& preferences);
+
+  /**
+   * @brief Returns the context installed on the calling thread by execute() or the default context.
+   * @return ExecutionContext
+   */
+  static ExecutionContext Current();
+
+  /**
+   * @brief Sets the context returned by Current() on threads that are not inside execute().
+   * @param context
+   */
+  static void SetDefault(const ExecutionContext& context);
+
+  /**
+   * @brief Returns the ids of the NUMA nodes that threads can be pinned to. Returns
+   * {k_AnyNumaNode} if NUMA information is not available.
+   * @return std::vector<int32>
+   */
+  static std::vector<int32> NumaNodes();
+
+  /**
+   * @brief Returns the maximum number of threads. 0 means all available threads.
+   * @return usize
+   */
+  usize getMaxConcurrency() const;
+
+  /**
+   * @brief Sets the maximum number of threads. 0 uses all available threads.
+   * @param maxConcurrency
+   */
+  void setMaxConcurrency(usize maxConcurrency);
+
+  /**
+   * @brief Returns the number of threads that parallel algorithms inside this context can use.
+   * @return usize
+   */
+  usize getConcurrency() const;
+
+  /**
+   * @brief Returns the preferred minimum number of elements per parallel task. 0 lets TBB decide.
+   * @return usize
+   */
+  usize getGrainSize() const;
+
+  /**
+   * @brief Sets the preferred minimum number of elements per parallel task. 0 lets TBB decide.
+   * @param grainSize
+   */
+  void setGrainSize(usize grainSize);
+
+  /**
+   * @brief Returns the NUMA node the threads are pinned to or k_AnyNumaNode.
+   * @return int32
+   */
+  int32 getNumaNode() const;
+
+  /**
+   * @brief Pins the threads to the NUMA node. Nodes that are not listed by NumaNodes() are ignored.
+   * @param numaNode
+   */
+  void setNumaNode(int32 numaNode);
+
+  /**
+   * @brief Returns true if new data store buffers are initialized by the threads of this context.
+   * @return bool
+   */
+  bool getFirstTouchAllocation() const;
+
+  /**
+   * @brief Sets whether new data store buffers are initialized in parallel by the threads of this
+   * context, so their memory pages are placed close to the threads that work on them.
+   * @param firstTouch
+   */
+  void setFirstTouchAllocation(bool firstTouch);
+
+  /**
+   * @brief Runs the function inside this context's arena with this context installed as Current().
+   * @param function
+   */
+  void execute(const std::function<void()>& function) const;
+
+  /**
+   * @brief Initializes a new buffer of the given number of values. The initializer is called with
+   * [begin, end) ranges that cover the buffer. The ranges are spread over the threads of this context
+   * if first touch allocation is enabled and the buffer is large enough.
+   * @param size
+   * @param initializer void(usize begin, usize end)
+   */
+  void initializeBuffer(usize size, const std::function<void(usize, usize)>& initializer) const;
+
+private:
+  struct Arena;
+
+  /**
+   * @brief Creates the arena that matches the current limits or removes it if there are none.
+   */
+  void updateArena();
+
+  usize m_MaxConcurrency = 0;
+  usize m_GrainSize = 0;
+  int32 m_NumaNode = k_AnyNumaNode;
+  bool m_FirstTouchAllocation = false;
+  std::shared_ptr<Arena> m_Arena;
+};
+} // namespace nx::core
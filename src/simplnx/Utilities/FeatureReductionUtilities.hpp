@@ -0,0 +1,532 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+/**
+ * Parallel reductions from elements (cells, vertices, ...) to the features they belong to and
+ * broadcasts from features back to their elements, keyed by a featureIds array.
+ *
+ * FeatureReduce() accumulates one value per feature and component. Any type with the following
+ * members can be used as the reduction operation, the structs below cover the common cases:
+ *
+ *   using AccumulatorType = ...;
+ *   AccumulatorType identity() const;
+ *   void accumulate(AccumulatorType& accumulator, ValueType value, usize elementIndex) const;
+ *   void merge(AccumulatorType& accumulator, const AccumulatorType& later) const;
+ *
+ * The elements are split into a fixed number of contiguous chunks that only depend on the number of
+ * elements and features. Every chunk fills its own accumulators and the chunks are merged in element
+ * order, so merge() always receives the accumulator of the later elements and the result is the same
+ * for every thread count.
+ */
+namespace nx::core::FeatureReductionUtilities
+{
+inline constexpr int32 k_InvalidFeatureIdError = -48610;
+inline constexpr int32 k_TupleCountMismatchError = -48611;
+inline constexpr int32 k_ComponentCountMismatchError = -48612;
+
+inline constexpr usize k_MinElementsPerChunk = 65536;
+inline constexpr usize k_MaxChunks = 64;
+inline constexpr usize k_NoElement = std::numeric_limits<usize>::max();
+
+template <typename T, typename AccumT = T>
+struct Sum
+{
+  using AccumulatorType = AccumT;
+
+  AccumulatorType identity() const
+  {
+    return static_cast<AccumulatorType>(0);
+  }
+
+  void accumulate(AccumulatorType& accumulator, T value, usize elementIndex) const
+  {
+    accumulator += static_cast<AccumulatorType>(value);
+  }
+
+  void merge(AccumulatorType& accumulator, const AccumulatorType& later) const
+  {
+    accumulator += later;
+  }
+};
+
+template <typename T>
+struct Min
+{
+  using AccumulatorType = T;
+
+  AccumulatorType identity() const
+  {
+    return std::numeric_limits<T>::max();
+  }
+
+  void accumulate(AccumulatorType& accumulator, T value, usize elementIndex) const
+  {
+    accumulator = std::min(accumulator, value);
+  }
+
+  void merge(AccumulatorType& accumulator, const AccumulatorType& later) const
+  {
+    accumulator = std::min(accumulator, later);
+  }
+};
+
+template <typename T>
+struct Max
+{
+  using AccumulatorType = T;
+
+  AccumulatorType identity() const
+  {
+    return std::numeric_limits<T>::lowest();
+  }
+
+  void accumulate(AccumulatorType& accumulator, T value, usize elementIndex) const
+  {
+    accumulator = std::max(accumulator, value);
+  }
+
+  void merge(AccumulatorType& accumulator, const AccumulatorType& later) const
+  {
+    accumulator = std::max(accumulator, later);
+  }
+};
+
+/**
+ * @brief Counts the elements of each feature. The element values are ignored.
+ */
+struct Count
+{
+  using AccumulatorType = uint64;
+
+  AccumulatorType identity() const
+  {
+    return 0;
+  }
+
+  template <typename T>
+  void accumulate(AccumulatorType& accumulator, T value, usize elementIndex) const
+  {
+    accumulator++;
+  }
+
+  void merge(AccumulatorType& accumulator, const AccumulatorType& later) const
+  {
+    accumulator += later;
+  }
+};
+
+/**
+ * @brief Averages the element values of each feature using a compensated (Kahan) sum.
+ */
+template <typename T>
+struct Mean
+{
+  struct AccumulatorType
+  {
+    float64 sum = 0.0;
+    float64 compensation = 0.0;
+    uint64 count = 0;
+  };
+
+  AccumulatorType identity() const
+  {
+    return {};
+  }
+
+  void accumulate(AccumulatorType& accumulator, T value, usize elementIndex) const
+  {
+    const float64 compensated = static_cast<float64>(value) - accumulator.compensation;
+    const float64 sum = accumulator.sum + compensated;
+    accumulator.compensation = (sum - accumulator.sum) - compensated;
+    accumulator.sum = sum;
+    accumulator.count++;
+  }
+
+  void merge(AccumulatorType& accumulator, const AccumulatorType& later) const
+  {
+    // Keep the rounding error of adding both partial sums
+    const float64 sum = accumulator.sum + later.sum;
+    const float64 error = std::abs(accumulator.sum) >= std::abs(later.sum) ? (accumulator.sum - sum) + later.sum : (later.sum - sum) + accumulator.sum;
+    accumulator.compensation = accumulator.compensation + later.compensation - error;
+    accumulator.sum = sum;
+    accumulator.count += later.count;
+  }
+
+  /**
+   * @brief Returns the mean or fallback if the feature has no elements.
+   */
+  static float64 GetMean(const AccumulatorType& accumulator, float64 fallback = 0.0)
+  {
+    return accumulator.count == 0 ? fallback : (accumulator.sum - accumulator.compensation) / static_cast<float64>(accumulator.count);
+  }
+};
+
+/**
+ * @brief Keeps the value of the first element of each feature.
+ */
+template <typename T>
+struct First
+{
+  struct AccumulatorType
+  {
+    T value = {};
+    usize elementIndex = k_NoElement;
+  };
+
+  AccumulatorType identity() const
+  {
+    return {};
+  }
+
+  void accumulate(AccumulatorType& accumulator, T value, usize elementIndex) const
+  {
+    if(accumulator.elementIndex == k_NoElement)
+    {
+      accumulator = {value, elementIndex};
+    }
+  }
+
+  void merge(AccumulatorType& accumulator, const AccumulatorType& later) const
+  {
+    if(accumulator.elementIndex == k_NoElement)
+    {
+      accumulator = later;
+    }
+  }
+};
+
+/**
+ * @brief Keeps the value of the last element of each feature.
+ */
+template <typename T>
+struct Last
+{
+  struct AccumulatorType
+  {
+    T value = {};
+    usize elementIndex = k_NoElement;
+  };
+
+  AccumulatorType identity() const
+  {
+    return {};
+  }
+
+  void accumulate(AccumulatorType& accumulator, T value, usize elementIndex) const
+  {
+    accumulator = {value, elementIndex};
+  }
+
+  void merge(AccumulatorType& accumulator, const AccumulatorType& later) const
+  {
+    if(later.elementIndex != k_NoElement)
+    {
+      accumulator = later;
+    }
+  }
+};
+
+namespace detail
+{
+/**
+ * @brief Returns the number of chunks the elements are split into. Each chunk holds one accumulator per
+ * feature and component, so fewer chunks are used when there are many features.
+ */
+inline usize GetNumberOfChunks(usize numElements, usize numAccumulators)
+{
+  const usize chunkSize = std::max(k_MinElementsPerChunk, numAccumulators * 4);
+  return std::clamp<usize>(numElements / chunkSize, 1, k_MaxChunks);
+}
+
+/**
+ * @brief Returns an error naming the first element whose feature id is outside [0, numFeatures).
+ */
+template <typename T>
+Result<T> MakeInvalidFeatureIdResult(const Int32AbstractDataStore& featureIds, usize numFeatures)
+{
+  const usize numElements = featureIds.getNumberOfTuples();
+  for(usize i = 0; i < numElements; i++)
+  {
+    const int32 featureId = featureIds[i];
+    if(featureId < 0 || static_cast<usize>(featureId) >= numFeatures)
+    {
+      return MakeErrorResult<T>(k_InvalidFeatureIdError, fmt::format("Element {} has the feature id {}, which is outside the valid range [0, {})", i, featureId, numFeatures));
+    }
+  }
+  return MakeErrorResult<T>(k_InvalidFeatureIdError, fmt::format("The feature ids are outside the valid range [0, {})", numFeatures));
+}
+
+template <typename ReduceOp, typename ValueFunc>
+class ReduceChunksImpl
+{
+public:
+  using AccumulatorType = typename ReduceOp::AccumulatorType;
+
+  ReduceChunksImpl(const Int32AbstractDataStore& featureIds, usize numFeatures, usize numComponents, const ValueFunc& valueFunc, const ReduceOp& reduceOp,
+                   std::vector<std::vector<AccumulatorType>>& chunkAccumulators, std::atomic_bool& invalidFeatureId, const std::atomic_bool& shouldCancel)
+  : m_FeatureIds(featureIds)
+  , m_NumFeatures(numFeatures)
+  , m_NumComponents(numComponents)
+  , m_ValueFunc(valueFunc)
+  , m_ReduceOp(reduceOp)
+  , m_ChunkAccumulators(chunkAccumulators)
+  , m_InvalidFeatureId(invalidFeatureId)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize numElements = m_FeatureIds.getNumberOfTuples();
+    const usize numChunks = m_ChunkAccumulators.size();
+    for(usize chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      std::vector<AccumulatorType>& accumulators = m_ChunkAccumulators[chunk];
+      accumulators.assign(m_NumFeatures * m_NumComponents, m_ReduceOp.identity());
+
+      const usize chunkEnd = numElements * (chunk + 1) / numChunks;
+      for(usize i = numElements * chunk / numChunks; i < chunkEnd; i++)
+      {
+        if(m_ShouldCancel || m_InvalidFeatureId)
+        {
+          return;
+        }
+
+        const int32 featureId = m_FeatureIds[i];
+        if(featureId < 0 || static_cast<usize>(featureId) >= m_NumFeatures)
+        {
+          m_InvalidFeatureId = true;
+          return;
+        }
+
+        const usize offset = static_cast<usize>(featureId) * m_NumComponents;
+        for(usize comp = 0; comp < m_NumComponents; comp++)
+        {
+          m_ReduceOp.accumulate(accumulators[offset + comp], m_ValueFunc(i, comp), i);
+        }
+      }
+    }
+  }
+
+private:
+  const Int32AbstractDataStore& m_FeatureIds;
+  usize m_NumFeatures;
+  usize m_NumComponents;
+  const ValueFunc& m_ValueFunc;
+  const ReduceOp& m_ReduceOp;
+  std::vector<std::vector<AccumulatorType>>& m_ChunkAccumulators;
+  std::atomic_bool& m_InvalidFeatureId;
+  const std::atomic_bool& m_ShouldCancel;
+};
+
+template <typename ReduceOp>
+class MergeChunksImpl
+{
+public:
+  using AccumulatorType = typename ReduceOp::AccumulatorType;
+
+  MergeChunksImpl(const ReduceOp& reduceOp, std::vector<std::vector<AccumulatorType>>& chunkAccumulators)
+  : m_ReduceOp(reduceOp)
+  , m_ChunkAccumulators(chunkAccumulators)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    std::vector<AccumulatorType>& result = m_ChunkAccumulators[0];
+    for(usize chunk = 1; chunk < m_ChunkAccumulators.size(); chunk++)
+    {
+      const std::vector<AccumulatorType>& later = m_ChunkAccumulators[chunk];
+      for(usize i = range.min(); i < range.max(); i++)
+      {
+        m_ReduceOp.merge(result[i], later[i]);
+      }
+    }
+  }
+
+private:
+  const ReduceOp& m_ReduceOp;
+  std::vector<std::vector<AccumulatorType>>& m_ChunkAccumulators;
+};
+
+template <typename T>
+class BroadcastImpl
+{
+public:
+  BroadcastImpl(const Int32AbstractDataStore& featureIds, const AbstractDataStore<T>& featureValues, AbstractDataStore<T>& elementValues, std::atomic_bool& invalidFeatureId,
+                const std::atomic_bool& shouldCancel)
+  : m_FeatureIds(featureIds)
+  , m_FeatureValues(featureValues)
+  , m_ElementValues(elementValues)
+  , m_InvalidFeatureId(invalidFeatureId)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize numComponents = m_FeatureValues.getNumberOfComponents();
+    const usize numFeatures = m_FeatureValues.getNumberOfTuples();
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      if(m_ShouldCancel || m_InvalidFeatureId)
+      {
+        return;
+      }
+
+      const int32 featureId = m_FeatureIds[i];
+      if(featureId < 0 || static_cast<usize>(featureId) >= numFeatures)
+      {
+        m_InvalidFeatureId = true;
+        return;
+      }
+
+      for(usize comp = 0; comp < numComponents; comp++)
+      {
+        m_ElementValues[i * numComponents + comp] = m_FeatureValues[static_cast<usize>(featureId) * numComponents + comp];
+      }
+    }
+  }
+
+private:
+  const Int32AbstractDataStore& m_FeatureIds;
+  const AbstractDataStore<T>& m_FeatureValues;
+  AbstractDataStore<T>& m_ElementValues;
+  std::atomic_bool& m_InvalidFeatureId;
+  const std::atomic_bool& m_ShouldCancel;
+};
+} // namespace detail
+
+/**
+ * @brief Reduces the values of all elements into one accumulator per feature and component.
+ * valueFunc(elementIndex, component) returns the value of one element component. The returned
+ * accumulators are ordered by feature and then by component. An empty vector is returned when
+ * the reduction is cancelled.
+ * @param featureIds
+ * @param numFeatures
+ * @param numComponents
+ * @param valueFunc
+ * @param reduceOp
+ * @param shouldCancel
+ * @return Result<std::vector<typename ReduceOp::AccumulatorType>>
+ */
+template <typename ReduceOp, typename ValueFunc>
+Result<std::vector<typename ReduceOp::AccumulatorType>> FeatureReduce(const Int32AbstractDataStore& featureIds, usize numFeatures, usize numComponents, const ValueFunc& valueFunc,
+                                                                      const ReduceOp& reduceOp, const std::atomic_bool& shouldCancel = false)
+{
+  using AccumulatorType = typename ReduceOp::AccumulatorType;
+
+  const usize numAccumulators = numFeatures * numComponents;
+  const usize numChunks = detail::GetNumberOfChunks(featureIds.getNumberOfTuples(), numAccumulators);
+  std::vector<std::vector<AccumulatorType>> chunkAccumulators(numChunks);
+  std::atomic_bool invalidFeatureId = false;
+
+  ParallelDataAlgorithm reduceAlg;
+  reduceAlg.setRange(0, numChunks);
+  reduceAlg.setGrainSize(1);
+  reduceAlg.requireStoresInMemory({&featureIds});
+  reduceAlg.execute(detail::ReduceChunksImpl<ReduceOp, ValueFunc>(featureIds, numFeatures, numComponents, valueFunc, reduceOp, chunkAccumulators, invalidFeatureId, shouldCancel));
+
+  if(invalidFeatureId)
+  {
+    return detail::MakeInvalidFeatureIdResult<std::vector<AccumulatorType>>(featureIds, numFeatures);
+  }
+  if(shouldCancel)
+  {
+    return {};
+  }
+
+  if(numChunks > 1)
+  {
+    ParallelDataAlgorithm mergeAlg;
+    mergeAlg.setRange(0, numAccumulators);
+    mergeAlg.execute(detail::MergeChunksImpl<ReduceOp>(reduceOp, chunkAccumulators));
+  }
+  return {std::move(chunkAccumulators[0])};
+}
+
+/**
+ * @brief Reduces the values of an element array into one accumulator per feature and component.
+ * @param featureIds
+ * @param elementValues
+ * @param numFeatures
+ * @param reduceOp
+ * @param shouldCancel
+ * @return Result<std::vector<typename ReduceOp::AccumulatorType>>
+ */
+template <typename T, typename ReduceOp>
+Result<std::vector<typename ReduceOp::AccumulatorType>> FeatureReduce(const Int32AbstractDataStore& featureIds, const AbstractDataStore<T>& elementValues, usize numFeatures,
+                                                                      const ReduceOp& reduceOp, const std::atomic_bool& shouldCancel = false)
+{
+  if(elementValues.getNumberOfTuples() != featureIds.getNumberOfTuples())
+  {
+    return MakeErrorResult<std::vector<typename ReduceOp::AccumulatorType>>(
+        k_TupleCountMismatchError, fmt::format("The element array has {} tuples but there are {} feature ids", elementValues.getNumberOfTuples(), featureIds.getNumberOfTuples()));
+  }
+
+  const usize numComponents = elementValues.getNumberOfComponents();
+  auto valueFunc = [&elementValues, numComponents](usize elementIndex, usize comp) { return elementValues[elementIndex * numComponents + comp]; };
+  return FeatureReduce(featureIds, numFeatures, numComponents, valueFunc, reduceOp, shouldCancel);
+}
+
+/**
+ * @brief Counts the elements of each feature.
+ * @param featureIds
+ * @param numFeatures
+ * @param shouldCancel
+ * @return Result<std::vector<uint64>>
+ */
+inline Result<std::vector<uint64>> FeatureCount(const Int32AbstractDataStore& featureIds, usize numFeatures, const std::atomic_bool& shouldCancel = false)
+{
+  auto valueFunc = [](usize elementIndex, usize comp) { return 0; };
+  return FeatureReduce(featureIds, numFeatures, 1, valueFunc, Count{}, shouldCancel);
+}
+
+/**
+ * @brief Copies the value of each feature to all of its elements in parallel.
+ * @param featureIds
+ * @param featureValues
+ * @param elementValues
+ * @param shouldCancel
+ * @return Result<>
+ */
+template <typename T>
+Result<> FeatureBroadcast(const Int32AbstractDataStore& featureIds, const AbstractDataStore<T>& featureValues, AbstractDataStore<T>& elementValues, const std::atomic_bool& shouldCancel = false)
+{
+  if(elementValues.getNumberOfTuples() != featureIds.getNumberOfTuples())
+  {
+    return MakeErrorResult(k_TupleCountMismatchError,
+                           fmt::format("The element array has {} tuples but there are {} feature ids", elementValues.getNumberOfTuples(), featureIds.getNumberOfTuples()));
+  }
+  if(elementValues.getNumberOfComponents() != featureValues.getNumberOfComponents())
+  {
+    return MakeErrorResult(k_ComponentCountMismatchError, fmt::format("The element array has {} components but the feature array has {}", elementValues.getNumberOfComponents(),
+                                                                      featureValues.getNumberOfComponents()));
+  }
+
+  std::atomic_bool invalidFeatureId = false;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, featureIds.getNumberOfTuples());
+  dataAlg.requireStoresInMemory({&featureIds, &featureValues, &elementValues});
+  dataAlg.execute(detail::BroadcastImpl<T>(featureIds, featureValues, elementValues, invalidFeatureId, shouldCancel));
+
+  if(invalidFeatureId)
+  {
+    return detail::MakeInvalidFeatureIdResult<void>(featureIds, featureValues.getNumberOfTuples());
+  }
+  return {};
+}
+} // namespace nx::core::FeatureReductionUtilities
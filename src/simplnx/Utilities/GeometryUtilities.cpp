@@ -2,6 +2,17 @@
 
 #include "simplnx/Common/Array.hpp"
 #include "simplnx/Common/Result.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
+
+#ifdef SIMPLNX_ENABLE_MULTICORE
+#include <tbb/parallel_sort.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <tuple>
 
 using namespace nx::core;
 
@@ -9,43 +20,258 @@ namespace
 {
 constexpr float32 k_PartitionEdgePadding = 0.000001;
 const Point3Df k_Padding(k_PartitionEdgePadding, k_PartitionEdgePadding, k_PartitionEdgePadding);
-} // namespace
 
-GeometryUtilities::FindUniqueIdsImpl::FindUniqueIdsImpl(VertexStore& vertexStore, const std::vector<std::vector<size_t>>& nodesInBin, nx::core::Int64DataStore& uniqueIds)
-: m_VertexStore(vertexStore)
-, m_NodesInBin(nodesInBin)
-, m_UniqueIds(uniqueIds)
+/**
+ * @brief Sorts the range in parallel when multicore support is enabled
+ */
+template <class IteratorType, class CompareType>
+void SortEntries(IteratorType first, IteratorType last, CompareType compare)
 {
+#ifdef SIMPLNX_ENABLE_MULTICORE
+  tbb::parallel_sort(first, last, compare);
+#else
+  std::sort(first, last, compare);
+#endif
 }
 
-// -----------------------------------------------------------------------------
-void GeometryUtilities::FindUniqueIdsImpl::convert(size_t start, size_t end) const
+// Hashed cell key and vertex index. Hash collisions only add candidates that fail the distance test.
+using CellEntry = std::pair<uint64, usize>;
+
+/**
+ * @brief Returns the integer cell coordinates of the point for cells with an edge length of 'cellSize'.
+ */
+std::array<int64, 3> ComputeCell(const float32* point, const std::array<float32, 3>& origin, float32 cellSize)
+{
+  constexpr float64 k_MaxCell = static_cast<float64>(1LL << 60);
+  std::array<int64, 3> cell = {0, 0, 0};
+  for(usize dim = 0; dim < 3; dim++)
+  {
+    const float64 value = std::floor((static_cast<float64>(point[dim]) - origin[dim]) / cellSize);
+    cell[dim] = static_cast<int64>(std::clamp(value, -k_MaxCell, k_MaxCell));
+  }
+  return cell;
+}
+
+uint64 HashCell(int64 x, int64 y, int64 z)
+{
+  return (static_cast<uint64>(x) * 73856093ULL) ^ (static_cast<uint64>(y) * 19349663ULL) ^ (static_cast<uint64>(z) * 83492791ULL);
+}
+
+/**
+ * @brief Computes the hashed cell of every vertex
+ */
+class ComputeCellEntriesImpl
+{
+public:
+  ComputeCellEntriesImpl(const float32* coordinates, const std::array<float32, 3>& origin, float32 cellSize, std::vector<CellEntry>& cellEntries)
+  : m_Coordinates(coordinates)
+  , m_Origin(origin)
+  , m_CellSize(cellSize)
+  , m_CellEntries(cellEntries)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      const auto cell = ComputeCell(m_Coordinates + i * 3, m_Origin, m_CellSize);
+      m_CellEntries[i] = {HashCell(cell[0], cell[1], cell[2]), i};
+    }
+  }
+
+private:
+  const float32* m_Coordinates;
+  const std::array<float32, 3>& m_Origin;
+  float32 m_CellSize;
+  std::vector<CellEntry>& m_CellEntries;
+};
+
+/**
+ * @brief Finds the lowest index vertex within the tolerance of each vertex by searching the 27
+ * cells surrounding it
+ */
+class FindWeldedVerticesImpl
 {
-  int64* uniqueIdsPtr = m_UniqueIds.data();
-  for(size_t i = start; i < end; i++)
+public:
+  FindWeldedVerticesImpl(const float32* coordinates, const std::array<float32, 3>& origin, float32 tolerance, const std::vector<CellEntry>& cellEntries, std::vector<usize>& firstOccurrence)
+  : m_Coordinates(coordinates)
+  , m_Origin(origin)
+  , m_Tolerance(tolerance)
+  , m_CellEntries(cellEntries)
+  , m_FirstOccurrence(firstOccurrence)
+  {
+  }
+
+  void operator()(const Range& range) const
   {
-    for(size_t j = 0; j < m_NodesInBin[i].size(); j++)
+    const float32 toleranceSquared = m_Tolerance * m_Tolerance;
+    for(usize i = range.min(); i < range.max(); i++)
     {
-      size_t node1 = m_NodesInBin[i][j];
-      if(uniqueIdsPtr[node1] == static_cast<int64_t>(node1))
+      const float32* point = m_Coordinates + i * 3;
+      const auto cell = ComputeCell(point, m_Origin, m_Tolerance);
+      usize first = i;
+      for(int64 z = -1; z <= 1; z++)
       {
-        for(size_t k = j + 1; k < m_NodesInBin[i].size(); k++)
+        for(int64 y = -1; y <= 1; y++)
         {
-          size_t node2 = m_NodesInBin[i][k];
-          if(m_VertexStore[node1 * 3] == m_VertexStore[node2 * 3] && m_VertexStore[node1 * 3 + 1] == m_VertexStore[node2 * 3 + 1] && m_VertexStore[node1 * 3 + 2] == m_VertexStore[node2 * 3 + 2])
+          for(int64 x = -1; x <= 1; x++)
           {
-            uniqueIdsPtr[node2] = node1;
+            const uint64 key = HashCell(cell[0] + x, cell[1] + y, cell[2] + z);
+            // Entries of a cell are sorted by vertex index, so stop at the first candidate that cannot lower 'first'
+            for(auto iter = std::lower_bound(m_CellEntries.begin(), m_CellEntries.end(), CellEntry{key, 0}); iter != m_CellEntries.end() && iter->first == key && iter->second < first; ++iter)
+            {
+              const float32* candidate = m_Coordinates + iter->second * 3;
+              const float32 dx = candidate[0] - point[0];
+              const float32 dy = candidate[1] - point[1];
+              const float32 dz = candidate[2] - point[2];
+              if(dx * dx + dy * dy + dz * dz <= toleranceSquared)
+              {
+                first = iter->second;
+                break;
+              }
+            }
           }
         }
       }
+      m_FirstOccurrence[i] = first;
     }
   }
-}
+
+private:
+  const float32* m_Coordinates;
+  const std::array<float32, 3>& m_Origin;
+  float32 m_Tolerance;
+  const std::vector<CellEntry>& m_CellEntries;
+  std::vector<usize>& m_FirstOccurrence;
+};
+
+/**
+ * @brief Assigns every run of identical vertices in the sorted order to the run's first vertex. Each
+ * run is handled by the thread whose range contains the start of the run.
+ */
+class FindIdenticalVerticesImpl
+{
+public:
+  FindIdenticalVerticesImpl(const float32* coordinates, const std::vector<usize>& order, std::vector<usize>& firstOccurrence)
+  : m_Coordinates(coordinates)
+  , m_Order(order)
+  , m_FirstOccurrence(firstOccurrence)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize position = range.min(); position < range.max(); position++)
+    {
+      if(position > 0 && isIdentical(m_Order[position - 1], m_Order[position]))
+      {
+        continue;
+      }
+      const usize first = m_Order[position];
+      for(usize runPosition = position; runPosition < m_Order.size() && isIdentical(first, m_Order[runPosition]); runPosition++)
+      {
+        m_FirstOccurrence[m_Order[runPosition]] = first;
+      }
+    }
+  }
+
+private:
+  bool isIdentical(usize lhs, usize rhs) const
+  {
+    const float32* lhsCoords = m_Coordinates + lhs * 3;
+    const float32* rhsCoords = m_Coordinates + rhs * 3;
+    return lhsCoords[0] == rhsCoords[0] && lhsCoords[1] == rhsCoords[1] && lhsCoords[2] == rhsCoords[2];
+  }
+
+  const float32* m_Coordinates;
+  const std::vector<usize>& m_Order;
+  std::vector<usize>& m_FirstOccurrence;
+};
+} // namespace
 
 // -----------------------------------------------------------------------------
-void GeometryUtilities::FindUniqueIdsImpl::operator()(const Range& range) const
+usize GeometryUtilities::FindUniqueVertexIds(const AbstractDataStore<IGeometry::SharedVertexList::value_type>& vertices, float32 tolerance, std::vector<IGeometry::MeshIndexType>& uniqueIds)
 {
-  convert(range.min(), range.max());
+  const usize numVertices = vertices.getNumberOfTuples();
+  uniqueIds.resize(numVertices);
+  if(numVertices == 0)
+  {
+    return 0;
+  }
+
+  // Work on a contiguous view of the coordinates, copying them only if the store is not in memory
+  std::vector<float32> coordinateCopy;
+  const float32* coordinates = nullptr;
+  if(const auto* dataStore = dynamic_cast<const DataStore<float32>*>(&vertices); dataStore != nullptr)
+  {
+    coordinates = dataStore->data();
+  }
+  else
+  {
+    coordinateCopy.resize(numVertices * 3);
+    for(usize i = 0; i < coordinateCopy.size(); i++)
+    {
+      coordinateCopy[i] = vertices.getValue(i);
+    }
+    coordinates = coordinateCopy.data();
+  }
+
+  std::vector<usize> firstOccurrence(numVertices);
+  if(tolerance > 0.0F)
+  {
+    // Hash every vertex into a cell the size of the tolerance and sort the vertices by cell
+    std::array<float32, 3> origin = {coordinates[0], coordinates[1], coordinates[2]};
+    for(usize i = 1; i < numVertices; i++)
+    {
+      for(usize dim = 0; dim < 3; dim++)
+      {
+        origin[dim] = std::min(origin[dim], coordinates[i * 3 + dim]);
+      }
+    }
+    std::vector<CellEntry> cellEntries(numVertices);
+    {
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0ULL, numVertices);
+      dataAlg.execute(ComputeCellEntriesImpl(coordinates, origin, tolerance, cellEntries));
+    }
+    SortEntries(cellEntries.begin(), cellEntries.end(), [](const CellEntry& lhs, const CellEntry& rhs) { return lhs < rhs; });
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0ULL, numVertices);
+    dataAlg.execute(FindWeldedVerticesImpl(coordinates, origin, tolerance, cellEntries, firstOccurrence));
+  }
+  else
+  {
+    // Identical vertices are adjacent once sorted by their coordinates, with the first occurrence leading each run
+    std::vector<usize> order(numVertices);
+    std::iota(order.begin(), order.end(), 0);
+    SortEntries(order.begin(), order.end(), [coordinates](usize lhs, usize rhs) {
+      const float32* lhsCoords = coordinates + lhs * 3;
+      const float32* rhsCoords = coordinates + rhs * 3;
+      return std::tie(lhsCoords[0], lhsCoords[1], lhsCoords[2], lhs) < std::tie(rhsCoords[0], rhsCoords[1], rhsCoords[2], rhs);
+    });
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0ULL, numVertices);
+    dataAlg.execute(FindIdenticalVerticesImpl(coordinates, order, firstOccurrence));
+  }
+
+  // Renumber the unique vertices in order of first occurrence
+  usize uniqueCount = 0;
+  for(usize i = 0; i < numVertices; i++)
+  {
+    if(firstOccurrence[i] == i)
+    {
+      uniqueIds[i] = static_cast<IGeometry::MeshIndexType>(uniqueCount);
+      uniqueCount++;
+    }
+    else
+    {
+      uniqueIds[i] = uniqueIds[firstOccurrence[i]];
+    }
+  }
+  return uniqueCount;
 }
 
 Result<FloatVec3> GeometryUtilities::CalculatePartitionLengthsByPartitionCount(const INodeGeometry0D& geometry, const SizeVec3& numberOfPartitionsPerAxis)
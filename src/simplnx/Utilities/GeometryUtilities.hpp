@@ -11,23 +11,18 @@
 namespace nx::core::GeometryUtilities
 {
 /**
- * @brief The FindUniqueIdsImpl class implements a threaded algorithm that determines the set of
- * unique vertices in a given geometry
+ * @brief Finds the vertices that coincide and assigns every vertex the id of the unique vertex it
+ * is merged into. Unique vertices are numbered in the order of their first occurrence, so the id of
+ * a vertex is never larger than its index. With a tolerance of 0 only vertices with identical
+ * coordinates are merged. Otherwise, vertices closer than the tolerance are merged into the first
+ * such vertex. The search sorts the vertices instead of binning them into a fixed grid, so memory
+ * is proportional to the vertex count and clustered vertices do not degrade the search.
+ * @param vertices The vertex coordinates (3 components per tuple)
+ * @param tolerance The maximum distance between merged vertices
+ * @param uniqueIds Output unique vertex id for every vertex
+ * @return The number of unique vertices
  */
-class SIMPLNX_EXPORT FindUniqueIdsImpl
-{
-public:
-  using VertexStore = nx::core::AbstractDataStore<nx::core::IGeometry::SharedVertexList::value_type>;
-  FindUniqueIdsImpl(VertexStore& vertexStore, const std::vector<std::vector<size_t>>& nodesInBin, nx::core::Int64DataStore& uniqueIds);
-
-  void convert(size_t start, size_t end) const;
-  void operator()(const Range& range) const;
-
-private:
-  const VertexStore& m_VertexStore;
-  const std::vector<std::vector<size_t>>& m_NodesInBin;
-  nx::core::Int64DataStore& m_UniqueIds;
-};
+SIMPLNX_EXPORT usize FindUniqueVertexIds(const AbstractDataStore<IGeometry::SharedVertexList::value_type>& vertices, float32 tolerance, std::vector<IGeometry::MeshIndexType>& uniqueIds);
 
 /**
  * @brief Calculates the X,Y,Z partition length for a given geometry if the geometry were partitioned into equal numberOfPartitionsPerAxis partitions.
@@ -78,14 +73,12 @@ SIMPLNX_EXPORT Result<FloatVec3> CalculatePartitionLengthsOfBoundingBox(const Bo
 /**
  * @brief Removes duplicate nodes to ensure the vertex list is unique
  * @param geom The geometry to eliminate the duplicate nodes from.  This MUST be a node-based geometry.
+ * @param scaleFactor Optional factor applied to the remaining vertices
+ * @param tolerance Vertices closer than this distance are merged. 0 only merges identical vertices.
  */
 template <class GeometryType = INodeGeometry1D, class = std::enable_if_t<std::is_base_of<INodeGeometry1D, GeometryType>::value>>
-Result<> EliminateDuplicateNodes(GeometryType& geom, std::optional<float32> scaleFactor = std::nullopt)
+Result<> EliminateDuplicateNodes(GeometryType& geom, std::optional<float32> scaleFactor = std::nullopt, float32 tolerance = 0.0F)
 {
-  usize numXBins = 100;
-  usize numYBins = 100;
-  usize numZBins = 100;
-
   using SharedVertList = AbstractDataStore<IGeometry::SharedVertexList::value_type>;
 
   SharedVertList& vertices = geom.getVertices()->getDataStoreRef();
@@ -110,81 +103,10 @@ Result<> EliminateDuplicateNodes(GeometryType& geom, std::optional<float32> scal
   }
   AbstractDataStore<INodeGeometry1D::MeshIndexArrayType::value_type>& cellsRef = cells->getDataStoreRef();
 
-  IGeometry::MeshIndexType nNodesAll = geom.getNumberOfVertices();
-  size_t nNodes = 0;
-  if(nNodesAll > 0)
-  {
-    nNodes = static_cast<size_t>(nNodesAll);
-  }
-
-  auto boundingBox = geom.getBoundingBox();
-  auto minPoint = boundingBox.getMinPoint();
-  auto maxPoint = boundingBox.getMaxPoint();
-  float32 stepX = (maxPoint.getX() - minPoint.getX()) / numXBins;
-  float32 stepY = (maxPoint.getY() - minPoint.getY()) / numYBins;
-  float32 stepZ = (maxPoint.getZ() - minPoint.getZ()) / numZBins;
+  const usize nNodes = geom.getNumberOfVertices();
 
-  std::vector<std::vector<usize>> nodesInBin(numXBins * numYBins * numZBins);
-
-  // determine (xyz) bin each node falls in - used to speed up node comparison
-  usize xBin = 0, yBin = 0, zBin = 0;
-  for(size_t i = 0; i < nNodes; i++)
-  {
-    if(stepX != 0.0)
-    {
-      xBin = static_cast<usize>((vertices[i * 3] - minPoint.getX()) / stepX);
-    }
-    if(stepY != 0.0)
-    {
-      yBin = static_cast<usize>((vertices[i * 3 + 1] - minPoint.getY()) / stepY);
-    }
-    if(stepZ != 0)
-    {
-      zBin = static_cast<usize>((vertices[i * 3 + 2] - minPoint.getZ()) / stepZ);
-    }
-    if(xBin == numXBins)
-    {
-      xBin = numXBins - 1;
-    }
-    if(yBin == numYBins)
-    {
-      yBin = numYBins - 1;
-    }
-    if(zBin == numZBins)
-    {
-      zBin = numZBins - 1;
-    }
-    usize bin = (zBin * numYBins * numXBins) + (yBin * numXBins) + xBin;
-    nodesInBin[bin].push_back(i);
-  }
-
-  // Create array to hold unique node numbers
-  Int64DataStore uniqueIds(IDataStore::ShapeType{nNodes}, IDataStore::ShapeType{1}, {});
-  for(IGeometry::MeshIndexType i = 0; i < nNodesAll; i++)
-  {
-    uniqueIds[i] = static_cast<int64>(i);
-  }
-
-  // Parallel algorithm to find duplicate nodes
-  ParallelDataAlgorithm dataAlg;
-  dataAlg.setParallelizationEnabled(true);
-  dataAlg.setRange(0ULL, static_cast<usize>(numXBins * numYBins * numZBins));
-  dataAlg.execute(GeometryUtilities::FindUniqueIdsImpl(vertices, nodesInBin, uniqueIds));
-
-  // renumber the unique nodes
-  int64 uniqueCount = 0;
-  for(usize i = 0; i < nNodes; i++)
-  {
-    if(uniqueIds[i] == static_cast<int64>(i))
-    {
-      uniqueIds[i] = uniqueCount;
-      uniqueCount++;
-    }
-    else
-    {
-      uniqueIds[i] = uniqueIds[uniqueIds[i]];
-    }
-  }
+  std::vector<IGeometry::MeshIndexType> uniqueIds;
+  const usize uniqueCount = FindUniqueVertexIds(vertices, tolerance, uniqueIds);
 
   float32 scaleFactorValue = 1.0F;
   if(scaleFactor.has_value())
@@ -192,12 +114,19 @@ Result<> EliminateDuplicateNodes(GeometryType& geom, std::optional<float32> scal
     scaleFactorValue = scaleFactor.value();
   }
 
-  // Move nodes to uniqueIds and then resize nodes array and apply optional scaling
-  for(size_t i = 0; i < nNodes; i++)
+  // Move the first occurrence of each unique node to its new position, then resize nodes array and apply optional scaling.
+  // Unique ids never exceed the node index, so this can be done in place.
+  IGeometry::MeshIndexType nextUniqueId = 0;
+  for(usize i = 0; i < nNodes; i++)
   {
+    if(uniqueIds[i] != nextUniqueId)
+    {
+      continue;
+    }
     vertices[uniqueIds[i] * 3] = vertices[i * 3] * scaleFactorValue;
     vertices[uniqueIds[i] * 3 + 1] = vertices[i * 3 + 1] * scaleFactorValue;
     vertices[uniqueIds[i] * 3 + 2] = vertices[i * 3 + 2] * scaleFactorValue;
+    nextUniqueId++;
   }
   geom.resizeVertexList(uniqueCount);
 
@@ -229,7 +158,7 @@ Result<> EliminateDuplicateNodes(GeometryType& geom, std::optional<float32> scal
   {
     for(usize j = 0; j < nVerticesPerCell; j++)
     {
-      auto node = static_cast<int64>(cellsRef[i * nVerticesPerCell + j]);
+      auto node = static_cast<usize>(cellsRef[i * nVerticesPerCell + j]);
       cellsRef[i * nVerticesPerCell + j] = uniqueIds[node];
     }
   }
@@ -0,0 +1,182 @@
+#pragma once
+
+#include "simplnx/Common/Array.hpp"
+#include "simplnx/Common/Types.hpp"
+
+#include <array>
+
+namespace nx::core
+{
+/**
+ * @brief The neighbors of a grid cell: the cells sharing a face (6), a face or an edge (18) or a face,
+ * an edge or a vertex (26) with it.
+ */
+enum class GridConnectivity : uint8
+{
+  Face = 6,
+  FaceEdge = 18,
+  FaceEdgeVertex = 26
+};
+
+namespace detail
+{
+template <GridConnectivity ConnectivityV>
+constexpr std::array<std::array<int64, 3>, static_cast<usize>(ConnectivityV)> MakeNeighborSteps()
+{
+  // Neighbors differing in one axis share a face, two axes an edge and three axes a vertex
+  constexpr int64 k_MaxChangedAxes = ConnectivityV == GridConnectivity::Face ? 1 : (ConnectivityV == GridConnectivity::FaceEdge ? 2 : 3);
+
+  std::array<std::array<int64, 3>, static_cast<usize>(ConnectivityV)> steps = {};
+  usize count = 0;
+  for(int64 dz = -1; dz <= 1; dz++)
+  {
+    for(int64 dy = -1; dy <= 1; dy++)
+    {
+      for(int64 dx = -1; dx <= 1; dx++)
+      {
+        const int64 changedAxes = (dx != 0 ? 1 : 0) + (dy != 0 ? 1 : 0) + (dz != 0 ? 1 : 0);
+        if(changedAxes == 0 || changedAxes > k_MaxChangedAxes)
+        {
+          continue;
+        }
+        steps[count] = {dx, dy, dz};
+        count++;
+      }
+    }
+  }
+  return steps;
+}
+} // namespace detail
+
+/**
+ * @brief GridNeighborhood visits the neighbors of cells in a structured grid (ImageGeom, RectGridGeom)
+ * with the given connectivity.
+ *
+ * The neighbors are visited in z, y, x order of their offsets, so the face neighbors come in the order
+ * -z, -y, -x, +x, +y, +z that the algorithms have always used. Cells that do not touch the grid
+ * boundary take a path without any bounds checks and the boundary path tests every axis without
+ * branching, so the loops can be unrolled by the compiler.
+ *
+ * @code
+ *  const GridNeighborhood<GridConnectivity::Face> neighborhood(imageGeom.getDimensions());
+ *  neighborhood.forEachNeighbor(cellIndex, [&](usize neighborIndex, usize slot) {
+ *    // ...
+ *  });
+ * @endcode
+ */
+template <GridConnectivity ConnectivityV>
+class GridNeighborhood
+{
+public:
+  static inline constexpr usize k_NumNeighbors = static_cast<usize>(ConnectivityV);
+  static inline constexpr std::array<std::array<int64, 3>, k_NumNeighbors> k_Steps = detail::MakeNeighborSteps<ConnectivityV>();
+
+  explicit GridNeighborhood(const SizeVec3& dims)
+  : m_Dims({static_cast<int64>(dims[0]), static_cast<int64>(dims[1]), static_cast<int64>(dims[2])})
+  {
+    for(usize slot = 0; slot < k_NumNeighbors; slot++)
+    {
+      m_Offsets[slot] = (k_Steps[slot][2] * m_Dims[1] + k_Steps[slot][1]) * m_Dims[0] + k_Steps[slot][0];
+    }
+  }
+
+  /**
+   * @brief Returns the difference between the index of a neighbor and the index of the cell for every slot.
+   * @return const std::array<int64, k_NumNeighbors>&
+   */
+  const std::array<int64, k_NumNeighbors>& getOffsets() const
+  {
+    return m_Offsets;
+  }
+
+  /**
+   * @brief Returns true if the cell does not touch the boundary of the grid, i.e. all of its neighbors exist.
+   * @param x
+   * @param y
+   * @param z
+   * @return bool
+   */
+  bool isInterior(usize x, usize y, usize z) const
+  {
+    return x > 0 && y > 0 && z > 0 && static_cast<int64>(x) + 1 < m_Dims[0] && static_cast<int64>(y) + 1 < m_Dims[1] && static_cast<int64>(z) + 1 < m_Dims[2];
+  }
+
+  /**
+   * @brief Returns true if the cell does not touch the boundary of the grid, i.e. all of its neighbors exist.
+   * @param index
+   * @return bool
+   */
+  bool isInterior(usize index) const
+  {
+    const auto position = getPosition(index);
+    return isInterior(position[0], position[1], position[2]);
+  }
+
+  /**
+   * @brief Returns the x, y and z index of a cell.
+   * @param index
+   * @return std::array<usize, 3>
+   */
+  std::array<usize, 3> getPosition(usize index) const
+  {
+    const auto xDim = static_cast<usize>(m_Dims[0]);
+    const auto yDim = static_cast<usize>(m_Dims[1]);
+    return {index % xDim, (index / xDim) % yDim, index / (xDim * yDim)};
+  }
+
+  /**
+   * @brief Calls func(neighborIndex, slot) for every neighbor of the cell that lies inside the grid.
+   * slot is the position of the neighbor in k_Steps.
+   * @param index
+   * @param func
+   */
+  template <typename FuncT>
+  void forEachNeighbor(usize index, FuncT&& func) const
+  {
+    const auto position = getPosition(index);
+    forEachNeighbor(index, position[0], position[1], position[2], func);
+  }
+
+  /**
+   * @brief Calls func(neighborIndex, slot) for every neighbor of the cell that lies inside the grid.
+   * Use this overload when the x, y and z index of the cell are already known.
+   * @param index
+   * @param x
+   * @param y
+   * @param z
+   * @param func
+   */
+  template <typename FuncT>
+  void forEachNeighbor(usize index, usize x, usize y, usize z, FuncT&& func) const
+  {
+    const auto signedIndex = static_cast<int64>(index);
+    if(isInterior(x, y, z))
+    {
+      for(usize slot = 0; slot < k_NumNeighbors; slot++)
+      {
+        func(static_cast<usize>(signedIndex + m_Offsets[slot]), slot);
+      }
+      return;
+    }
+
+    const std::array<int64, 3> position = {static_cast<int64>(x), static_cast<int64>(y), static_cast<int64>(z)};
+    for(usize slot = 0; slot < k_NumNeighbors; slot++)
+    {
+      bool inside = true;
+      for(usize axis = 0; axis < 3; axis++)
+      {
+        const int64 neighborPosition = position[axis] + k_Steps[slot][axis];
+        inside &= (neighborPosition >= 0) & (neighborPosition < m_Dims[axis]);
+      }
+      if(inside)
+      {
+        func(static_cast<usize>(signedIndex + m_Offsets[slot]), slot);
+      }
+    }
+  }
+
+private:
+  std::array<int64, 3> m_Dims;
+  std::array<int64, k_NumNeighbors> m_Offsets = {};
+};
+} // namespace nx::core
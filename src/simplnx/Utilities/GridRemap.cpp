@@ -0,0 +1,243 @@
+#include "GridRemap.hpp"
+
+#include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+using namespace nx::core;
+
+namespace
+{
+struct CopySlabFunctor
+{
+  template <typename T>
+  void operator()(const GridRemap& remap, const IDataArray& sourceArray, IDataArray& destArray, usize zStart, usize zEnd)
+  {
+    const auto& sourceStore = sourceArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
+    auto& destStore = destArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
+    remap.copySlab<T>(sourceStore, destStore, zStart, zEnd);
+  }
+};
+
+class CopySlabsImpl
+{
+public:
+  CopySlabsImpl(const GridRemap& remap, const std::vector<GridRemap::ArrayPair>& arrays, const std::atomic_bool& shouldCancel)
+  : m_Remap(remap)
+  , m_Arrays(arrays)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize numSlabs = m_Remap.getNumberOfSlabs();
+    const usize planesPerSlab = m_Remap.getPlanesPerSlab();
+    const usize numPlanes = m_Remap.getDestDims()[2];
+    for(usize task = range.min(); task < range.max(); task++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      // Consecutive tasks walk the slabs of one array so each thread streams through contiguous memory
+      const auto& [sourceArray, destArray] = m_Arrays[task / numSlabs];
+      const usize zStart = (task % numSlabs) * planesPerSlab;
+      const usize zEnd = std::min(zStart + planesPerSlab, numPlanes);
+      ExecuteDataFunction(CopySlabFunctor{}, sourceArray->getDataType(), m_Remap, *sourceArray, *destArray, zStart, zEnd);
+    }
+  }
+
+private:
+  const GridRemap& m_Remap;
+  const std::vector<GridRemap::ArrayPair>& m_Arrays;
+  const std::atomic_bool& m_ShouldCancel;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+Result<GridRemap> GridRemap::Create(const SizeVec3& sourceDims, const SizeVec3& destDims, std::array<AxisMap, 3> axisMaps)
+{
+  for(usize axis = 0; axis < 3; axis++)
+  {
+    if(axisMaps[axis].size() != destDims[axis])
+    {
+      return MakeErrorResult<GridRemap>(k_AxisMapSizeError,
+                                        fmt::format("The map for axis {} has {} entries but the destination grid has {} cells along that axis", axis, axisMaps[axis].size(), destDims[axis]));
+    }
+    for(int64 sourceIndex : axisMaps[axis])
+    {
+      if(sourceIndex != k_NoSource && (sourceIndex < 0 || static_cast<usize>(sourceIndex) >= sourceDims[axis]))
+      {
+        return MakeErrorResult<GridRemap>(k_AxisMapRangeError,
+                                          fmt::format("The map for axis {} references source index {} but the source grid has {} cells along that axis", axis, sourceIndex, sourceDims[axis]));
+      }
+    }
+  }
+
+  GridRemap remap;
+  remap.m_SourceDims = sourceDims;
+  remap.m_DestDims = destDims;
+  remap.m_AxisMaps = std::move(axisMaps);
+
+  // Split the x map into blocks of consecutive source indices
+  const AxisMap& xMap = remap.m_AxisMaps[0];
+  for(usize x = 0; x < xMap.size(); x++)
+  {
+    if(xMap[x] == k_NoSource)
+    {
+      continue;
+    }
+    if(!remap.m_Runs.empty())
+    {
+      Run& lastRun = remap.m_Runs.back();
+      if(lastRun.destX + lastRun.length == x && lastRun.sourceX + lastRun.length == static_cast<usize>(xMap[x]))
+      {
+        lastRun.length++;
+        continue;
+      }
+    }
+    remap.m_Runs.push_back({x, static_cast<usize>(xMap[x]), 1});
+  }
+
+  return {std::move(remap)};
+}
+
+// -----------------------------------------------------------------------------
+Result<GridRemap> GridRemap::Crop(const SizeVec3& sourceDims, const std::array<usize, 6>& bounds)
+{
+  SizeVec3 destDims;
+  std::array<AxisMap, 3> axisMaps;
+  for(usize axis = 0; axis < 3; axis++)
+  {
+    const usize minIndex = bounds[axis * 2];
+    const usize maxIndex = bounds[axis * 2 + 1];
+    if(minIndex >= maxIndex || maxIndex > sourceDims[axis])
+    {
+      return MakeErrorResult<GridRemap>(k_AxisMapRangeError,
+                                        fmt::format("The crop bounds [{}, {}) along axis {} are not inside the source grid which has {} cells along that axis", minIndex, maxIndex, axis, sourceDims[axis]));
+    }
+    destDims[axis] = maxIndex - minIndex;
+    axisMaps[axis].resize(destDims[axis]);
+    for(usize i = 0; i < destDims[axis]; i++)
+    {
+      axisMaps[axis][i] = static_cast<int64>(minIndex + i);
+    }
+  }
+  return Create(sourceDims, destDims, std::move(axisMaps));
+}
+
+// -----------------------------------------------------------------------------
+Result<GridRemap> GridRemap::Resample(const SizeVec3& sourceDims, const FloatVec3& sourceSpacing, const SizeVec3& destDims, const FloatVec3& destSpacing)
+{
+  std::array<AxisMap, 3> axisMaps;
+  for(usize axis = 0; axis < 3; axis++)
+  {
+    if(sourceDims[axis] == 0)
+    {
+      return MakeErrorResult<GridRemap>(k_AxisMapRangeError, fmt::format("The source grid has no cells along axis {}", axis));
+    }
+    const auto lastIndex = static_cast<int64>(sourceDims[axis] - 1);
+    axisMaps[axis].resize(destDims[axis]);
+    for(usize i = 0; i < destDims[axis]; i++)
+    {
+      const float32 position = static_cast<float32>(i) * destSpacing[axis];
+      axisMaps[axis][i] = std::min(static_cast<int64>(position / sourceSpacing[axis]), lastIndex);
+    }
+  }
+  return Create(sourceDims, destDims, std::move(axisMaps));
+}
+
+// -----------------------------------------------------------------------------
+Result<GridRemap> GridRemap::Place(const SizeVec3& sourceDims, const SizeVec3& destDims, const SizeVec3& offset, const std::array<bool, 3>& mirror)
+{
+  std::array<AxisMap, 3> axisMaps;
+  for(usize axis = 0; axis < 3; axis++)
+  {
+    axisMaps[axis].resize(destDims[axis]);
+    for(usize i = 0; i < destDims[axis]; i++)
+    {
+      const usize unmirroredIndex = mirror[axis] ? destDims[axis] - 1 - i : i;
+      const bool inSource = unmirroredIndex >= offset[axis] && unmirroredIndex - offset[axis] < sourceDims[axis];
+      axisMaps[axis][i] = inSource ? static_cast<int64>(unmirroredIndex - offset[axis]) : k_NoSource;
+    }
+  }
+  return Create(sourceDims, destDims, std::move(axisMaps));
+}
+
+// -----------------------------------------------------------------------------
+GridRemap::~GridRemap() noexcept = default;
+
+// -----------------------------------------------------------------------------
+const SizeVec3& GridRemap::getSourceDims() const
+{
+  return m_SourceDims;
+}
+
+// -----------------------------------------------------------------------------
+const SizeVec3& GridRemap::getDestDims() const
+{
+  return m_DestDims;
+}
+
+// -----------------------------------------------------------------------------
+const GridRemap::AxisMap& GridRemap::getAxisMap(usize axis) const
+{
+  return m_AxisMaps[axis];
+}
+
+// -----------------------------------------------------------------------------
+const std::vector<GridRemap::Run>& GridRemap::getRuns() const
+{
+  return m_Runs;
+}
+
+// -----------------------------------------------------------------------------
+usize GridRemap::getPlanesPerSlab() const
+{
+  const usize planeSize = std::max<usize>(m_DestDims[0] * m_DestDims[1], 1);
+  return std::max<usize>(k_MinCellsPerSlab / planeSize, 1);
+}
+
+// -----------------------------------------------------------------------------
+usize GridRemap::getNumberOfSlabs() const
+{
+  const usize planesPerSlab = getPlanesPerSlab();
+  return (m_DestDims[2] + planesPerSlab - 1) / planesPerSlab;
+}
+
+// -----------------------------------------------------------------------------
+Result<> GridRemap::copyArrays(const std::vector<ArrayPair>& arrays, const std::atomic_bool& shouldCancel) const
+{
+  const usize numSourceCells = m_SourceDims[0] * m_SourceDims[1] * m_SourceDims[2];
+  const usize numDestCells = m_DestDims[0] * m_DestDims[1] * m_DestDims[2];
+
+  IParallelAlgorithm::AlgorithmArrays algorithmArrays;
+  for(const auto& [sourceArray, destArray] : arrays)
+  {
+    if(sourceArray->getNumberOfTuples() != numSourceCells || destArray->getNumberOfTuples() != numDestCells)
+    {
+      return MakeErrorResult(k_TupleCountMismatchError, fmt::format("Arrays '{}' ({} tuples) and '{}' ({} tuples) do not match the source grid ({} cells) and destination grid ({} cells)",
+                                                                    sourceArray->getName(), sourceArray->getNumberOfTuples(), destArray->getName(), destArray->getNumberOfTuples(), numSourceCells,
+                                                                    numDestCells));
+    }
+    if(sourceArray->getNumberOfComponents() != destArray->getNumberOfComponents())
+    {
+      return MakeErrorResult(k_ComponentMismatchError, fmt::format("Array '{}' has {} components but array '{}' has {}", sourceArray->getName(), sourceArray->getNumberOfComponents(),
+                                                                   destArray->getName(), destArray->getNumberOfComponents()));
+    }
+    if(sourceArray->getDataType() != destArray->getDataType())
+    {
+      return MakeErrorResult(k_DataTypeMismatchError, fmt::format("Array '{}' is of type {} but array '{}' is of type {}", sourceArray->getName(), DataTypeToString(sourceArray->getDataType()),
+                                                                  destArray->getName(), DataTypeToString(destArray->getDataType())));
+    }
+    algorithmArrays.push_back(sourceArray);
+    algorithmArrays.push_back(destArray);
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, arrays.size() * getNumberOfSlabs());
+  dataAlg.setGrainSize(1);
+  dataAlg.requireArraysInMemory(algorithmArrays);
+  dataAlg.execute(CopySlabsImpl(*this, arrays, shouldCancel));
+  return {};
+}
@@ -0,0 +1,205 @@
+#pragma once
+
+#include "simplnx/Common/Array.hpp"
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/DataStructure/IDataArray.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @brief GridRemap moves the cell data of a source image grid into a destination image grid
+ * (cropping, resampling, appending). The mapping is separable: every destination x, y and z index
+ * maps to one source index along the same axis, or to k_NoSource. The map therefore only takes
+ * destX + destY + destZ entries instead of one entry per destination cell.
+ *
+ * The x map is split once into runs of consecutive source indices, and every destination row is
+ * copied as a handful of contiguous blocks. The copy is parallelized over arrays and z slabs.
+ * Destination cells without a source are left unchanged.
+ */
+class SIMPLNX_EXPORT GridRemap
+{
+public:
+  static inline constexpr int64 k_NoSource = -1;
+  static inline constexpr usize k_MinCellsPerSlab = 65536;
+  static inline constexpr usize k_BufferSize = 65536;
+
+  static inline constexpr int32 k_AxisMapSizeError = -4820;
+  static inline constexpr int32 k_AxisMapRangeError = -4821;
+  static inline constexpr int32 k_TupleCountMismatchError = -4822;
+  static inline constexpr int32 k_ComponentMismatchError = -4823;
+  static inline constexpr int32 k_DataTypeMismatchError = -4824;
+
+  using AxisMap = std::vector<int64>;
+  using ArrayPair = std::pair<const IDataArray*, IDataArray*>;
+
+  /**
+   * @brief A block of consecutive destination x indices that map to consecutive source x indices.
+   */
+  struct Run
+  {
+    usize destX = 0;
+    usize sourceX = 0;
+    usize length = 0;
+  };
+
+  /**
+   * @brief Creates a remap from explicit axis maps. Each map holds one entry per destination index
+   * along its axis.
+   * @param sourceDims
+   * @param destDims
+   * @param axisMaps
+   * @return Result<GridRemap>
+   */
+  static Result<GridRemap> Create(const SizeVec3& sourceDims, const SizeVec3& destDims, std::array<AxisMap, 3> axisMaps);
+
+  /**
+   * @brief Creates the remap of a crop. The bounds are {xMin, xMax, yMin, yMax, zMin, zMax} with
+   * exclusive maximums and the destination has the dimensions of the bounds.
+   * @param sourceDims
+   * @param bounds
+   * @return Result<GridRemap>
+   */
+  static Result<GridRemap> Crop(const SizeVec3& sourceDims, const std::array<usize, 6>& bounds);
+
+  /**
+   * @brief Creates the remap of a nearest-neighbor resample. Destination cell i along an axis takes
+   * the source cell that contains i * destSpacing.
+   * @param sourceDims
+   * @param sourceSpacing
+   * @param destDims
+   * @param destSpacing
+   * @return Result<GridRemap>
+   */
+  static Result<GridRemap> Resample(const SizeVec3& sourceDims, const FloatVec3& sourceSpacing, const SizeVec3& destDims, const FloatVec3& destSpacing);
+
+  /**
+   * @brief Creates the remap that places the whole source grid into the destination grid starting
+   * at offset. If mirror is set for an axis the destination is mirrored along that axis afterwards.
+   * @param sourceDims
+   * @param destDims
+   * @param offset
+   * @param mirror
+   * @return Result<GridRemap>
+   */
+  static Result<GridRemap> Place(const SizeVec3& sourceDims, const SizeVec3& destDims, const SizeVec3& offset, const std::array<bool, 3>& mirror = {false, false, false});
+
+  GridRemap(const GridRemap&) = default;
+  GridRemap(GridRemap&&) noexcept = default;
+  GridRemap& operator=(const GridRemap&) = default;
+  GridRemap& operator=(GridRemap&&) noexcept = default;
+  ~GridRemap() noexcept;
+
+  const SizeVec3& getSourceDims() const;
+  const SizeVec3& getDestDims() const;
+  const AxisMap& getAxisMap(usize axis) const;
+  const std::vector<Run>& getRuns() const;
+
+  /**
+   * @brief Returns the number of destination z planes copied by each parallel task.
+   * @return usize
+   */
+  usize getPlanesPerSlab() const;
+
+  /**
+   * @brief Returns the number of z slabs the copy is split into.
+   * @return usize
+   */
+  usize getNumberOfSlabs() const;
+
+  /**
+   * @brief Copies the destination z planes [zStart, zEnd) of a single store.
+   * @param source
+   * @param dest
+   * @param zStart
+   * @param zEnd
+   */
+  template <typename T>
+  void copySlab(const AbstractDataStore<T>& source, AbstractDataStore<T>& dest, usize zStart, usize zEnd) const
+  {
+    const usize numComps = dest.getNumberOfComponents();
+    const usize sourceRowSize = m_SourceDims[0];
+    const usize sourcePlaneSize = m_SourceDims[0] * m_SourceDims[1];
+    const usize destRowSize = m_DestDims[0];
+    const usize destPlaneSize = m_DestDims[0] * m_DestDims[1];
+
+    const auto* sourceDataStore = dynamic_cast<const DataStore<T>*>(&source);
+    auto* destDataStore = dynamic_cast<DataStore<T>*>(&dest);
+    const T* sourcePtr = sourceDataStore != nullptr ? sourceDataStore->data() : nullptr;
+    T* destPtr = destDataStore != nullptr ? destDataStore->data() : nullptr;
+    // Only used when one of the stores does not keep its values in memory
+    std::unique_ptr<T[]> buffer;
+
+    for(usize z = zStart; z < zEnd; z++)
+    {
+      const int64 sourceZ = m_AxisMaps[2][z];
+      if(sourceZ == k_NoSource)
+      {
+        continue;
+      }
+      for(usize y = 0; y < m_DestDims[1]; y++)
+      {
+        const int64 sourceY = m_AxisMaps[1][y];
+        if(sourceY == k_NoSource)
+        {
+          continue;
+        }
+        const usize sourceRowStart = static_cast<usize>(sourceZ) * sourcePlaneSize + static_cast<usize>(sourceY) * sourceRowSize;
+        const usize destRowStart = z * destPlaneSize + y * destRowSize;
+        for(const Run& run : m_Runs)
+        {
+          const usize sourceOffset = (sourceRowStart + run.sourceX) * numComps;
+          const usize destOffset = (destRowStart + run.destX) * numComps;
+          const usize count = run.length * numComps;
+          if(sourcePtr != nullptr && destPtr != nullptr)
+          {
+            std::copy(sourcePtr + sourceOffset, sourcePtr + sourceOffset + count, destPtr + destOffset);
+          }
+          else
+          {
+            if(buffer == nullptr)
+            {
+              buffer = std::make_unique<T[]>(k_BufferSize);
+            }
+            for(usize offset = 0; offset < count; offset += k_BufferSize)
+            {
+              const usize chunkSize = std::min(k_BufferSize, count - offset);
+              source.copyIntoBuffer(sourceOffset + offset, nonstd::span<T>(buffer.get(), chunkSize));
+              dest.copyFromBuffer(destOffset + offset, nonstd::span<const T>(buffer.get(), chunkSize));
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Copies every source array into its destination array. The arrays must hold one tuple per
+   * cell of their grid and each pair must have the same DataType and number of components.
+   * @param arrays
+   * @param shouldCancel
+   * @return Result<>
+   */
+  Result<> copyArrays(const std::vector<ArrayPair>& arrays, const std::atomic_bool& shouldCancel = false) const;
+
+private:
+  GridRemap() = default;
+
+  SizeVec3 m_SourceDims;
+  SizeVec3 m_DestDims;
+  std::array<AxisMap, 3> m_AxisMaps;
+  std::vector<Run> m_Runs;
+};
+} // namespace nx::core
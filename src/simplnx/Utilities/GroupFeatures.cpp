@@ -0,0 +1,232 @@
+#include "GroupFeatures.hpp"
+
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <fmt/format.h>
+
+using namespace nx::core;
+
+namespace
+{
+/**
+ * @brief Lock-free disjoint set forest. Roots are always linked below the smaller root id so
+ * concurrent unions can never form a cycle.
+ */
+class ConcurrentDisjointSet
+{
+public:
+  explicit ConcurrentDisjointSet(usize size)
+  : m_Parents(size)
+  {
+    for(usize i = 0; i < size; i++)
+    {
+      m_Parents[i].store(static_cast<int32>(i), std::memory_order_relaxed);
+    }
+  }
+
+  int32 find(int32 element)
+  {
+    while(true)
+    {
+      int32 parent = m_Parents[element].load(std::memory_order_acquire);
+      if(parent == element)
+      {
+        return element;
+      }
+      int32 grandParent = m_Parents[parent].load(std::memory_order_acquire);
+      if(parent != grandParent)
+      {
+        // Path halving. Losing this race is harmless, another thread already shortened the path.
+        m_Parents[element].compare_exchange_weak(parent, grandParent, std::memory_order_acq_rel);
+      }
+      element = grandParent;
+    }
+  }
+
+  void unite(int32 first, int32 second)
+  {
+    while(true)
+    {
+      first = find(first);
+      second = find(second);
+      if(first == second)
+      {
+        return;
+      }
+      if(first > second)
+      {
+        std::swap(first, second);
+      }
+      int32 expected = second;
+      if(m_Parents[second].compare_exchange_strong(expected, first, std::memory_order_acq_rel))
+      {
+        return;
+      }
+    }
+  }
+
+private:
+  std::vector<std::atomic<int32>> m_Parents;
+};
+
+/**
+ * @brief Evaluates the grouping criterion of every neighbor pair (lower id first) and flags the
+ * accepted pairs at their position in the flattened neighbor list.
+ */
+class EvaluatePairsImpl
+{
+public:
+  EvaluatePairsImpl(const GroupFeatures& grouping, const NeighborList<int32>& neighborList, const std::vector<usize>& offsets, std::vector<uint8>& acceptedPairs,
+                    const std::atomic_bool& shouldCancel)
+  : m_Grouping(grouping)
+  , m_NeighborList(neighborList)
+  , m_Offsets(offsets)
+  , m_AcceptedPairs(acceptedPairs)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize feature = range.min(); feature < range.max(); feature++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      const auto& neighbors = m_NeighborList.at(feature);
+      const usize offset = m_Offsets[feature];
+      for(usize index = 0; index < neighbors.size(); index++)
+      {
+        const int32 neighbor = neighbors[index];
+        if(neighbor > static_cast<int32>(feature) && m_Grouping.determineGrouping(static_cast<int32>(feature), neighbor))
+        {
+          m_AcceptedPairs[offset + index] = 1;
+        }
+      }
+    }
+  }
+
+private:
+  const GroupFeatures& m_Grouping;
+  const NeighborList<int32>& m_NeighborList;
+  const std::vector<usize>& m_Offsets;
+  std::vector<uint8>& m_AcceptedPairs;
+  const std::atomic_bool& m_ShouldCancel;
+};
+
+/**
+ * @brief Merges the sets of all accepted pairs
+ */
+class MergePairsImpl
+{
+public:
+  MergePairsImpl(ConcurrentDisjointSet& disjointSet, const NeighborList<int32>& neighborList, const std::vector<usize>& offsets, const std::vector<uint8>& acceptedPairs)
+  : m_DisjointSet(disjointSet)
+  , m_NeighborList(neighborList)
+  , m_Offsets(offsets)
+  , m_AcceptedPairs(acceptedPairs)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize feature = range.min(); feature < range.max(); feature++)
+    {
+      const auto& neighbors = m_NeighborList.at(feature);
+      const usize offset = m_Offsets[feature];
+      for(usize index = 0; index < neighbors.size(); index++)
+      {
+        if(m_AcceptedPairs[offset + index] != 0)
+        {
+          m_DisjointSet.unite(static_cast<int32>(feature), neighbors[index]);
+        }
+      }
+    }
+  }
+
+private:
+  ConcurrentDisjointSet& m_DisjointSet;
+  const NeighborList<int32>& m_NeighborList;
+  const std::vector<usize>& m_Offsets;
+  const std::vector<uint8>& m_AcceptedPairs;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+GroupFeatures::GroupFeatures(const std::atomic_bool& shouldCancel, const IFilter::MessageHandler& mesgHandler)
+: m_ShouldCancel(shouldCancel)
+, m_MessageHandler(mesgHandler)
+{
+}
+
+// -----------------------------------------------------------------------------
+GroupFeatures::~GroupFeatures() = default;
+
+// -----------------------------------------------------------------------------
+Result<int32> GroupFeatures::execute(const NeighborList<int32>& neighborList, usize seedStart, AbstractDataStore<int32>& featureParentIds)
+{
+  const usize numFeatures = featureParentIds.getNumberOfTuples();
+  if(static_cast<usize>(neighborList.getNumberOfTuples()) < numFeatures)
+  {
+    return MakeErrorResult<int32>(-23600, fmt::format("The neighbor list has {} tuples but {} features are being grouped.", neighborList.getNumberOfTuples(), numFeatures));
+  }
+  if(numFeatures == 0)
+  {
+    return {0};
+  }
+
+  // Flatten the neighbor list layout so every pair has a slot in the accepted pair flags
+  std::vector<usize> offsets(numFeatures + 1, 0);
+  for(usize feature = 0; feature < numFeatures; feature++)
+  {
+    offsets[feature + 1] = offsets[feature] + neighborList.at(feature).size();
+  }
+
+  m_MessageHandler(IFilter::Message{IFilter::Message::Type::Info, fmt::format("Evaluating {} neighbor pairs", offsets[numFeatures])});
+  std::vector<uint8> acceptedPairs(offsets[numFeatures], 0);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(1, numFeatures);
+    dataAlg.execute(EvaluatePairsImpl(*this, neighborList, offsets, acceptedPairs, m_ShouldCancel));
+  }
+  if(m_ShouldCancel)
+  {
+    return {0};
+  }
+
+  m_MessageHandler(IFilter::Message{IFilter::Message::Type::Info, "Merging grouped features"});
+  ConcurrentDisjointSet disjointSet(numFeatures);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(1, numFeatures);
+    dataAlg.execute(MergePairsImpl(disjointSet, neighborList, offsets, acceptedPairs));
+  }
+
+  // Number the parents in the order their first member is visited
+  std::vector<int32> rootParentIds(numFeatures, -1);
+  rootParentIds[0] = 0;
+  int32 parentCount = 1;
+  seedStart = seedStart % numFeatures;
+  for(usize counter = 0; counter < numFeatures; counter++)
+  {
+    usize feature = seedStart + counter;
+    if(feature >= numFeatures)
+    {
+      feature -= numFeatures;
+    }
+    if(feature == 0)
+    {
+      continue;
+    }
+    int32 root = disjointSet.find(static_cast<int32>(feature));
+    if(rootParentIds[root] == -1)
+    {
+      rootParentIds[root] = parentCount++;
+    }
+    featureParentIds[feature] = rootParentIds[root];
+  }
+  featureParentIds[0] = 0;
+
+  return {parentCount};
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/DataStructure/NeighborList.hpp"
+#include "simplnx/Filter/IFilter.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <atomic>
+#include <vector>
+
+namespace nx::core
+{
+
+/**
+ * @class GroupFeatures
+ * @brief The GroupFeatures class merges neighboring features into parent features. Subclasses
+ * only implement the pair criterion in determineGrouping(). All neighbor pairs are evaluated
+ * once in parallel and the accepted pairs are merged with a concurrent union-find, so the
+ * result only depends on the connectivity of the accepted pairs and not on the visiting order.
+ *
+ * Feature 0 is never grouped and always belongs to parent 0. The neighbor list is expected to
+ * be symmetric (as contiguous and non-contiguous neighbor lists are) so each pair is only
+ * evaluated from its lower feature id.
+ */
+class SIMPLNX_EXPORT GroupFeatures
+{
+public:
+  GroupFeatures(const std::atomic_bool& shouldCancel, const IFilter::MessageHandler& mesgHandler);
+
+  virtual ~GroupFeatures();
+
+  GroupFeatures(const GroupFeatures&) = delete;            // Copy Constructor Not Implemented
+  GroupFeatures(GroupFeatures&&) = delete;                 // Move Constructor Not Implemented
+  GroupFeatures& operator=(const GroupFeatures&) = delete; // Copy Assignment Not Implemented
+  GroupFeatures& operator=(GroupFeatures&&) = delete;      // Move Assignment Not Implemented
+
+  /**
+   * @brief Groups the features and writes the parent id of every feature into featureParentIds.
+   * Parent ids are handed out in the order the groups are first encountered when visiting the
+   * features circularly starting at 'seedStart'.
+   * @param neighborList The neighbor list of the features
+   * @param seedStart The first feature visited when numbering the parents
+   * @param featureParentIds Output parent id for each feature. Must have one tuple per feature.
+   * @return The number of parents, including parent 0
+   */
+  Result<int32> execute(const NeighborList<int32>& neighborList, usize seedStart, AbstractDataStore<int32>& featureParentIds);
+
+  /**
+   * @brief Returns true if the two neighboring features belong to the same parent. This is
+   * called concurrently from multiple threads and must not modify any shared state.
+   * @param referenceFeature
+   * @param neighborFeature
+   * @return bool
+   */
+  virtual bool determineGrouping(int32 referenceFeature, int32 neighborFeature) const = 0;
+
+protected:
+  const std::atomic_bool& m_ShouldCancel;
+  const IFilter::MessageHandler& m_MessageHandler;
+};
+
+} // namespace nx::core
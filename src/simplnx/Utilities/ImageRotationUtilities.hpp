@@ -18,6 +18,8 @@
 #include <fstream>
 #include <iostream>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 namespace nx::core::ImageRotationUtilities
 {
@@ -143,50 +145,6 @@ SIMPLNX_EXPORT float DetermineSpacing(const FloatVec3& spacing, const Eigen::Vec
  */
 SIMPLNX_EXPORT ImageRotationUtilities::RotateArgs CreateRotationArgs(const ImageGeom& imageGeom, const Matrix4fR& transformationMatrix);
 
-/**
- * @brief
- * @tparam T
- * @param params
- * @param xyzIndex
- * @param sourceArray
- * @param compIndex
- * @return
- */
-template <typename T>
-T inline GetSourceArrayValue(const RotateArgs& params, Vector3i64 xyzIndex, const DataArray<T>& sourceArray, size_t compIndex)
-{
-  if(xyzIndex[0] < 0)
-  {
-    xyzIndex[0] = 0;
-  }
-  if(xyzIndex[0] >= params.xp)
-  {
-    xyzIndex[0] = params.xp - 1;
-  }
-
-  if(xyzIndex[1] < 0)
-  {
-    xyzIndex[1] = 0;
-  }
-  if(xyzIndex[1] >= params.yp)
-  {
-    xyzIndex[1] = params.yp - 1;
-  }
-
-  if(xyzIndex[2] < 0)
-  {
-    xyzIndex[2] = 0;
-  }
-  if(xyzIndex[2] >= params.zp)
-  {
-    xyzIndex[2] = params.zp - 1;
-  }
-
-  // Now just compute the proper index
-  const usize index = (xyzIndex[2] * params.xp * params.yp) + (xyzIndex[1] * params.xp) + xyzIndex[0];
-  return sourceArray[index * sourceArray.getNumberOfComponents() + compIndex];
-}
-
 /**
  * @brief FindOctant
  * @param params
@@ -216,48 +174,6 @@ static const OctantOffsetArrayType k_IndexOffset7 = {Vector3i64{-1, 0, 0}, Vecto
                                                      Vector3i64{-1, 0, 1}, Vector3i64{0, 0, 1}, Vector3i64{0, 1, 1}, Vector3i64{-1, -1, 1}};
 static const std::array<OctantOffsetArrayType, 8> k_AllOctantOffsets{k_IndexOffset0, k_IndexOffset1, k_IndexOffset2, k_IndexOffset3, k_IndexOffset4, k_IndexOffset5, k_IndexOffset6, k_IndexOffset7};
 
-/**
- * @brief FindInterpolationValues
- * @param params
- * @param index
- * @param octant
- * @param oldIndicesU
- * @param oldCoords
- * @param sourceArray
- * @param pValues
- * @param uvw
- */
-template <typename T>
-inline void FindInterpolationValues(const RotateArgs& params, size_t octant, SizeVec3 oldIndicesU, Eigen::Array4f& oldCoords, const DataArray<T>& sourceArray, std::vector<T>& pValues,
-                                    Eigen::Vector3f& uvw)
-{
-  const std::array<Vector3i64, 8>& indexOffset = k_AllOctantOffsets[octant];
-
-  const Vector3i64 oldIndices(static_cast<int64_t>(oldIndicesU[0]), static_cast<int64_t>(oldIndicesU[1]), static_cast<int64_t>(oldIndicesU[2]));
-  size_t numComps = sourceArray.getNumberOfComponents();
-
-  Eigen::Vector3f p1Coord;
-
-  for(size_t i = 0; i < 8; i++)
-  {
-    auto pIndices = oldIndices + indexOffset[i];
-    for(size_t compIndex = 0; compIndex < numComps; compIndex++)
-    {
-      T value = GetSourceArrayValue<T>(params, pIndices, sourceArray, compIndex);
-      pValues[i * numComps + compIndex] = value;
-    }
-    if(i == 0)
-    {
-      p1Coord = {static_cast<float32>(pIndices[0]) * params.xRes + (0.5F * params.xRes) + params.OriginalOrigin[0],
-                 static_cast<float32>(pIndices[1]) * params.yRes + (0.5F * params.yRes) + params.OriginalOrigin[1],
-                 static_cast<float32>(pIndices[2]) * params.zRes + (0.5F * params.zRes) + params.OriginalOrigin[2]};
-    }
-  }
-  uvw[0] = oldCoords[0] - p1Coord[0];
-  uvw[1] = oldCoords[1] - p1Coord[1];
-  uvw[2] = oldCoords[2] - p1Coord[2];
-}
-
 /**
  * @brief
  */
@@ -308,285 +224,123 @@ private:
   int32 m_Progcounter = 0;
 };
 
+enum class InterpolationType : uint8
+{
+  NearestNeighbor,
+  Trilinear
+};
+
 /**
- * @brief The RotateImageGeometryWithTrilinearInterpolation class
+ * @brief The RotationIndexMap class maps the voxels of the transformed geometry back to the
+ * original geometry. The map covers one slab of z slices at a time so its memory stays bounded,
+ * and every slab is computed once and then applied to all of the cell arrays.
  */
-template <typename T>
-class RotateImageGeometryWithTrilinearInterpolation
+class SIMPLNX_EXPORT RotationIndexMap
 {
 public:
-  RotateImageGeometryWithTrilinearInterpolation(const IDataArray* sourceArray, IDataArray* targetArray, const RotateArgs& rotateArgs, const Matrix4fR& transformationMatrix,
-                                                FilterProgressCallback* filterCallback)
-  : m_SourceArray(sourceArray)
-  , m_TargetArray(targetArray)
-  , m_Params(rotateArgs)
-  , m_TransformationMatrix(transformationMatrix)
-  , m_FilterCallback(filterCallback)
-  {
-  }
-  ~RotateImageGeometryWithTrilinearInterpolation() = default;
+  static inline constexpr int64 k_OutsideSource = -1;
+  static inline constexpr usize k_TargetSlabSize = 1024 * 1024; // Number of voxels per slab
 
-  RotateImageGeometryWithTrilinearInterpolation(const RotateImageGeometryWithTrilinearInterpolation&) = default;
-  RotateImageGeometryWithTrilinearInterpolation(RotateImageGeometryWithTrilinearInterpolation&&) noexcept = default;
-  RotateImageGeometryWithTrilinearInterpolation& operator=(const RotateImageGeometryWithTrilinearInterpolation&) = delete;
-  RotateImageGeometryWithTrilinearInterpolation& operator=(RotateImageGeometryWithTrilinearInterpolation&&) noexcept = delete;
   /**
-   * @brief calculateInterpolatedValue
-   *
-   * This comes from https://www.cs.purdue.edu/homes/cs530/slides/04.DataStructure.pdf, page 36.
-   *
-   * Note in the codes below the equations have been changed to do all of the additions first, then
-   * the subtractions. This should hopefully alleviate issue with trying to subtract unsigned integers
-   * and ending up with what should have been a negative number but since it is unsigned the value
-   * that the compiler will compute would be vastly different.
-   *
-   * @param sourceArray
-   * @param oldIndex
-   * @param indices
-   * @return
+   * @brief The source voxel and interpolation weights of one transformed voxel.
    */
-  T calculateInterpolatedValue(std::vector<T>& pValues, Eigen::Vector3f& uvw, size_t numComps, size_t compIndex) const
+  struct TrilinearSample
   {
-    constexpr size_t P1 = 0;
-    constexpr size_t P2 = 1;
-    constexpr size_t P3 = 2;
-    constexpr size_t P4 = 3;
-    constexpr size_t P5 = 4;
-    constexpr size_t P6 = 5;
-    constexpr size_t P7 = 6;
-    constexpr size_t P8 = 7;
-
-    const float u = uvw[0];
-    const float v = uvw[1];
-    const float w = uvw[2];
-
-    T value = pValues[0];
-    // clang-format off
-    value += u * (pValues[P2 * numComps + compIndex] - pValues[P1 * numComps + compIndex]);
-    value += v * (pValues[P4 * numComps + compIndex] - pValues[P1 * numComps + compIndex]);
-    value += w * (pValues[P5 * numComps + compIndex] - pValues[P1 * numComps + compIndex]);
-    value += u * v * (pValues[P1 * numComps + compIndex] + pValues[P3 * numComps + compIndex] - pValues[P2 * numComps + compIndex] - pValues[P4 * numComps + compIndex]);
-    value += u * w * (pValues[P1 * numComps + compIndex] + pValues[P6 * numComps + compIndex] - pValues[P2 * numComps + compIndex] - pValues[P5 * numComps + compIndex]);
-    value += v * w * (pValues[P1 * numComps + compIndex] + pValues[P8 * numComps + compIndex] - pValues[P4 * numComps + compIndex] - pValues[P5 * numComps + compIndex]);
-    value += u * v * w *
-             ( pValues[P4 * numComps + compIndex]
-              + pValues[P2 * numComps + compIndex]
-              + pValues[P8 * numComps + compIndex]
-              + pValues[P6 * numComps + compIndex]
-              - pValues[P1 * numComps + compIndex]
-              - pValues[P3 * numComps + compIndex]
-              - pValues[P5 * numComps + compIndex]
-              - pValues[P7 * numComps + compIndex] );
-
-    // clang-format on
-    return value;
-  }
-
-  /**
-   * @brief This is the main algorithm to perform the interpolation and get a final value that is placed into the transformed
-   * voxel. This uses Trilinear interpolation which will devolve into Bilinear and Linear interpolation depending on the
-   * values of U, V and W.
-   */
-  void operator()() const
-  {
-    using DataArrayType = DataArray<T>;
-
-    const DataArrayType& sourceArray = dynamic_cast<const DataArrayType&>(*m_SourceArray);
-    const size_t numComps = sourceArray.getNumberOfComponents();
-    if(numComps == 0)
-    {
-      m_FilterCallback->sendThreadSafeProgressMessage(fmt::format("{}: Number of Components was Zero for array. Exiting Transform.", sourceArray.getName()));
-      return;
-    }
+    Vector3i64 sourceIndices = {0, 0, 0};
+    Eigen::Vector3f uvw = {0.0F, 0.0F, 0.0F};
+    uint8 octant = 0;
+    bool inside = false;
+  };
 
-    m_FilterCallback->sendThreadSafeProgressMessage(fmt::format("{}: Transform Starting", sourceArray.getName()));
+  RotationIndexMap(const RotateArgs& params, const Matrix4fR& transformationMatrix, InterpolationType interpolationType, bool sliceBySlice);
+  ~RotationIndexMap() noexcept;
 
-    auto& newDataStore = m_TargetArray->template getIDataStoreRefAs<AbstractDataStore<T>>();
+  RotationIndexMap(const RotationIndexMap&) = delete;
+  RotationIndexMap(RotationIndexMap&&) noexcept = delete;
+  RotationIndexMap& operator=(const RotationIndexMap&) = delete;
+  RotationIndexMap& operator=(RotationIndexMap&&) noexcept = delete;
 
-    DataStructure tempDataStructure;
-    ImageGeom* origImageGeomPtr = ImageGeom::Create(tempDataStructure, "Temp");
-    origImageGeomPtr->setDimensions(m_Params.OriginalDims);
-    origImageGeomPtr->setSpacing(m_Params.OriginalSpacing);
-    origImageGeomPtr->setOrigin(m_Params.OriginalOrigin);
-
-    ImageGeom* destImageGeomPtr = ImageGeom::Create(tempDataStructure, "dest image geom");
-    destImageGeomPtr->setDimensions(m_Params.TransformedDims);
-    destImageGeomPtr->setSpacing(m_Params.TransformedSpacing);
-    destImageGeomPtr->setOrigin(m_Params.TransformedOrigin);
-
-    // Tri linearInterpolationData<T> interpolationValues;
-    // SizeVec3 oldGeomIndices = {std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max()};
-
-    std::vector<T> pValues(8 * numComps);
-    Eigen::Vector3f uvw;
-
-    Matrix4fR inverseTransform = m_TransformationMatrix.inverse();
+  /**
+   * @brief Returns the number of z slices in a slab.
+   * @return int64
+   */
+  int64 getSlabDepth() const;
 
-    for(int64_t k = 0; k < m_Params.zpNew; k++)
-    {
-      if(m_FilterCallback->getCancel())
-      {
-        break;
-      }
-      m_FilterCallback->sendThreadSafeProgressMessage(fmt::format("{}: Interpolating values for slice '{}/{}'", m_SourceArray->getName(), k, m_Params.zpNew));
-      int64_t ktot = (m_Params.xpNew * m_Params.ypNew) * k;
+  /**
+   * @brief Computes the map for the z slices [zStart, zEnd) of the transformed geometry in parallel.
+   * @param zStart
+   * @param zEnd
+   */
+  void computeSlab(int64 zStart, int64 zEnd);
 
-      for(int64_t j = 0; j < m_Params.ypNew; j++)
-      {
-        int64_t jtot = (m_Params.xpNew) * j;
-        for(int64_t i = 0; i < m_Params.xpNew; i++)
-        {
-          int64_t newIndex = ktot + jtot + i;
-
-          Point3Df point = destImageGeomPtr->getCoordsf(newIndex);
-          // Last value is 1. See https://www.euclideanspace.com/maths/geometry/affine/matrix4x4/index.htm
-          Eigen::Vector4f coordsNew(point.getX(), point.getY(), point.getZ(), 1.0f);
-          // Transform back to the old coordinate
-          Eigen::Array4f coordsOld = inverseTransform * coordsNew;
-
-          // Now compute the old Cell Index from the old coordinate
-          SizeVec3 oldGeomIndices;
-          auto errorResult = origImageGeomPtr->computeCellIndex(coordsOld.data(), oldGeomIndices);
-
-          // Now we know what voxel the new cell center maps back to in the original geometry.
-          if(errorResult == ImageGeom::ErrorType::NoError)
-          {
-            size_t oldIndex = (m_Params.OriginalDims[0] * m_Params.OriginalDims[1] * oldGeomIndices[2]) + (m_Params.OriginalDims[0] * m_Params.OriginalDims[1]) + oldGeomIndices[0];
-            auto centerPoint = origImageGeomPtr->getCoordsf(oldIndex);
-
-            int octant = FindOctant(m_Params, centerPoint, coordsOld);
-
-            FindInterpolationValues(m_Params, octant, oldGeomIndices, coordsOld, sourceArray, pValues, uvw);
-            for(size_t compIndex = 0; compIndex < numComps; compIndex++)
-            {
-              T value = calculateInterpolatedValue(pValues, uvw, numComps, compIndex);
-              newDataStore.setComponent(newIndex, compIndex, value);
-            }
-          }
-          else
-          {
-            newDataStore.fillTuple(newIndex, static_cast<T>(0));
-          }
-        }
-      }
-    }
-    m_FilterCallback->sendThreadSafeProgressMessage(fmt::format("{}: Transform Ending", sourceArray.getName()));
-  }
+  /**
+   * @brief Returns the index of the first transformed voxel of the current slab.
+   * @return usize
+   */
+  usize getSlabOffset() const;
 
-private:
-  const IDataArray* m_SourceArray;
-  IDataArray* m_TargetArray;
-  ImageRotationUtilities::RotateArgs m_Params;
-  Matrix4fR m_TransformationMatrix;
-  FilterProgressCallback* m_FilterCallback = nullptr;
-};
+  /**
+   * @brief Returns the number of voxels in the current slab.
+   * @return usize
+   */
+  usize getSlabSize() const;
 
-//------------------------------------------------------------------------------
-template <typename T>
-class RotateImageGeometryWithNearestNeighbor
-{
-public:
-  RotateImageGeometryWithNearestNeighbor(const IDataArray* sourceArray, IDataArray* targetArray, const RotateArgs& args, const Matrix4fR& transformationMatrix, bool sliceBySlice,
-                                         FilterProgressCallback* filterCallback)
-  : m_SourceArray(sourceArray)
-  , m_TargetArray(targetArray)
-  , m_Params(args)
-  , m_TransformationMatrix(transformationMatrix)
-  , m_SliceBySlice(sliceBySlice)
-  , m_FilterCallback(filterCallback)
+  /**
+   * @brief Returns the source tuple index of a voxel of the current slab or k_OutsideSource. Only valid for nearest neighbor maps.
+   * @param slabIndex
+   * @return int64
+   */
+  int64 getSourceIndex(usize slabIndex) const
   {
+    return m_SourceIndices[slabIndex];
   }
-  ~RotateImageGeometryWithNearestNeighbor() = default;
 
-  RotateImageGeometryWithNearestNeighbor(const RotateImageGeometryWithNearestNeighbor&) = default;
-  RotateImageGeometryWithNearestNeighbor(RotateImageGeometryWithNearestNeighbor&&) noexcept = default;
-  RotateImageGeometryWithNearestNeighbor& operator=(const RotateImageGeometryWithNearestNeighbor&) = delete;
-  RotateImageGeometryWithNearestNeighbor& operator=(RotateImageGeometryWithNearestNeighbor&&) noexcept = delete;
-
-  void convert() const
+  /**
+   * @brief Returns the interpolation sample of a voxel of the current slab. Only valid for trilinear maps.
+   * @param slabIndex
+   * @return const TrilinearSample&
+   */
+  const TrilinearSample& getTrilinearSample(usize slabIndex) const
   {
+    return m_TrilinearSamples[slabIndex];
+  }
 
-    DataStructure tempDataStructure;
-    ImageGeom* srcImageGeomPtr = ImageGeom::Create(tempDataStructure, "source image geom");
-    srcImageGeomPtr->setDimensions(m_Params.OriginalDims);
-    srcImageGeomPtr->setSpacing(m_Params.OriginalSpacing);
-    srcImageGeomPtr->setOrigin(m_Params.OriginalOrigin);
-
-    ImageGeom* destImageGeomPtr = ImageGeom::Create(tempDataStructure, "dest image geom");
-    destImageGeomPtr->setDimensions(m_Params.TransformedDims);
-    destImageGeomPtr->setSpacing(m_Params.TransformedSpacing);
-    destImageGeomPtr->setOrigin(m_Params.TransformedOrigin);
-
-    const auto& oldDataStore = m_SourceArray->template getIDataStoreRefAs<AbstractDataStore<T>>();
-    auto& newDataStore = m_TargetArray->template getIDataStoreRefAs<AbstractDataStore<T>>();
+  const RotateArgs& getParams() const;
 
-    Matrix4fR inverseTransform = m_TransformationMatrix.inverse();
-    for(int64 k = 0; k < m_Params.zpNew; k++)
-    {
-      if(m_FilterCallback->getCancel())
-      {
-        break;
-      }
-      m_FilterCallback->sendThreadSafeProgressMessage(fmt::format("{}: Interpolating values for slice '{}/{}'", m_SourceArray->getName(), k, m_Params.zpNew));
+  InterpolationType getInterpolationType() const;
 
-      int64 const ktot = (m_Params.xpNew * m_Params.ypNew) * k;
-      for(int64 j = 0; j < m_Params.ypNew; j++)
-      {
-        int64 jtot = (m_Params.xpNew) * j;
-        for(int64 i = 0; i < m_Params.xpNew; i++)
-        {
-          int64 const newIndex = ktot + jtot + i;
-          Point3Df point = destImageGeomPtr->getCoordsf(newIndex);
-          // Last value is 1. See https://www.euclideanspace.com/maths/geometry/affine/matrix4x4/index.htm
-          Eigen::Vector4f coordsNew(point.getX(), point.getY(), point.getZ(), 1.0f);
-          // Transform back to the old coordinate
-          Eigen::Array4f coordsOld = inverseTransform * coordsNew;
-
-          // Now compute the old Cell Index from the old coordinate
-          SizeVec3 oldGeomIndices;
-          auto errorResult = srcImageGeomPtr->computeCellIndex(coordsOld.data(), oldGeomIndices);
-
-          // Now we know what voxel the new cell center maps back to in the original geometry.
-          if(errorResult == ImageGeom::ErrorType::NoError)
-          {
-            if(m_SliceBySlice)
-            {
-              oldGeomIndices[2] = k;
-            }
-            size_t oldIndex = (m_Params.OriginalDims[0] * m_Params.OriginalDims[1] * oldGeomIndices[2]) + (m_Params.OriginalDims[0] * oldGeomIndices[1]) + oldGeomIndices[0];
-
-            if(newDataStore.copyFrom(newIndex, oldDataStore, oldIndex, 1).invalid())
-            {
-              std::cout << fmt::format("Array copy failed: Source Array Name: {} Source Tuple Index: {}\nDest Array Name: {}  Dest. Tuple Index {}\n", m_SourceArray->getName(), oldIndex,
-                                       m_SourceArray->getName(), newIndex)
-                        << std::endl;
-              break;
-            }
-          }
-          else
-          {
-            newDataStore.fillTuple(newIndex, 0);
-          }
-        }
-      }
-    }
-    m_FilterCallback->sendThreadSafeProgressMessage(fmt::format("{}: Transform Ending", m_SourceArray->getName()));
-  }
+private:
+  friend class ComputeRotationIndexMapImpl;
 
-  void operator()() const
-  {
-    convert();
-  }
+  void computeVoxel(usize slabIndex, int64 i, int64 j, int64 k);
 
-private:
-  const IDataArray* m_SourceArray;
-  IDataArray* m_TargetArray;
-  ImageRotationUtilities::RotateArgs m_Params;
-  const Matrix4fR& m_TransformationMatrix;
+  RotateArgs m_Params;
+  Matrix4fR m_InverseTransform;
+  InterpolationType m_InterpolationType = InterpolationType::NearestNeighbor;
   bool m_SliceBySlice = false;
-  FilterProgressCallback* m_FilterCallback = nullptr;
+  DataStructure m_TempDataStructure;
+  ImageGeom* m_SourceGeom = nullptr;
+  ImageGeom* m_DestGeom = nullptr;
+  int64 m_SlabStart = 0;
+  int64 m_SlabEnd = 0;
+  std::vector<int64> m_SourceIndices;
+  std::vector<TrilinearSample> m_TrilinearSamples;
 };
 
+/**
+ * @brief Transforms every source array into its target array using the rotation index map. The map
+ * is computed once per slab of the transformed geometry and applied to all arrays, each of them in
+ * parallel over the voxels of the slab. Boolean arrays are skipped by trilinear interpolation.
+ * @param params
+ * @param transformationMatrix
+ * @param interpolationType
+ * @param sliceBySlice Only used by nearest neighbor interpolation
+ * @param arrays Pairs of source and target arrays
+ * @param filterCallback
+ */
+SIMPLNX_EXPORT void TransformImageArrays(const RotateArgs& params, const Matrix4fR& transformationMatrix, InterpolationType interpolationType, bool sliceBySlice,
+                                         const std::vector<std::pair<const IDataArray*, IDataArray*>>& arrays, FilterProgressCallback& filterCallback);
+
 /**
  * @brief The ApplyTransformationToNodeGeometry class will apply a transformation to a node based geometry.
  */
@@ -8,6 +8,7 @@
 #include "simplnx/Common/Types.hpp"
 #include "simplnx/DataStructure/Geometry/INodeGeometry0D.hpp"
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
+#include "simplnx/Utilities/TriangleBVH.hpp"
 #include "simplnx/simplnx_export.hpp"
 
 #include <chrono>
@@ -781,5 +782,114 @@ char IsPointInPolyhedron(const nx::core::TriangleGeom& triangleGeomRef, const st
 
   return 'o';
 }
+
+/**
+ * @brief [Spatial Index Overload] Determines if a point is in the polyhedron formed by the faces accepted
+ * by 'isPolyhedronFace'. Instead of testing every face of the polyhedron, each ray only visits the faces
+ * that the triangle hierarchy reports along the ray. Uses the same ray sequence and face tests as the
+ * overload above.
+ * @param triangleGeomRef the geometry to query
+ * @param bvh the triangle hierarchy of the geometry
+ * @param isPolyhedronFace bool(usize faceId) returns true for the faces of the polyhedron
+ * @param numPolyhedronFaces number of faces of the polyhedron, bounds the number of degenerate rays retried
+ * @param faceBBs the bounding boxes of each id in the geometry
+ * @param point search point
+ * @param bounds overarching bounding box for all of the geometry
+ * @param radius length of ray
+ * @return char
+ */
+template <typename T, typename FacePredicateT>
+char IsPointInPolyhedron(const nx::core::TriangleGeom& triangleGeomRef, const TriangleBVH& bvh, FacePredicateT&& isPolyhedronFace, usize numPolyhedronFaces,
+                         const std::vector<BoundingBox3D<T>>& faceBBs, const Point3D<T>& point, const nx::core::BoundingBox3D<T>& bounds, T radius)
+{
+  usize iter = 0, crossings = 0;
+
+  //* If query point is outside bounding box, finished. */
+  if(!IsPointInBox(point, bounds))
+  {
+    return 'o';
+  }
+
+  // Standard mersenne_twister_engine random seed
+  std::mt19937_64 generator(std::mt19937_64::default_seed);
+  std::uniform_real_distribution<T> distribution(0.0, 1.0);
+
+  detail::GeometryStoreCache cache(triangleGeomRef.getVertices()->getDataStoreRef(), triangleGeomRef.getFaces()->getDataStoreRef(), triangleGeomRef.getNumberOfVerticesPerFace());
+
+  // initialize temp storage 'verts' vector to avoid expensive
+  // calls during tight loops below
+  std::vector<usize> verts(cache.NumVertsPerFace);
+
+  char surfaceCode = '0';
+  while(iter++ < numPolyhedronFaces)
+  {
+    crossings = 0;
+
+    std::array<T, 3> eulerAngles;
+
+    float rand1 = distribution(generator);
+    float rand2 = distribution(generator);
+
+    eulerAngles[2] = (2.0f * rand1) - 1.0f;
+    float t = Constants::k_2PiF * rand2;
+    float w = std::sqrt(1.0f - (eulerAngles[2] * eulerAngles[2]));
+    eulerAngles[0] = w * std::cos(t);
+    eulerAngles[1] = w * std::sin(t);
+
+    // Generate and add ray to point to find other end [optimized version with lifetime caching]
+    CachedRay<T> ray(point, ZXZEuler(eulerAngles.data()), radius);
+    const Point3D<T>& origin = ray.getOriginRef();
+    const Point3D<T>& endPoint = ray.getEndPointRef();
+
+    bool doNextCheck = false;
+    bvh.visitSegment({static_cast<float32>(origin[0]), static_cast<float32>(origin[1]), static_cast<float32>(origin[2])},
+                     {static_cast<float32>(endPoint[0]), static_cast<float32>(endPoint[1]), static_cast<float32>(endPoint[2])}, [&](usize face) {
+                       if(!isPolyhedronFace(face) || !DoesRayIntersectBox(ray, faceBBs[face]))
+                       {
+                         return true;
+                       }
+                       std::array<Point3D<T>, 3> coords = detail::GetFaceCoordinates<T>(cache, face, verts);
+                       char code = RayIntersectsTriangle(ray, coords[0], coords[1], coords[2]);
+
+                       /* If ray is degenerate, then go to outer while to generate another. */
+                       if(code == 'p' || code == 'v' || code == 'e' || code == '?')
+                       {
+                         doNextCheck = true;
+                         return false;
+                       }
+                       /* If ray hits face at interior point, increment crossings. */
+                       if(code == 'f')
+                       {
+                         crossings++;
+                       }
+                       /* If query endpoint q sits on a V/E/F, return that code. */
+                       else if(code == 'V' || code == 'E' || code == 'F')
+                       {
+                         surfaceCode = code;
+                         return false;
+                       }
+                       return true;
+                     });
+    if(surfaceCode != '0')
+    {
+      return surfaceCode;
+    }
+    if(doNextCheck)
+    {
+      continue;
+    }
+    /* No degeneracies encountered: ray is generic, so finished. */
+    break;
+
+  } /* End while loop */
+
+  /* q strictly interior to polyhedron if an odd number of crossings. */
+  if(crossings % 2 != 0)
+  {
+    return 'i';
+  }
+
+  return 'o';
+}
 } // namespace GeometryMath
 } // namespace nx::core
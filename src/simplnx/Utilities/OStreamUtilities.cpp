@@ -1,10 +1,15 @@
 #include "OStreamUtilities.hpp"
 
 #include "simplnx/Common/AtomicFile.hpp"
+#include "simplnx/Common/Range.hpp"
+#include "simplnx/Utilities/BufferedBinaryWriter.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
+#include <array>
+#include <charconv>
 #include <chrono>
-#include <iomanip>
+#include <iterator>
 #include <ostream>
 #include <string>
 
@@ -15,6 +20,138 @@ namespace // for nonmember functions
 {
 const std::array<std::string, 5> k_DelimiterStrings = {" ", ";", ",", ":", "\t"}; // Don't reorder
 
+// Rows are formatted in chunks of k_RowsPerChunk and k_ChunksPerBatch chunks are formatted in parallel
+// before they are written, which bounds the memory used for the text of one batch.
+constexpr usize k_RowsPerChunk = 1024;
+constexpr usize k_ChunksPerBatch = 128;
+
+/**
+ * @brief Appends the text of a single value to the buffer. Integers are written with std::to_chars and
+ * 8 bit integers and booleans are written as numbers. Floating point values use the shortest representation
+ * that round trips, or the given number of significant digits in the style of printf's "%g" if precision > 0.
+ * @tparam T The primitive type of the value
+ * @param buffer The buffer to append to
+ * @param value The value to append
+ * @param precision The number of significant digits for floating point values
+ */
+template <typename T>
+void AppendValue(std::string& buffer, T value, int32 precision = 0)
+{
+  if constexpr(std::is_same_v<T, bool>)
+  {
+    buffer.push_back(value ? '1' : '0');
+  }
+  else if constexpr(std::is_floating_point_v<T>)
+  {
+    // fmt uses the same shortest round trip algorithm as std::to_chars but is available for floating point on all of our platforms
+    if(precision > 0)
+    {
+      fmt::format_to(std::back_inserter(buffer), "{:.{}g}", value, precision);
+    }
+    else
+    {
+      fmt::format_to(std::back_inserter(buffer), "{}", value);
+    }
+  }
+  else
+  {
+    using OutputType = std::conditional_t<sizeof(T) == 1, int32, T>;
+    std::array<char, 24> text = {};
+    const auto result = std::to_chars(text.data(), text.data() + text.size(), static_cast<OutputType>(value));
+    buffer.append(text.data(), result.ptr);
+  }
+}
+
+/**
+ * @brief Formats the rows of one batch into per chunk buffers.
+ * @tparam FormatRowT void(std::string& buffer, usize row)
+ */
+template <typename FormatRowT>
+class FormatRowChunksImpl
+{
+public:
+  FormatRowChunksImpl(const FormatRowT& formatRow, usize firstRow, usize endRow, std::vector<std::string>& chunks)
+  : m_FormatRow(formatRow)
+  , m_FirstRow(firstRow)
+  , m_EndRow(endRow)
+  , m_Chunks(chunks)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      std::string& buffer = m_Chunks[chunk];
+      buffer.clear();
+      const usize chunkStart = m_FirstRow + chunk * k_RowsPerChunk;
+      const usize chunkEnd = std::min(m_EndRow, chunkStart + k_RowsPerChunk);
+      for(usize row = chunkStart; row < chunkEnd; row++)
+      {
+        m_FormatRow(buffer, row);
+      }
+    }
+  }
+
+private:
+  const FormatRowT& m_FormatRow;
+  usize m_FirstRow;
+  usize m_EndRow;
+  std::vector<std::string>& m_Chunks;
+};
+
+/**
+ * @brief Writes the rows [firstRow, endRow) to outputStrm. The rows of each batch are converted to text in
+ * parallel and the chunks are then written in order, so the output is identical to a serial loop over the rows.
+ * Stores that are not in memory are formatted serially.
+ * @tparam FormatRowT void(std::string& buffer, usize row), must be safe to call concurrently
+ * @param outputStrm the ostream to write to
+ * @param firstRow The first row to write
+ * @param endRow One past the last row to write
+ * @param formatRow Appends the text of one row to a buffer
+ * @param stores The data stores read by formatRow
+ * @param name The name used in progress messages
+ * @param mesgHandler The message handler to dump progress updates to
+ * @param shouldCancel The atomic boolean that determines cancel
+ * @return false if the operation was canceled
+ */
+template <typename FormatRowT>
+bool WriteFormattedRows(std::ostream& outputStrm, usize firstRow, usize endRow, const FormatRowT& formatRow, const ParallelDataAlgorithm::AlgorithmStores& stores, const std::string& name,
+                        const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel)
+{
+  constexpr usize k_RowsPerBatch = k_RowsPerChunk * k_ChunksPerBatch;
+  std::vector<std::string> chunks(k_ChunksPerBatch);
+  auto start = std::chrono::steady_clock::now();
+  for(usize batchStart = firstRow; batchStart < endRow; batchStart += k_RowsPerBatch)
+  {
+    auto now = std::chrono::steady_clock::now();
+    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+    {
+      auto string = fmt::format("Processing {}: {}% completed", name, static_cast<int32>(100 * static_cast<float>(batchStart) / static_cast<float>(endRow)));
+      mesgHandler(IFilter::Message::Type::Info, string);
+      start = now;
+    }
+    if(shouldCancel)
+    {
+      return false;
+    }
+
+    const usize batchEnd = std::min(endRow, batchStart + k_RowsPerBatch);
+    const usize numChunks = (batchEnd - batchStart + k_RowsPerChunk - 1) / k_RowsPerChunk;
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numChunks);
+    dataAlg.requireStoresInMemory(stores);
+    dataAlg.execute(FormatRowChunksImpl<FormatRowT>(formatRow, batchStart, batchEnd, chunks));
+
+    for(usize chunk = 0; chunk < numChunks; chunk++)
+    {
+      outputStrm.write(chunks[chunk].data(), static_cast<std::streamsize>(chunks[chunk].size()));
+    }
+  }
+  return true;
+}
+
 /**
  * @brief implicit writing of **NeighborList**'s elements to outputStrm
  * @tparam ScalarType The primitive type attacthed to **NeighborList**
@@ -25,16 +162,16 @@ const std::array<std::string, 5> k_DelimiterStrings = {" ", ";", ",", ":", "\t"}
  * @param delimiter The delimiter to insert between values
  * @param hasIndex bool to determine if index must be printed
  * @param hasHeaders bool to determine if headers must be printed
+ * @param precision The number of significant digits for floating point values, 0 writes the shortest round trip value
  */
 struct PrintNeighborList
 {
   template <typename ScalarType>
   Result<> operator()(std::ostream& outputStrm, INeighborList* inputNeighborList, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, const std::string& delimiter = ",",
-                      bool hasIndex = false, bool hasHeader = false)
+                      bool hasIndex = false, bool hasHeader = false, int32 precision = 0)
   {
-    auto& neighborList = *dynamic_cast<NeighborList<ScalarType>*>(inputNeighborList);
-    auto start = std::chrono::steady_clock::now();
-    auto numLists = neighborList.getNumberOfLists();
+    const auto& neighborList = *dynamic_cast<NeighborList<ScalarType>*>(inputNeighborList);
+    const usize numLists = neighborList.getNumberOfLists();
 
     if(hasHeader)
     {
@@ -44,84 +181,27 @@ struct PrintNeighborList
       }
       outputStrm << "Element Count" << delimiter << inputNeighborList->getName() << "\n";
     }
-    if(hasIndex)
-    {
-      for(size_t list = 0; list < numLists; list++)
+
+    auto formatList = [&neighborList, &delimiter, hasIndex, precision](std::string& buffer, usize list) {
+      const auto grain = neighborList.at(list);
+      if(hasIndex)
       {
-        auto now = std::chrono::steady_clock::now();
-        if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-        {
-          auto string = fmt::format("Processing {}: {}% completed", neighborList.getName(), static_cast<int32>(100 * static_cast<float>(list) / static_cast<float>(numLists)));
-          mesgHandler(IFilter::Message::Type::Info, string);
-          start = now;
-          if(shouldCancel)
-          {
-            return {};
-          }
-        }
-        const auto& grain = neighborList.getListReference(list);
-        outputStrm << list << delimiter << grain.size() << delimiter;
-        for(size_t index = 0; index < grain.size(); index++)
-        {
-          if constexpr(std::is_same_v<ScalarType, int8> || std::is_same_v<ScalarType, uint8>)
-          {
-            outputStrm << static_cast<int32>(grain[index]);
-          }
-          else if constexpr(std::is_same_v<ScalarType, float32> || std::is_same_v<ScalarType, float64>)
-          {
-            outputStrm << fmt::format("{}", grain[index]);
-          }
-          else
-          {
-            outputStrm << grain[index];
-          }
-          if(index != grain.size() - 1)
-          {
-            outputStrm << delimiter;
-          }
-        }
-        outputStrm << "\n";
+        AppendValue(buffer, list);
+        buffer.append(delimiter);
       }
-    }
-    else // no index
-    {
-      for(size_t list = 0; list < neighborList.getNumberOfLists(); list++)
+      AppendValue(buffer, grain.size());
+      buffer.append(delimiter);
+      for(usize index = 0; index < grain.size(); index++)
       {
-        auto now = std::chrono::steady_clock::now();
-        if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+        AppendValue(buffer, grain[index], precision);
+        if(index != grain.size() - 1)
         {
-          auto string = fmt::format("Processing {}: {}% completed", neighborList.getName(), static_cast<int32>(static_cast<float>(list) / static_cast<float>(numLists)));
-          mesgHandler(IFilter::Message::Type::Info, string);
-          start = now;
-          if(shouldCancel)
-          {
-            return {};
-          }
+          buffer.append(delimiter);
         }
-        const auto& grain = neighborList.getListReference(list);
-        outputStrm << grain.size() << delimiter;
-        for(size_t index = 0; index < grain.size(); index++)
-        {
-          if constexpr(std::is_same_v<ScalarType, int8> || std::is_same_v<ScalarType, uint8>)
-          {
-            outputStrm << static_cast<int32>(grain[index]);
-          }
-          else if constexpr(std::is_same_v<ScalarType, float32> || std::is_same_v<ScalarType, float64>)
-          {
-            outputStrm << fmt::format("{}", grain[index]);
-          }
-          else
-          {
-            outputStrm << grain[index];
-          }
-          if(index != grain.size() - 1)
-          {
-            outputStrm << delimiter;
-          }
-        }
-        outputStrm << "\n";
       }
-    }
+      buffer.push_back('\n');
+    };
+    WriteFormattedRows(outputStrm, 0, numLists, formatList, {}, neighborList.getName(), mesgHandler, shouldCancel);
     return {};
   }
 };
@@ -135,68 +215,40 @@ struct PrintNeighborList
  * // default parameters
  * @param delimiter The delimiter to insert between values
  * @param componentsPerLine The number of components per line
+ * @param precision The number of significant digits for floating point values, 0 writes the shortest round trip value
  */
 struct PrintDataArray
 {
   template <typename ScalarType>
   Result<> operator()(std::ostream& outputStrm, IDataArray* inputDataArray, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, const std::string& delimiter = ",",
-                      int32 tuplesPerLine = 0)
+                      int32 tuplesPerLine = 0, int32 precision = 0)
   {
-    auto& dataStore = inputDataArray->template getIDataStoreRefAs<AbstractDataStore<ScalarType>>();
-    auto start = std::chrono::steady_clock::now();
-    auto numTuples = dataStore.getNumberOfTuples();
-    if(tuplesPerLine == 0)
-    {
-      tuplesPerLine = 1;
-    }
+    const auto& dataStore = inputDataArray->template getIDataStoreRefAs<AbstractDataStore<ScalarType>>();
+    const usize numTuples = dataStore.getNumberOfTuples();
+    const usize numComps = dataStore.getNumberOfComponents();
+    const usize lineLength = tuplesPerLine <= 0 ? 1 : static_cast<usize>(tuplesPerLine);
 
-    usize numComps = dataStore.getNumberOfComponents();
-    int32 tuplesWritten = 0;
-    for(size_t tuple = 0; tuple < numTuples; tuple++)
-    {
-      auto now = std::chrono::steady_clock::now();
-      if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-      {
-        auto string = fmt::format("Processing {}: {}% completed", inputDataArray->getName(), static_cast<int32>(100 * static_cast<float>(tuple) / static_cast<float>(numTuples)));
-        mesgHandler(IFilter::Message::Type::Info, string);
-        start = now;
-        if(shouldCancel)
-        {
-          return {};
-        }
-      }
+    auto formatTuple = [&dataStore, &delimiter, numComps, lineLength, precision](std::string& buffer, usize tuple) {
       // Write out all the components for this tuple
-      for(size_t index = 0; index < numComps; index++)
+      for(usize index = 0; index < numComps; index++)
       {
-        if constexpr(std::is_same_v<ScalarType, int8> || std::is_same_v<ScalarType, uint8>)
-        {
-          outputStrm << static_cast<int32>(dataStore[tuple * numComps + index]);
-        }
-        else if constexpr(std::is_same_v<ScalarType, float32> || std::is_same_v<ScalarType, float64>)
-        {
-          outputStrm << fmt::format("{}", dataStore[tuple * numComps + index]);
-        }
-        else
-        {
-          outputStrm << dataStore[tuple * numComps + index];
-        }
+        AppendValue(buffer, dataStore[tuple * numComps + index], precision);
         if(index != numComps - 1)
         {
-          outputStrm << delimiter;
+          buffer.append(delimiter);
         }
       }
       // Now figure out if we need a new line character or if we need the delimiter instead.
-      tuplesWritten++;
-      if(tuplesWritten == tuplesPerLine)
+      if((tuple + 1) % lineLength == 0)
       {
-        outputStrm << '\n';
-        tuplesWritten = 0;
+        buffer.push_back('\n');
       }
       else
       {
-        outputStrm << delimiter;
+        buffer.append(delimiter);
       }
-    }
+    };
+    WriteFormattedRows(outputStrm, 0, numTuples, formatTuple, {&dataStore}, inputDataArray->getName(), mesgHandler, shouldCancel);
     return {};
   }
 };
@@ -213,25 +265,11 @@ struct PrintDataArray
 Result<> PrintStringArray(std::ostream& outputStrm, const StringArray& inputStringArray, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
                           const std::string& delimiter = ",")
 {
-  auto start = std::chrono::steady_clock::now();
-  auto numTuples = inputStringArray.getNumberOfTuples();
-
-  for(size_t tuple = 0; tuple < numTuples; tuple++)
-  {
-    auto now = std::chrono::steady_clock::now();
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-    {
-      auto string = fmt::format("Processing {}: {}% completed", inputStringArray.getName(), static_cast<int32>(100 * static_cast<float>(tuple) / static_cast<float>(numTuples)));
-      mesgHandler(IFilter::Message::Type::Info, string);
-      start = now;
-      if(shouldCancel)
-      {
-        return {};
-      }
-    }
-    outputStrm << inputStringArray[tuple] << "\n";
-  }
-
+  auto formatString = [&inputStringArray](std::string& buffer, usize tuple) {
+    buffer.append(inputStringArray[tuple]);
+    buffer.push_back('\n');
+  };
+  WriteFormattedRows(outputStrm, 0, inputStringArray.getNumberOfTuples(), formatString, {}, inputStringArray.getName(), mesgHandler, shouldCancel);
   return {};
 }
 
@@ -240,8 +278,9 @@ class ITupleWriter
 public:
   ITupleWriter() = default;
   virtual ~ITupleWriter() = default;
-  virtual void write(std::ostream& outputStrm, usize tupleIndex) const = 0;
+  virtual void write(std::string& buffer, usize tupleIndex) const = 0;
   virtual void writeHeader(std::ostream& outputStrm) const = 0;
+  virtual const IDataStore* getDataStore() const = 0;
 };
 
 class StringTupleWriter : public ITupleWriter
@@ -262,9 +301,11 @@ public:
   StringTupleWriter& operator=(const StringTupleWriter&) = delete;
   StringTupleWriter& operator=(StringTupleWriter&&) noexcept = delete;
 
-  void write(std::ostream& outputStrm, usize tupleIndex) const override
+  void write(std::string& buffer, usize tupleIndex) const override
   {
-    outputStrm << m_Delimiter << m_DataArray[tupleIndex] << m_Delimiter;
+    buffer.append(m_Delimiter);
+    buffer.append(m_DataArray[tupleIndex]);
+    buffer.append(m_Delimiter);
   }
 
   void writeHeader(std::ostream& outputStrm) const override
@@ -272,6 +313,11 @@ public:
     outputStrm << m_DataArray.getName();
   }
 
+  const IDataStore* getDataStore() const override
+  {
+    return nullptr;
+  }
+
 private:
   const DataArrayType& m_DataArray;
   const std::string m_Delimiter = "'";
@@ -283,38 +329,27 @@ class TupleWriter : public ITupleWriter
   using DataArrayType = DataArray<ScalarType>;
 
 public:
-  TupleWriter(const IDataArray& iDataArray, const std::string& delimiter)
+  TupleWriter(const IDataArray& iDataArray, const std::string& delimiter, int32 precision)
   : m_DataStore(iDataArray.template getIDataStoreRefAs<AbstractDataStore<ScalarType>>())
   , m_Name(iDataArray.getName())
   , m_Delimiter(delimiter)
   {
     m_NumComps = m_DataStore.getNumberOfComponents();
+    if(precision > 0)
+    {
+      m_Precision = precision;
+    }
   }
   ~TupleWriter() override = default;
 
-  void write(std::ostream& outputStrm, usize tupleIndex) const override
+  void write(std::string& buffer, usize tupleIndex) const override
   {
     for(usize comp = 0; comp < m_NumComps; comp++)
     {
-      if constexpr(std::is_same_v<ScalarType, int8> || std::is_same_v<ScalarType, uint8>)
-      {
-        outputStrm << static_cast<int32>(m_DataStore[tupleIndex * m_NumComps + comp]);
-      }
-      else if constexpr(std::is_same_v<ScalarType, float32>)
-      {
-        outputStrm << std::setprecision(8) << std::noshowpoint << m_DataStore[tupleIndex * m_NumComps + comp];
-      }
-      else if constexpr(std::is_same_v<ScalarType, float64>)
-      {
-        outputStrm << std::setprecision(16) << std::noshowpoint << m_DataStore[tupleIndex * m_NumComps + comp];
-      }
-      else
-      {
-        outputStrm << m_DataStore[tupleIndex * m_NumComps + comp];
-      }
+      AppendValue(buffer, m_DataStore[tupleIndex * m_NumComps + comp], m_Precision);
       if(comp < m_NumComps - 1)
       {
-        outputStrm << m_Delimiter;
+        buffer.append(m_Delimiter);
       }
     }
   }
@@ -339,22 +374,37 @@ public:
     }
   }
 
+  const IDataStore* getDataStore() const override
+  {
+    return &m_DataStore;
+  }
+
 private:
   const std::string m_Name;
   const AbstractDataStore<ScalarType>& m_DataStore;
   const std::string& m_Delimiter = ",";
   usize m_NumComps = 1;
+  // Significant digits of floating point values, the default matches a stream with std::setprecision(8) or std::setprecision(16)
+  int32 m_Precision = std::is_same_v<ScalarType, float32> ? 8 : 16;
 };
 
 struct AddTupleWriter
 {
   template <typename ScalarType>
-  Result<> operator()(std::vector<std::shared_ptr<ITupleWriter>>& writers, const IDataArray& iDataArray, const std::string& delimiter)
+  Result<> operator()(std::vector<std::shared_ptr<ITupleWriter>>& writers, const IDataArray& iDataArray, const std::string& delimiter, int32 precision)
   {
-    writers.push_back(std::make_shared<TupleWriter<ScalarType>>(iDataArray, delimiter));
+    writers.push_back(std::make_shared<TupleWriter<ScalarType>>(iDataArray, delimiter, precision));
     return {};
   }
 };
+
+/**
+ * @brief Returns the floating point precision requested for the object at index, 0 if none was requested.
+ */
+int32 GetPrecision(const std::vector<int32>& precisions, usize index)
+{
+  return index < precisions.size() ? precisions[index] : 0;
+}
 } // namespace
 
 namespace nx::core::OStreamUtilities
@@ -382,10 +432,11 @@ std::string DelimiterToString(uint64 delim)
  * @param includeIndex The boolean that determines if "Feature_IDs" are printed | leave blank if binary is end output
  * @param includeHeaders The boolean that determines if headers are printed | leave blank if binary is end output
  * @param componentsPerLine The amount of elements to be inserted before newline character | leave blank if binary is end output
+ * @param precisions The number of significant digits for floating point values of each object, missing or non-positive entries write the shortest round trip value
  */
 Result<> PrintDataSetsToMultipleFiles(const std::vector<DataPath>& objectPaths, DataStructure& dataStructure, const std::string& directoryPath, const IFilter::MessageHandler& mesgHandler,
                                       const std::atomic_bool& shouldCancel, const std::string& fileExtension, bool exportToBinary, const std::string& delimiter, bool includeIndex, bool includeHeaders,
-                                      size_t tuplesPerLine)
+                                      size_t tuplesPerLine, const std::vector<int32>& precisions)
 {
   fs::path dirPath(directoryPath);
   if(!fs::is_directory(dirPath))
@@ -393,8 +444,10 @@ Result<> PrintDataSetsToMultipleFiles(const std::vector<DataPath>& objectPaths,
     throw std::runtime_error(fmt::format("{}({}): Function {}: Error. OutputPath must be a directory. '{}'", "PrintDataSetsToMultipleFiles", __FILE__, __LINE__, directoryPath));
   }
 
-  for(const auto& dataPath : objectPaths)
+  for(usize objectIndex = 0; objectIndex < objectPaths.size(); objectIndex++)
   {
+    const DataPath& dataPath = objectPaths[objectIndex];
+    const int32 precision = GetPrecision(precisions, objectIndex);
     auto atomicFileResult = AtomicFile::Create(fmt::format("{}/{}{}", directoryPath, dataPath.getTargetName(), fileExtension));
     if(atomicFileResult.invalid())
     {
@@ -416,11 +469,13 @@ Result<> PrintDataSetsToMultipleFiles(const std::vector<DataPath>& objectPaths,
       {
         if(exportToBinary)
         {
-          result = dataArray->getIDataStore()->writeBinaryFile(outputFilePath);
+          BufferedBinaryWriter writer(outStrm);
+          Result<> writeResult = MergeResults(writer.writeDataStore(*dataArray->getIDataStore(), endian::native, shouldCancel), writer.flush());
+          result = writeResult.invalid() ? std::make_pair(writeResult.errors().front().code, writeResult.errors().front().message) : std::make_pair(0, std::string{});
         }
         else
         {
-          ExecuteDataFunction(PrintDataArray{}, dataArray->getDataType(), outStrm, dataArray, mesgHandler, shouldCancel, delimiter, tuplesPerLine);
+          ExecuteDataFunction(PrintDataArray{}, dataArray->getDataType(), outStrm, dataArray, mesgHandler, shouldCancel, delimiter, tuplesPerLine, precision);
         }
       }
       auto* stringArray = dataStructure.getDataAs<StringArray>(dataPath);
@@ -436,7 +491,7 @@ Result<> PrintDataSetsToMultipleFiles(const std::vector<DataPath>& objectPaths,
           throw std::runtime_error(
               fmt::format("{}({}): Function {}: Error. Cannot print a NeighborList to binary: '{}'", "PrintDataSetsToMultipleFiles", __FILE__, __LINE__, dataPath.getTargetName()));
         }
-        ExecuteNeighborFunction(PrintNeighborList{}, neighborList->getDataType(), outStrm, neighborList, mesgHandler, shouldCancel, delimiter, includeIndex, includeHeaders);
+        ExecuteNeighborFunction(PrintNeighborList{}, neighborList->getDataType(), outStrm, neighborList, mesgHandler, shouldCancel, delimiter, includeIndex, includeHeaders, precision);
       }
       if(result.first < 0)
       {
@@ -503,24 +558,26 @@ void PrintSingleDataObject(std::ostream& outputStrm, const DataPath& objectPath,
  * @param includeHeaders The boolean that determines if headers are printed
  * @param componentsPerLine The amount of elements to be inserted before newline character
  * @param neighborLists The list of dataPaths of neighborlists to include
+ * @param precisions The number of significant digits for floating point values of each object in objectPaths followed by each neighbor list,
+ * missing or non-positive entries keep the default of 8 digits for float32 and 16 for float64 arrays and the shortest round trip value for neighbor lists
  */
 void PrintDataSetsToSingleFile(std::ostream& outputStrm, const std::vector<DataPath>& objectPaths, DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler,
                                const std::atomic_bool& shouldCancel, const std::string& delimiter, bool includeIndex, bool includeHeaders, bool writeFirstIndex, const std::string& indexName,
-                               const std::vector<DataPath>& neighborLists, bool writeNumOfFeatures)
+                               const std::vector<DataPath>& neighborLists, bool writeNumOfFeatures, const std::vector<int32>& precisions)
 {
   const auto& firstDataArray = dataStructure.getDataRefAs<IArray>(objectPaths[0]);
   usize numTuples = firstDataArray.getNumberOfTuples();
-  auto start = std::chrono::steady_clock::now();
 
   // Create our wrapper classes for each DataArray
   std::vector<std::shared_ptr<ITupleWriter>> writers;
-  for(const auto& selectedArrayPath : objectPaths)
+  for(usize objectIndex = 0; objectIndex < objectPaths.size(); objectIndex++)
   {
+    const DataPath& selectedArrayPath = objectPaths[objectIndex];
     auto* dataArrayPtr = dataStructure.getDataAs<IDataArray>(selectedArrayPath);
     if(nullptr != dataArrayPtr)
     {
       const auto& iDataArrayRef = dataStructure.getDataRefAs<IDataArray>(selectedArrayPath);
-      ExecuteDataFunction(AddTupleWriter{}, iDataArrayRef.getDataType(), writers, iDataArrayRef, delimiter);
+      ExecuteDataFunction(AddTupleWriter{}, iDataArrayRef.getDataType(), writers, iDataArrayRef, delimiter, GetPrecision(precisions, objectIndex));
     }
     auto* stringArrayPtr = dataStructure.getDataAs<StringArray>(selectedArrayPath);
     if(nullptr != stringArrayPtr)
@@ -577,42 +634,41 @@ void PrintDataSetsToSingleFile(std::ostream& outputStrm, const std::vector<DataP
   {
     writerIndexStart = 1;
   }
-  for(usize tupleIndex = writerIndexStart; tupleIndex < numTuples; tupleIndex++)
+  ParallelDataAlgorithm::AlgorithmStores stores;
+  for(const auto& writer : writers)
   {
-    auto now = std::chrono::steady_clock::now();
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-    {
-      auto string = fmt::format("Printing tuples: {}% completed", static_cast<int32>(100 * static_cast<float>(tupleIndex) / static_cast<float>(numTuples)));
-      mesgHandler(IFilter::Message::Type::Info, string);
-      start = now;
-      if(shouldCancel)
-      {
-        return;
-      }
-    }
+    stores.push_back(writer->getDataStore());
+  }
+  auto formatTuple = [&writers, &delimiter, includeIndex](std::string& buffer, usize tupleIndex) {
     if(includeIndex)
     {
-      outputStrm << tupleIndex << delimiter;
+      AppendValue(buffer, tupleIndex);
+      buffer.append(delimiter);
     }
-    for(size_t writerIndex = 0; writerIndex < writersCount; writerIndex++)
+    for(usize writerIndex = 0; writerIndex < writers.size(); writerIndex++)
     {
-      writers[writerIndex]->write(outputStrm, tupleIndex);
-      if(writerIndex != writersCount - 1)
+      writers[writerIndex]->write(buffer, tupleIndex);
+      if(writerIndex != writers.size() - 1)
       {
-        outputStrm << delimiter;
+        buffer.append(delimiter);
       }
     }
-    outputStrm << '\n';
+    buffer.push_back('\n');
+  };
+  if(!WriteFormattedRows(outputStrm, writerIndexStart, numTuples, formatTuple, stores, "tuples", mesgHandler, shouldCancel))
+  {
+    return;
   }
 
   if(!neighborLists.empty())
   {
-    for(const auto& dataPath : neighborLists)
+    for(usize neighborIndex = 0; neighborIndex < neighborLists.size(); neighborIndex++)
     {
-      auto* neighborList = dataStructure.getDataAs<INeighborList>(dataPath);
+      auto* neighborList = dataStructure.getDataAs<INeighborList>(neighborLists[neighborIndex]);
       if(neighborList != nullptr)
       {
-        ExecuteNeighborFunction(PrintNeighborList{}, neighborList->getDataType(), outputStrm, neighborList, mesgHandler, shouldCancel, delimiter, includeIndex, includeHeaders);
+        ExecuteNeighborFunction(PrintNeighborList{}, neighborList->getDataType(), outputStrm, neighborList, mesgHandler, shouldCancel, delimiter, includeIndex, includeHeaders,
+                                GetPrecision(precisions, objectPaths.size() + neighborIndex));
       }
       if(shouldCancel)
       {
@@ -44,11 +44,12 @@ SIMPLNX_EXPORT std::string DelimiterToString(uint64 delim);
  * @param includeIndex The boolean that determines if "Feature_IDs" are printed | leave blank if binary is end output
  * @param includeHeaders The boolean that determines if headers are printed | leave blank if binary is end output
  * @param componentsPerLine The amount of elements to be inserted before newline character | leave blank if binary is end output
+ * @param precisions The number of significant digits for floating point values of each object, missing or non-positive entries write the shortest round trip value
  */
 SIMPLNX_EXPORT Result<> PrintDataSetsToMultipleFiles(const std::vector<DataPath>& objectPaths, DataStructure& dataStructure, const std::string& directoryPath,
                                                      const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, const std::string& fileExtension = ".txt",
                                                      bool exportToBinary = false, const std::string& delimiter = "", bool includeIndex = false, bool includeHeaders = false,
-                                                     size_t componentsPerLine = 0);
+                                                     size_t componentsPerLine = 0, const std::vector<int32>& precisions = {});
 
 /**
  * @brief [Single Output][Custom OStream] | Writes one IArray child to some OStream
@@ -80,8 +81,11 @@ SIMPLNX_EXPORT void PrintSingleDataObject(std::ostream& outputStrm, const DataPa
  * @param includeHeaders The boolean that determines if headers are printed
  * @param neighborLists The list of dataPaths of neighborlists to include
  * @param writeNumOfFeatures The amount of elements per tuple printed at top
+ * @param precisions The number of significant digits for floating point values of each object in objectPaths followed by each neighbor list,
+ * missing or non-positive entries keep the default of 8 digits for float32 and 16 for float64 arrays and the shortest round trip value for neighbor lists
  */
 SIMPLNX_EXPORT void PrintDataSetsToSingleFile(std::ostream& outputStrm, const std::vector<DataPath>& objectPaths, DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler,
                                               const std::atomic_bool& shouldCancel, const std::string& delimiter = "", bool includeIndex = false, bool includeHeaders = false,
-                                              bool writeFirstIndex = true, const std::string& indexName = "Index", const std::vector<DataPath>& neighborLists = {}, bool writeNumOfFeatures = false);
+                                              bool writeFirstIndex = true, const std::string& indexName = "Index", const std::vector<DataPath>& neighborLists = {}, bool writeNumOfFeatures = false,
+                                              const std::vector<int32>& precisions = {});
 } // namespace nx::core::OStreamUtilities
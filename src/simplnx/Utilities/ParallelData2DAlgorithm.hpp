@@ -11,6 +11,7 @@
 #include <tbb/partitioner.h>
 #endif
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <optional>
@@ -121,7 +122,9 @@ protected:
     if(getParallelizationEnabled())
     {
       tbb::auto_partitioner partitioner;
-      tbb::blocked_range2d<size_t, size_t> tbbRange(range.minRow(), range.maxRow(), range.minCol(), range.maxCol());
+      // The grain size hint applies to the rows, so the element grain size is converted to rows
+      const usize grainSize = getGrainSize(range.maxCol() - range.minCol());
+      tbb::blocked_range2d<size_t, size_t> tbbRange(range.minRow(), range.maxRow(), std::max<size_t>(grainSize, 1), range.minCol(), range.maxCol(), 1);
       tbb::parallel_for(tbbRange, body, partitioner);
     }
     else
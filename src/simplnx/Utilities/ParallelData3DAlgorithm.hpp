@@ -11,6 +11,7 @@
 #include <tbb/partitioner.h>
 #endif
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <optional>
@@ -130,7 +131,9 @@ protected:
     if(getParallelizationEnabled())
     {
       tbb::auto_partitioner partitioner;
-      tbb::blocked_range3d<size_t, size_t, size_t> tbbRange(range[4], range[5], range[2], range[3], range[0], range[1]);
+      // The grain size hint applies to the slowest (Z) dimension, so the element grain size is converted to slices
+      const usize grainSize = getGrainSize((range[1] - range[0]) * (range[3] - range[2]));
+      tbb::blocked_range3d<size_t, size_t, size_t> tbbRange(range[4], range[5], std::max<size_t>(grainSize, 1), range[2], range[3], 1, range[0], range[1], 1);
       tbb::parallel_for(tbbRange, body, partitioner);
     }
     else
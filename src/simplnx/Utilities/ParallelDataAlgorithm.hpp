@@ -10,6 +10,7 @@
 #include <tbb/partitioner.h>
 #endif
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 
@@ -64,7 +65,7 @@ public:
     if(getParallelizationEnabled())
     {
       tbb::auto_partitioner partitioner;
-      tbb::blocked_range<size_t> tbbRange(m_Range[0], m_Range[1]);
+      tbb::blocked_range<size_t> tbbRange(m_Range[0], m_Range[1], std::max<size_t>(getGrainSize(), 1));
       tbb::parallel_for(tbbRange, body, partitioner);
     }
     else
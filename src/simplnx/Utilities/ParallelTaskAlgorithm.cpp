@@ -1,12 +1,19 @@
 #include "ParallelTaskAlgorithm.hpp"
 
+#include "simplnx/Utilities/ExecutionContext.hpp"
+
 #include <algorithm>
 #include <thread>
 
 using namespace nx::core;
 
 // -----------------------------------------------------------------------------
-ParallelTaskAlgorithm::ParallelTaskAlgorithm() = default;
+ParallelTaskAlgorithm::ParallelTaskAlgorithm()
+{
+#ifdef SIMPLNX_ENABLE_MULTICORE
+  m_MaxThreads = static_cast<uint32_t>(ExecutionContext::Current().getConcurrency());
+#endif
+}
 
 // -----------------------------------------------------------------------------
 ParallelTaskAlgorithm::~ParallelTaskAlgorithm()
@@ -27,7 +27,8 @@ public:
   virtual ~ParallelTaskAlgorithm();
 
   /**
-   * @brief Return maximum threads to use for parallelization.  If Parallel Algorithms
+   * @brief Return maximum threads to use for parallelization. The default is the concurrency of
+   * ExecutionContext::Current() when the algorithm is created.  If Parallel Algorithms
    * is not enabled, the maximum hardware concurrency is returned instead.
    * @return
    */
@@ -970,17 +970,17 @@ Result<> createLegacyNeighborList(DataStructure& dataStructure, DataObject ::IdT
 {
   auto numTuples = std::accumulate(tupleDims.cbegin(), tupleDims.cend(), static_cast<usize>(1), std::multiplies<>());
 
-  auto data = HDF5::NeighborListIO<T>::ReadHdf5Data(parentReader, datasetReader);
+  auto packedLists = HDF5::NeighborListIO<T>::ReadHdf5Data(parentReader, datasetReader);
   auto* neighborList = NeighborList<T>::Create(dataStructure, datasetReader.getName(), numTuples, parentId);
   if(neighborList == nullptr)
   {
     std::string ss = fmt::format("Failed to create NeighborList: '{}'", datasetReader.getName());
     return MakeErrorResult(Legacy::k_FailedCreatingNeighborList_Code, ss);
   }
-  for(usize i = 0; i < data.size(); ++i)
-  {
-    neighborList->setList(i, data[i]);
-  }
+  // The geometry decides the number of lists, missing lists stay empty
+  packedLists.offsets.resize(numTuples + 1, packedLists.offsets.back());
+  packedLists.values.resize(packedLists.offsets.back());
+  neighborList->setPackedLists(std::move(packedLists));
   return {};
 }
 
@@ -1,7 +1,10 @@
 #include "H5.hpp"
 
+#include "simplnx/Utilities/StringUtilities.hpp"
+
 #include <fmt/core.h>
 
+#include <set>
 #include <stdexcept>
 #include <vector>
 
@@ -172,3 +175,15 @@ std::string nx::core::HDF5::GetParentPath(const std::string& objectPath)
   }
   return objectPath.substr(0, ++back);
 }
+
+bool nx::core::HDF5::IsHdf5FilePath(const std::filesystem::path& filePath)
+{
+  static const std::set<std::string> k_Hdf5Extensions = {".dream3d", ".h5", ".hdf5", ".h5ebsd", ".h5oina", ".nxs"};
+  return k_Hdf5Extensions.count(StringUtilities::toLower(filePath.extension().string())) > 0;
+}
+
+std::recursive_mutex& nx::core::HDF5::GetLibraryMutex()
+{
+  static std::recursive_mutex mutex;
+  return mutex;
+}
@@ -4,6 +4,8 @@
 #include "simplnx/simplnx_export.hpp"
 
 #include <cstdint>
+#include <filesystem>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -84,4 +86,20 @@ std::string SIMPLNX_EXPORT GetNameFromId(IdType id);
  */
 std::string SIMPLNX_EXPORT GetParentPath(const std::string& objectPath);
 
+/**
+ * @brief Returns true if the path has the extension of a file that is read or
+ * written through the HDF5 library.
+ * @param filePath
+ * @return bool
+ */
+bool SIMPLNX_EXPORT IsHdf5FilePath(const std::filesystem::path& filePath);
+
+/**
+ * @brief Returns the process wide mutex that serializes access to the HDF5
+ * library, which is not built thread safe. Held while a pipeline filter that
+ * reads or writes HDF5 files is preflighted or executed.
+ * @return std::recursive_mutex&
+ */
+SIMPLNX_EXPORT std::recursive_mutex& GetLibraryMutex();
+
 } // namespace nx::core::HDF5
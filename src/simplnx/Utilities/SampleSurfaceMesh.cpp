@@ -7,6 +7,7 @@
 #include "simplnx/Utilities/ParallelAlgorithmUtilities.hpp"
 #include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
+#include "simplnx/Utilities/TriangleBVH.hpp"
 
 #include <chrono>
 
@@ -17,9 +18,11 @@ namespace
 class SampleSurfaceMeshImpl
 {
 public:
-  SampleSurfaceMeshImpl(const TriangleGeom& faces, const std::vector<std::vector<int32>>& faceIds, const std::vector<BoundingBox3Df>& faceBBs, const std::vector<Point3Df>& points,
-                        Int32AbstractDataStore& polyIds, const std::atomic_bool& shouldCancel)
+  SampleSurfaceMeshImpl(const TriangleGeom& faces, const TriangleBVH& bvh, const std::vector<int32>& faceLabels, const std::vector<std::vector<int32>>& faceIds,
+                        const std::vector<BoundingBox3Df>& faceBBs, const std::vector<Point3Df>& points, Int32AbstractDataStore& polyIds, const std::atomic_bool& shouldCancel)
   : m_Faces(faces)
+  , m_BVH(bvh)
+  , m_FaceLabels(faceLabels)
   , m_FaceIds(faceIds)
   , m_FaceBBs(faceBBs)
   , m_Points(points)
@@ -44,6 +47,8 @@ public:
       // find bounding box for current feature
       BoundingBox3Df boundingBox(GeometryMath::FindBoundingBoxOfFaces(m_Faces, m_FaceIds[iter]));
       float32 radius = GeometryMath::FindDistanceBetweenPoints(boundingBox.getMinPoint(), boundingBox.getMaxPoint()) / 2;
+      const auto featureId = static_cast<int32>(iter);
+      auto isFeatureFace = [this, featureId](usize face) { return m_FaceLabels[2 * face] == featureId || m_FaceLabels[2 * face + 1] == featureId; };
 
       // check points in vertex array to see if they are in the bounding box of the feature
       for(usize i = 0; i < numPoints; i++)
@@ -57,7 +62,7 @@ public:
         Point3Df point = m_Points[i];
         if(m_PolyIds[i] == 0)
         {
-          char code = GeometryMath::IsPointInPolyhedron(m_Faces, m_FaceIds[iter], m_FaceBBs, point, boundingBox, radius);
+          char code = GeometryMath::IsPointInPolyhedron(m_Faces, m_BVH, isFeatureFace, m_FaceIds[iter].size(), m_FaceBBs, point, boundingBox, radius);
           if(code == 'i' || code == 'V' || code == 'E' || code == 'F')
           {
             m_PolyIds[i] = iter;
@@ -74,6 +79,8 @@ public:
 
 private:
   const TriangleGeom& m_Faces;
+  const TriangleBVH& m_BVH;
+  const std::vector<int32>& m_FaceLabels;
   const std::vector<std::vector<int32>>& m_FaceIds;
   const std::vector<BoundingBox3Df>& m_FaceBBs;
   const std::vector<Point3Df>& m_Points;
@@ -85,10 +92,13 @@ private:
 class SampleSurfaceMeshImplByPoints
 {
 public:
-  SampleSurfaceMeshImplByPoints(SampleSurfaceMesh* filter, const TriangleGeom& faces, const std::vector<int32>& faceIds, const std::vector<BoundingBox3Df>& faceBBs,
-                                const std::vector<Point3Df>& points, const usize featureId, Int32AbstractDataStore& polyIds, const std::atomic_bool& shouldCancel)
+  SampleSurfaceMeshImplByPoints(SampleSurfaceMesh* filter, const TriangleGeom& faces, const TriangleBVH& bvh, const std::vector<int32>& faceLabels, const std::vector<int32>& faceIds,
+                                const std::vector<BoundingBox3Df>& faceBBs, const std::vector<Point3Df>& points, const usize featureId, Int32AbstractDataStore& polyIds,
+                                const std::atomic_bool& shouldCancel)
   : m_Filter(filter)
   , m_Faces(faces)
+  , m_BVH(bvh)
+  , m_FaceLabels(faceLabels)
   , m_FaceIds(faceIds)
   , m_FaceBBs(faceBBs)
   , m_Points(points)
@@ -106,6 +116,8 @@ public:
     // find bounding box for current feature
     BoundingBox3Df boundingBox(GeometryMath::FindBoundingBoxOfFaces(m_Faces, m_FaceIds));
     float32 radius = GeometryMath::FindDistanceBetweenPoints(boundingBox.getMinPoint(), boundingBox.getMaxPoint()) / 2;
+    const auto featureId = static_cast<int32>(iter);
+    auto isFeatureFace = [this, featureId](usize face) { return m_FaceLabels[2 * face] == featureId || m_FaceLabels[2 * face + 1] == featureId; };
 
     usize pointsVisited = 0;
     // check points in vertex array to see if they are in the bounding box of the feature
@@ -114,7 +126,7 @@ public:
       Point3Df point = m_Points[i];
       if(m_PolyIds[i] == 0)
       {
-        char code = GeometryMath::IsPointInPolyhedron(m_Faces, m_FaceIds, m_FaceBBs, point, boundingBox, radius);
+        char code = GeometryMath::IsPointInPolyhedron(m_Faces, m_BVH, isFeatureFace, m_FaceIds.size(), m_FaceBBs, point, boundingBox, radius);
         if(code == 'i' || code == 'V' || code == 'E' || code == 'F')
         {
           m_PolyIds[i] = iter;
@@ -143,6 +155,8 @@ public:
 private:
   SampleSurfaceMesh* m_Filter = nullptr;
   const TriangleGeom& m_Faces;
+  const TriangleBVH& m_BVH;
+  const std::vector<int32>& m_FaceLabels;
   const std::vector<int32>& m_FaceIds;
   const std::vector<BoundingBox3Df>& m_FaceBBs;
   const std::vector<Point3Df>& m_Points;
@@ -234,6 +248,7 @@ Result<> SampleSurfaceMesh::execute(SampleSurfaceMeshInputValues& inputValues)
 
   // fill out lists with number of references to cells
   std::vector<int32> linkLoc(numFaces, 0);
+  std::vector<int32> faceLabels(faceLabelsSM.begin(), faceLabelsSM.end());
 
   std::vector<BoundingBox3Df> faceBBs;
   {
@@ -277,6 +292,9 @@ Result<> SampleSurfaceMesh::execute(SampleSurfaceMeshInputValues& inputValues)
   // create array to hold which polyhedron (feature) each point falls in
   auto& polyIds = m_DataStructure.getDataAs<Int32Array>(inputValues.FeatureIdsArrayPath)->getDataStoreRef();
 
+  updateProgress("Building triangle search hierarchy ...");
+  const std::shared_ptr<const TriangleBVH> bvh = triangleGeom.getBVH();
+
   updateProgress("Sampling triangle geometry ...");
 
   // C++11 RIGHT HERE....
@@ -287,7 +305,7 @@ Result<> SampleSurfaceMesh::execute(SampleSurfaceMeshInputValues& inputValues)
   {
     ParallelDataAlgorithm dataAlg;
     dataAlg.setRange(0, numFeatures);
-    dataAlg.execute(SampleSurfaceMeshImpl(triangleGeom, faceLists, faceBBs, points, polyIds, m_ShouldCancel));
+    dataAlg.execute(SampleSurfaceMeshImpl(triangleGeom, *bvh, faceLabels, faceLists, faceBBs, points, polyIds, m_ShouldCancel));
   }
   else
   {
@@ -295,7 +313,7 @@ Result<> SampleSurfaceMesh::execute(SampleSurfaceMeshInputValues& inputValues)
     {
       ParallelDataAlgorithm dataAlg;
       dataAlg.setRange(0, points.size());
-      dataAlg.execute(SampleSurfaceMeshImplByPoints(this, triangleGeom, faceLists[featureId], faceBBs, points, featureId, polyIds, m_ShouldCancel));
+      dataAlg.execute(SampleSurfaceMeshImplByPoints(this, triangleGeom, *bvh, faceLabels, faceLists[featureId], faceBBs, points, featureId, polyIds, m_ShouldCancel));
     }
   }
 
@@ -1,6 +1,7 @@
 #include "SegmentFeatures.hpp"
 
 #include "simplnx/DataStructure/Geometry/IGridGeometry.hpp"
+#include "simplnx/Utilities/GridNeighborhood.hpp"
 
 using namespace nx::core;
 
@@ -18,9 +19,7 @@ SegmentFeatures::~SegmentFeatures() = default;
 // -----------------------------------------------------------------------------
 Result<> SegmentFeatures::execute(IGridGeometry* gridGeom)
 {
-  SizeVec3 udims = gridGeom->getDimensions();
-
-  int64 dims[3] = {static_cast<int64_t>(udims[0]), static_cast<int64_t>(udims[1]), static_cast<int64_t>(udims[2])};
+  const GridNeighborhood<GridConnectivity::Face> neighborhood(gridGeom->getDimensions());
 
   // Initialize sequence of execution modifiers
   int32 gnum = 1;
@@ -28,25 +27,10 @@ Result<> SegmentFeatures::execute(IGridGeometry* gridGeom)
   int64 seed = getSeed(gnum, nextSeed);
   usize size = 0;
 
-  // Initialize calculation modifiers
-  int64 neighbor = 0;
-  bool good = false;
-  int64 col = 0, row = 0, plane = 0;
-
   // Initialize containers
   usize initialVoxelsListSize = 100000;
   std::vector<int64_t> voxelsList(initialVoxelsListSize, -1);
 
-  int64 neighPoints[6] = {0, 0, 0, 0, 0, 0};
-  { // Initialize neighPoints in a readable fashion
-    neighPoints[0] = -(dims[0] * dims[1]);
-    neighPoints[1] = -dims[0];
-    neighPoints[2] = -1;
-    neighPoints[3] = 1;
-    neighPoints[4] = dims[0];
-    neighPoints[5] = (dims[0] * dims[1]);
-  }
-
   auto start = std::chrono::steady_clock::now();
 
   while(seed >= 0)
@@ -63,59 +47,27 @@ Result<> SegmentFeatures::execute(IGridGeometry* gridGeom)
     {
       int64 currentPoint = voxelsList[size - 1];
       size -= 1;
-      col = currentPoint % dims[0];
-      row = (currentPoint / dims[0]) % dims[1];
-      plane = currentPoint / (dims[0] * dims[1]);
-      for(int32 i = 0; i < 6; i++)
-      {
-        good = true;
-        neighbor = currentPoint + neighPoints[i];
-        if(i == 0 && plane == 0)
-        {
-          good = false;
-        }
-        if(i == 5 && plane == (dims[2] - 1))
-        {
-          good = false;
-        }
-        if(i == 1 && row == 0)
-        {
-          good = false;
-        }
-        if(i == 4 && row == (dims[1] - 1))
+      neighborhood.forEachNeighbor(static_cast<usize>(currentPoint), [&](usize neighborIndex, usize) {
+        const auto neighbor = static_cast<int64>(neighborIndex);
+        if(determineGrouping(currentPoint, neighbor, gnum))
         {
-          good = false;
-        }
-        if(i == 2 && col == 0)
-        {
-          good = false;
-        }
-        if(i == 3 && col == (dims[0] - 1))
-        {
-          good = false;
-        }
-        if(good)
-        {
-          if(determineGrouping(currentPoint, neighbor, gnum))
+          voxelsList[size] = neighbor;
+          size++;
+          if(neighbor == nextSeed)
           {
-            voxelsList[size] = neighbor;
-            size++;
-            if(neighbor == nextSeed)
-            {
-              nextSeed = neighbor + 1;
-            }
-            if(size >= voxelsList.size())
+            nextSeed = neighbor + 1;
+          }
+          if(size >= voxelsList.size())
+          {
+            size = voxelsList.size();
+            voxelsList.resize(size + initialVoxelsListSize);
+            for(std::vector<int64_t>::size_type j = size; j < voxelsList.size(); ++j)
             {
-              size = voxelsList.size();
-              voxelsList.resize(size + initialVoxelsListSize);
-              for(std::vector<int64_t>::size_type j = size; j < voxelsList.size(); ++j)
-              {
-                voxelsList[j] = -1;
-              }
+              voxelsList[j] = -1;
             }
           }
         }
-      }
+      });
     }
 
     voxelsList.assign(initialVoxelsListSize, -1);
@@ -0,0 +1,280 @@
+#include "StreamCompaction.hpp"
+
+#include "simplnx/Utilities/FilterUtilities.hpp"
+
+#include <fmt/format.h>
+
+using namespace nx::core;
+
+namespace
+{
+struct CopyBlockFunctor
+{
+  template <typename T>
+  void operator()(const StreamCompaction& compaction, const IDataArray& sourceArray, IDataArray& destArray, usize newStart, usize newEnd)
+  {
+    const auto& sourceStore = sourceArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
+    auto& destStore = destArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
+    compaction.copyBlock<T>(sourceStore, destStore, newStart, newEnd);
+  }
+};
+
+class CopyBlocksImpl
+{
+public:
+  CopyBlocksImpl(const StreamCompaction& compaction, const std::vector<StreamCompaction::ArrayPair>& arrays, usize numBlocks, const std::atomic_bool& shouldCancel)
+  : m_Compaction(compaction)
+  , m_Arrays(arrays)
+  , m_NumBlocks(numBlocks)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize numKept = m_Compaction.getNumberOfKept();
+    for(usize task = range.min(); task < range.max(); task++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      // Consecutive tasks walk the blocks of one array so each thread streams through contiguous memory
+      const auto& [sourceArray, destArray] = m_Arrays[task / m_NumBlocks];
+      const usize newStart = (task % m_NumBlocks) * StreamCompaction::k_BlockSize;
+      const usize newEnd = std::min(newStart + StreamCompaction::k_BlockSize, numKept);
+      ExecuteDataFunction(CopyBlockFunctor{}, sourceArray->getDataType(), m_Compaction, *sourceArray, *destArray, newStart, newEnd);
+    }
+  }
+
+private:
+  const StreamCompaction& m_Compaction;
+  const std::vector<StreamCompaction::ArrayPair>& m_Arrays;
+  usize m_NumBlocks;
+  const std::atomic_bool& m_ShouldCancel;
+};
+
+class MarkUsedVerticesImpl
+{
+public:
+  MarkUsedVerticesImpl(const StreamCompaction::ConnectivityStore& connectivity, const std::vector<usize>& keptElements, std::vector<std::atomic<uint8>>& usedVertices,
+                       std::atomic_bool& invalidVertex, const std::atomic_bool& shouldCancel)
+  : m_Connectivity(connectivity)
+  , m_KeptElements(keptElements)
+  , m_UsedVertices(usedVertices)
+  , m_InvalidVertex(invalidVertex)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize numComps = m_Connectivity.getNumberOfComponents();
+    const usize numVertices = m_UsedVertices.size();
+    for(usize index = range.min(); index < range.max(); index++)
+    {
+      if(m_ShouldCancel || m_InvalidVertex)
+      {
+        return;
+      }
+      const usize offset = m_KeptElements[index] * numComps;
+      for(usize comp = 0; comp < numComps; comp++)
+      {
+        const auto vertex = static_cast<usize>(m_Connectivity.getValue(offset + comp));
+        if(vertex >= numVertices)
+        {
+          m_InvalidVertex = true;
+          return;
+        }
+        m_UsedVertices[vertex].store(1, std::memory_order_relaxed);
+      }
+    }
+  }
+
+private:
+  const StreamCompaction::ConnectivityStore& m_Connectivity;
+  const std::vector<usize>& m_KeptElements;
+  std::vector<std::atomic<uint8>>& m_UsedVertices;
+  std::atomic_bool& m_InvalidVertex;
+  const std::atomic_bool& m_ShouldCancel;
+};
+
+class CreateOldToNewMapImpl
+{
+public:
+  CreateOldToNewMapImpl(const std::vector<usize>& keptIndices, std::vector<usize>& oldToNew)
+  : m_KeptIndices(keptIndices)
+  , m_OldToNew(oldToNew)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize newIndex = range.min(); newIndex < range.max(); newIndex++)
+    {
+      m_OldToNew[m_KeptIndices[newIndex]] = newIndex;
+    }
+  }
+
+private:
+  const std::vector<usize>& m_KeptIndices;
+  std::vector<usize>& m_OldToNew;
+};
+
+class CopyConnectivityImpl
+{
+public:
+  CopyConnectivityImpl(const StreamCompaction::ConnectivityStore& source, StreamCompaction::ConnectivityStore& dest, const std::vector<usize>& keptElements, const std::vector<usize>& vertexOldToNew,
+                       const std::atomic_bool& shouldCancel)
+  : m_Source(source)
+  , m_Dest(dest)
+  , m_KeptElements(keptElements)
+  , m_VertexOldToNew(vertexOldToNew)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize numComps = m_Source.getNumberOfComponents();
+    for(usize newIndex = range.min(); newIndex < range.max(); newIndex++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      const usize sourceOffset = m_KeptElements[newIndex] * numComps;
+      for(usize comp = 0; comp < numComps; comp++)
+      {
+        const auto oldVertex = static_cast<usize>(m_Source.getValue(sourceOffset + comp));
+        m_Dest.setValue(newIndex * numComps + comp, static_cast<IGeometry::MeshIndexType>(m_VertexOldToNew[oldVertex]));
+      }
+    }
+  }
+
+private:
+  const StreamCompaction::ConnectivityStore& m_Source;
+  StreamCompaction::ConnectivityStore& m_Dest;
+  const std::vector<usize>& m_KeptElements;
+  const std::vector<usize>& m_VertexOldToNew;
+  const std::atomic_bool& m_ShouldCancel;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+Result<StreamCompaction> StreamCompaction::CreateFromConnectivity(const ConnectivityStore& connectivity, const StreamCompaction& elements, usize numVertices, const std::atomic_bool& shouldCancel)
+{
+  if(connectivity.getNumberOfTuples() != elements.getNumberOfElements())
+  {
+    return MakeErrorResult<StreamCompaction>(k_TupleCountMismatchError, fmt::format("The connectivity list has {} elements but the element compaction was created for {} elements",
+                                                                                    connectivity.getNumberOfTuples(), elements.getNumberOfElements()));
+  }
+
+  std::vector<std::atomic<uint8>> usedVertices(numVertices);
+  std::atomic_bool invalidVertex = false;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, elements.getNumberOfKept());
+  dataAlg.requireStoresInMemory({&connectivity});
+  dataAlg.execute(MarkUsedVerticesImpl(connectivity, elements.getKeptIndices(), usedVertices, invalidVertex, shouldCancel));
+  if(invalidVertex)
+  {
+    return MakeErrorResult<StreamCompaction>(k_VertexIndexError, fmt::format("The connectivity list references a vertex index that is not inside the vertex list of {} vertices", numVertices));
+  }
+
+  return {Create(numVertices, [&usedVertices](usize index) { return usedVertices[index].load(std::memory_order_relaxed) != 0; }, {}, shouldCancel)};
+}
+
+// -----------------------------------------------------------------------------
+StreamCompaction::~StreamCompaction() noexcept = default;
+
+// -----------------------------------------------------------------------------
+usize StreamCompaction::getNumberOfElements() const
+{
+  return m_NumElements;
+}
+
+// -----------------------------------------------------------------------------
+usize StreamCompaction::getNumberOfKept() const
+{
+  return m_KeptIndices.size();
+}
+
+// -----------------------------------------------------------------------------
+const std::vector<usize>& StreamCompaction::getKeptIndices() const
+{
+  return m_KeptIndices;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<usize> StreamCompaction::createOldToNewMap(const std::atomic_bool& shouldCancel) const
+{
+  std::vector<usize> oldToNew(m_NumElements, k_Removed);
+  if(shouldCancel)
+  {
+    return oldToNew;
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, getNumberOfKept());
+  dataAlg.execute(CreateOldToNewMapImpl(m_KeptIndices, oldToNew));
+  return oldToNew;
+}
+
+// -----------------------------------------------------------------------------
+Result<> StreamCompaction::copyArrays(const std::vector<ArrayPair>& arrays, const std::atomic_bool& shouldCancel) const
+{
+  IParallelAlgorithm::AlgorithmArrays algorithmArrays;
+  for(const auto& [sourceArray, destArray] : arrays)
+  {
+    if(sourceArray->getNumberOfTuples() != m_NumElements || destArray->getNumberOfTuples() != getNumberOfKept())
+    {
+      return MakeErrorResult(k_TupleCountMismatchError, fmt::format("Arrays '{}' ({} tuples) and '{}' ({} tuples) do not match the {} elements and {} kept elements of the compaction",
+                                                                    sourceArray->getName(), sourceArray->getNumberOfTuples(), destArray->getName(), destArray->getNumberOfTuples(), m_NumElements,
+                                                                    getNumberOfKept()));
+    }
+    if(sourceArray->getNumberOfComponents() != destArray->getNumberOfComponents())
+    {
+      return MakeErrorResult(k_ComponentMismatchError, fmt::format("Array '{}' has {} components but array '{}' has {}", sourceArray->getName(), sourceArray->getNumberOfComponents(),
+                                                                   destArray->getName(), destArray->getNumberOfComponents()));
+    }
+    if(sourceArray->getDataType() != destArray->getDataType())
+    {
+      return MakeErrorResult(k_DataTypeMismatchError, fmt::format("Array '{}' is of type {} but array '{}' is of type {}", sourceArray->getName(), DataTypeToString(sourceArray->getDataType()),
+                                                                  destArray->getName(), DataTypeToString(destArray->getDataType())));
+    }
+    algorithmArrays.push_back(sourceArray);
+    algorithmArrays.push_back(destArray);
+  }
+
+  const usize numBlocks = GetNumberOfBlocks(getNumberOfKept());
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, arrays.size() * numBlocks);
+  dataAlg.setGrainSize(1);
+  dataAlg.requireArraysInMemory(algorithmArrays);
+  dataAlg.execute(CopyBlocksImpl(*this, arrays, numBlocks, shouldCancel));
+  return {};
+}
+
+// -----------------------------------------------------------------------------
+Result<> StreamCompaction::copyConnectivity(const ConnectivityStore& source, ConnectivityStore& dest, const StreamCompaction& vertices, const std::atomic_bool& shouldCancel) const
+{
+  if(source.getNumberOfTuples() != m_NumElements || dest.getNumberOfTuples() != getNumberOfKept())
+  {
+    return MakeErrorResult(k_TupleCountMismatchError, fmt::format("The connectivity lists have {} and {} elements but the compaction has {} elements and {} kept elements", source.getNumberOfTuples(),
+                                                                  dest.getNumberOfTuples(), m_NumElements, getNumberOfKept()));
+  }
+  if(source.getNumberOfComponents() != dest.getNumberOfComponents())
+  {
+    return MakeErrorResult(k_ComponentMismatchError,
+                           fmt::format("The source connectivity list has {} vertices per element but the destination has {}", source.getNumberOfComponents(), dest.getNumberOfComponents()));
+  }
+
+  const std::vector<usize> vertexOldToNew = vertices.createOldToNewMap(shouldCancel);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, getNumberOfKept());
+  dataAlg.requireStoresInMemory({&source, &dest});
+  dataAlg.execute(CopyConnectivityImpl(source, dest, m_KeptIndices, vertexOldToNew, shouldCancel));
+  return {};
+}
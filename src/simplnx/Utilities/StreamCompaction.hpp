@@ -0,0 +1,287 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/DataStructure/Geometry/IGeometry.hpp"
+#include "simplnx/DataStructure/IDataArray.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @brief StreamCompaction removes elements (points, vertices, edges, faces) from a list while keeping
+ * the order of the remaining elements. The elements are processed in blocks of k_BlockSize and the
+ * compaction takes three passes: every block counts the elements it keeps in parallel, an exclusive
+ * scan over the block counts gives every block the first index it writes to, and every block then
+ * writes the source indices of its kept elements in parallel.
+ *
+ * The result is the list of kept source indices, i.e. the new -> old index map. copyArrays() uses it
+ * to copy attribute arrays in parallel, copying consecutive kept elements as a single block.
+ */
+class SIMPLNX_EXPORT StreamCompaction
+{
+public:
+  static inline constexpr usize k_BlockSize = 65536;
+  static inline constexpr usize k_Removed = std::numeric_limits<usize>::max();
+
+  static inline constexpr int32 k_TupleCountMismatchError = -4830;
+  static inline constexpr int32 k_ComponentMismatchError = -4831;
+  static inline constexpr int32 k_DataTypeMismatchError = -4832;
+  static inline constexpr int32 k_VertexIndexError = -4833;
+
+  using ArrayPair = std::pair<const IDataArray*, IDataArray*>;
+  using ConnectivityStore = AbstractDataStore<IGeometry::MeshIndexType>;
+
+  /**
+   * @brief Compacts the elements [0, numElements). keep(index) must return true for every element
+   * that is kept. It is called twice per element from several threads, so it must not have side effects.
+   * Every DataStore that keep() reads must be listed in predicateStores, the compaction then only runs
+   * in parallel when all of them keep their values in memory.
+   * @param numElements
+   * @param keep
+   * @param predicateStores
+   * @param shouldCancel
+   * @return StreamCompaction
+   */
+  template <typename PredicateT>
+  static StreamCompaction Create(usize numElements, PredicateT&& keep, const IParallelAlgorithm::AlgorithmStores& predicateStores, const std::atomic_bool& shouldCancel = false)
+  {
+    using Predicate = std::remove_cv_t<std::remove_reference_t<PredicateT>>;
+
+    StreamCompaction compaction;
+    compaction.m_NumElements = numElements;
+
+    const usize numBlocks = GetNumberOfBlocks(numElements);
+    // blockOffsets[block + 1] first receives the number of elements the block keeps
+    std::vector<usize> blockOffsets(numBlocks + 1, 0);
+    ParallelDataAlgorithm countAlg;
+    countAlg.setRange(0, numBlocks);
+    countAlg.setGrainSize(1);
+    countAlg.requireStoresInMemory(predicateStores);
+    countAlg.execute(CountKeptImpl<Predicate>(numElements, keep, blockOffsets, shouldCancel));
+    if(shouldCancel)
+    {
+      return compaction;
+    }
+
+    std::partial_sum(blockOffsets.begin(), blockOffsets.end(), blockOffsets.begin());
+    compaction.m_KeptIndices.resize(blockOffsets.back());
+
+    ParallelDataAlgorithm scatterAlg;
+    scatterAlg.setRange(0, numBlocks);
+    scatterAlg.setGrainSize(1);
+    scatterAlg.requireStoresInMemory(predicateStores);
+    scatterAlg.execute(ScatterKeptImpl<Predicate>(numElements, keep, blockOffsets, compaction.m_KeptIndices, shouldCancel));
+    return compaction;
+  }
+
+  /**
+   * @brief Compacts the vertices of a shared vertex list so that only the vertices used by the kept
+   * elements of a connectivity list (edges, faces) remain.
+   * @param connectivity One tuple per element holding the indices of its vertices
+   * @param elements The compaction of the elements
+   * @param numVertices
+   * @param shouldCancel
+   * @return Result<StreamCompaction>
+   */
+  static Result<StreamCompaction> CreateFromConnectivity(const ConnectivityStore& connectivity, const StreamCompaction& elements, usize numVertices, const std::atomic_bool& shouldCancel = false);
+
+  StreamCompaction(const StreamCompaction&) = default;
+  StreamCompaction(StreamCompaction&&) noexcept = default;
+  StreamCompaction& operator=(const StreamCompaction&) = default;
+  StreamCompaction& operator=(StreamCompaction&&) noexcept = default;
+  ~StreamCompaction() noexcept;
+
+  usize getNumberOfElements() const;
+  usize getNumberOfKept() const;
+
+  /**
+   * @brief Returns the source index of every kept element in order (new -> old).
+   * @return const std::vector<usize>&
+   */
+  const std::vector<usize>& getKeptIndices() const;
+
+  /**
+   * @brief Creates the old -> new index map. Removed elements map to k_Removed.
+   * @param shouldCancel
+   * @return std::vector<usize>
+   */
+  std::vector<usize> createOldToNewMap(const std::atomic_bool& shouldCancel = false) const;
+
+  /**
+   * @brief Copies the kept tuples of a store into the destination tuples [newStart, newEnd).
+   * @param source
+   * @param dest
+   * @param newStart
+   * @param newEnd
+   */
+  template <typename T>
+  void copyBlock(const AbstractDataStore<T>& source, AbstractDataStore<T>& dest, usize newStart, usize newEnd) const
+  {
+    const usize numComps = dest.getNumberOfComponents();
+
+    const auto* sourceDataStore = dynamic_cast<const DataStore<T>*>(&source);
+    auto* destDataStore = dynamic_cast<DataStore<T>*>(&dest);
+    const T* sourcePtr = sourceDataStore != nullptr ? sourceDataStore->data() : nullptr;
+    T* destPtr = destDataStore != nullptr ? destDataStore->data() : nullptr;
+    // Only used when one of the stores does not keep its values in memory
+    std::unique_ptr<T[]> buffer;
+
+    usize runStart = newStart;
+    while(runStart < newEnd)
+    {
+      // Consecutive kept elements are copied as one block
+      usize runEnd = runStart + 1;
+      while(runEnd < newEnd && m_KeptIndices[runEnd] == m_KeptIndices[runEnd - 1] + 1)
+      {
+        runEnd++;
+      }
+
+      const usize sourceOffset = m_KeptIndices[runStart] * numComps;
+      const usize destOffset = runStart * numComps;
+      const usize count = (runEnd - runStart) * numComps;
+      if(sourcePtr != nullptr && destPtr != nullptr)
+      {
+        std::copy(sourcePtr + sourceOffset, sourcePtr + sourceOffset + count, destPtr + destOffset);
+      }
+      else
+      {
+        if(buffer == nullptr)
+        {
+          buffer = std::make_unique<T[]>(k_BlockSize);
+        }
+        for(usize offset = 0; offset < count; offset += k_BlockSize)
+        {
+          const usize chunkSize = std::min(k_BlockSize, count - offset);
+          source.copyIntoBuffer(sourceOffset + offset, nonstd::span<T>(buffer.get(), chunkSize));
+          dest.copyFromBuffer(destOffset + offset, nonstd::span<const T>(buffer.get(), chunkSize));
+        }
+      }
+      runStart = runEnd;
+    }
+  }
+
+  /**
+   * @brief Copies the kept tuples of every source array into its destination array. The source arrays
+   * must hold one tuple per element and the destination arrays one tuple per kept element. Each pair
+   * must have the same DataType and number of components.
+   * @param arrays
+   * @param shouldCancel
+   * @return Result<>
+   */
+  Result<> copyArrays(const std::vector<ArrayPair>& arrays, const std::atomic_bool& shouldCancel = false) const;
+
+  /**
+   * @brief Copies the kept elements of a connectivity list and replaces every vertex index with the
+   * index it has in the compacted vertex list.
+   * @param source
+   * @param dest
+   * @param vertices The compaction of the vertices, usually created by CreateFromConnectivity()
+   * @param shouldCancel
+   * @return Result<>
+   */
+  Result<> copyConnectivity(const ConnectivityStore& source, ConnectivityStore& dest, const StreamCompaction& vertices, const std::atomic_bool& shouldCancel = false) const;
+
+private:
+  StreamCompaction() = default;
+
+  static usize GetNumberOfBlocks(usize numElements)
+  {
+    return (numElements + k_BlockSize - 1) / k_BlockSize;
+  }
+
+  template <typename PredicateT>
+  class CountKeptImpl
+  {
+  public:
+    CountKeptImpl(usize numElements, const PredicateT& keep, std::vector<usize>& blockOffsets, const std::atomic_bool& shouldCancel)
+    : m_NumElements(numElements)
+    , m_Keep(keep)
+    , m_BlockOffsets(blockOffsets)
+    , m_ShouldCancel(shouldCancel)
+    {
+    }
+
+    void operator()(const Range& range) const
+    {
+      for(usize block = range.min(); block < range.max(); block++)
+      {
+        if(m_ShouldCancel)
+        {
+          return;
+        }
+        const usize end = std::min((block + 1) * k_BlockSize, m_NumElements);
+        usize count = 0;
+        for(usize index = block * k_BlockSize; index < end; index++)
+        {
+          count += m_Keep(index) ? 1 : 0;
+        }
+        m_BlockOffsets[block + 1] = count;
+      }
+    }
+
+  private:
+    usize m_NumElements;
+    const PredicateT& m_Keep;
+    std::vector<usize>& m_BlockOffsets;
+    const std::atomic_bool& m_ShouldCancel;
+  };
+
+  template <typename PredicateT>
+  class ScatterKeptImpl
+  {
+  public:
+    ScatterKeptImpl(usize numElements, const PredicateT& keep, const std::vector<usize>& blockOffsets, std::vector<usize>& keptIndices, const std::atomic_bool& shouldCancel)
+    : m_NumElements(numElements)
+    , m_Keep(keep)
+    , m_BlockOffsets(blockOffsets)
+    , m_KeptIndices(keptIndices)
+    , m_ShouldCancel(shouldCancel)
+    {
+    }
+
+    void operator()(const Range& range) const
+    {
+      for(usize block = range.min(); block < range.max(); block++)
+      {
+        if(m_ShouldCancel)
+        {
+          return;
+        }
+        const usize end = std::min((block + 1) * k_BlockSize, m_NumElements);
+        usize newIndex = m_BlockOffsets[block];
+        for(usize index = block * k_BlockSize; index < end; index++)
+        {
+          if(m_Keep(index))
+          {
+            m_KeptIndices[newIndex] = index;
+            newIndex++;
+          }
+        }
+      }
+    }
+
+  private:
+    usize m_NumElements;
+    const PredicateT& m_Keep;
+    const std::vector<usize>& m_BlockOffsets;
+    std::vector<usize>& m_KeptIndices;
+    const std::atomic_bool& m_ShouldCancel;
+  };
+
+  usize m_NumElements = 0;
+  std::vector<usize> m_KeptIndices;
+};
+} // namespace nx::core
@@ -0,0 +1,549 @@
+#include "TriangleBVH.hpp"
+
+#include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <fmt/format.h>
+
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+using namespace nx::core;
+
+namespace
+{
+using Vec3Type = std::array<float32, 3>;
+
+// Subtrees with fewer triangles than this are built by a single task
+constexpr usize k_MinParallelSubtreeSize = 16384;
+// Number of subtrees the top levels are split into before the parallel build
+constexpr usize k_ParallelSubtreeCount = 256;
+
+Vec3Type Subtract(const Vec3Type& lhs, const Vec3Type& rhs)
+{
+  return {lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2]};
+}
+
+Vec3Type Add(const Vec3Type& lhs, const Vec3Type& rhs)
+{
+  return {lhs[0] + rhs[0], lhs[1] + rhs[1], lhs[2] + rhs[2]};
+}
+
+Vec3Type Scale(const Vec3Type& vec, float32 scalar)
+{
+  return {vec[0] * scalar, vec[1] * scalar, vec[2] * scalar};
+}
+
+float32 Dot(const Vec3Type& lhs, const Vec3Type& rhs)
+{
+  return lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2];
+}
+
+Vec3Type Cross(const Vec3Type& lhs, const Vec3Type& rhs)
+{
+  return {lhs[1] * rhs[2] - lhs[2] * rhs[1], lhs[2] * rhs[0] - lhs[0] * rhs[2], lhs[0] * rhs[1] - lhs[1] * rhs[0]};
+}
+
+/**
+ * @brief Closest point on the triangle abc. Taken from
+ * https://github.com/embree/embree/blob/master/tutorials/common/math/closest_point.h
+ * which has an apache license.
+ */
+Vec3Type ClosestPointOnTriangle(const Vec3Type& p, const Vec3Type& a, const Vec3Type& b, const Vec3Type& c)
+{
+  const Vec3Type ab = Subtract(b, a);
+  const Vec3Type ac = Subtract(c, a);
+  const Vec3Type ap = Subtract(p, a);
+
+  const float32 d1 = Dot(ab, ap);
+  const float32 d2 = Dot(ac, ap);
+  if(d1 <= 0.f && d2 <= 0.f)
+  {
+    return a;
+  }
+
+  const Vec3Type bp = Subtract(p, b);
+  const float32 d3 = Dot(ab, bp);
+  const float32 d4 = Dot(ac, bp);
+  if(d3 >= 0.f && d4 <= d3)
+  {
+    return b;
+  }
+
+  const Vec3Type cp = Subtract(p, c);
+  const float32 d5 = Dot(ab, cp);
+  const float32 d6 = Dot(ac, cp);
+  if(d6 >= 0.f && d5 <= d6)
+  {
+    return c;
+  }
+
+  const float32 vc = d1 * d4 - d3 * d2;
+  if(vc <= 0.f && d1 >= 0.f && d3 <= 0.f)
+  {
+    const float32 v = d1 / (d1 - d3);
+    return Add(a, Scale(ab, v));
+  }
+
+  const float32 vb = d5 * d2 - d1 * d6;
+  if(vb <= 0.f && d2 >= 0.f && d6 <= 0.f)
+  {
+    const float32 v = d2 / (d2 - d6);
+    return Add(a, Scale(ac, v));
+  }
+
+  const float32 va = d3 * d6 - d5 * d4;
+  if(va <= 0.f && (d4 - d3) >= 0.f && (d5 - d6) >= 0.f)
+  {
+    const float32 v = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+    return Add(b, Scale(Subtract(c, b), v));
+  }
+
+  const float32 denominator = 1.f / (va + vb + vc);
+  const float32 v = vb * denominator;
+  const float32 w = vc * denominator;
+  return Add(Add(a, Scale(ab, v)), Scale(ac, w));
+}
+
+/**
+ * @brief Squared distance from the point to the node's box. 0 if the point is inside.
+ */
+float32 SquaredDistanceToBox(const Vec3Type& point, const TriangleBVH::Node& node)
+{
+  float32 distance = 0.0F;
+  for(usize axis = 0; axis < 3; axis++)
+  {
+    float32 delta = 0.0F;
+    if(point[axis] < node.minPoint[axis])
+    {
+      delta = node.minPoint[axis] - point[axis];
+    }
+    else if(point[axis] > node.maxPoint[axis])
+    {
+      delta = point[axis] - node.maxPoint[axis];
+    }
+    distance += delta * delta;
+  }
+  return distance;
+}
+
+/**
+ * @brief Copies the corners of every triangle and computes its bounds and centroid
+ */
+class GatherTrianglesImpl
+{
+public:
+  GatherTrianglesImpl(const AbstractDataStore<IGeometry::SharedVertexList::value_type>& vertices, const AbstractDataStore<IGeometry::MeshIndexType>& faces, std::vector<float32>& corners,
+                      std::vector<float32>& bounds, std::vector<float32>& centroids)
+  : m_Vertices(vertices)
+  , m_Faces(faces)
+  , m_Corners(corners)
+  , m_Bounds(bounds)
+  , m_Centroids(centroids)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize triangle = range.min(); triangle < range.max(); triangle++)
+    {
+      float32* corners = m_Corners.data() + 9 * triangle;
+      float32* bounds = m_Bounds.data() + 6 * triangle;
+      for(usize corner = 0; corner < 3; corner++)
+      {
+        const usize vertex = m_Faces[3 * triangle + corner];
+        for(usize axis = 0; axis < 3; axis++)
+        {
+          corners[3 * corner + axis] = m_Vertices[3 * vertex + axis];
+        }
+      }
+      for(usize axis = 0; axis < 3; axis++)
+      {
+        const auto [minValue, maxValue] = std::minmax({corners[axis], corners[3 + axis], corners[6 + axis]});
+        bounds[axis] = minValue;
+        bounds[3 + axis] = maxValue;
+        m_Centroids[3 * triangle + axis] = (corners[axis] + corners[3 + axis] + corners[6 + axis]) / 3.0F;
+      }
+    }
+  }
+
+private:
+  const AbstractDataStore<IGeometry::SharedVertexList::value_type>& m_Vertices;
+  const AbstractDataStore<IGeometry::MeshIndexType>& m_Faces;
+  std::vector<float32>& m_Corners;
+  std::vector<float32>& m_Bounds;
+  std::vector<float32>& m_Centroids;
+};
+
+/**
+ * @brief Builds the nodes of the hierarchy by recursively splitting the triangle order at the median centroid
+ */
+class HierarchyBuilder
+{
+public:
+  struct Subtree
+  {
+    usize nodeIndex = 0;
+    usize begin = 0;
+    usize end = 0;
+  };
+
+  HierarchyBuilder(const std::vector<float32>& bounds, const std::vector<float32>& centroids, std::vector<uint32>& order)
+  : m_Bounds(bounds)
+  , m_Centroids(centroids)
+  , m_Order(order)
+  {
+  }
+
+  /**
+   * @brief Builds the subtree of the triangle order range [begin, end) into nodes[nodeIndex].
+   * Subtrees smaller than deferSize are recorded in 'deferred' instead of being built.
+   */
+  void build(std::vector<TriangleBVH::Node>& nodes, usize nodeIndex, usize begin, usize end, usize deferSize, std::vector<Subtree>* deferred) const
+  {
+    if(deferred != nullptr && end - begin <= deferSize)
+    {
+      deferred->push_back({nodeIndex, begin, end});
+      return;
+    }
+
+    TriangleBVH::Node node;
+    node.minPoint = {std::numeric_limits<float32>::max(), std::numeric_limits<float32>::max(), std::numeric_limits<float32>::max()};
+    node.maxPoint = {std::numeric_limits<float32>::lowest(), std::numeric_limits<float32>::lowest(), std::numeric_limits<float32>::lowest()};
+    Vec3Type centroidMin = node.minPoint;
+    Vec3Type centroidMax = node.maxPoint;
+    for(usize index = begin; index < end; index++)
+    {
+      const uint32 triangle = m_Order[index];
+      for(usize axis = 0; axis < 3; axis++)
+      {
+        node.minPoint[axis] = std::min(node.minPoint[axis], m_Bounds[6 * triangle + axis]);
+        node.maxPoint[axis] = std::max(node.maxPoint[axis], m_Bounds[6 * triangle + 3 + axis]);
+        centroidMin[axis] = std::min(centroidMin[axis], m_Centroids[3 * triangle + axis]);
+        centroidMax[axis] = std::max(centroidMax[axis], m_Centroids[3 * triangle + axis]);
+      }
+    }
+
+    usize splitAxis = 0;
+    for(usize axis = 1; axis < 3; axis++)
+    {
+      if(centroidMax[axis] - centroidMin[axis] > centroidMax[splitAxis] - centroidMin[splitAxis])
+      {
+        splitAxis = axis;
+      }
+    }
+
+    // Stop at small ranges or when all centroids coincide and no split can separate them
+    if(end - begin <= TriangleBVH::k_MaxLeafSize || centroidMax[splitAxis] <= centroidMin[splitAxis])
+    {
+      node.first = static_cast<uint32>(begin);
+      node.count = static_cast<uint32>(end - begin);
+      nodes[nodeIndex] = node;
+      return;
+    }
+
+    const usize middle = begin + (end - begin) / 2;
+    std::nth_element(m_Order.begin() + begin, m_Order.begin() + middle, m_Order.begin() + end,
+                     [this, splitAxis](uint32 lhs, uint32 rhs) { return m_Centroids[3 * lhs + splitAxis] < m_Centroids[3 * rhs + splitAxis]; });
+
+    const usize leftChild = nodes.size();
+    node.first = static_cast<uint32>(leftChild);
+    node.count = 0;
+    nodes[nodeIndex] = node;
+    nodes.resize(leftChild + 2);
+    build(nodes, leftChild, begin, middle, deferSize, deferred);
+    build(nodes, leftChild + 1, middle, end, deferSize, deferred);
+  }
+
+private:
+  const std::vector<float32>& m_Bounds;
+  const std::vector<float32>& m_Centroids;
+  std::vector<uint32>& m_Order;
+};
+
+/**
+ * @brief Builds the deferred subtrees into their own node lists
+ */
+class BuildSubtreesImpl
+{
+public:
+  BuildSubtreesImpl(const HierarchyBuilder& builder, const std::vector<HierarchyBuilder::Subtree>& subtrees, std::vector<std::vector<TriangleBVH::Node>>& subtreeNodes)
+  : m_Builder(builder)
+  , m_Subtrees(subtrees)
+  , m_SubtreeNodes(subtreeNodes)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize index = range.min(); index < range.max(); index++)
+    {
+      const HierarchyBuilder::Subtree& subtree = m_Subtrees[index];
+      std::vector<TriangleBVH::Node>& nodes = m_SubtreeNodes[index];
+      nodes.resize(1);
+      m_Builder.build(nodes, 0, subtree.begin, subtree.end, 0, nullptr);
+    }
+  }
+
+private:
+  const HierarchyBuilder& m_Builder;
+  const std::vector<HierarchyBuilder::Subtree>& m_Subtrees;
+  std::vector<std::vector<TriangleBVH::Node>>& m_SubtreeNodes;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+TriangleBVH::TriangleBVH(const TriangleGeom& triangleGeom)
+{
+  const auto* vertexList = triangleGeom.getVertices();
+  const auto* faceList = triangleGeom.getFaces();
+  if(vertexList == nullptr || faceList == nullptr)
+  {
+    return;
+  }
+  const auto& vertices = vertexList->getDataStoreRef();
+  const auto& faces = faceList->getDataStoreRef();
+
+  const usize numTriangles = faces.getNumberOfTuples();
+  if(numTriangles == 0)
+  {
+    return;
+  }
+  if(numTriangles > std::numeric_limits<uint32>::max())
+  {
+    throw std::runtime_error(fmt::format("TriangleBVH supports at most {} triangles but the geometry has {}", std::numeric_limits<uint32>::max(), numTriangles));
+  }
+
+  std::vector<float32> corners(9 * numTriangles);
+  std::vector<float32> bounds(6 * numTriangles);
+  std::vector<float32> centroids(3 * numTriangles);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0ULL, numTriangles);
+    dataAlg.requireStoresInMemory({&vertices, &faces});
+    dataAlg.execute(GatherTrianglesImpl(vertices, faces, corners, bounds, centroids));
+  }
+
+  std::vector<uint32> order(numTriangles);
+  std::iota(order.begin(), order.end(), 0U);
+  HierarchyBuilder builder(bounds, centroids, order);
+
+  // Split the top levels serially until the remaining subtrees are small enough to be built in parallel
+  std::vector<HierarchyBuilder::Subtree> subtrees;
+  const usize deferSize = std::max(k_MinParallelSubtreeSize, numTriangles / k_ParallelSubtreeCount);
+  m_Nodes.resize(1);
+  builder.build(m_Nodes, 0, 0, numTriangles, deferSize, &subtrees);
+
+  std::vector<std::vector<Node>> subtreeNodes(subtrees.size());
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0ULL, subtrees.size());
+    dataAlg.execute(BuildSubtreesImpl(builder, subtrees, subtreeNodes));
+  }
+
+  // Append the subtrees so that their child indices refer to the combined node list
+  for(usize index = 0; index < subtrees.size(); index++)
+  {
+    std::vector<Node>& nodes = subtreeNodes[index];
+    const usize offset = m_Nodes.size() - 1;
+    for(Node& node : nodes)
+    {
+      if(node.count == 0)
+      {
+        node.first = static_cast<uint32>(node.first + offset);
+      }
+    }
+    m_Nodes[subtrees[index].nodeIndex] = nodes[0];
+    m_Nodes.insert(m_Nodes.end(), nodes.begin() + 1, nodes.end());
+  }
+
+  // Store the triangles in leaf order
+  m_TriangleIds.assign(order.begin(), order.end());
+  m_Corners.resize(9 * numTriangles);
+  for(usize slot = 0; slot < numTriangles; slot++)
+  {
+    std::copy_n(corners.data() + 9 * order[slot], 9, m_Corners.data() + 9 * slot);
+  }
+}
+
+// -----------------------------------------------------------------------------
+TriangleBVH::~TriangleBVH() noexcept = default;
+
+// -----------------------------------------------------------------------------
+usize TriangleBVH::getNumberOfTriangles() const
+{
+  return m_TriangleIds.size();
+}
+
+// -----------------------------------------------------------------------------
+usize TriangleBVH::getNumberOfNodes() const
+{
+  return m_Nodes.size();
+}
+
+// -----------------------------------------------------------------------------
+BoundingBox3Df TriangleBVH::getBounds() const
+{
+  if(m_Nodes.empty())
+  {
+    return {Point3Df(0.0F, 0.0F, 0.0F), Point3Df(-1.0F, -1.0F, -1.0F)};
+  }
+  const Node& root = m_Nodes[0];
+  return {Point3Df(root.minPoint[0], root.minPoint[1], root.minPoint[2]), Point3Df(root.maxPoint[0], root.maxPoint[1], root.maxPoint[2])};
+}
+
+// -----------------------------------------------------------------------------
+TriangleBVH::ClosestPoint TriangleBVH::findClosestPoint(const std::array<float32, 3>& point) const
+{
+  ClosestPoint closest;
+  if(m_Nodes.empty())
+  {
+    return closest;
+  }
+
+  std::array<uint32, 64> stack = {};
+  usize stackSize = 0;
+  stack[stackSize++] = 0;
+  while(stackSize > 0)
+  {
+    const Node& node = m_Nodes[stack[--stackSize]];
+    // Equally distant nodes are still visited so ties resolve to the lowest triangle id
+    if(SquaredDistanceToBox(point, node) > closest.squaredDistance)
+    {
+      continue;
+    }
+    if(node.count > 0)
+    {
+      for(uint32 slot = node.first; slot < node.first + node.count; slot++)
+      {
+        const float32* corners = m_Corners.data() + 9 * slot;
+        const Vec3Type candidate = ClosestPointOnTriangle(point, {corners[0], corners[1], corners[2]}, {corners[3], corners[4], corners[5]}, {corners[6], corners[7], corners[8]});
+        const Vec3Type delta = Subtract(point, candidate);
+        const float32 squaredDistance = Dot(delta, delta);
+        const usize triangleId = m_TriangleIds[slot];
+        if(squaredDistance < closest.squaredDistance || (squaredDistance == closest.squaredDistance && triangleId < closest.triangleId))
+        {
+          closest.triangleId = triangleId;
+          closest.point = candidate;
+          closest.squaredDistance = squaredDistance;
+        }
+      }
+      continue;
+    }
+    // Visit the nearer child first so the search radius shrinks quickly
+    const float32 leftDistance = SquaredDistanceToBox(point, m_Nodes[node.first]);
+    const float32 rightDistance = SquaredDistanceToBox(point, m_Nodes[node.first + 1]);
+    if(leftDistance <= rightDistance)
+    {
+      stack[stackSize++] = node.first + 1;
+      stack[stackSize++] = node.first;
+    }
+    else
+    {
+      stack[stackSize++] = node.first;
+      stack[stackSize++] = node.first + 1;
+    }
+  }
+  return closest;
+}
+
+// -----------------------------------------------------------------------------
+TriangleBVH::RayHit TriangleBVH::intersectRay(const std::array<float32, 3>& origin, const std::array<float32, 3>& direction, float32 maxDistance) const
+{
+  RayHit hit;
+  hit.distance = maxDistance;
+  if(m_Nodes.empty())
+  {
+    return hit;
+  }
+
+  std::array<uint32, 64> stack = {};
+  usize stackSize = 0;
+  stack[stackSize++] = 0;
+  while(stackSize > 0)
+  {
+    const Node& node = m_Nodes[stack[--stackSize]];
+    if(!SegmentIntersectsBox(origin, direction, hit.distance, node))
+    {
+      continue;
+    }
+    if(node.count == 0)
+    {
+      stack[stackSize++] = node.first + 1;
+      stack[stackSize++] = node.first;
+      continue;
+    }
+    for(uint32 slot = node.first; slot < node.first + node.count; slot++)
+    {
+      // Moller-Trumbore ray triangle intersection
+      const float32* corners = m_Corners.data() + 9 * slot;
+      const Vec3Type p0 = {corners[0], corners[1], corners[2]};
+      const Vec3Type edge1 = Subtract({corners[3], corners[4], corners[5]}, p0);
+      const Vec3Type edge2 = Subtract({corners[6], corners[7], corners[8]}, p0);
+      const Vec3Type pvec = Cross(direction, edge2);
+      const float32 determinant = Dot(edge1, pvec);
+      if(determinant == 0.0F)
+      {
+        continue;
+      }
+      const float32 inverseDeterminant = 1.0F / determinant;
+      const Vec3Type tvec = Subtract(origin, p0);
+      const float32 u = Dot(tvec, pvec) * inverseDeterminant;
+      if(u < 0.0F || u > 1.0F)
+      {
+        continue;
+      }
+      const Vec3Type qvec = Cross(tvec, edge1);
+      const float32 v = Dot(direction, qvec) * inverseDeterminant;
+      if(v < 0.0F || u + v > 1.0F)
+      {
+        continue;
+      }
+      const float32 t = Dot(edge2, qvec) * inverseDeterminant;
+      const usize triangleId = m_TriangleIds[slot];
+      if(t >= 0.0F && (t < hit.distance || (t == hit.distance && triangleId < hit.triangleId)))
+      {
+        hit.triangleId = triangleId;
+        hit.distance = t;
+      }
+    }
+  }
+  if(hit.triangleId == k_InvalidTriangle)
+  {
+    hit.distance = std::numeric_limits<float32>::max();
+  }
+  return hit;
+}
+
+// -----------------------------------------------------------------------------
+bool TriangleBVH::SegmentIntersectsBox(const std::array<float32, 3>& origin, const std::array<float32, 3>& direction, float32 maxT, const Node& node)
+{
+  float32 tMin = 0.0F;
+  float32 tMax = maxT;
+  for(usize axis = 0; axis < 3; axis++)
+  {
+    if(direction[axis] == 0.0F)
+    {
+      if(origin[axis] < node.minPoint[axis] || origin[axis] > node.maxPoint[axis])
+      {
+        return false;
+      }
+      continue;
+    }
+    const float32 inverseDirection = 1.0F / direction[axis];
+    float32 t0 = (node.minPoint[axis] - origin[axis]) * inverseDirection;
+    float32 t1 = (node.maxPoint[axis] - origin[axis]) * inverseDirection;
+    if(t0 > t1)
+    {
+      std::swap(t0, t1);
+    }
+    tMin = std::max(tMin, t0);
+    tMax = std::min(tMax, t1);
+    if(tMin > tMax)
+    {
+      return false;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "simplnx/Common/Array.hpp"
+#include "simplnx/Common/BoundingBox.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <vector>
+
+namespace nx::core
+{
+class TriangleGeom;
+
+/**
+ * @class TriangleBVH
+ * @brief The TriangleBVH class is a bounding volume hierarchy over the triangles of a TriangleGeom.
+ *
+ * The nodes are stored depth first in a single array and every leaf holds a contiguous run of
+ * triangles. The corner coordinates of the triangles are copied into the hierarchy in leaf order,
+ * so queries neither chase pointers nor touch the data stores of the geometry. The hierarchy is
+ * built with median splits along the largest centroid extent and the subtrees below the top
+ * levels are built in parallel.
+ *
+ * Instances are normally obtained from TriangleGeom::getBVH(), which builds the hierarchy on first
+ * use and shares it between callers. All queries are const and may be called concurrently.
+ */
+class SIMPLNX_EXPORT TriangleBVH
+{
+public:
+  static inline constexpr usize k_InvalidTriangle = std::numeric_limits<usize>::max();
+  static inline constexpr usize k_MaxLeafSize = 4;
+
+  /**
+   * @brief Node of the hierarchy. The right child of an internal node directly follows its left child.
+   */
+  struct Node
+  {
+    std::array<float32, 3> minPoint = {0.0F, 0.0F, 0.0F};
+    std::array<float32, 3> maxPoint = {0.0F, 0.0F, 0.0F};
+    uint32 first = 0; // First leaf slot of a leaf or the left child of an internal node
+    uint32 count = 0; // Number of triangles of a leaf, 0 for internal nodes
+  };
+
+  /**
+   * @brief Result of a closest point query
+   */
+  struct ClosestPoint
+  {
+    usize triangleId = k_InvalidTriangle;
+    std::array<float32, 3> point = {0.0F, 0.0F, 0.0F};
+    float32 squaredDistance = std::numeric_limits<float32>::max();
+  };
+
+  /**
+   * @brief Result of a ray query. The distance is measured in units of the ray direction.
+   */
+  struct RayHit
+  {
+    usize triangleId = k_InvalidTriangle;
+    float32 distance = std::numeric_limits<float32>::max();
+  };
+
+  /**
+   * @brief Builds the hierarchy over all triangles of the geometry.
+   * @param triangleGeom
+   */
+  explicit TriangleBVH(const TriangleGeom& triangleGeom);
+
+  ~TriangleBVH() noexcept;
+
+  TriangleBVH(const TriangleBVH&) = default;
+  TriangleBVH(TriangleBVH&&) noexcept = default;
+  TriangleBVH& operator=(const TriangleBVH&) = default;
+  TriangleBVH& operator=(TriangleBVH&&) noexcept = default;
+
+  /**
+   * @brief Returns the number of triangles in the hierarchy.
+   * @return usize
+   */
+  usize getNumberOfTriangles() const;
+
+  /**
+   * @brief Returns the number of nodes in the hierarchy.
+   * @return usize
+   */
+  usize getNumberOfNodes() const;
+
+  /**
+   * @brief Returns the bounding box of all triangles. The box is invalid if there are no triangles.
+   * @return BoundingBox3Df
+   */
+  BoundingBox3Df getBounds() const;
+
+  /**
+   * @brief Finds the closest point on any triangle. If several triangles are equally close, the
+   * one with the lowest id is returned, matching a linear scan over all triangles.
+   * @param point
+   * @return ClosestPoint
+   */
+  ClosestPoint findClosestPoint(const std::array<float32, 3>& point) const;
+
+  /**
+   * @brief Finds the first triangle hit by the ray origin + t * direction with 0 <= t <= maxDistance.
+   * Returns an invalid triangle id if nothing is hit.
+   * @param origin
+   * @param direction
+   * @param maxDistance
+   * @return RayHit
+   */
+  RayHit intersectRay(const std::array<float32, 3>& origin, const std::array<float32, 3>& direction, float32 maxDistance = std::numeric_limits<float32>::max()) const;
+
+  /**
+   * @brief Calls the visitor with the id of every triangle whose bounding box intersects the
+   * segment from start to end. The visitor returns false to stop the traversal.
+   * @param start
+   * @param end
+   * @param visitor bool(usize triangleId)
+   */
+  template <typename VisitorT>
+  void visitSegment(const std::array<float32, 3>& start, const std::array<float32, 3>& end, VisitorT&& visitor) const
+  {
+    const std::array<float32, 3> direction = {end[0] - start[0], end[1] - start[1], end[2] - start[2]};
+    traverse([&](const Node& node) { return SegmentIntersectsBox(start, direction, 1.0F, node); }, visitor);
+  }
+
+  /**
+   * @brief Calls the visitor with the id of every triangle whose bounding box overlaps the box.
+   * The visitor returns false to stop the traversal.
+   * @param box
+   * @param visitor bool(usize triangleId)
+   */
+  template <typename VisitorT>
+  void visitBox(const BoundingBox3Df& box, VisitorT&& visitor) const
+  {
+    const std::array<float32, 3> boxMin = {box.getMinPoint()[0], box.getMinPoint()[1], box.getMinPoint()[2]};
+    const std::array<float32, 3> boxMax = {box.getMaxPoint()[0], box.getMaxPoint()[1], box.getMaxPoint()[2]};
+    traverse(
+        [&](const Node& node) {
+          for(usize axis = 0; axis < 3; axis++)
+          {
+            if(node.maxPoint[axis] < boxMin[axis] || node.minPoint[axis] > boxMax[axis])
+            {
+              return false;
+            }
+          }
+          return true;
+        },
+        visitor);
+  }
+
+  /**
+   * @brief Returns true if the segment origin + t * direction with 0 <= t <= maxT intersects the node's box.
+   * @param origin
+   * @param direction
+   * @param maxT
+   * @param node
+   * @return bool
+   */
+  static bool SegmentIntersectsBox(const std::array<float32, 3>& origin, const std::array<float32, 3>& direction, float32 maxT, const Node& node);
+
+private:
+  /**
+   * @brief Depth first traversal that descends into every node accepted by the predicate and
+   * reports the triangles of accepted leaves to the visitor.
+   */
+  template <typename PredicateT, typename VisitorT>
+  void traverse(PredicateT&& acceptNode, VisitorT&& visitor) const
+  {
+    if(m_Nodes.empty())
+    {
+      return;
+    }
+    std::array<uint32, 64> stack = {};
+    usize stackSize = 0;
+    stack[stackSize++] = 0;
+    while(stackSize > 0)
+    {
+      const Node& node = m_Nodes[stack[--stackSize]];
+      if(!acceptNode(node))
+      {
+        continue;
+      }
+      if(node.count > 0)
+      {
+        for(uint32 slot = node.first; slot < node.first + node.count; slot++)
+        {
+          if(!visitor(m_TriangleIds[slot]))
+          {
+            return;
+          }
+        }
+        continue;
+      }
+      stack[stackSize++] = node.first + 1;
+      stack[stackSize++] = node.first;
+    }
+  }
+
+  std::vector<Node> m_Nodes;
+  std::vector<usize> m_TriangleIds; // Triangle id of every leaf slot
+  std::vector<float32> m_Corners;   // 9 corner coordinates of every leaf slot
+};
+} // namespace nx::core
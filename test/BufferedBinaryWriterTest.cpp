@@ -0,0 +1,57 @@
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/Utilities/BufferedBinaryWriter.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <sstream>
+
+using namespace nx::core;
+
+namespace
+{
+std::vector<uint32> ReadValues(const std::string& bytes, usize offset, usize count)
+{
+  std::vector<uint32> values(count);
+  std::memcpy(values.data(), bytes.data() + offset, count * sizeof(uint32));
+  return values;
+}
+} // namespace
+
+TEST_CASE("BufferedBinaryWriterTest")
+{
+  constexpr usize k_NumValues = 1000;
+  DataStore<uint32> dataStore({k_NumValues}, {1}, 0);
+  for(usize i = 0; i < k_NumValues; i++)
+  {
+    dataStore[i] = static_cast<uint32>(i * 65537 + 3);
+  }
+  const std::atomic_bool shouldCancel = false;
+
+  // A small block size forces many blocks that are not aligned to the values
+  std::ostringstream outputStream;
+  {
+    BufferedBinaryWriter writer(outputStream, 10);
+    REQUIRE(writer.write("HEADER\n").valid());
+    REQUIRE(writer.writeValues(dataStore, endian::native, shouldCancel).valid());
+    REQUIRE(writer.writeValues(dataStore, endian::native == endian::little ? endian::big : endian::little, shouldCancel).valid());
+    REQUIRE(writer.writeValuesAs<uint8>(dataStore, endian::big, shouldCancel).valid());
+    REQUIRE(writer.flush().valid());
+  }
+  const std::string bytes = outputStream.str();
+
+  constexpr usize k_HeaderSize = 7;
+  REQUIRE(bytes.size() == k_HeaderSize + 2 * k_NumValues * sizeof(uint32) + k_NumValues);
+  REQUIRE(bytes.substr(0, k_HeaderSize) == "HEADER\n");
+
+  const std::vector<uint32> nativeValues = ReadValues(bytes, k_HeaderSize, k_NumValues);
+  const std::vector<uint32> swappedValues = ReadValues(bytes, k_HeaderSize + k_NumValues * sizeof(uint32), k_NumValues);
+  for(usize i = 0; i < k_NumValues; i++)
+  {
+    REQUIRE(nativeValues[i] == dataStore[i]);
+    REQUIRE(swappedValues[i] == byteswap(dataStore[i]));
+    REQUIRE(static_cast<uint8>(bytes[k_HeaderSize + 2 * k_NumValues * sizeof(uint32) + i]) == static_cast<uint8>(dataStore[i]));
+  }
+
+  // The source data is never modified
+  REQUIRE(dataStore[1] == 65540);
+}
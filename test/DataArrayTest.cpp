@@ -8,6 +8,8 @@
 #include <catch2/catch.hpp>
 
 #include <cmath>
+#include <numeric>
+#include <thread>
 #include <vector>
 
 using namespace nx::core;
@@ -149,3 +151,278 @@ TEST_CASE("Copy DataStore", "DataArray")
     REQUIRE(dataStore[i] == dataStore2[i]);
   }
 }
+
+TEST_CASE("Copy-On-Write DataStore", "DataArray")
+{
+  IDataStore::ShapeType tupleShape{5};
+  IDataStore::ShapeType componentShape{3};
+  DataStore<int32> dataStore(tupleShape, componentShape, 5);
+  const auto& constStore = dataStore;
+  const int32* values = constStore.data();
+
+  // The copied store keeps its buffer and the copy reads from it
+  DataStore<int32> dataStore2(dataStore);
+  const auto& constStore2 = dataStore2;
+  REQUIRE(constStore.data() == values);
+  REQUIRE(&constStore2[0] == values);
+  REQUIRE(dataStore.isShared());
+  REQUIRE(dataStore2.isShared());
+
+  dataStore2[0] = 9;
+  REQUIRE(&constStore2[0] != values);
+  REQUIRE(!dataStore2.isShared());
+  REQUIRE(constStore[0] == 5);
+  REQUIRE(constStore2[0] == 9);
+
+  dataStore[1] = 7;
+  REQUIRE(!dataStore.isShared());
+  REQUIRE(constStore.data() == values);
+  REQUIRE(constStore[1] == 7);
+  REQUIRE(constStore2[1] == 5);
+
+  // Pointers retrieved before a copy keep pointing at the values of the copied store
+  int32* writableValues = dataStore.data();
+  DataStore<int32> dataStore3(dataStore);
+  const auto& constStore3 = dataStore3;
+  dataStore[2] = 8;
+  REQUIRE(writableValues[2] == 8);
+  REQUIRE(constStore3[2] == 5);
+  REQUIRE(constStore3[1] == 7);
+
+  // A moved from store has no values
+  DataStore<int32> movedStore(std::move(dataStore3));
+  REQUIRE(constStore3.data() == nullptr);
+  REQUIRE(movedStore[1] == 7);
+  DataStore<int32> movedFromCopy(dataStore3);
+  REQUIRE(movedFromCopy.getSize() == dataStore.getSize());
+
+  DataStructure dataStructure;
+  auto* dataArray = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, "Array", tupleShape, componentShape);
+  REQUIRE(dataArray != nullptr);
+  dataArray->fill(1);
+
+  DataStructure snapshot = dataStructure;
+  snapshot.detachDataStores();
+  dataArray->fill(2);
+
+  const auto& snapshotArray = snapshot.getDataRefAs<Int32Array>(DataPath({"Array"}));
+  for(usize i = 0; i < snapshotArray.getSize(); i++)
+  {
+    REQUIRE(snapshotArray.at(i) == 1);
+    REQUIRE(dataArray->at(i) == 2);
+  }
+}
+
+TEST_CASE("Adopted Buffer DataStore", "DataArray")
+{
+  IDataStore::ShapeType tupleShape{4};
+  IDataStore::ShapeType componentShape{2};
+  const usize size = 8;
+
+  bool released = false;
+  int32* rawBuffer = new int32[size];
+  std::iota(rawBuffer, rawBuffer + size, 0);
+  {
+    std::shared_ptr<int32[]> buffer(rawBuffer, [&released](const int32* values) {
+      released = true;
+      delete[] values;
+    });
+    DataStore<int32> dataStore(std::move(buffer), tupleShape, componentShape);
+    const auto& constStore = dataStore;
+    REQUIRE(constStore.data() == rawBuffer);
+    REQUIRE(dataStore.getNumberOfTuples() == 4);
+    REQUIRE(dataStore[5] == 5);
+
+    dataStore[5] = 50;
+    REQUIRE(rawBuffer[5] == 50);
+    REQUIRE(!released);
+
+    // Copies of an adopted buffer copy the values so the store keeps writing into the buffer
+    REQUIRE(dataStore.isPinned());
+    DataStore<int32> copy(dataStore);
+    const auto& constCopy = copy;
+    REQUIRE(constCopy.data() != rawBuffer);
+    REQUIRE(!dataStore.isShared());
+    copy[5] = 60;
+    dataStore[6] = 70;
+    REQUIRE(constStore.data() == rawBuffer);
+    REQUIRE(rawBuffer[5] == 50);
+    REQUIRE(rawBuffer[6] == 70);
+    REQUIRE(constCopy[6] == 6);
+  }
+  REQUIRE(released);
+}
+
+TEST_CASE("Pinned DataStore", "DataArray")
+{
+  IDataStore::ShapeType tupleShape{5};
+  IDataStore::ShapeType componentShape{3};
+
+  DataStructure dataStructure;
+  auto* dataArray = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, "Array", tupleShape, componentShape);
+  REQUIRE(dataArray != nullptr);
+  dataArray->fill(1);
+  auto* dataStore = dynamic_cast<Int32DataStore*>(dataArray->getDataStore());
+  REQUIRE(dataStore != nullptr);
+  REQUIRE(!dataStore->isPinned());
+
+  // An exported buffer keeps tracking the live array after a snapshot is taken and written to
+  int32* buffer = dataStore->pinBuffer();
+  REQUIRE(dataStore->isPinned());
+  DataStructure snapshot = dataStructure;
+  snapshot.detachDataStores();
+  auto& snapshotArray = snapshot.getDataRefAs<Int32Array>(DataPath({"Array"}));
+  snapshotArray.fill(3);
+  dataArray->fill(2);
+  buffer[0] = 4;
+
+  const auto& constStore = *dataStore;
+  REQUIRE(constStore.data() == buffer);
+  REQUIRE(dataArray->at(0) == 4);
+  for(usize i = 1; i < dataArray->getSize(); i++)
+  {
+    REQUIRE(buffer[i] == 2);
+  }
+  for(usize i = 0; i < snapshotArray.getSize(); i++)
+  {
+    REQUIRE(snapshotArray.at(i) == 3);
+  }
+
+  // Resizing reallocates the values so the store is no longer pinned
+  dataStore->resizeTuples({10});
+  REQUIRE(!dataStore->isPinned());
+}
+
+TEST_CASE("DataStore Buffer Windows", "DataArray")
+{
+  IDataStore::ShapeType tupleShape{5};
+  IDataStore::ShapeType componentShape{3};
+  DataStore<int32> dataStore(tupleShape, componentShape, 0);
+  std::iota(dataStore.begin(), dataStore.end(), 0);
+
+  std::vector<int32> window(6);
+  REQUIRE(dataStore.copyIntoBuffer(3, nonstd::span<int32>(window)).valid());
+  REQUIRE(window == std::vector<int32>{3, 4, 5, 6, 7, 8});
+
+  std::fill(window.begin(), window.end(), -1);
+  REQUIRE(dataStore.copyFromBuffer(9, nonstd::span<const int32>(window)).valid());
+  REQUIRE(dataStore[8] == 8);
+  REQUIRE(dataStore[9] == -1);
+  REQUIRE(dataStore[14] == -1);
+
+  REQUIRE(dataStore.copyIntoBuffer(10, nonstd::span<int32>(window)).invalid());
+  REQUIRE(dataStore.copyFromBuffer(10, nonstd::span<const int32>(window)).invalid());
+
+  // The generic implementation is used by stores that do not keep their values in one buffer
+  AbstractDataStore<int32>& abstractStore = dataStore;
+  std::vector<int32> genericWindow(3);
+  REQUIRE(abstractStore.AbstractDataStore<int32>::copyIntoBuffer(0, nonstd::span<int32>(genericWindow)).valid());
+  REQUIRE(genericWindow == std::vector<int32>{0, 1, 2});
+}
+
+TEST_CASE("Copy-On-Write DataStore Pages", "DataArray")
+{
+  constexpr usize k_PageSize = DataStore<int32>::k_CopyOnWritePageSize;
+  const usize numValues = k_PageSize * 4 + 17;
+  DataStore<int32> dataStore({numValues}, {1}, 0);
+  std::iota(dataStore.begin(), dataStore.end(), 0);
+
+  const auto& constStore = dataStore;
+  const int32* sourceValues = constStore.data();
+  DataStore<int32> dataStore2(dataStore);
+  const auto& constStore2 = dataStore2;
+
+  // Only the written page is copied, the other pages are still read from the copied store
+  dataStore2[k_PageSize + 3] = -1;
+  REQUIRE(dataStore2.isShared());
+  REQUIRE(&constStore2[0] == &constStore[0]);
+  REQUIRE(&constStore2[k_PageSize] != &constStore[k_PageSize]);
+  REQUIRE(constStore[k_PageSize + 3] == static_cast<int32>(k_PageSize + 3));
+  REQUIRE(constStore2[k_PageSize + 3] == -1);
+
+  // Copying a partially copied store shares both the original and the copied pages
+  DataStore<int32> dataStore3(dataStore2);
+  const auto& constStore3 = dataStore3;
+  REQUIRE(&constStore3[0] == &constStore[0]);
+  REQUIRE(constStore3[k_PageSize + 3] == -1);
+
+  std::vector<int32> buffer(numValues);
+  REQUIRE(constStore2.copyIntoBuffer(0, nonstd::span<int32>(buffer)).valid());
+  for(usize i = 0; i < numValues; i++)
+  {
+    REQUIRE(buffer[i] == (i == k_PageSize + 3 ? -1 : static_cast<int32>(i)));
+  }
+
+  // Contiguous access copies the remaining pages
+  int32* values = dataStore2.data();
+  REQUIRE(!dataStore2.isShared());
+  REQUIRE(values[k_PageSize + 3] == -1);
+  REQUIRE(values[numValues - 1] == static_cast<int32>(numValues - 1));
+  REQUIRE(constStore[numValues - 1] == static_cast<int32>(numValues - 1));
+  REQUIRE(constStore3[numValues - 1] == static_cast<int32>(numValues - 1));
+  REQUIRE(constStore3[k_PageSize + 3] == -1);
+
+  // The copied store preserves a page for its copies before writing to it
+  dataStore[1] = -2;
+  REQUIRE(constStore.data() == sourceValues);
+  REQUIRE(constStore[1] == -2);
+  REQUIRE(constStore3[1] == 1);
+  REQUIRE(&constStore3[0] != &constStore[0]);
+  REQUIRE(&constStore3[2 * k_PageSize] == &constStore[2 * k_PageSize]);
+
+  // Copies made without a write in between read the same preserved page
+  DataStore<int32> dataStore4(dataStore);
+  DataStore<int32> dataStore5(dataStore);
+  const auto& constStore4 = dataStore4;
+  const auto& constStore5 = dataStore5;
+  dataStore[2 * k_PageSize] = -3;
+  REQUIRE(constStore4[2 * k_PageSize] == static_cast<int32>(2 * k_PageSize));
+  REQUIRE(&constStore4[2 * k_PageSize] == &constStore5[2 * k_PageSize]);
+  REQUIRE(&constStore4[2 * k_PageSize] != &constStore[2 * k_PageSize]);
+}
+
+TEST_CASE("Copy-On-Write DataStore Concurrent Access", "DataArray")
+{
+  constexpr usize k_PageSize = DataStore<int32>::k_CopyOnWritePageSize;
+  const usize numValues = k_PageSize * 16;
+  DataStore<int32> dataStore({numValues}, {1}, 0);
+  std::iota(dataStore.begin(), dataStore.end(), 0);
+  DataStore<int32> dataStore2(dataStore);
+  const auto& constStore2 = dataStore2;
+
+  // Writers touch the first value of alternating pages, detaching them one at a time while readers
+  // scan the remaining values and must always see i at index i
+  std::atomic<usize> mismatches = 0;
+  std::vector<std::thread> threads;
+  for(usize thread = 0; thread < 4; thread++)
+  {
+    threads.emplace_back([&, thread]() {
+      if(thread % 2 == 0)
+      {
+        for(usize i = (thread / 2) * k_PageSize; i < numValues; i += 2 * k_PageSize)
+        {
+          dataStore2.setValue(i, static_cast<int32>(i));
+        }
+        return;
+      }
+      for(usize i = 0; i < numValues; i++)
+      {
+        if(i % k_PageSize != 0 && constStore2[i] != static_cast<int32>(i))
+        {
+          mismatches++;
+        }
+      }
+    });
+  }
+  for(auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  REQUIRE(mismatches == 0);
+  REQUIRE(!dataStore2.isShared());
+  for(usize i = 0; i < numValues; i++)
+  {
+    REQUIRE(constStore2[i] == static_cast<int32>(i));
+  }
+}
@@ -12,6 +12,7 @@
 #include "simplnx/DataStructure/Geometry/RectGridGeom.hpp"
 #include "simplnx/DataStructure/Geometry/TetrahedralGeom.hpp"
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
+#include "simplnx/DataStructure/NeighborList.hpp"
 #include "simplnx/DataStructure/ScalarData.hpp"
 #include "simplnx/DataStructure/StringArray.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
@@ -22,6 +23,8 @@
 #include <catch2/catch.hpp>
 
 #include <memory>
+#include <numeric>
+#include <thread>
 #include <vector>
 
 using namespace nx::core;
@@ -623,6 +626,64 @@ TEST_CASE("DataPathTest")
   REQUIRE(empty2.value().empty());
 }
 
+TEST_CASE("DataPathCacheTest")
+{
+  DataStructure dataStr;
+  auto group = DataGroup::Create(dataStr, "Foo");
+  auto child1 = DataGroup::Create(dataStr, "Bar1", group->getId());
+  auto child2 = DataGroup::Create(dataStr, "Bar2", group->getId());
+  auto grandchild = DataGroup::Create(dataStr, "Bazz", child1->getId());
+
+  const DataPath gcPath({"Foo", "Bar1", "Bazz"});
+  const DataPath c1Path({"Foo", "Bar1"});
+  const DataPath c2Path({"Foo", "Bar2"});
+
+  // Repeated lookups are served from the cache and must follow every change to the hierarchy
+  REQUIRE(dataStr.getData(gcPath) == grandchild);
+  REQUIRE(dataStr.getData(gcPath) == grandchild);
+  REQUIRE(dataStr.getData(c2Path) == child2);
+
+  SECTION("rename")
+  {
+    REQUIRE(child1->rename("Temp"));
+    REQUIRE(child2->rename("Bar1"));
+    REQUIRE(child1->rename("Bar2"));
+    REQUIRE(dataStr.getData(c1Path) == child2);
+    REQUIRE(dataStr.getData(c2Path) == child1);
+    REQUIRE(dataStr.getData(gcPath) == nullptr);
+    REQUIRE(dataStr.getData(DataPath({"Foo", "Bar2", "Bazz"})) == grandchild);
+  }
+  SECTION("replace")
+  {
+    REQUIRE(dataStr.removeData(grandchild->getId()));
+    REQUIRE(dataStr.getData(gcPath) == nullptr);
+    auto replacement = DataGroup::Create(dataStr, "Bazz", child1->getId());
+    REQUIRE(dataStr.getData(gcPath) == replacement);
+  }
+  SECTION("reparent")
+  {
+    const auto grandchildId = grandchild->getId();
+    REQUIRE(dataStr.setAdditionalParent(grandchildId, child2->getId()));
+    REQUIRE(dataStr.removeParent(grandchildId, child1->getId()));
+    REQUIRE(dataStr.getData(gcPath) == nullptr);
+    REQUIRE(dataStr.getData(DataPath({"Foo", "Bar2", "Bazz"})) == grandchild);
+  }
+  SECTION("reset ids")
+  {
+    dataStr.resetIds(100);
+    REQUIRE(dataStr.getData(gcPath) == grandchild);
+    REQUIRE(dataStr.getData(c2Path) == child2);
+  }
+  SECTION("copy")
+  {
+    DataStructure copy = dataStr;
+    const DataObject* copiedGrandchild = copy.getData(gcPath);
+    REQUIRE(copiedGrandchild != nullptr);
+    REQUIRE(copiedGrandchild != grandchild);
+    REQUIRE(copiedGrandchild->getId() == grandchild->getId());
+  }
+}
+
 TEST_CASE("LinkedPathTest")
 {
   DataStructure dataStr;
@@ -768,6 +829,133 @@ TEST_CASE("DataStoreTest")
   }
 }
 
+TEST_CASE("NeighborListPackedTest")
+{
+  DataStructure dataStruct;
+  auto* neighborList = NeighborList<int32>::Create(dataStruct, "NeighborList", 0);
+  REQUIRE(neighborList != nullptr);
+
+  // Allocate every list up front and fill the lists independently
+  const std::vector<usize> listSizes = {3, 0, 1, 4};
+  neighborList->allocateLists(listSizes);
+  REQUIRE(neighborList->getNumberOfTuples() == listSizes.size());
+  for(usize i = 0; i < listSizes.size(); i++)
+  {
+    nonstd::span<int32> list = neighborList->getListSpan(i);
+    REQUIRE(list.size() == listSizes[i]);
+    std::iota(list.begin(), list.end(), static_cast<int32>(i * 10));
+  }
+
+  const std::vector<usize> expectedOffsets = {0, 3, 3, 4, 8};
+  REQUIRE(neighborList->getListOffsets() == expectedOffsets);
+
+  SECTION("pack")
+  {
+    const auto packedLists = neighborList->pack();
+    REQUIRE(packedLists.getNumberOfLists() == listSizes.size());
+    REQUIRE(packedLists.offsets == expectedOffsets);
+    REQUIRE(packedLists.values == std::vector<int32>{0, 1, 2, 20, 30, 31, 32, 33});
+    REQUIRE(packedLists.getList(1).empty());
+    REQUIRE(packedLists.getList(2)[0] == 20);
+  }
+
+  SECTION("unpack")
+  {
+    const std::vector<int32> values = {7, 8, 9};
+    const std::vector<usize> offsets = {0, 1, 1, 3};
+    neighborList->setPackedLists(values, offsets);
+    REQUIRE(neighborList->getNumberOfTuples() == 3);
+    REQUIRE(neighborList->copyOfList(0) == std::vector<int32>{7});
+    REQUIRE(neighborList->at(1).empty());
+    REQUIRE(neighborList->copyOfList(2) == std::vector<int32>{8, 9});
+
+    const std::vector<usize> badOffsets = {0, 4};
+    REQUIRE_THROWS(neighborList->setPackedLists(values, badOffsets));
+  }
+
+  SECTION("lists outlive their neighbors")
+  {
+    auto list = neighborList->getList(3);
+    neighborList->setList(0, std::make_shared<std::vector<int32>>(2, 5));
+    neighborList->addEntry(5, 50);
+    neighborList->clearAllLists();
+    REQUIRE(*list == std::vector<int32>{30, 31, 32, 33});
+  }
+
+  SECTION("deep copy")
+  {
+    auto copy = std::dynamic_pointer_cast<NeighborList<int32>>(neighborList->deepCopy(DataPath({"NeighborListCopy"})));
+    REQUIRE(copy != nullptr);
+    (*neighborList)[0][0] = -1;
+    REQUIRE(copy->getListOffsets() == expectedOffsets);
+    REQUIRE(copy->copyOfList(0) == std::vector<int32>{0, 1, 2});
+    REQUIRE(copy->copyOfList(3) == std::vector<int32>{30, 31, 32, 33});
+  }
+
+  SECTION("set list copies the values")
+  {
+    auto values = std::make_shared<std::vector<int32>>(2, 5);
+    neighborList->setList(1, values);
+    (*values)[0] = -1;
+    REQUIRE(neighborList->copyOfList(1) == std::vector<int32>{5, 5});
+
+    auto list = neighborList->getList(1);
+    (*list)[1] = -1;
+    REQUIRE(neighborList->copyOfList(1) == std::vector<int32>{5, 5});
+  }
+
+  SECTION("shallow copy")
+  {
+    std::unique_ptr<NeighborList<int32>> copy(dynamic_cast<NeighborList<int32>*>(neighborList->shallowCopy()));
+    REQUIRE(copy != nullptr);
+    REQUIRE(copy->at(0).data() == neighborList->at(0).data());
+
+    (*neighborList)[0][0] = -1;
+    neighborList->addEntry(1, 10);
+    REQUIRE(copy->copyOfList(0) == std::vector<int32>{0, 1, 2});
+    REQUIRE(copy->at(1).empty());
+
+    (*copy)[3][0] = -2;
+    REQUIRE(neighborList->copyOfList(3) == std::vector<int32>{30, 31, 32, 33});
+    REQUIRE(copy->copyOfList(3) == std::vector<int32>{-2, 31, 32, 33});
+  }
+
+  SECTION("compact")
+  {
+    neighborList->addEntry(1, 10);
+    neighborList->addEntry(1, 11);
+    neighborList->addEntry(2, 21);
+    REQUIRE(neighborList->getListOffsets() == std::vector<usize>{0, 3, 5, 7, 11});
+
+    neighborList->compact();
+    const auto packedLists = neighborList->pack();
+    REQUIRE(packedLists.values == std::vector<int32>{0, 1, 2, 10, 11, 20, 21, 30, 31, 32, 33});
+    REQUIRE(neighborList->at(1).data() == neighborList->at(0).data() + 3);
+    REQUIRE(neighborList->at(3).data() == neighborList->at(0).data() + 7);
+  }
+
+  SECTION("concurrent overflow")
+  {
+    // Every thread has to receive the same overflowed list
+    constexpr usize k_NumThreads = 8;
+    std::vector<std::vector<int32>*> lists(k_NumThreads, nullptr);
+    std::vector<std::thread> threads;
+    for(usize i = 0; i < k_NumThreads; i++)
+    {
+      threads.emplace_back([neighborList, &lists, i]() { lists[i] = &(*neighborList)[usize{3}]; });
+    }
+    for(auto& thread : threads)
+    {
+      thread.join();
+    }
+    for(const auto* list : lists)
+    {
+      REQUIRE(list == lists.front());
+    }
+    REQUIRE(*lists.front() == std::vector<int32>{30, 31, 32, 33});
+  }
+}
+
 TEST_CASE("DataArrayTest")
 {
   DataStructure dataStr;
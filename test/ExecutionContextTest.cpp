@@ -0,0 +1,132 @@
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/Utilities/ExecutionContext.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#ifdef SIMPLNX_ENABLE_MULTICORE
+#include <tbb/task_arena.h>
+#endif
+
+using namespace nx::core;
+
+namespace
+{
+constexpr usize k_FirstTouchNumValues = ExecutionContext::k_FirstTouchMinimumSize * 3 + 17;
+
+class RecordConcurrencyImpl
+{
+public:
+  RecordConcurrencyImpl(std::atomic<int32>& maxConcurrency, std::atomic<usize>& count)
+  : m_MaxConcurrency(maxConcurrency)
+  , m_Count(count)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+#ifdef SIMPLNX_ENABLE_MULTICORE
+    int32 concurrency = tbb::this_task_arena::max_concurrency();
+    int32 previous = m_MaxConcurrency.load();
+    while(concurrency > previous && !m_MaxConcurrency.compare_exchange_weak(previous, concurrency))
+    {
+    }
+#endif
+    m_Count += range.size();
+  }
+
+private:
+  std::atomic<int32>& m_MaxConcurrency;
+  std::atomic<usize>& m_Count;
+};
+} // namespace
+
+TEST_CASE("ExecutionContextTest: Current context")
+{
+  ExecutionContext context;
+  context.setGrainSize(64);
+  context.setMaxConcurrency(2);
+  REQUIRE(context.getMaxConcurrency() == 2);
+  REQUIRE(context.getConcurrency() <= 2);
+
+  const usize outsideGrainSize = ExecutionContext::Current().getGrainSize();
+  usize insideGrainSize = 0;
+  usize algorithmGrainSize = 0;
+  usize sliceGrainSize = 0;
+  usize blockGrainSize = 0;
+  context.execute([&]() {
+    insideGrainSize = ExecutionContext::Current().getGrainSize();
+    ParallelDataAlgorithm dataAlg;
+    algorithmGrainSize = dataAlg.getGrainSize();
+    // 64 elements round up to 3 slices of 30 elements
+    sliceGrainSize = dataAlg.getGrainSize(30);
+    // Ranges that count blocks set their own grain size, which the context must not override
+    ParallelDataAlgorithm blockAlg;
+    blockAlg.setGrainSize(1);
+    blockGrainSize = blockAlg.getGrainSize(30);
+  });
+  REQUIRE(insideGrainSize == 64);
+  REQUIRE(algorithmGrainSize == 64);
+  REQUIRE(sliceGrainSize == 3);
+  REQUIRE(blockGrainSize == 1);
+  REQUIRE(ExecutionContext::Current().getGrainSize() == outsideGrainSize);
+}
+
+TEST_CASE("ExecutionContextTest: Default context")
+{
+  const ExecutionContext previous = ExecutionContext::Current();
+  // Make sure the thread has cached the default before it is replaced
+  REQUIRE(ExecutionContext::Current().getGrainSize() == previous.getGrainSize());
+
+  ExecutionContext context;
+  context.setGrainSize(previous.getGrainSize() + 17);
+  ExecutionContext::SetDefault(context);
+  REQUIRE(ExecutionContext::Current().getGrainSize() == previous.getGrainSize() + 17);
+
+  usize otherThreadGrainSize = 0;
+  std::thread([&otherThreadGrainSize]() { otherThreadGrainSize = ExecutionContext::Current().getGrainSize(); }).join();
+  REQUIRE(otherThreadGrainSize == previous.getGrainSize() + 17);
+
+  ExecutionContext::SetDefault(previous);
+  REQUIRE(ExecutionContext::Current().getGrainSize() == previous.getGrainSize());
+}
+
+TEST_CASE("ExecutionContextTest: Parallel algorithms stay in the arena")
+{
+  constexpr usize k_NumValues = 100000;
+  ExecutionContext context;
+  context.setMaxConcurrency(2);
+
+  std::atomic<int32> maxConcurrency = 0;
+  std::atomic<usize> count = 0;
+  context.execute([&]() {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, k_NumValues);
+    dataAlg.execute(RecordConcurrencyImpl(maxConcurrency, count));
+  });
+  REQUIRE(count == k_NumValues);
+  REQUIRE(maxConcurrency <= 2);
+}
+
+TEST_CASE("ExecutionContextTest: First touch allocation")
+{
+  ExecutionContext context;
+  context.setFirstTouchAllocation(true);
+  REQUIRE(context.getFirstTouchAllocation());
+
+  std::vector<uint8> touched(k_FirstTouchNumValues, 0);
+  context.initializeBuffer(k_FirstTouchNumValues, [&touched](usize begin, usize end) { std::fill(touched.begin() + begin, touched.begin() + end, static_cast<uint8>(touched[begin] + 1)); });
+  REQUIRE(std::all_of(touched.cbegin(), touched.cend(), [](uint8 value) { return value == 1; }));
+
+  context.execute([]() {
+    DataStore<int32> dataStore({k_FirstTouchNumValues}, {1}, 7);
+    REQUIRE(dataStore[0] == 7);
+    REQUIRE(dataStore[k_FirstTouchNumValues - 1] == 7);
+    REQUIRE(std::count(dataStore.begin(), dataStore.end(), 7) == k_FirstTouchNumValues);
+  });
+}
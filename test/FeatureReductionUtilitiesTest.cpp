@@ -0,0 +1,151 @@
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/Utilities/ExecutionContext.hpp"
+#include "simplnx/Utilities/FeatureReductionUtilities.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+using namespace nx::core;
+namespace fru = nx::core::FeatureReductionUtilities;
+
+namespace
+{
+constexpr usize k_NumFeatures = 7;
+constexpr usize k_NumElements = fru::k_MinElementsPerChunk * 5 + 13;
+
+// Element i belongs to feature (i / 3) % k_NumFeatures and has the values {i, -i}
+DataStore<int32> CreateFeatureIds()
+{
+  DataStore<int32> featureIds({k_NumElements}, {1}, 0);
+  for(usize i = 0; i < k_NumElements; i++)
+  {
+    featureIds[i] = static_cast<int32>((i / 3) % k_NumFeatures);
+  }
+  return featureIds;
+}
+
+DataStore<float32> CreateElementValues()
+{
+  DataStore<float32> values({k_NumElements}, {2}, 0.0f);
+  for(usize i = 0; i < k_NumElements; i++)
+  {
+    values[i * 2] = static_cast<float32>(i) * 0.1f;
+    values[i * 2 + 1] = -static_cast<float32>(i);
+  }
+  return values;
+}
+} // namespace
+
+TEST_CASE("FeatureReductionUtilitiesTest: Reductions")
+{
+  const DataStore<int32> featureIds = CreateFeatureIds();
+  const DataStore<float32> values = CreateElementValues();
+
+  std::vector<uint64> expectedCounts(k_NumFeatures, 0);
+  std::vector<float64> expectedSums(k_NumFeatures * 2, 0.0);
+  std::vector<float32> expectedMins(k_NumFeatures * 2, std::numeric_limits<float32>::max());
+  std::vector<usize> expectedFirsts(k_NumFeatures, fru::k_NoElement);
+  std::vector<usize> expectedLasts(k_NumFeatures, fru::k_NoElement);
+  for(usize i = 0; i < k_NumElements; i++)
+  {
+    const usize featureId = featureIds[i];
+    expectedCounts[featureId]++;
+    if(expectedFirsts[featureId] == fru::k_NoElement)
+    {
+      expectedFirsts[featureId] = i;
+    }
+    expectedLasts[featureId] = i;
+    for(usize comp = 0; comp < 2; comp++)
+    {
+      expectedSums[featureId * 2 + comp] += values[i * 2 + comp];
+      expectedMins[featureId * 2 + comp] = std::min(expectedMins[featureId * 2 + comp], values[i * 2 + comp]);
+    }
+  }
+
+  SECTION("Count")
+  {
+    auto result = fru::FeatureCount(featureIds, k_NumFeatures);
+    REQUIRE(result.valid());
+    REQUIRE(result.value() == expectedCounts);
+  }
+
+  SECTION("Sum, Min and Mean")
+  {
+    auto sumResult = fru::FeatureReduce(featureIds, values, k_NumFeatures, fru::Sum<float32, float64>{});
+    auto minResult = fru::FeatureReduce(featureIds, values, k_NumFeatures, fru::Min<float32>{});
+    auto meanResult = fru::FeatureReduce(featureIds, values, k_NumFeatures, fru::Mean<float32>{});
+    REQUIRE(sumResult.valid());
+    REQUIRE(minResult.valid());
+    REQUIRE(meanResult.valid());
+    REQUIRE(minResult.value() == expectedMins);
+    for(usize i = 0; i < k_NumFeatures * 2; i++)
+    {
+      REQUIRE(sumResult.value()[i] == Approx(expectedSums[i]));
+      REQUIRE(fru::Mean<float32>::GetMean(meanResult.value()[i]) == Approx(expectedSums[i] / static_cast<float64>(expectedCounts[i / 2])));
+    }
+  }
+
+  SECTION("First and Last")
+  {
+    auto firstResult = fru::FeatureReduce(featureIds, values, k_NumFeatures, fru::First<float32>{});
+    auto lastResult = fru::FeatureReduce(featureIds, values, k_NumFeatures, fru::Last<float32>{});
+    REQUIRE(firstResult.valid());
+    REQUIRE(lastResult.valid());
+    for(usize featureId = 0; featureId < k_NumFeatures; featureId++)
+    {
+      REQUIRE(firstResult.value()[featureId * 2].elementIndex == expectedFirsts[featureId]);
+      REQUIRE(firstResult.value()[featureId * 2 + 1].value == values[expectedFirsts[featureId] * 2 + 1]);
+      REQUIRE(lastResult.value()[featureId * 2].elementIndex == expectedLasts[featureId]);
+      REQUIRE(lastResult.value()[featureId * 2 + 1].value == values[expectedLasts[featureId] * 2 + 1]);
+    }
+  }
+
+  SECTION("Same result for every thread count")
+  {
+    auto parallelResult = fru::FeatureReduce(featureIds, values, k_NumFeatures, fru::Sum<float32>{});
+    REQUIRE(parallelResult.valid());
+
+    ExecutionContext context;
+    context.setMaxConcurrency(1);
+    std::vector<float32> serialSums;
+    context.execute([&]() { serialSums = fru::FeatureReduce(featureIds, values, k_NumFeatures, fru::Sum<float32>{}).value(); });
+    REQUIRE(parallelResult.value() == serialSums);
+  }
+
+  SECTION("Invalid feature ids")
+  {
+    DataStore<int32> badFeatureIds = CreateFeatureIds();
+    badFeatureIds[k_NumElements - 2] = static_cast<int32>(k_NumFeatures);
+    badFeatureIds[k_NumElements - 1] = -1;
+    auto result = fru::FeatureCount(badFeatureIds, k_NumFeatures);
+    REQUIRE(result.invalid());
+    REQUIRE(result.errors()[0].code == fru::k_InvalidFeatureIdError);
+    REQUIRE(result.errors()[0].message.find(std::to_string(k_NumElements - 2)) != std::string::npos);
+  }
+}
+
+TEST_CASE("FeatureReductionUtilitiesTest: Broadcast")
+{
+  const DataStore<int32> featureIds = CreateFeatureIds();
+  DataStore<int32> featureValues({k_NumFeatures}, {2}, 0);
+  for(usize featureId = 0; featureId < k_NumFeatures; featureId++)
+  {
+    featureValues[featureId * 2] = static_cast<int32>(featureId * 10);
+    featureValues[featureId * 2 + 1] = -static_cast<int32>(featureId);
+  }
+
+  DataStore<int32> elementValues({k_NumElements}, {2}, 0);
+  REQUIRE(fru::FeatureBroadcast<int32>(featureIds, featureValues, elementValues).valid());
+  for(usize i = 0; i < k_NumElements; i++)
+  {
+    const usize featureId = featureIds[i];
+    REQUIRE(elementValues[i * 2] == featureValues[featureId * 2]);
+    REQUIRE(elementValues[i * 2 + 1] == featureValues[featureId * 2 + 1]);
+  }
+
+  DataStore<int32> wrongComponents({k_NumElements}, {1}, 0);
+  auto result = fru::FeatureBroadcast<int32>(featureIds, featureValues, wrongComponents);
+  REQUIRE(result.invalid());
+  REQUIRE(result.errors()[0].code == fru::k_ComponentCountMismatchError);
+}
@@ -10,9 +10,12 @@
 #include "simplnx/DataStructure/Geometry/TetrahedralGeom.hpp"
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
 #include "simplnx/DataStructure/Geometry/VertexGeom.hpp"
+#include "simplnx/Utilities/TriangleBVH.hpp"
 
 #include <catch2/catch.hpp>
 
+#include <algorithm>
+
 using namespace nx::core;
 
 ////////////////////////////////////
@@ -191,6 +194,23 @@ TEST_CASE("ImageGeomTest")
   {
     REQUIRE(geom->getTypeName() == "ImageGeom");
   }
+  SECTION("element sizes")
+  {
+    geom->setDimensions({4, 3, 2});
+    geom->setSpacing(0.5f, 2.0f, 3.0f);
+    REQUIRE(geom->getElementSize(0) == 3.0f);
+    REQUIRE(geom->getElementSize(3, 2, 1) == 3.0f);
+
+    REQUIRE(geom->findElementSizes(false) == 1);
+    REQUIRE(geom->getElementSizes()->getNumberOfTuples() == 24);
+    REQUIRE((*geom->getElementSizes())[23] == 3.0f);
+
+    geom->setSpacing(1.0f, 2.0f, 3.0f);
+    REQUIRE(geom->findElementSizes(false) == 0);
+    REQUIRE((*geom->getElementSizes())[23] == 3.0f);
+    REQUIRE(geom->findElementSizes(true) == 1);
+    REQUIRE((*geom->getElementSizes())[23] == 6.0f);
+  }
 }
 
 TEST_CASE("QuadGeomTest")
@@ -217,6 +237,34 @@ TEST_CASE("RectGridGeomTest")
   {
     REQUIRE(geom->getTypeName() == "RectGridGeom");
   }
+  SECTION("element sizes")
+  {
+    auto* xBounds = Float32Array::CreateWithStore<Float32DataStore>(dataStructure, "xBounds", {3}, {1});
+    auto* yBounds = Float32Array::CreateWithStore<Float32DataStore>(dataStructure, "yBounds", {2}, {1});
+    auto* zBounds = Float32Array::CreateWithStore<Float32DataStore>(dataStructure, "zBounds", {3}, {1});
+    (*xBounds)[0] = 0.0f;
+    (*xBounds)[1] = 1.0f;
+    (*xBounds)[2] = 3.0f;
+    (*yBounds)[0] = 0.0f;
+    (*yBounds)[1] = 2.0f;
+    (*zBounds)[0] = 0.0f;
+    (*zBounds)[1] = 1.0f;
+    (*zBounds)[2] = 5.0f;
+    geom->setDimensions({2, 1, 2});
+    geom->setBounds(xBounds, yBounds, zBounds);
+
+    REQUIRE(geom->getElementSize(0) == 2.0f);
+    REQUIRE(geom->getElementSize(1, 0, 0) == 4.0f);
+    REQUIRE(geom->getElementSize(2) == 8.0f);
+    REQUIRE(geom->getElementSize(1, 0, 1) == 16.0f);
+
+    REQUIRE(geom->findElementSizes(false) == 1);
+    REQUIRE((*geom->getElementSizes())[3] == 16.0f);
+
+    (*xBounds)[2] = 2.0f;
+    REQUIRE(geom->findElementSizes(true) == 1);
+    REQUIRE((*geom->getElementSizes())[3] == 8.0f);
+  }
 }
 
 TEST_CASE("TetrahedralGeomTest")
@@ -245,6 +293,141 @@ TEST_CASE("TriangleGeomTest")
   }
 }
 
+TEST_CASE("TriangleGeomBVHTest")
+{
+  // A flat grid of k_Dim x k_Dim unit squares in the z = 0 plane, split into two triangles each
+  constexpr usize k_Dim = 40;
+  constexpr usize k_NumVertices = (k_Dim + 1) * (k_Dim + 1);
+  constexpr usize k_NumTriangles = 2 * k_Dim * k_Dim;
+
+  DataStructure dataStructure;
+  auto geom = createGeom<TriangleGeom>(dataStructure);
+  auto* vertices = IGeometry::SharedVertexList::Create(dataStructure, "Vertices", std::make_unique<DataStore<float32>>(std::vector<usize>{k_NumVertices}, std::vector<usize>{3}, 0.0f),
+                                                       geom->getId());
+  auto* faces = IGeometry::SharedFaceList::Create(dataStructure, "Faces", std::make_unique<DataStore<IGeometry::MeshIndexType>>(std::vector<usize>{k_NumTriangles}, std::vector<usize>{3}, 0),
+                                                  geom->getId());
+  REQUIRE(vertices != nullptr);
+  REQUIRE(faces != nullptr);
+  for(usize y = 0; y <= k_Dim; y++)
+  {
+    for(usize x = 0; x <= k_Dim; x++)
+    {
+      const usize vertex = y * (k_Dim + 1) + x;
+      (*vertices)[3 * vertex + 0] = static_cast<float32>(x);
+      (*vertices)[3 * vertex + 1] = static_cast<float32>(y);
+    }
+  }
+  for(usize y = 0; y < k_Dim; y++)
+  {
+    for(usize x = 0; x < k_Dim; x++)
+    {
+      const usize v00 = y * (k_Dim + 1) + x;
+      const usize v10 = v00 + 1;
+      const usize v01 = v00 + k_Dim + 1;
+      const usize v11 = v01 + 1;
+      const usize triangle = 2 * (y * k_Dim + x);
+      // Lower right triangle followed by the upper left triangle of the square
+      const std::array<usize, 6> corners = {v00, v10, v11, v00, v11, v01};
+      for(usize i = 0; i < 6; i++)
+      {
+        (*faces)[3 * triangle + i] = corners[i];
+      }
+    }
+  }
+  geom->setVertices(*vertices);
+  geom->setFaceList(*faces);
+
+  const std::shared_ptr<const TriangleBVH> bvh = geom->getBVH();
+  REQUIRE(bvh != nullptr);
+  REQUIRE(bvh->getNumberOfTriangles() == k_NumTriangles);
+  REQUIRE(geom->getBVH() == bvh);
+
+  SECTION("closest point")
+  {
+    for(usize y = 0; y < k_Dim; y += 3)
+    {
+      for(usize x = 0; x < k_Dim; x += 7)
+      {
+        const std::array<float32, 3> point = {static_cast<float32>(x) + 0.3f, static_cast<float32>(y) + 0.6f, 2.0f};
+        const TriangleBVH::ClosestPoint closest = bvh->findClosestPoint(point);
+        REQUIRE(closest.triangleId == 2 * (y * k_Dim + x) + 1);
+        REQUIRE(closest.squaredDistance == Approx(4.0f));
+      }
+    }
+
+    // Outside of the grid the closest point is on the boundary
+    const TriangleBVH::ClosestPoint closest = bvh->findClosestPoint({-1.0f, 0.5f, 0.0f});
+    REQUIRE(closest.triangleId == 1);
+    REQUIRE(closest.squaredDistance == Approx(1.0f));
+  }
+
+  SECTION("ray")
+  {
+    const TriangleBVH::RayHit hit = bvh->intersectRay({10.8f, 5.1f, 3.0f}, {0.0f, 0.0f, -1.0f});
+    REQUIRE(hit.triangleId == 2 * (5 * k_Dim + 10));
+    REQUIRE(hit.distance == Approx(3.0f));
+
+    const TriangleBVH::RayHit miss = bvh->intersectRay({10.8f, 5.1f, 3.0f}, {0.0f, 0.0f, 1.0f});
+    REQUIRE(miss.triangleId == TriangleBVH::k_InvalidTriangle);
+  }
+
+  SECTION("box")
+  {
+    std::vector<usize> triangles;
+    bvh->visitBox(BoundingBox3Df(Point3Df(2.2f, 2.2f, -1.0f), Point3Df(2.8f, 2.8f, 1.0f)), [&triangles](usize triangle) {
+      triangles.push_back(triangle);
+      return true;
+    });
+    // Leaves may report extra candidates, but both triangles of the square must be among them
+    const usize square = 2 * k_Dim + 2;
+    REQUIRE(std::find(triangles.begin(), triangles.end(), 2 * square) != triangles.end());
+    REQUIRE(std::find(triangles.begin(), triangles.end(), 2 * square + 1) != triangles.end());
+  }
+
+  SECTION("invalidation")
+  {
+    geom->resizeFaceList(k_NumTriangles / 2);
+    const std::shared_ptr<const TriangleBVH> rebuilt = geom->getBVH();
+    REQUIRE(rebuilt != bvh);
+    REQUIRE(rebuilt->getNumberOfTriangles() == k_NumTriangles / 2);
+
+    geom->invalidateBVH();
+    REQUIRE(geom->getBVH() != rebuilt);
+  }
+
+  SECTION("in place transformation")
+  {
+    // Translate the mesh in place the way ApplyTransformationToGeometry does
+    auto& vertexStore = geom->getVertices()->getDataStoreRef();
+    for(usize vertex = 0; vertex < vertexStore.getNumberOfTuples(); vertex++)
+    {
+      vertexStore[3 * vertex] += 100.0f;
+      vertexStore[3 * vertex + 2] += 5.0f;
+    }
+    // Edits made directly through the data store are not tracked until the geometry is told
+    REQUIRE(geom->getBVH() == bvh);
+    geom->markModified();
+    const std::shared_ptr<const TriangleBVH> transformed = geom->getBVH();
+    REQUIRE(transformed != bvh);
+    REQUIRE(geom->getBVH() == transformed);
+
+    const TriangleBVH::ClosestPoint closest = transformed->findClosestPoint({110.3f, 5.6f, 2.0f});
+    REQUIRE(closest.triangleId == 2 * (5 * k_Dim + 10) + 1);
+    REQUIRE(closest.squaredDistance == Approx(9.0f));
+
+    const TriangleBVH::RayHit hit = transformed->intersectRay({110.8f, 5.1f, 8.0f}, {0.0f, 0.0f, -1.0f});
+    REQUIRE(hit.triangleId == 2 * (5 * k_Dim + 10));
+    REQUIRE(hit.distance == Approx(3.0f));
+
+    // Editing a face through the geometry marks it as modified
+    std::array<usize, 3> faceVertices = {};
+    geom->getFacePointIds(0, faceVertices);
+    faceVertices[2] = faceVertices[1];
+    geom->setFacePointIds(0, faceVertices);
+    REQUIRE(geom->getBVH() != transformed);
+  }
+}
+
 TEST_CASE("VertexGeomTest")
 {
   DataStructure dataStructure;
@@ -0,0 +1,88 @@
+#include "simplnx/Utilities/GridNeighborhood.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstdlib>
+#include <vector>
+
+using namespace nx::core;
+
+namespace
+{
+// Visits every cell of the grid and compares the neighbors against a brute force search of the surrounding 3x3x3 block
+template <GridConnectivity ConnectivityV>
+void RequireNeighborsMatch(const SizeVec3& dims, int64 maxChangedAxes)
+{
+  const GridNeighborhood<ConnectivityV> neighborhood(dims);
+  for(usize z = 0; z < dims[2]; z++)
+  {
+    for(usize y = 0; y < dims[1]; y++)
+    {
+      for(usize x = 0; x < dims[0]; x++)
+      {
+        const usize index = (z * dims[1] + y) * dims[0] + x;
+        std::vector<usize> expected;
+        for(int64 dz = -1; dz <= 1; dz++)
+        {
+          for(int64 dy = -1; dy <= 1; dy++)
+          {
+            for(int64 dx = -1; dx <= 1; dx++)
+            {
+              const int64 changedAxes = std::abs(dx) + std::abs(dy) + std::abs(dz);
+              const int64 neighborX = static_cast<int64>(x) + dx;
+              const int64 neighborY = static_cast<int64>(y) + dy;
+              const int64 neighborZ = static_cast<int64>(z) + dz;
+              const bool inside = neighborX >= 0 && neighborY >= 0 && neighborZ >= 0 && neighborX < static_cast<int64>(dims[0]) && neighborY < static_cast<int64>(dims[1]) &&
+                                  neighborZ < static_cast<int64>(dims[2]);
+              if(changedAxes == 0 || changedAxes > maxChangedAxes || !inside)
+              {
+                continue;
+              }
+              expected.push_back(static_cast<usize>((neighborZ * static_cast<int64>(dims[1]) + neighborY) * static_cast<int64>(dims[0]) + neighborX));
+            }
+          }
+        }
+
+        std::vector<usize> neighbors;
+        neighborhood.forEachNeighbor(index, [&](usize neighborIndex, usize slot) {
+          REQUIRE(slot < GridNeighborhood<ConnectivityV>::k_NumNeighbors);
+          neighbors.push_back(neighborIndex);
+        });
+        REQUIRE(neighbors == expected);
+        REQUIRE(neighborhood.isInterior(index) == (expected.size() == GridNeighborhood<ConnectivityV>::k_NumNeighbors));
+      }
+    }
+  }
+}
+} // namespace
+
+TEST_CASE("SIMPLNX::GridNeighborhood: Face Order", "[Utilities][GridNeighborhood]")
+{
+  using Neighborhood = GridNeighborhood<GridConnectivity::Face>;
+  static_assert(Neighborhood::k_NumNeighbors == 6);
+
+  const Neighborhood neighborhood({5, 4, 3});
+  const std::array<int64, 6> expectedOffsets = {-20, -5, -1, 1, 5, 20};
+  REQUIRE(neighborhood.getOffsets() == expectedOffsets);
+
+  // Slot order is -z, -y, -x, +x, +y, +z
+  std::vector<usize> slots;
+  neighborhood.forEachNeighbor(0, [&](usize, usize slot) { slots.push_back(slot); });
+  REQUIRE(slots == std::vector<usize>{3, 4, 5});
+
+  const auto position = neighborhood.getPosition(33);
+  REQUIRE(position == std::array<usize, 3>{3, 2, 1});
+  REQUIRE(neighborhood.isInterior(33));
+}
+
+TEST_CASE("SIMPLNX::GridNeighborhood: Brute Force", "[Utilities][GridNeighborhood]")
+{
+  static_assert(GridNeighborhood<GridConnectivity::FaceEdge>::k_NumNeighbors == 18);
+  static_assert(GridNeighborhood<GridConnectivity::FaceEdgeVertex>::k_NumNeighbors == 26);
+
+  const SizeVec3 dims = GENERATE(SizeVec3(4, 5, 6), SizeVec3(1, 3, 3), SizeVec3(7, 1, 1), SizeVec3(2, 2, 2));
+
+  RequireNeighborsMatch<GridConnectivity::Face>(dims, 1);
+  RequireNeighborsMatch<GridConnectivity::FaceEdge>(dims, 2);
+  RequireNeighborsMatch<GridConnectivity::FaceEdgeVertex>(dims, 3);
+}
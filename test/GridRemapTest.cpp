@@ -0,0 +1,120 @@
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/Utilities/GridRemap.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace nx::core;
+
+namespace
+{
+// Cell (x, y, z) of the source grid holds the values {x + 1000 * y, z}
+Int32Array* CreateSourceArray(DataStructure& dataStructure, const SizeVec3& dims)
+{
+  auto* sourceArray = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, "Source", {dims[2], dims[1], dims[0]}, {2});
+  for(usize z = 0; z < dims[2]; z++)
+  {
+    for(usize y = 0; y < dims[1]; y++)
+    {
+      for(usize x = 0; x < dims[0]; x++)
+      {
+        const usize index = (z * dims[1] + y) * dims[0] + x;
+        (*sourceArray)[index * 2] = static_cast<int32>(x + 1000 * y);
+        (*sourceArray)[index * 2 + 1] = static_cast<int32>(z);
+      }
+    }
+  }
+  return sourceArray;
+}
+
+void RequireRemapped(const GridRemap& remap, const Int32Array& destArray, int32 unmappedValue)
+{
+  const SizeVec3 destDims = remap.getDestDims();
+  for(usize z = 0; z < destDims[2]; z++)
+  {
+    for(usize y = 0; y < destDims[1]; y++)
+    {
+      for(usize x = 0; x < destDims[0]; x++)
+      {
+        const usize index = (z * destDims[1] + y) * destDims[0] + x;
+        const int64 sourceX = remap.getAxisMap(0)[x];
+        const int64 sourceY = remap.getAxisMap(1)[y];
+        const int64 sourceZ = remap.getAxisMap(2)[z];
+        if(sourceX == GridRemap::k_NoSource || sourceY == GridRemap::k_NoSource || sourceZ == GridRemap::k_NoSource)
+        {
+          REQUIRE(destArray[index * 2] == unmappedValue);
+          continue;
+        }
+        REQUIRE(destArray[index * 2] == sourceX + 1000 * sourceY);
+        REQUIRE(destArray[index * 2 + 1] == sourceZ);
+      }
+    }
+  }
+}
+} // namespace
+
+TEST_CASE("GridRemapTest: Crop")
+{
+  DataStructure dataStructure;
+  const SizeVec3 sourceDims = {37, 21, 300};
+  const auto* sourceArray = CreateSourceArray(dataStructure, sourceDims);
+
+  auto remapResult = GridRemap::Crop(sourceDims, {3, 30, 0, 21, 10, 285});
+  REQUIRE(remapResult.valid());
+  const GridRemap& remap = remapResult.value();
+  REQUIRE(remap.getDestDims() == SizeVec3{27, 21, 275});
+  REQUIRE(remap.getRuns().size() == 1);
+  REQUIRE(remap.getNumberOfSlabs() > 1);
+
+  auto* destArray = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, "Dest", {275, 21, 27}, {2});
+  REQUIRE(remap.copyArrays({{sourceArray, destArray}}).valid());
+  RequireRemapped(remap, *destArray, 0);
+
+  REQUIRE(GridRemap::Crop(sourceDims, {3, 38, 0, 21, 10, 285}).invalid());
+}
+
+TEST_CASE("GridRemapTest: Resample")
+{
+  DataStructure dataStructure;
+  const SizeVec3 sourceDims = {40, 30, 20};
+  const auto* sourceArray = CreateSourceArray(dataStructure, sourceDims);
+
+  const SizeVec3 destDims = {80, 15, 20};
+  auto remapResult = GridRemap::Resample(sourceDims, {1.0f, 1.0f, 1.0f}, destDims, {0.5f, 2.0f, 1.0f});
+  REQUIRE(remapResult.valid());
+  const GridRemap& remap = remapResult.value();
+  REQUIRE(remap.getAxisMap(0)[5] == 2);
+  REQUIRE(remap.getAxisMap(1)[5] == 10);
+
+  auto* destArray = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, "Dest", {20, 15, 80}, {2});
+  REQUIRE(remap.copyArrays({{sourceArray, destArray}}).valid());
+  RequireRemapped(remap, *destArray, 0);
+}
+
+TEST_CASE("GridRemapTest: Place")
+{
+  DataStructure dataStructure;
+  const SizeVec3 sourceDims = {10, 6, 4};
+  const auto* sourceArray = CreateSourceArray(dataStructure, sourceDims);
+
+  const SizeVec3 destDims = {25, 6, 4};
+  auto remapResult = GridRemap::Place(sourceDims, destDims, {12, 0, 0}, {true, false, false});
+  REQUIRE(remapResult.valid());
+  const GridRemap& remap = remapResult.value();
+  // Mirrored along x the source occupies destination x 3 to 12, starting with source x 9
+  REQUIRE(remap.getAxisMap(0)[2] == GridRemap::k_NoSource);
+  REQUIRE(remap.getAxisMap(0)[3] == 9);
+  REQUIRE(remap.getAxisMap(0)[12] == 0);
+  REQUIRE(remap.getAxisMap(0)[13] == GridRemap::k_NoSource);
+  REQUIRE(remap.getRuns().size() == 10);
+
+  auto* destArray = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, "Dest", {4, 6, 25}, {2});
+  destArray->fill(-7);
+  REQUIRE(remap.copyArrays({{sourceArray, destArray}}).valid());
+  RequireRemapped(remap, *destArray, -7);
+
+  auto* wrongComponents = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, "WrongComponents", {4, 6, 25}, {1});
+  auto copyResult = remap.copyArrays({{sourceArray, wrongComponents}});
+  REQUIRE(copyResult.invalid());
+  REQUIRE(copyResult.errors()[0].code == GridRemap::k_ComponentMismatchError);
+}
@@ -0,0 +1,117 @@
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/DataStructure/NeighborList.hpp"
+#include "simplnx/Utilities/GroupFeatures.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+using namespace nx::core;
+
+namespace
+{
+/**
+ * @brief Groups two neighboring features when they carry the same label
+ */
+class LabelGrouping : public GroupFeatures
+{
+public:
+  LabelGrouping(const std::atomic_bool& shouldCancel, const IFilter::MessageHandler& mesgHandler, std::vector<int32> labels)
+  : GroupFeatures(shouldCancel, mesgHandler)
+  , m_Labels(std::move(labels))
+  {
+  }
+
+  bool determineGrouping(int32 referenceFeature, int32 neighborFeature) const override
+  {
+    return m_Labels[referenceFeature] == m_Labels[neighborFeature];
+  }
+
+private:
+  std::vector<int32> m_Labels;
+};
+
+// Features 1-2-3-4-5-6 form a chain, feature 7 touches 5 and feature 8 has no neighbors
+NeighborList<int32>& CreateNeighborList(DataStructure& dataStructure, usize numTuples)
+{
+  auto* neighborList = NeighborList<int32>::Create(dataStructure, "NeighborList", numTuples);
+  const std::vector<std::pair<int32, int32>> pairs = {{1, 2}, {2, 3}, {3, 4}, {4, 5}, {5, 6}, {5, 7}};
+  for(const auto& [first, second] : pairs)
+  {
+    if(static_cast<usize>(second) < numTuples)
+    {
+      neighborList->addEntry(first, second);
+      neighborList->addEntry(second, first);
+    }
+  }
+  // addEntry() only grows the list up to the last feature that received a neighbor
+  neighborList->resizeTuples(numTuples);
+  return *neighborList;
+}
+} // namespace
+
+TEST_CASE("GroupFeaturesTest: Parent Ids")
+{
+  constexpr usize k_NumFeatures = 9;
+  const std::atomic_bool shouldCancel = false;
+  const IFilter::MessageHandler messageHandler{[](const IFilter::Message&) {}};
+
+  DataStructure dataStructure;
+  const auto& neighborList = CreateNeighborList(dataStructure, k_NumFeatures);
+
+  // 1,2 and 3 share a label with 5 but 4 breaks the chain so {1,2,3} and {5,7} are separate groups
+  LabelGrouping grouping(shouldCancel, messageHandler, {0, 1, 1, 1, 2, 1, 3, 1, 1});
+  DataStore<int32> featureParentIds({k_NumFeatures}, {1}, -1);
+
+  SECTION("Seed at feature 1")
+  {
+    Result<int32> result = grouping.execute(neighborList, 1, featureParentIds);
+    REQUIRE(result.valid());
+    REQUIRE(result.value() == 6);
+    const std::vector<int32> expected = {0, 1, 1, 1, 2, 3, 4, 3, 5};
+    for(usize i = 0; i < k_NumFeatures; i++)
+    {
+      REQUIRE(featureParentIds[i] == expected[i]);
+    }
+  }
+
+  SECTION("Seed wraps around")
+  {
+    Result<int32> result = grouping.execute(neighborList, k_NumFeatures + 6, featureParentIds);
+    REQUIRE(result.valid());
+    REQUIRE(result.value() == 6);
+    const std::vector<int32> expected = {0, 4, 4, 4, 5, 2, 1, 2, 3};
+    for(usize i = 0; i < k_NumFeatures; i++)
+    {
+      REQUIRE(featureParentIds[i] == expected[i]);
+    }
+  }
+
+  SECTION("Nothing groups")
+  {
+    LabelGrouping unique(shouldCancel, messageHandler, {0, 1, 2, 3, 4, 5, 6, 7, 8});
+    Result<int32> result = unique.execute(neighborList, 1, featureParentIds);
+    REQUIRE(result.valid());
+    REQUIRE(result.value() == static_cast<int32>(k_NumFeatures));
+    for(usize i = 0; i < k_NumFeatures; i++)
+    {
+      REQUIRE(featureParentIds[i] == static_cast<int32>(i));
+    }
+  }
+}
+
+TEST_CASE("GroupFeaturesTest: Short Neighbor List")
+{
+  const std::atomic_bool shouldCancel = false;
+  const IFilter::MessageHandler messageHandler{[](const IFilter::Message&) {}};
+
+  DataStructure dataStructure;
+  const auto& neighborList = CreateNeighborList(dataStructure, 4);
+
+  LabelGrouping grouping(shouldCancel, messageHandler, {0, 1, 1, 1, 1, 1});
+  DataStore<int32> featureParentIds({6}, {1}, -1);
+  Result<int32> result = grouping.execute(neighborList, 1, featureParentIds);
+  REQUIRE(result.invalid());
+  REQUIRE(result.errors()[0].code == -23600);
+}
@@ -0,0 +1,240 @@
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
+#include "simplnx/Utilities/ImageRotationUtilities.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <Eigen/Geometry>
+
+#include <atomic>
+#include <random>
+
+using namespace nx::core;
+using namespace nx::core::ImageRotationUtilities;
+
+namespace
+{
+const SizeVec3 k_SourceDims = {13, 11, 7};
+const FloatVec3 k_SourceSpacing = {0.5f, 0.75f, 1.0f};
+const FloatVec3 k_SourceOrigin = {-2.0f, 1.0f, 3.0f};
+
+Matrix4fR CreateTransformationMatrix(const Eigen::Vector3f& axis)
+{
+  Matrix4fR transformationMatrix = Matrix4fR::Identity();
+  transformationMatrix.block<3, 3>(0, 0) = Eigen::AngleAxisf(0.6f, axis.normalized()).toRotationMatrix();
+  transformationMatrix(0, 3) = 1.5f;
+  transformationMatrix(2, 3) = -0.5f;
+  return transformationMatrix;
+}
+
+template <typename T>
+DataArray<T>* CreateSourceArray(DataStructure& dataStructure, const std::string& name, usize numComps)
+{
+  auto* sourceArray = DataArray<T>::template CreateWithStore<DataStore<T>>(dataStructure, name, {k_SourceDims[2], k_SourceDims[1], k_SourceDims[0]}, {numComps});
+  std::mt19937 generator(1234);
+  std::uniform_int_distribution<int32> distribution(0, 200);
+  for(usize i = 0; i < sourceArray->getSize(); i++)
+  {
+    (*sourceArray)[i] = static_cast<T>(distribution(generator));
+  }
+  return sourceArray;
+}
+
+ImageGeom* CreateGeometry(DataStructure& dataStructure, const std::string& name, const USizeVec3& dims, const FloatVec3& spacing, const FloatVec3& origin)
+{
+  ImageGeom* imageGeom = ImageGeom::Create(dataStructure, name);
+  imageGeom->setDimensions(dims);
+  imageGeom->setSpacing(spacing);
+  imageGeom->setOrigin(origin);
+  return imageGeom;
+}
+
+/**
+ * @brief The per array nearest neighbor transform that RotationIndexMap replaced.
+ */
+template <typename T>
+void ReferenceNearestNeighbor(const RotateArgs& params, const Matrix4fR& transformationMatrix, bool sliceBySlice, const DataArray<T>& sourceArray, DataArray<T>& targetArray)
+{
+  DataStructure tempDataStructure;
+  const ImageGeom* srcImageGeomPtr = CreateGeometry(tempDataStructure, "source image geom", params.OriginalDims, params.OriginalSpacing, params.OriginalOrigin);
+  const ImageGeom* destImageGeomPtr = CreateGeometry(tempDataStructure, "dest image geom", params.TransformedDims, params.TransformedSpacing, params.TransformedOrigin);
+
+  const Matrix4fR inverseTransform = transformationMatrix.inverse();
+  for(int64 k = 0; k < params.zpNew; k++)
+  {
+    for(int64 j = 0; j < params.ypNew; j++)
+    {
+      for(int64 i = 0; i < params.xpNew; i++)
+      {
+        const int64 newIndex = (params.xpNew * params.ypNew) * k + params.xpNew * j + i;
+        const Point3Df point = destImageGeomPtr->getCoordsf(newIndex);
+        const Eigen::Vector4f coordsNew(point.getX(), point.getY(), point.getZ(), 1.0f);
+        Eigen::Array4f coordsOld = inverseTransform * coordsNew;
+
+        SizeVec3 oldGeomIndices;
+        if(srcImageGeomPtr->computeCellIndex(coordsOld.data(), oldGeomIndices) == ImageGeom::ErrorType::NoError)
+        {
+          if(sliceBySlice)
+          {
+            oldGeomIndices[2] = k;
+          }
+          const usize oldIndex = (params.OriginalDims[0] * params.OriginalDims[1] * oldGeomIndices[2]) + (params.OriginalDims[0] * oldGeomIndices[1]) + oldGeomIndices[0];
+          REQUIRE(targetArray.getDataStoreRef().copyFrom(newIndex, sourceArray.getDataStoreRef(), oldIndex, 1).valid());
+        }
+        else
+        {
+          targetArray.getDataStoreRef().fillTuple(newIndex, 0);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief The per array trilinear transform that RotationIndexMap replaced, including its source index.
+ */
+template <typename T>
+void ReferenceTrilinear(const RotateArgs& params, const Matrix4fR& transformationMatrix, const DataArray<T>& sourceArray, DataArray<T>& targetArray)
+{
+  DataStructure tempDataStructure;
+  const ImageGeom* origImageGeomPtr = CreateGeometry(tempDataStructure, "Temp", params.OriginalDims, params.OriginalSpacing, params.OriginalOrigin);
+  const ImageGeom* destImageGeomPtr = CreateGeometry(tempDataStructure, "dest image geom", params.TransformedDims, params.TransformedSpacing, params.TransformedOrigin);
+
+  const usize numComps = sourceArray.getNumberOfComponents();
+  std::vector<T> pValues(8 * numComps);
+  const Matrix4fR inverseTransform = transformationMatrix.inverse();
+  for(int64 k = 0; k < params.zpNew; k++)
+  {
+    for(int64 j = 0; j < params.ypNew; j++)
+    {
+      for(int64 i = 0; i < params.xpNew; i++)
+      {
+        const int64 newIndex = (params.xpNew * params.ypNew) * k + params.xpNew * j + i;
+        const Point3Df point = destImageGeomPtr->getCoordsf(newIndex);
+        const Eigen::Vector4f coordsNew(point.getX(), point.getY(), point.getZ(), 1.0f);
+        Eigen::Array4f coordsOld = inverseTransform * coordsNew;
+
+        SizeVec3 oldGeomIndices;
+        if(origImageGeomPtr->computeCellIndex(coordsOld.data(), oldGeomIndices) != ImageGeom::ErrorType::NoError)
+        {
+          targetArray.getDataStoreRef().fillTuple(newIndex, static_cast<T>(0));
+          continue;
+        }
+        const usize oldIndex = (params.OriginalDims[0] * params.OriginalDims[1] * oldGeomIndices[2]) + (params.OriginalDims[0] * params.OriginalDims[1]) + oldGeomIndices[0];
+        const Point3Df centerPoint = origImageGeomPtr->getCoordsf(oldIndex);
+        const usize octant = FindOctant(params, centerPoint, coordsOld);
+
+        const Vector3i64 oldIndices(static_cast<int64>(oldGeomIndices[0]), static_cast<int64>(oldGeomIndices[1]), static_cast<int64>(oldGeomIndices[2]));
+        Eigen::Vector3f p1Coord;
+        for(usize p = 0; p < 8; p++)
+        {
+          Vector3i64 pIndices = oldIndices + k_AllOctantOffsets[octant][p];
+          if(p == 0)
+          {
+            p1Coord = {static_cast<float32>(pIndices[0]) * params.xRes + (0.5F * params.xRes) + params.OriginalOrigin[0],
+                       static_cast<float32>(pIndices[1]) * params.yRes + (0.5F * params.yRes) + params.OriginalOrigin[1],
+                       static_cast<float32>(pIndices[2]) * params.zRes + (0.5F * params.zRes) + params.OriginalOrigin[2]};
+          }
+          pIndices[0] = std::clamp<int64>(pIndices[0], 0, params.xp - 1);
+          pIndices[1] = std::clamp<int64>(pIndices[1], 0, params.yp - 1);
+          pIndices[2] = std::clamp<int64>(pIndices[2], 0, params.zp - 1);
+          const usize sourceIndex = (pIndices[2] * params.xp * params.yp) + (pIndices[1] * params.xp) + pIndices[0];
+          for(usize compIndex = 0; compIndex < numComps; compIndex++)
+          {
+            pValues[p * numComps + compIndex] = sourceArray[sourceIndex * numComps + compIndex];
+          }
+        }
+        const float u = coordsOld[0] - p1Coord[0];
+        const float v = coordsOld[1] - p1Coord[1];
+        const float w = coordsOld[2] - p1Coord[2];
+
+        for(usize compIndex = 0; compIndex < numComps; compIndex++)
+        {
+          auto p = [&pValues, numComps, compIndex](usize index) { return pValues[index * numComps + compIndex]; };
+          T value = pValues[0];
+          value += u * (p(1) - p(0));
+          value += v * (p(3) - p(0));
+          value += w * (p(4) - p(0));
+          value += u * v * (p(0) + p(2) - p(1) - p(3));
+          value += u * w * (p(0) + p(5) - p(1) - p(4));
+          value += v * w * (p(0) + p(7) - p(3) - p(4));
+          value += u * v * w * (p(3) + p(1) + p(7) + p(5) - p(0) - p(2) - p(4) - p(6));
+          targetArray.getDataStoreRef().setComponent(newIndex, compIndex, value);
+        }
+      }
+    }
+  }
+}
+
+template <typename T>
+void RequireMatchingArrays(const DataArray<T>& expected, const DataArray<T>& computed)
+{
+  REQUIRE(expected.getSize() == computed.getSize());
+  for(usize i = 0; i < expected.getSize(); i++)
+  {
+    if constexpr(std::is_floating_point_v<T>)
+    {
+      REQUIRE(computed[i] == Approx(expected[i]).margin(1.0e-4));
+    }
+    else
+    {
+      REQUIRE(computed[i] == expected[i]);
+    }
+  }
+}
+} // namespace
+
+TEST_CASE("ImageRotationUtilities: Rotation index map matches the per array transform")
+{
+  // Slice by slice transforms are only used for rotations about the z axis, which keep the number of z slices
+  const bool sliceBySlice = GENERATE(false, true);
+  const Eigen::Vector3f axis = sliceBySlice ? Eigen::Vector3f(0.0f, 0.0f, 1.0f) : Eigen::Vector3f(1.0f, 2.0f, 3.0f);
+
+  DataStructure dataStructure;
+  ImageGeom* sourceGeom = CreateGeometry(dataStructure, "Source Geometry", k_SourceDims, k_SourceSpacing, k_SourceOrigin);
+  const Matrix4fR transformationMatrix = CreateTransformationMatrix(axis);
+  const RotateArgs params = CreateRotationArgs(*sourceGeom, transformationMatrix);
+  const std::vector<usize> transformedTupleShape = {params.TransformedDims[2], params.TransformedDims[1], params.TransformedDims[0]};
+
+  const std::atomic_bool shouldCancel = false;
+  const IFilter::MessageHandler messageHandler{[](const IFilter::Message&) {}};
+  FilterProgressCallback filterCallback(messageHandler, shouldCancel);
+
+  SECTION("Nearest Neighbor")
+  {
+    const auto* sourceArray = CreateSourceArray<uint8>(dataStructure, "Source", 3);
+    auto* expectedArray = UInt8Array::CreateWithStore<UInt8DataStore>(dataStructure, "Expected", transformedTupleShape, {3});
+    auto* computedArray = UInt8Array::CreateWithStore<UInt8DataStore>(dataStructure, "Computed", transformedTupleShape, {3});
+
+    ReferenceNearestNeighbor(params, transformationMatrix, sliceBySlice, *sourceArray, *expectedArray);
+    TransformImageArrays(params, transformationMatrix, InterpolationType::NearestNeighbor, sliceBySlice, {{sourceArray, computedArray}}, filterCallback);
+    RequireMatchingArrays(*expectedArray, *computedArray);
+  }
+  SECTION("Trilinear")
+  {
+    const auto* sourceArray = CreateSourceArray<float32>(dataStructure, "Source", 2);
+    auto* expectedArray = Float32Array::CreateWithStore<Float32DataStore>(dataStructure, "Expected", transformedTupleShape, {2});
+    auto* computedArray = Float32Array::CreateWithStore<Float32DataStore>(dataStructure, "Computed", transformedTupleShape, {2});
+
+    ReferenceTrilinear(params, transformationMatrix, *sourceArray, *expectedArray);
+    TransformImageArrays(params, transformationMatrix, InterpolationType::Trilinear, false, {{sourceArray, computedArray}}, filterCallback);
+    RequireMatchingArrays(*expectedArray, *computedArray);
+  }
+  SECTION("Slabs")
+  {
+    // Computing the map one z slice at a time gives the same sources as the single slab used for this small geometry
+    RotationIndexMap wholeMap(params, transformationMatrix, InterpolationType::NearestNeighbor, sliceBySlice);
+    wholeMap.computeSlab(0, params.zpNew);
+    RotationIndexMap sliceMap(params, transformationMatrix, InterpolationType::NearestNeighbor, sliceBySlice);
+    for(int64 z = 0; z < params.zpNew; z++)
+    {
+      sliceMap.computeSlab(z, z + 1);
+      REQUIRE(sliceMap.getSlabOffset() == static_cast<usize>(z * params.xpNew * params.ypNew));
+      for(usize slabIndex = 0; slabIndex < sliceMap.getSlabSize(); slabIndex++)
+      {
+        REQUIRE(sliceMap.getSourceIndex(slabIndex) == wholeMap.getSourceIndex(sliceMap.getSlabOffset() + slabIndex));
+      }
+    }
+  }
+}
@@ -0,0 +1,427 @@
+#include "simplnx/Core/Application.hpp"
+#include "simplnx/Filter/Actions/CreateArrayAction.hpp"
+#include "simplnx/Parameters/FileSystemPathParameter.hpp"
+#include "simplnx/Pipeline/Pipeline.hpp"
+#include "simplnx/Pipeline/PipelineBatch.hpp"
+#include "simplnx/Plugin/PluginLoader.hpp"
+#include "simplnx/Utilities/Parsing/HDF5/H5.hpp"
+
+#include "simplnx/UnitTest/UnitTestCommon.hpp"
+#include "simplnx/unit_test/simplnx_test_dirs.hpp"
+
+#include <catch2/catch.hpp>
+#include <nlohmann/json.hpp>
+
+#include <filesystem>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+using namespace nx::core;
+
+namespace
+{
+const Uuid k_CreateDataGroupFilterId = *Uuid::FromString("e7d2f9b8-4131-4b28-a843-ea3c6950f101");
+constexpr StringLiteral k_DataObjectPathKey = "data_object_path";
+
+/**
+ * @brief Creates the JSON of a pipeline with two filters that each create a DataGroup.
+ */
+nlohmann::json CreatePipelineJson()
+{
+  auto app = Application::GetOrCreateInstance();
+  app->loadPlugins(unit_test::k_BuildDir.view());
+  auto* filterList = app->getFilterList();
+  REQUIRE(filterList != nullptr);
+
+  Pipeline pipeline;
+  for(const std::string name : {"Group A", "Group B"})
+  {
+    IFilter::UniquePointer filter = filterList->createFilter(k_CreateDataGroupFilterId);
+    REQUIRE(filter != nullptr);
+    Arguments args;
+    args.insert(k_DataObjectPathKey, DataPath({name}));
+    REQUIRE(pipeline.push_back(std::move(filter), args));
+  }
+  return pipeline.toJson();
+}
+
+class ThrowingFilter : public IFilter
+{
+public:
+  static constexpr Uuid k_ID = *Uuid::FromString("3f4c5c9e-2a8d-4f71-9b1e-6d0a7c2e5b14");
+
+  ThrowingFilter() = default;
+  ~ThrowingFilter() override = default;
+
+  std::string name() const override
+  {
+    return "ThrowingFilter";
+  }
+
+  std::string className() const override
+  {
+    return "ThrowingFilter";
+  }
+
+  Uuid uuid() const override
+  {
+    return k_ID;
+  }
+
+  std::string humanName() const override
+  {
+    return "Throwing Filter";
+  }
+
+  std::vector<std::string> defaultTags() const override
+  {
+    return {};
+  }
+
+  Parameters parameters() const override
+  {
+    return {};
+  }
+
+  VersionType parametersVersion() const override
+  {
+    return 1;
+  }
+
+  UniquePointer clone() const override
+  {
+    return std::make_unique<ThrowingFilter>();
+  }
+
+protected:
+  PreflightResult preflightImpl(const DataStructure& dataStructure, const Arguments& args, const MessageHandler& messageHandler, const std::atomic_bool& shouldCancel) const override
+  {
+    return {};
+  }
+
+  Result<> executeImpl(DataStructure& dataStructure, const Arguments& args, const PipelineFilter* pipelineNode, const MessageHandler& messageHandler,
+                       const std::atomic_bool& shouldCancel) const override
+  {
+    throw std::runtime_error("ThrowingFilter failed");
+  }
+};
+
+/**
+ * @brief Creates an array and records how many jobs execute it at the same time and whether
+ * the HDF5 library mutex is held while it executes.
+ */
+class BatchProbeFilter : public IFilter
+{
+public:
+  static constexpr Uuid k_ID = *Uuid::FromString("0b6a3f2e-91d4-4c57-8e1a-2f7c5d9b3e60");
+  static constexpr StringLiteral k_FilePathKey = "file_path";
+
+  static inline std::mutex s_Mutex;
+  static inline int32 s_ActiveCount = 0;
+  static inline int32 s_MaxActiveCount = 0;
+  static inline int32 s_LockedCount = 0;
+
+  static void Reset()
+  {
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    s_ActiveCount = 0;
+    s_MaxActiveCount = 0;
+    s_LockedCount = 0;
+  }
+
+  BatchProbeFilter() = default;
+  ~BatchProbeFilter() override = default;
+
+  std::string name() const override
+  {
+    return "BatchProbeFilter";
+  }
+
+  std::string className() const override
+  {
+    return "BatchProbeFilter";
+  }
+
+  Uuid uuid() const override
+  {
+    return k_ID;
+  }
+
+  std::string humanName() const override
+  {
+    return "Batch Probe Filter";
+  }
+
+  std::vector<std::string> defaultTags() const override
+  {
+    return {};
+  }
+
+  Parameters parameters() const override
+  {
+    Parameters params;
+    params.insert(std::make_unique<FileSystemPathParameter>(k_FilePathKey, "File Path", "The file is never written", std::filesystem::temp_directory_path() / "BatchProbe.txt",
+                                                            FileSystemPathParameter::ExtensionsType{}, FileSystemPathParameter::PathType::OutputFile, true));
+    return params;
+  }
+
+  VersionType parametersVersion() const override
+  {
+    return 1;
+  }
+
+  UniquePointer clone() const override
+  {
+    return std::make_unique<BatchProbeFilter>();
+  }
+
+protected:
+  PreflightResult preflightImpl(const DataStructure& dataStructure, const Arguments& args, const MessageHandler& messageHandler, const std::atomic_bool& shouldCancel) const override
+  {
+    // The array gives the job a memory estimate larger than a one byte budget
+    OutputActions outputActions;
+    outputActions.appendAction(std::make_unique<CreateArrayAction>(DataType::int32, std::vector<usize>{10}, std::vector<usize>{1}, DataPath({"Probe Array"})));
+    return {std::move(outputActions)};
+  }
+
+  Result<> executeImpl(DataStructure& dataStructure, const Arguments& args, const PipelineFilter* pipelineNode, const MessageHandler& messageHandler,
+                       const std::atomic_bool& shouldCancel) const override
+  {
+    // The mutex is recursive, so another thread has to test whether it is held
+    bool isLocked = false;
+    std::thread([&isLocked]() {
+      isLocked = !HDF5::GetLibraryMutex().try_lock();
+      if(!isLocked)
+      {
+        HDF5::GetLibraryMutex().unlock();
+      }
+    }).join();
+
+    {
+      std::lock_guard<std::mutex> lock(s_Mutex);
+      s_MaxActiveCount = std::max(s_MaxActiveCount, ++s_ActiveCount);
+      s_LockedCount += isLocked ? 1 : 0;
+    }
+    std::this_thread::yield();
+    {
+      std::lock_guard<std::mutex> lock(s_Mutex);
+      --s_ActiveCount;
+    }
+    return {};
+  }
+};
+
+class BatchTestPlugin : public AbstractPlugin
+{
+public:
+  static constexpr AbstractPlugin::IdType k_ID = *Uuid::FromString("8b1f0d6a-5e2c-4c3b-a7f9-1e4d2c6b9a03");
+
+  BatchTestPlugin()
+  : AbstractPlugin(k_ID, "BatchTestPlugin", "", "")
+  {
+    addFilter([]() { return std::make_unique<ThrowingFilter>(); });
+    addFilter([]() { return std::make_unique<BatchProbeFilter>(); });
+  }
+  ~BatchTestPlugin() override = default;
+
+  BatchTestPlugin(const BatchTestPlugin&) = delete;
+  BatchTestPlugin(BatchTestPlugin&&) = delete;
+
+  BatchTestPlugin& operator=(const BatchTestPlugin&) = delete;
+  BatchTestPlugin& operator=(BatchTestPlugin&&) = delete;
+
+  SIMPLMapType getSimplToSimplnxMap() const override
+  {
+    return {};
+  }
+};
+
+nlohmann::json CreateOverride(usize filterIndex, const std::string& value)
+{
+  return {{PipelineBatch::k_FilterIndexKey, filterIndex}, {PipelineBatch::k_ParameterKey, k_DataObjectPathKey}, {PipelineBatch::k_ValueKey, value}};
+}
+
+/**
+ * @brief Runs a batch of jobs that each execute one BatchProbeFilter with the given file path.
+ */
+std::vector<PipelineBatch::JobReport> ExecuteProbeBatch(const std::filesystem::path& filePath, usize numJobs, usize maxJobs, uint64 memoryBudget)
+{
+  auto* filterList = Application::GetOrCreateInstance()->getFilterList();
+  filterList->addPlugin(std::make_shared<InMemoryPluginLoader>(std::make_shared<BatchTestPlugin>()));
+  REQUIRE(filterList->containsPlugin(BatchTestPlugin::k_ID));
+
+  Pipeline probePipeline;
+  Arguments args;
+  args.insert(BatchProbeFilter::k_FilePathKey, std::make_any<std::filesystem::path>(filePath));
+  REQUIRE(probePipeline.push_back(std::make_unique<BatchProbeFilter>(), args));
+
+  nlohmann::json manifestJson;
+  manifestJson[PipelineBatch::k_JobsKey] = nlohmann::json::array();
+  for(usize i = 0; i < numJobs; i++)
+  {
+    manifestJson[PipelineBatch::k_JobsKey].push_back(nlohmann::json::object());
+  }
+
+  Result<PipelineBatch> batchResult = PipelineBatch::FromJson(probePipeline.toJson(), manifestJson);
+  SIMPLNX_RESULT_REQUIRE_VALID(batchResult);
+  PipelineBatch& batch = batchResult.value();
+  batch.setMaxConcurrentJobs(maxJobs);
+  batch.setMemoryBudget(memoryBudget);
+
+  BatchProbeFilter::Reset();
+  std::vector<PipelineBatch::JobReport> reports = batch.execute();
+  filterList->removePlugin(BatchTestPlugin::k_ID);
+
+  REQUIRE(reports.size() == numJobs);
+  for(const auto& report : reports)
+  {
+    SIMPLNX_RESULT_REQUIRE_VALID(report.result);
+  }
+  return reports;
+}
+} // namespace
+
+TEST_CASE("PipelineBatch: Overrides")
+{
+  const nlohmann::json pipelineJson = CreatePipelineJson();
+
+  nlohmann::json manifestJson;
+  manifestJson[PipelineBatch::k_JobsKey] = {{{PipelineBatch::k_JobNameKey, "Renamed"}, {PipelineBatch::k_OverridesKey, {CreateOverride(1, "Group C")}}}, nlohmann::json::object()};
+
+  Result<PipelineBatch> batchResult = PipelineBatch::FromJson(pipelineJson, manifestJson);
+  SIMPLNX_RESULT_REQUIRE_VALID(batchResult);
+  const PipelineBatch& batch = batchResult.value();
+  REQUIRE(batch.getJobs().size() == 2);
+  REQUIRE(batch.getJobs()[0].name == "Renamed");
+  REQUIRE(batch.getJobs()[1].name == "Job 1");
+
+  Result<nlohmann::json> jsonResult = batch.createPipelineJson(0);
+  SIMPLNX_RESULT_REQUIRE_VALID(jsonResult);
+  REQUIRE(jsonResult.value()["pipeline"][0]["args"][k_DataObjectPathKey]["value"] == "Group A");
+  REQUIRE(jsonResult.value()["pipeline"][1]["args"][k_DataObjectPathKey]["value"] == "Group C");
+  REQUIRE(jsonResult.value()["pipeline"][1]["args"][k_DataObjectPathKey]["version"] == pipelineJson["pipeline"][1]["args"][k_DataObjectPathKey]["version"]);
+
+  jsonResult = batch.createPipelineJson(1);
+  SIMPLNX_RESULT_REQUIRE_VALID(jsonResult);
+  REQUIRE(jsonResult.value() == pipelineJson);
+
+  SECTION("Invalid filter index")
+  {
+    manifestJson[PipelineBatch::k_JobsKey] = {{{PipelineBatch::k_OverridesKey, {CreateOverride(2, "Group C")}}}};
+    SIMPLNX_RESULT_REQUIRE_INVALID(PipelineBatch::FromJson(pipelineJson, manifestJson));
+  }
+  SECTION("Invalid parameter key")
+  {
+    nlohmann::json overrideJson = CreateOverride(0, "Group C");
+    overrideJson[PipelineBatch::k_ParameterKey] = "not_a_parameter";
+    manifestJson[PipelineBatch::k_JobsKey] = {{{PipelineBatch::k_OverridesKey, {overrideJson}}}};
+    SIMPLNX_RESULT_REQUIRE_INVALID(PipelineBatch::FromJson(pipelineJson, manifestJson));
+  }
+  SECTION("Missing jobs")
+  {
+    SIMPLNX_RESULT_REQUIRE_INVALID(PipelineBatch::FromJson(pipelineJson, nlohmann::json::object()));
+  }
+}
+
+TEST_CASE("PipelineBatch: Execute")
+{
+  const nlohmann::json pipelineJson = CreatePipelineJson();
+
+  constexpr usize k_NumJobs = 8;
+  nlohmann::json jobsJson = nlohmann::json::array();
+  for(usize i = 0; i < k_NumJobs; i++)
+  {
+    // Every third job creates "Group A" twice, which fails in preflight
+    const std::string groupName = i % 3 == 2 ? "Group A" : fmt::format("Group {}", i + 10);
+    jobsJson.push_back({{PipelineBatch::k_JobNameKey, fmt::format("Job_{}", i)}, {PipelineBatch::k_OverridesKey, {CreateOverride(1, groupName)}}});
+  }
+  nlohmann::json manifestJson;
+  manifestJson[PipelineBatch::k_JobsKey] = std::move(jobsJson);
+
+  Result<PipelineBatch> batchResult = PipelineBatch::FromJson(pipelineJson, manifestJson);
+  SIMPLNX_RESULT_REQUIRE_VALID(batchResult);
+  PipelineBatch& batch = batchResult.value();
+  batch.setMaxConcurrentJobs(3);
+  batch.setMemoryBudget(1);
+
+  usize numCallbacks = 0;
+  std::vector<PipelineBatch::JobReport> reports = batch.execute(false, [&numCallbacks](const PipelineBatch::JobReport&) { numCallbacks++; });
+  REQUIRE(numCallbacks == k_NumJobs);
+  REQUIRE(reports.size() == k_NumJobs);
+  for(usize i = 0; i < k_NumJobs; i++)
+  {
+    INFO(fmt::format("Job {}", i));
+    REQUIRE(reports[i].name == fmt::format("Job_{}", i));
+    REQUIRE(reports[i].result.valid() == (i % 3 != 2));
+  }
+
+  nlohmann::json summary = PipelineBatch::CreateSummary(reports);
+  REQUIRE(summary["total_jobs"] == k_NumJobs);
+  REQUIRE(summary["failed_jobs"] == 2);
+  REQUIRE(summary[PipelineBatch::k_JobsKey].size() == k_NumJobs);
+  REQUIRE(summary[PipelineBatch::k_JobsKey][2]["succeeded"] == false);
+  REQUIRE(!summary[PipelineBatch::k_JobsKey][2]["errors"].empty());
+}
+
+TEST_CASE("PipelineBatch: Throwing Job")
+{
+  nlohmann::json pipelineJson = CreatePipelineJson();
+  auto* filterList = Application::GetOrCreateInstance()->getFilterList();
+  filterList->addPlugin(std::make_shared<InMemoryPluginLoader>(std::make_shared<BatchTestPlugin>()));
+  REQUIRE(filterList->containsPlugin(BatchTestPlugin::k_ID));
+
+  Pipeline throwingPipeline;
+  REQUIRE(throwingPipeline.push_back(std::make_unique<ThrowingFilter>()));
+  pipelineJson["pipeline"].push_back(throwingPipeline.toJson()["pipeline"][0]);
+
+  constexpr usize k_NumJobs = 4;
+  nlohmann::json jobsJson = nlohmann::json::array();
+  for(usize i = 0; i < k_NumJobs; i++)
+  {
+    jobsJson.push_back({{PipelineBatch::k_JobNameKey, fmt::format("Job_{}", i)}, {PipelineBatch::k_OverridesKey, {CreateOverride(1, fmt::format("Group {}", i + 10))}}});
+  }
+  nlohmann::json manifestJson;
+  manifestJson[PipelineBatch::k_JobsKey] = std::move(jobsJson);
+
+  Result<PipelineBatch> batchResult = PipelineBatch::FromJson(pipelineJson, manifestJson);
+  SIMPLNX_RESULT_REQUIRE_VALID(batchResult);
+  PipelineBatch& batch = batchResult.value();
+  batch.setMaxConcurrentJobs(2);
+  // Every job needs the whole budget, so a reservation that is never released would block the other jobs forever
+  batch.setMemoryBudget(1);
+
+  std::vector<PipelineBatch::JobReport> reports = batch.execute();
+  filterList->removePlugin(BatchTestPlugin::k_ID);
+
+  REQUIRE(reports.size() == k_NumJobs);
+  for(usize i = 0; i < k_NumJobs; i++)
+  {
+    INFO(fmt::format("Job {}", i));
+    REQUIRE(reports[i].name == fmt::format("Job_{}", i));
+    REQUIRE(reports[i].result.invalid());
+    REQUIRE(reports[i].result.errors()[0].message.find("ThrowingFilter failed") != std::string::npos);
+  }
+}
+
+TEST_CASE("PipelineBatch: Jobs Over The Memory Budget")
+{
+  // Every job needs more than the whole budget, so each one has to wait until it is the only job running
+  ExecuteProbeBatch(std::filesystem::temp_directory_path() / "BatchProbe.txt", 6, 3, 1);
+  REQUIRE(BatchProbeFilter::s_MaxActiveCount == 1);
+}
+
+TEST_CASE("PipelineBatch: HDF5 Filters")
+{
+  SECTION("Text file")
+  {
+    ExecuteProbeBatch(std::filesystem::temp_directory_path() / "BatchProbe.txt", 4, 2, 0);
+    REQUIRE(BatchProbeFilter::s_LockedCount == 0);
+  }
+  SECTION("HDF5 file")
+  {
+    ExecuteProbeBatch(std::filesystem::temp_directory_path() / "BatchProbe.dream3d", 4, 2, 0);
+    REQUIRE(BatchProbeFilter::s_LockedCount == 4);
+    REQUIRE(BatchProbeFilter::s_MaxActiveCount == 1);
+  }
+}
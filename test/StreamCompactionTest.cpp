@@ -0,0 +1,134 @@
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/Utilities/StreamCompaction.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace nx::core;
+
+namespace
+{
+// Spans several blocks and ends in a partial block
+constexpr usize k_NumElements = StreamCompaction::k_BlockSize * 3 + 123;
+
+bool Keep(usize index)
+{
+  return index % 3 != 0 && index % 7 != 0;
+}
+} // namespace
+
+TEST_CASE("SIMPLNX::StreamCompaction: Create", "[Utilities][StreamCompaction]")
+{
+  const StreamCompaction compaction = StreamCompaction::Create(k_NumElements, Keep, {});
+
+  std::vector<usize> expected;
+  for(usize i = 0; i < k_NumElements; i++)
+  {
+    if(Keep(i))
+    {
+      expected.push_back(i);
+    }
+  }
+  REQUIRE(compaction.getNumberOfElements() == k_NumElements);
+  REQUIRE(compaction.getNumberOfKept() == expected.size());
+  REQUIRE(compaction.getKeptIndices() == expected);
+
+  const std::vector<usize> oldToNew = compaction.createOldToNewMap();
+  REQUIRE(oldToNew.size() == k_NumElements);
+  for(usize i = 0; i < k_NumElements; i++)
+  {
+    if(Keep(i))
+    {
+      REQUIRE(expected[oldToNew[i]] == i);
+    }
+    else
+    {
+      REQUIRE(oldToNew[i] == StreamCompaction::k_Removed);
+    }
+  }
+
+  const StreamCompaction none = StreamCompaction::Create(k_NumElements, [](usize) { return false; }, {});
+  REQUIRE(none.getNumberOfKept() == 0);
+  const StreamCompaction empty = StreamCompaction::Create(0, Keep, {});
+  REQUIRE(empty.getNumberOfKept() == 0);
+}
+
+TEST_CASE("SIMPLNX::StreamCompaction: Create From Mask", "[Utilities][StreamCompaction]")
+{
+  BoolDataStore mask({k_NumElements}, {1}, false);
+  for(usize i = 0; i < k_NumElements; i++)
+  {
+    mask[i] = Keep(i);
+  }
+
+  const StreamCompaction compaction = StreamCompaction::Create(k_NumElements, [&mask](usize index) { return mask[index]; }, {&mask});
+  const StreamCompaction expected = StreamCompaction::Create(k_NumElements, Keep, {});
+  REQUIRE(compaction.getKeptIndices() == expected.getKeptIndices());
+}
+
+TEST_CASE("SIMPLNX::StreamCompaction: Copy Arrays", "[Utilities][StreamCompaction]")
+{
+  const StreamCompaction compaction = StreamCompaction::Create(k_NumElements, Keep, {});
+  const usize numKept = compaction.getNumberOfKept();
+
+  DataStructure dataStructure;
+  auto* sourceArray = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, "Source", {k_NumElements}, {2});
+  auto* sourceMask = BoolArray::CreateWithStore<BoolDataStore>(dataStructure, "SourceMask", {k_NumElements}, {1});
+  for(usize i = 0; i < k_NumElements; i++)
+  {
+    (*sourceArray)[i * 2] = static_cast<int32>(i);
+    (*sourceArray)[i * 2 + 1] = -static_cast<int32>(i);
+    (*sourceMask)[i] = i % 2 == 0;
+  }
+  auto* destArray = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, "Dest", {numKept}, {2});
+  auto* destMask = BoolArray::CreateWithStore<BoolDataStore>(dataStructure, "DestMask", {numKept}, {1});
+
+  Result<> result = compaction.copyArrays({{sourceArray, destArray}, {sourceMask, destMask}});
+  REQUIRE(result.valid());
+
+  const std::vector<usize>& keptIndices = compaction.getKeptIndices();
+  for(usize i = 0; i < numKept; i++)
+  {
+    REQUIRE((*destArray)[i * 2] == static_cast<int32>(keptIndices[i]));
+    REQUIRE((*destArray)[i * 2 + 1] == -static_cast<int32>(keptIndices[i]));
+    REQUIRE((*destMask)[i] == (keptIndices[i] % 2 == 0));
+  }
+
+  auto* wrongSize = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, "WrongSize", {numKept + 1}, {2});
+  REQUIRE(compaction.copyArrays({{sourceArray, wrongSize}}).errors()[0].code == StreamCompaction::k_TupleCountMismatchError);
+  REQUIRE(compaction.copyArrays({{sourceArray, destMask}}).errors()[0].code == StreamCompaction::k_ComponentMismatchError);
+}
+
+TEST_CASE("SIMPLNX::StreamCompaction: Connectivity", "[Utilities][StreamCompaction]")
+{
+  // A strip of triangles where triangle i uses vertices i, i + 1 and i + 2
+  constexpr usize k_NumTriangles = 10;
+  constexpr usize k_NumVertices = k_NumTriangles + 2;
+  DataStore<IGeometry::MeshIndexType> triangles({k_NumTriangles}, {3}, 0);
+  for(usize i = 0; i < k_NumTriangles; i++)
+  {
+    triangles[i * 3] = i;
+    triangles[i * 3 + 1] = i + 1;
+    triangles[i * 3 + 2] = i + 2;
+  }
+
+  // Keep triangles 0, 1 and 7 which use vertices 0-3 and 7-9
+  const StreamCompaction triangleCompaction = StreamCompaction::Create(k_NumTriangles, [](usize index) { return index < 2 || index == 7; }, {});
+  auto vertexCompactionResult = StreamCompaction::CreateFromConnectivity(triangles, triangleCompaction, k_NumVertices);
+  REQUIRE(vertexCompactionResult.valid());
+  const StreamCompaction& vertexCompaction = vertexCompactionResult.value();
+  REQUIRE(vertexCompaction.getKeptIndices() == std::vector<usize>{0, 1, 2, 3, 7, 8, 9});
+
+  DataStore<IGeometry::MeshIndexType> reducedTriangles({triangleCompaction.getNumberOfKept()}, {3}, 0);
+  REQUIRE(triangleCompaction.copyConnectivity(triangles, reducedTriangles, vertexCompaction).valid());
+  const std::vector<IGeometry::MeshIndexType> expected = {0, 1, 2, 1, 2, 3, 4, 5, 6};
+  for(usize i = 0; i < expected.size(); i++)
+  {
+    REQUIRE(reducedTriangles[i] == expected[i]);
+  }
+
+  triangles[7 * 3 + 2] = k_NumVertices;
+  auto invalidResult = StreamCompaction::CreateFromConnectivity(triangles, triangleCompaction, k_NumVertices);
+  REQUIRE(invalidResult.invalid());
+  REQUIRE(invalidResult.errors()[0].code == StreamCompaction::k_VertexIndexError);
+}
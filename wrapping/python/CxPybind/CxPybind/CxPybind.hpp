@@ -517,6 +517,16 @@ inline auto MakeAtomicBoolProxyGuard(std::shared_ptr<AtomicBoolProxy>& proxy)
   return MakeScopeGuard([&proxy]() noexcept { proxy->reset(); });
 }
 
+/**
+ * @brief Wraps a filter that is implemented in Python.
+ *
+ * The GIL is only held while Python code of the filter runs. Everything the filter calls back
+ * into, such as C++ filters, pipelines, message handlers and resizing arrays, releases the GIL
+ * again, so C++ filters keep running while the filter works and executions of several Python
+ * filters can overlap. The Python code of different filters still runs one at a time because
+ * all filters share the interpreter of the application, they are not run in sub-interpreters
+ * or worker processes.
+ */
 class PyFilter : public IFilter
 {
 public:
@@ -594,8 +604,8 @@ protected:
   {
     try
     {
+      const Parameters& params = m_Parameters;
       py::gil_scoped_acquire gil;
-      Parameters params = parameters();
       auto shouldCancelProxy = std::make_shared<AtomicBoolProxy>(shouldCancel);
       auto guard = MakeAtomicBoolProxyGuard(shouldCancelProxy);
       auto result =
@@ -616,8 +626,8 @@ protected:
   {
     try
     {
+      const Parameters& params = m_Parameters;
       py::gil_scoped_acquire gil;
-      Parameters params = parameters();
       auto shouldCancelProxy = std::make_shared<AtomicBoolProxy>(shouldCancel);
       auto guard = MakeAtomicBoolProxyGuard(shouldCancelProxy);
       auto result = m_Object
@@ -11,8 +11,10 @@ set(SIMPLNX_PYTHON_TESTS
   "geometry_examples" 
   "import_d3d"      # Dependent on 'basic_ebsd_ipf' running first
   "import_hdf5"     # Dependent on 'basic_ebsd_ipf' running first
+  "numpy_shared_memory"
   "output_file" 
   "pipeline" 
+  "python_filter_concurrency"
   "read_csv_file"
 #  "read_esprit_data"
 )
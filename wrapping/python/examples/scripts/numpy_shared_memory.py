@@ -0,0 +1,104 @@
+"""
+Important Note
+==============
+
+This python file can be used as an example of how to execute a number of DREAM3D-NX
+filters one after another, if you plan to use the codes below (and you are welcome to),
+there are a few things that you, the developer, should take note of:
+
+Import Statements
+-----------------
+
+You will most likely *NOT* need to include the following code:
+
+   .. code:: python
+
+      import simplnx_test_dirs as nxtest
+
+Filter Error Detection
+----------------------
+
+In each section of code a filter is created and executed immediately. This may or
+may *not* be what you want to do. You can also preflight the filter to verify the
+correctness of the filters before executing the filter **although** this is done
+for you when the filter is executed. As such, you will want to check the 'result'
+variable to see if there are any errors or warnings. If there **are** any then
+you, as the developer, should act appropriately on the errors or warnings.
+More specifically, this bit of code:
+
+   .. code:: python
+
+      nxtest.check_filter_result(nx.CreateDataArrayFilter, result)
+
+is used by the simplnx unit testing framework and should be replaced by your own
+error checking code. You are welcome to look up the function definition and use
+that.
+
+"""
+import simplnx as nx
+import simplnx_test_dirs as nxtest
+
+
+import numpy as np
+
+
+#------------------------------------------------------------------------------
+# Shows that NumPy arrays returned by npview() and NumPy arrays adopted with
+# adopt_numpy() keep sharing their memory with the DataArray after a pipeline
+# has copied the DataStructure.
+#------------------------------------------------------------------------------
+data_structure = nx.DataStructure()
+
+view_path = nx.DataPath(['view'])
+adopted_path = nx.DataPath(['adopted'])
+for array_path in [view_path, adopted_path]:
+  result = nx.CreateDataArrayFilter.execute(data_structure,
+                                            numeric_type_index=nx.NumericType.float32,
+                                            component_count=1,
+                                            tuple_dimensions=[[3, 2]],
+                                            output_array_path=array_path,
+                                            initialization_value_str='0')
+  nxtest.check_filter_result(nx.CreateDataArrayFilter, result)
+
+view_data = data_structure[view_path].npview()
+view_data += 90.0
+
+adopted_data = np.full(6, 180.0, dtype=np.float32)
+data_structure[adopted_path].adopt_numpy(adopted_data)
+
+# Snapshot isolation copies the DataStructure after every filter, the copies must not take the shared memory with them
+pipeline = nx.Pipeline()
+pipeline.snapshot_isolation = True
+pipeline.append(nx.CreateDataArrayFilter(), {'numeric_type_index': nx.NumericType.int32,
+                                             'component_count': 1,
+                                             'tuple_dimensions': [[3, 2]],
+                                             'output_array_path': nx.DataPath(['created']),
+                                             'initialization_value_str': '1'})
+pipeline.append(nx.ChangeAngleRepresentationFilter(), {'conversion_type_index': 0, 'angles_array_path': view_path})
+pipeline.append(nx.ChangeAngleRepresentationFilter(), {'conversion_type_index': 0, 'angles_array_path': adopted_path})
+result = pipeline.execute(data_structure)
+assert len(result.errors) == 0
+
+# Writes made by the pipeline are visible through NumPy
+assert np.allclose(view_data, np.radians(90.0))
+assert np.allclose(adopted_data, np.radians(180.0))
+
+# Writes made through NumPy are visible to the DataArrays
+view_data[0] = 1.0
+adopted_data[0] = 2.0
+assert data_structure[view_path].store[0] == 1.0
+assert data_structure[adopted_path].store[0] == 2.0
+
+# Writes made by a filter after the pipeline are visible through NumPy
+for array_path in [view_path, adopted_path]:
+  result = nx.ChangeAngleRepresentationFilter.execute(data_structure, conversion_type_index=1, angles_array_path=array_path)
+  nxtest.check_filter_result(nx.ChangeAngleRepresentationFilter, result)
+assert np.allclose(view_data[0], np.degrees(1.0))
+assert np.allclose(adopted_data[0], np.degrees(2.0))
+assert np.allclose(view_data[1:], 90.0)
+assert np.allclose(adopted_data[1:], 180.0)
+
+print('npview:')
+print(view_data)
+print('adopt_numpy:')
+print(adopted_data)
@@ -0,0 +1,142 @@
+"""
+Important Note
+==============
+
+This python file can be used as an example of how to execute a number of DREAM3D-NX
+filters one after another, if you plan to use the codes below (and you are welcome to),
+there are a few things that you, the developer, should take note of:
+
+Import Statements
+-----------------
+
+You will most likely *NOT* need to include the following code:
+
+   .. code:: python
+
+      import simplnx_test_dirs as nxtest
+
+Filter Error Detection
+----------------------
+
+In each section of code a filter is created and executed immediately. This may or
+may *not* be what you want to do. You can also preflight the filter to verify the
+correctness of the filters before executing the filter **although** this is done
+for you when the filter is executed. As such, you will want to check the 'result'
+variable to see if there are any errors or warnings. If there **are** any then
+you, as the developer, should act appropriately on the errors or warnings.
+More specifically, this bit of code:
+
+   .. code:: python
+
+      nxtest.check_filter_result(nx.CreateDataArrayFilter, result)
+
+is used by the simplnx unit testing framework and should be replaced by your own
+error checking code. You are welcome to look up the function definition and use
+that.
+
+"""
+from typing import List
+import os
+import threading
+
+import simplnx as nx
+import simplnx_test_dirs as nxtest
+
+
+#------------------------------------------------------------------------------
+# Shows that Python filters run alongside each other, both in pipelines that
+# are executed from different Python threads and in a single pipeline that
+# executes independent filters concurrently. Each filter waits until its partner
+# is executing as well, so the script only finishes if both overlap.
+#------------------------------------------------------------------------------
+partner_barrier = threading.Barrier(2, timeout=60)
+
+class WaitForPartnerFilter:
+  OUTPUT_ARRAY_PATH = 'output_array_path'
+
+  def uuid(self) -> nx.Uuid:
+    return nx.Uuid('0b6f5d5e-8d67-4b8f-9d3c-6b0d1e2a7c41')
+
+  def human_name(self) -> str:
+    return 'Wait For Partner (Python)'
+
+  def class_name(self) -> str:
+    return 'WaitForPartnerFilter'
+
+  def name(self) -> str:
+    return 'WaitForPartnerFilter'
+
+  def default_tags(self) -> List[str]:
+    return ['python']
+
+  def clone(self):
+    return WaitForPartnerFilter()
+
+  def parameters(self) -> nx.Parameters:
+    params = nx.Parameters()
+    params.insert(nx.ArrayCreationParameter(WaitForPartnerFilter.OUTPUT_ARRAY_PATH, 'Created Array', 'Set to 1 once the partner filter was reached', nx.DataPath()))
+    return params
+
+  def parameters_version(self) -> int:
+    return 1
+
+  def preflight_impl(self, data_structure: nx.DataStructure, args: dict, message_handler: nx.IFilter.MessageHandler, should_cancel: nx.AtomicBoolProxy) -> nx.IFilter.PreflightResult:
+    output_array_path: nx.DataPath = args[WaitForPartnerFilter.OUTPUT_ARRAY_PATH]
+    output_actions = nx.OutputActions()
+    output_actions.append_action(nx.CreateArrayAction(nx.DataType.int32, [1], [1], output_array_path))
+    return nx.IFilter.PreflightResult(output_actions=output_actions)
+
+  def execute_impl(self, data_structure: nx.DataStructure, args: dict, message_handler: nx.IFilter.MessageHandler, should_cancel: nx.AtomicBoolProxy) -> nx.IFilter.ExecuteResult:
+    output_array_path: nx.DataPath = args[WaitForPartnerFilter.OUTPUT_ARRAY_PATH]
+    try:
+      partner_barrier.wait()
+    except threading.BrokenBarrierError:
+      return nx.Result(errors=[nx.Error(-1, 'The partner filter did not execute at the same time')])
+    data_structure[output_array_path].npview()[0] = 1
+    return nx.Result()
+
+
+def check_partner_arrays(data_structure: nx.DataStructure, array_paths: List[nx.DataPath]):
+  for array_path in array_paths:
+    assert data_structure[array_path].npview()[0] == 1
+
+
+# Two pipelines executed from two Python threads, each with a C++ and a Python filter
+results = {}
+data_structures = {}
+def execute_pipeline(name: str):
+  pipeline = nx.Pipeline(name)
+  pipeline.append(nx.CreateDataArrayFilter(), {'numeric_type_index': nx.NumericType.float32,
+                                               'component_count': 1,
+                                               'tuple_dimensions': [[100, 100, 100]],
+                                               'output_array_path': nx.DataPath(['cpp']),
+                                               'initialization_value_str': '1'})
+  pipeline.append(nx.PyFilter(WaitForPartnerFilter()), {WaitForPartnerFilter.OUTPUT_ARRAY_PATH: nx.DataPath(['python'])})
+  data_structures[name] = nx.DataStructure()
+  results[name] = pipeline.execute(data_structures[name])
+
+threads = [threading.Thread(target=execute_pipeline, args=(name,)) for name in ['first', 'second']]
+for thread in threads:
+  thread.start()
+for thread in threads:
+  thread.join()
+for name in ['first', 'second']:
+  assert len(results[name].errors) == 0, f'{name}: {results[name].errors}'
+  check_partner_arrays(data_structures[name], [nx.DataPath(['python'])])
+
+# One pipeline that runs its two independent Python filters on worker threads, this needs a second core
+if (os.cpu_count() or 1) > 1:
+  partner_barrier.reset()
+  pipeline = nx.Pipeline()
+  pipeline.concurrent_execution = True
+  first_path = nx.DataPath(['first'])
+  second_path = nx.DataPath(['second'])
+  pipeline.append(nx.PyFilter(WaitForPartnerFilter()), {WaitForPartnerFilter.OUTPUT_ARRAY_PATH: first_path})
+  pipeline.append(nx.PyFilter(WaitForPartnerFilter()), {WaitForPartnerFilter.OUTPUT_ARRAY_PATH: second_path})
+  assert pipeline.preflight()
+  data_structure = nx.DataStructure()
+  result = pipeline.execute(data_structure)
+  assert len(result.errors) == 0, f'{result.errors}'
+  check_partner_arrays(data_structure, [first_path, second_path])
+
+print('Python filters executed concurrently')